@@ -810,6 +810,24 @@ class NDArray {
       int Function(ffi.Pointer<ndarrayUnaryDispatchObject>,
           ffi.Pointer<ffi.Pointer<ndarray>>, ffi.Pointer<ffi.Void>)>();
 
+  /// Returns a unary dispatch object for applying a callback to ndarrays having a
+  /// specified data type.
+  ffi.Pointer<ndarrayUnaryDispatchObject> ndarray_unary_clbk_dispatch_object(
+    int dtype,
+  ) {
+    return _ndarray_unary_clbk_dispatch_object(
+      dtype,
+    );
+  }
+
+  late final _ndarray_unary_clbk_dispatch_objectPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Pointer<ndarrayUnaryDispatchObject> Function(ffi.Int16)>>(
+      'ndarray_unary_clbk_dispatch_object');
+  late final _ndarray_unary_clbk_dispatch_object =
+      _ndarray_unary_clbk_dispatch_objectPtr.asFunction<
+          ffi.Pointer<ndarrayUnaryDispatchObject> Function(int)>();
+
   /// Determines the order of a multidimensional array based on a provided
   /// stride array.
   int ndarray_strides2order(
@@ -1041,64 +1059,1492 @@ class NDArray {
     );
   }
 
-  late final _ndarray_function_allocatePtr = _lookup<
-          ffi.NativeFunction<
-              ffi.Pointer<ndarrayFunctionObject> Function(
-                  ffi.Pointer<ffi.Char>,
-                  ffi.Int32,
-                  ffi.Int32,
-                  ffi.Pointer<ndarrayFcn>,
-                  ffi.Int32,
-                  ffi.Pointer<ffi.Int32>,
-                  ffi.Pointer<ffi.Pointer<ffi.Void>>)>>(
-      'ndarray_function_allocate');
-  late final _ndarray_function_allocate =
-      _ndarray_function_allocatePtr.asFunction<
-          ffi.Pointer<ndarrayFunctionObject> Function(
-              ffi.Pointer<ffi.Char>,
-              int,
-              int,
-              ffi.Pointer<ndarrayFcn>,
-              int,
-              ffi.Pointer<ffi.Int32>,
-              ffi.Pointer<ffi.Pointer<ffi.Void>>)>();
-
-  /// Frees an ndarray function object's allocated memory.
-  void ndarray_function_free(
-    ffi.Pointer<ndarrayFunctionObject> obj,
+  late final _ndarray_function_allocatePtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Pointer<ndarrayFunctionObject> Function(
+                  ffi.Pointer<ffi.Char>,
+                  ffi.Int32,
+                  ffi.Int32,
+                  ffi.Pointer<ndarrayFcn>,
+                  ffi.Int32,
+                  ffi.Pointer<ffi.Int32>,
+                  ffi.Pointer<ffi.Pointer<ffi.Void>>)>>(
+      'ndarray_function_allocate');
+  late final _ndarray_function_allocate =
+      _ndarray_function_allocatePtr.asFunction<
+          ffi.Pointer<ndarrayFunctionObject> Function(
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ndarrayFcn>,
+              int,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Pointer<ffi.Pointer<ffi.Void>>)>();
+
+  /// Frees an ndarray function object's allocated memory.
+  void ndarray_function_free(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+  ) {
+    return _ndarray_function_free(
+      obj,
+    );
+  }
+
+  late final _ndarray_function_freePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<ndarrayFunctionObject>)>>('ndarray_function_free');
+  late final _ndarray_function_free = _ndarray_function_freePtr
+      .asFunction<void Function(ffi.Pointer<ndarrayFunctionObject>)>();
+
+  /// Returns the first index of a function whose signature satisfies a provided
+  /// list of array types.
+  int ndarray_function_dispatch_index_of(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+    ffi.Pointer<ffi.Int32> types,
+  ) {
+    return _ndarray_function_dispatch_index_of(
+      obj,
+      types,
+    );
+  }
+
+  late final _ndarray_function_dispatch_index_ofPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int64 Function(ffi.Pointer<ndarrayFunctionObject>,
+              ffi.Pointer<ffi.Int32>)>>('ndarray_function_dispatch_index_of');
+  late final _ndarray_function_dispatch_index_of =
+      _ndarray_function_dispatch_index_ofPtr.asFunction<
+          int Function(
+              ffi.Pointer<ndarrayFunctionObject>, ffi.Pointer<ffi.Int32>)>();
+
+  /// Applies an ndarray function to provided ndarrays, resolving a kernel based
+  /// on the ndarray data types, dimensionality, and memory layout.
+  int ndarray_function_apply(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+    ffi.Pointer<ffi.Pointer<ndarray>> arrays,
+  ) {
+    return _ndarray_function_apply(
+      obj,
+      arrays,
+    );
+  }
+
+  late final _ndarray_function_applyPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarrayFunctionObject>,
+              ffi.Pointer<ffi.Pointer<ndarray>>)>>('ndarray_function_apply');
+  late final _ndarray_function_apply = _ndarray_function_applyPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarrayFunctionObject>, ffi.Pointer<ffi.Pointer<ndarray>>)>();
+
+  /// Returns the index of the least costly function whose signature can be
+  /// satisfied by a provided list of array types when casting is allowed.
+  int ndarray_function_resolve_index_of(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+    ffi.Pointer<ffi.Int32> types,
+    int casting,
+  ) {
+    return _ndarray_function_resolve_index_of(
+      obj,
+      types,
+      casting,
+    );
+  }
+
+  late final _ndarray_function_resolve_index_ofPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int64 Function(ffi.Pointer<ndarrayFunctionObject>,
+              ffi.Pointer<ffi.Int32>, ffi.Int32)>>(
+    'ndarray_function_resolve_index_of');
+  late final _ndarray_function_resolve_index_of =
+      _ndarray_function_resolve_index_ofPtr.asFunction<
+          int Function(
+              ffi.Pointer<ndarrayFunctionObject>, ffi.Pointer<ffi.Int32>, int)>();
+
+  /// Applies an ndarray function to provided ndarrays, converting ndarrays
+  /// whose data types do not match any function signature.
+  int ndarray_function_apply_casting(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+    ffi.Pointer<ffi.Pointer<ndarray>> arrays,
+    int casting,
+  ) {
+    return _ndarray_function_apply_casting(
+      obj,
+      arrays,
+      casting,
+    );
+  }
+
+  late final _ndarray_function_apply_castingPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarrayFunctionObject>,
+              ffi.Pointer<ffi.Pointer<ndarray>>, ffi.Int32)>>(
+    'ndarray_function_apply_casting');
+  late final _ndarray_function_apply_casting =
+      _ndarray_function_apply_castingPtr.asFunction<
+          int Function(ffi.Pointer<ndarrayFunctionObject>,
+              ffi.Pointer<ffi.Pointer<ndarray>>, int)>();
+
+  /// Applies a function to chunks of ndarrays, converting operands to specified
+  /// data types via small scratch buffers.
+  int ndarray_buffered_apply(
+    int nin,
+    int narrays,
+    ffi.Pointer<ffi.Pointer<ndarray>> arrays,
+    ffi.Pointer<ffi.Int32> types,
+    int casting,
+    ndarrayBufferedFcn fcn,
+    ffi.Pointer<ffi.Void> ctx,
+  ) {
+    return _ndarray_buffered_apply(
+      nin,
+      narrays,
+      arrays,
+      types,
+      casting,
+      fcn,
+      ctx,
+    );
+  }
+
+  late final _ndarray_buffered_applyPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Int32,
+              ffi.Int32,
+              ffi.Pointer<ffi.Pointer<ndarray>>,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Int32,
+              ndarrayBufferedFcn,
+              ffi.Pointer<ffi.Void>)>>('ndarray_buffered_apply');
+  late final _ndarray_buffered_apply = _ndarray_buffered_applyPtr.asFunction<
+      int Function(int, int, ffi.Pointer<ffi.Pointer<ndarray>>,
+          ffi.Pointer<ffi.Int32>, int, ndarrayBufferedFcn, ffi.Pointer<ffi.Void>)>();
+
+  /// Registers an alternative ndarray function implementation requiring
+  /// specific CPU features.
+  int ndarray_function_register_variant(
+    ffi.Pointer<ndarrayFunctionObject> obj,
+    int idx,
+    int features,
+    ndarrayFcn fcn,
+  ) {
+    return _ndarray_function_register_variant(
+      obj,
+      idx,
+      features,
+      fcn,
+    );
+  }
+
+  late final _ndarray_function_register_variantPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarrayFunctionObject>, ffi.Int64,
+              ffi.Int64, ndarrayFcn)>>('ndarray_function_register_variant');
+  late final _ndarray_function_register_variant =
+      _ndarray_function_register_variantPtr.asFunction<
+          int Function(
+              ffi.Pointer<ndarrayFunctionObject>, int, int, ndarrayFcn)>();
+
+  /// Returns a bit mask of CPU features supported by the running CPU.
+  int ndarray_cpu_features() {
+    return _ndarray_cpu_features();
+  }
+
+  late final _ndarray_cpu_featuresPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function()>>('ndarray_cpu_features');
+  late final _ndarray_cpu_features =
+      _ndarray_cpu_featuresPtr.asFunction<int Function()>();
+
+  /// Tests whether the running CPU supports a set of CPU features.
+  int ndarray_cpu_has_features(
+    int features,
+  ) {
+    return _ndarray_cpu_has_features(
+      features,
+    );
+  }
+
+  late final _ndarray_cpu_has_featuresPtr =
+      _lookup<ffi.NativeFunction<ffi.Int8 Function(ffi.Int64)>>(
+          'ndarray_cpu_has_features');
+  late final _ndarray_cpu_has_features =
+      _ndarray_cpu_has_featuresPtr.asFunction<int Function(int)>();
+
+  /// Parses a list of CPU feature names.
+  int ndarray_cpu_parse_features(
+    ffi.Pointer<ffi.Char> str,
+  ) {
+    return _ndarray_cpu_parse_features(
+      str,
+    );
+  }
+
+  late final _ndarray_cpu_parse_featuresPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Pointer<ffi.Char>)>>(
+          'ndarray_cpu_parse_features');
+  late final _ndarray_cpu_parse_features = _ndarray_cpu_parse_featuresPtr
+      .asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+
+  /// Registers a user-defined data type.
+  int ndarray_dtype_register(
+    ffi.Pointer<ffi.Char> name,
+    int nbytes,
+    int alignment,
+    ndarrayStridedCastFcn copy,
+  ) {
+    return _ndarray_dtype_register(
+      name,
+      nbytes,
+      alignment,
+      copy,
+    );
+  }
+
+  late final _ndarray_dtype_registerPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int16 Function(ffi.Pointer<ffi.Char>, ffi.Int64, ffi.Int64,
+              ndarrayStridedCastFcn)>>('ndarray_dtype_register');
+  late final _ndarray_dtype_register = _ndarray_dtype_registerPtr.asFunction<
+      int Function(ffi.Pointer<ffi.Char>, int, int, ndarrayStridedCastFcn)>();
+
+  /// Registers a conversion between data types, at least one of which is a
+  /// user-defined data type.
+  int ndarray_dtype_register_cast(
+    int from,
+    int to,
+    ndarrayStridedCastFcn fcn,
+    int casting,
+  ) {
+    return _ndarray_dtype_register_cast(
+      from,
+      to,
+      fcn,
+      casting,
+    );
+  }
+
+  late final _ndarray_dtype_register_castPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Int16, ffi.Int16, ndarrayStridedCastFcn,
+              ffi.Int32)>>('ndarray_dtype_register_cast');
+  late final _ndarray_dtype_register_cast = _ndarray_dtype_register_castPtr
+      .asFunction<int Function(int, int, ndarrayStridedCastFcn, int)>();
+
+  /// Returns the data type number of a registered user-defined data type.
+  int ndarray_dtype_lookup(
+    ffi.Pointer<ffi.Char> name,
+  ) {
+    return _ndarray_dtype_lookup(
+      name,
+    );
+  }
+
+  late final _ndarray_dtype_lookupPtr =
+      _lookup<ffi.NativeFunction<ffi.Int16 Function(ffi.Pointer<ffi.Char>)>>(
+          'ndarray_dtype_lookup');
+  late final _ndarray_dtype_lookup = _ndarray_dtype_lookupPtr
+      .asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+
+  /// Returns the name of a user-defined data type.
+  ffi.Pointer<ffi.Char> ndarray_dtype_name(
+    int dtype,
+  ) {
+    return _ndarray_dtype_name(
+      dtype,
+    );
+  }
+
+  late final _ndarray_dtype_namePtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function(ffi.Int16)>>(
+          'ndarray_dtype_name');
+  late final _ndarray_dtype_name = _ndarray_dtype_namePtr
+      .asFunction<ffi.Pointer<ffi.Char> Function(int)>();
+
+  /// Returns the alignment (in bytes) of a data type.
+  int ndarray_dtype_alignment(
+    int dtype,
+  ) {
+    return _ndarray_dtype_alignment(
+      dtype,
+    );
+  }
+
+  late final _ndarray_dtype_alignmentPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int16)>>(
+          'ndarray_dtype_alignment');
+  late final _ndarray_dtype_alignment =
+      _ndarray_dtype_alignmentPtr.asFunction<int Function(int)>();
+
+  /// Returns a function for converting strided elements from one data type to
+  /// another data type.
+  ndarrayStridedCastFcn ndarray_strided_cast_function(
+    int from,
+    int to,
+  ) {
+    return _ndarray_strided_cast_function(
+      from,
+      to,
+    );
+  }
+
+  late final _ndarray_strided_cast_functionPtr = _lookup<
+      ffi.NativeFunction<
+          ndarrayStridedCastFcn Function(
+              ffi.Int16, ffi.Int16)>>('ndarray_strided_cast_function');
+  late final _ndarray_strided_cast_function = _ndarray_strided_cast_functionPtr
+      .asFunction<ndarrayStridedCastFcn Function(int, int)>();
+
+  /// Assigns the elements of an input ndarray to an output ndarray, converting
+  /// between data types and memory layouts.
+  int ndarray_assign(
+    ffi.Pointer<ndarray> dst,
+    ffi.Pointer<ndarray> src,
+    int casting,
+  ) {
+    return _ndarray_assign(
+      dst,
+      src,
+      casting,
+    );
+  }
+
+  late final _ndarray_assignPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Int32)>>('ndarray_assign');
+  late final _ndarray_assign = _ndarray_assignPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int)>();
+
+  /// Converts a contiguous ndarray to a specified memory layout in-place.
+  int ndarray_relayout(
+    ffi.Pointer<ndarray> arr,
+    int order,
+  ) {
+    return _ndarray_relayout(
+      arr,
+      order,
+    );
+  }
+
+  late final _ndarray_relayoutPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>, ffi.Int32)>>('ndarray_relayout');
+  late final _ndarray_relayout = _ndarray_relayoutPtr
+      .asFunction<int Function(ffi.Pointer<ndarray>, int)>();
+
+  /// Returns the default accumulator data type for reducing ndarray elements.
+  int ndarray_reduce_dtype(
+    int op,
+    int dtype,
+  ) {
+    return _ndarray_reduce_dtype(
+      op,
+      dtype,
+    );
+  }
+
+  late final _ndarray_reduce_dtypePtr =
+      _lookup<ffi.NativeFunction<ffi.Int16 Function(ffi.Int32, ffi.Int16)>>(
+          'ndarray_reduce_dtype');
+  late final _ndarray_reduce_dtype =
+      _ndarray_reduce_dtypePtr.asFunction<int Function(int, int)>();
+
+  /// Resolves the shape of an ndarray reduced along one or more dimensions.
+  int ndarray_reduce_shape(
+    ffi.Pointer<ndarray> x,
+    int naxes,
+    ffi.Pointer<ffi.Int64> axes,
+    int keepdims,
+    ffi.Pointer<ffi.Int64> out,
+  ) {
+    return _ndarray_reduce_shape(
+      x,
+      naxes,
+      axes,
+      keepdims,
+      out,
+    );
+  }
+
+  late final _ndarray_reduce_shapePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int64 Function(ffi.Pointer<ndarray>, ffi.Int64,
+              ffi.Pointer<ffi.Int64>, ffi.Int8, ffi.Pointer<ffi.Int64>)>>(
+    'ndarray_reduce_shape');
+  late final _ndarray_reduce_shape = _ndarray_reduce_shapePtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>, int,
+          ffi.Pointer<ffi.Int64>)>();
+
+  /// Reduces the elements of an input ndarray along one or more dimensions.
+  int ndarray_reduce(
+    int op,
+    ffi.Pointer<ndarray> x,
+    int naxes,
+    ffi.Pointer<ffi.Int64> axes,
+    int keepdims,
+    int acc,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_reduce(
+      op,
+      x,
+      naxes,
+      axes,
+      keepdims,
+      acc,
+      out,
+    );
+  }
+
+  late final _ndarray_reducePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Int32,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Pointer<ffi.Int64>,
+              ffi.Int8,
+              ffi.Int16,
+              ffi.Pointer<ndarray>)>>('ndarray_reduce');
+  late final _ndarray_reduce = _ndarray_reducePtr.asFunction<
+      int Function(int, ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>, int,
+          int, ffi.Pointer<ndarray>)>();
+
+  /// Reduces the elements of an input ndarray along one or more dimensions
+  /// using multiple threads, such that results do not depend on the number of
+  /// threads.
+  int ndarray_reduce_parallel(
+    int op,
+    ffi.Pointer<ndarray> x,
+    int naxes,
+    ffi.Pointer<ffi.Int64> axes,
+    int keepdims,
+    int acc,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_reduce_parallel(
+      op,
+      x,
+      naxes,
+      axes,
+      keepdims,
+      acc,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_reduce_parallelPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Int32,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Pointer<ffi.Int64>,
+              ffi.Int8,
+              ffi.Int16,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_reduce_parallel');
+  late final _ndarray_reduce_parallel = _ndarray_reduce_parallelPtr.asFunction<
+      int Function(int, ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>, int,
+          int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the cumulative sum, product, minimum, or maximum of ndarray
+  /// elements along a specified dimension.
+  int ndarray_scan(
+    int op,
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_scan(
+      op,
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_scanPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Int32, ffi.Pointer<ndarray>, ffi.Int64,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_scan');
+  late final _ndarray_scan = _ndarray_scanPtr.asFunction<
+      int Function(int, ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Returns the linear view index of the first minimum value of an ndarray.
+  int ndarray_argmin(
+    ffi.Pointer<ndarray> x,
+    int policy,
+    ffi.Pointer<ffi.Int64> out,
+  ) {
+    return _ndarray_argmin(
+      x,
+      policy,
+      out,
+    );
+  }
+
+  late final _ndarray_argminPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ffi.Int64>)>>('ndarray_argmin');
+  late final _ndarray_argmin = _ndarray_argminPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>)>();
+
+  /// Returns the linear view index of the first maximum value of an ndarray.
+  int ndarray_argmax(
+    ffi.Pointer<ndarray> x,
+    int policy,
+    ffi.Pointer<ffi.Int64> out,
+  ) {
+    return _ndarray_argmax(
+      x,
+      policy,
+      out,
+    );
+  }
+
+  late final _ndarray_argmaxPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ffi.Int64>)>>('ndarray_argmax');
+  late final _ndarray_argmax = _ndarray_argmaxPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>)>();
+
+  /// Tests whether at least one ndarray element satisfies a predicate.
+  int ndarray_any(
+    ffi.Pointer<ndarray> x,
+    int predicate,
+    ffi.Pointer<ffi.Int8> out,
+  ) {
+    return _ndarray_any(
+      x,
+      predicate,
+      out,
+    );
+  }
+
+  late final _ndarray_anyPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ffi.Int8>)>>('ndarray_any');
+  late final _ndarray_any = _ndarray_anyPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int8>)>();
+
+  /// Tests whether all ndarray elements satisfy a predicate.
+  int ndarray_all(
+    ffi.Pointer<ndarray> x,
+    int predicate,
+    ffi.Pointer<ffi.Int8> out,
+  ) {
+    return _ndarray_all(
+      x,
+      predicate,
+      out,
+    );
+  }
+
+  late final _ndarray_allPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ffi.Int8>)>>('ndarray_all');
+  late final _ndarray_all = _ndarray_allPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int8>)>();
+
+  /// Counts the number of ndarray elements which satisfy a predicate.
+  int ndarray_count(
+    ffi.Pointer<ndarray> x,
+    int predicate,
+    ffi.Pointer<ffi.Int64> out,
+  ) {
+    return _ndarray_count(
+      x,
+      predicate,
+      out,
+    );
+  }
+
+  late final _ndarray_countPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ffi.Int64>)>>('ndarray_count');
+  late final _ndarray_count = _ndarray_countPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>)>();
+
+  /// Initializes accumulated moments.
+  void ndarray_moments_init(
+    ffi.Pointer<ndarrayMoments> states,
+    int n,
+  ) {
+    return _ndarray_moments_init(
+      states,
+      n,
+    );
+  }
+
+  late final _ndarray_moments_initPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ndarrayMoments>,
+              ffi.Int64)>>('ndarray_moments_init');
+  late final _ndarray_moments_init = _ndarray_moments_initPtr
+      .asFunction<void Function(ffi.Pointer<ndarrayMoments>, int)>();
+
+  /// Merges accumulated moments into another set of accumulated moments.
+  void ndarray_moments_merge(
+    ffi.Pointer<ndarrayMoments> state,
+    ffi.Pointer<ndarrayMoments> other,
+  ) {
+    return _ndarray_moments_merge(
+      state,
+      other,
+    );
+  }
+
+  late final _ndarray_moments_mergePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ndarrayMoments>,
+              ffi.Pointer<ndarrayMoments>)>>('ndarray_moments_merge');
+  late final _ndarray_moments_merge = _ndarray_moments_mergePtr.asFunction<
+      void Function(
+          ffi.Pointer<ndarrayMoments>, ffi.Pointer<ndarrayMoments>)>();
+
+  /// Accumulates the moments of ndarray elements along one or more dimensions.
+  int ndarray_moments_update(
+    ffi.Pointer<ndarray> x,
+    int naxes,
+    ffi.Pointer<ffi.Int64> axes,
+    int nthreads,
+    ffi.Pointer<ndarrayMoments> states,
+  ) {
+    return _ndarray_moments_update(
+      x,
+      naxes,
+      axes,
+      nthreads,
+      states,
+    );
+  }
+
+  late final _ndarray_moments_updatePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Pointer<ffi.Int64>,
+              ffi.Int32,
+              ffi.Pointer<ndarrayMoments>)>>('ndarray_moments_update');
+  late final _ndarray_moments_update = _ndarray_moments_updatePtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>, int,
+          ffi.Pointer<ndarrayMoments>)>();
+
+  /// Computes a statistic from accumulated moments.
+  double ndarray_moments_stat(
+    ffi.Pointer<ndarrayMoments> state,
+    int stat,
+    int ddof,
+  ) {
+    return _ndarray_moments_stat(
+      state,
+      stat,
+      ddof,
+    );
+  }
+
+  late final _ndarray_moments_statPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Double Function(ffi.Pointer<ndarrayMoments>, ffi.Int32,
+              ffi.Int64)>>('ndarray_moments_stat');
+  late final _ndarray_moments_stat = _ndarray_moments_statPtr
+      .asFunction<double Function(ffi.Pointer<ndarrayMoments>, int, int)>();
+
+  /// Assigns statistics computed from accumulated moments to an output ndarray.
+  int ndarray_moments_assign(
+    ffi.Pointer<ndarrayMoments> states,
+    int stat,
+    int ddof,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_moments_assign(
+      states,
+      stat,
+      ddof,
+      out,
+    );
+  }
+
+  late final _ndarray_moments_assignPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarrayMoments>, ffi.Int32, ffi.Int64,
+              ffi.Pointer<ndarray>)>>('ndarray_moments_assign');
+  late final _ndarray_moments_assign = _ndarray_moments_assignPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarrayMoments>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes a statistic of ndarray elements along one or more dimensions.
+  int ndarray_moments(
+    int stat,
+    ffi.Pointer<ndarray> x,
+    int naxes,
+    ffi.Pointer<ffi.Int64> axes,
+    int ddof,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_moments(
+      stat,
+      x,
+      naxes,
+      axes,
+      ddof,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_momentsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Int32,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Pointer<ffi.Int64>,
+              ffi.Int64,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_moments');
+  late final _ndarray_moments = _ndarray_momentsPtr.asFunction<
+      int Function(int, ffi.Pointer<ndarray>, int, ffi.Pointer<ffi.Int64>, int,
+          int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the matrix-matrix product `C = alpha*A*B + beta*C` for
+  /// two-dimensional floating-point ndarrays.
+  int ndarray_gemm(
+    double alpha,
+    ffi.Pointer<ndarray> a,
+    ffi.Pointer<ndarray> b,
+    double beta,
+    int nthreads,
+    ffi.Pointer<ndarray> c,
+  ) {
+    return _ndarray_gemm(
+      alpha,
+      a,
+      b,
+      beta,
+      nthreads,
+      c,
+    );
+  }
+
+  late final _ndarray_gemmPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Double, ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>, ffi.Double, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_gemm');
+  late final _ndarray_gemm = _ndarray_gemmPtr.asFunction<
+      int Function(double, ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, double,
+          int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the matrix product of two ndarrays, treating the last two
+  /// dimensions of each ndarray as matrices and broadcasting the remaining
+  /// (leading) dimensions.
+  int ndarray_matmul(
+    ffi.Pointer<ndarray> a,
+    ffi.Pointer<ndarray> b,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_matmul(
+      a,
+      b,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_matmulPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_matmul');
+  late final _ndarray_matmul = _ndarray_matmulPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int, ffi.Pointer<ndarray>)>();
+
+  /// Sorts ndarray elements along a specified dimension.
+  int ndarray_sort(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_sort(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_sortPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_sort');
+  late final _ndarray_sort = _ndarray_sortPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the indices which would sort ndarray elements along a specified
+  /// dimension.
+  int ndarray_argsort(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_argsort(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_argsortPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_argsort');
+  late final _ndarray_argsort = _ndarray_argsortPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Partially sorts ndarray elements along a specified dimension, such that
+  /// the element at a specified position is in its sorted position.
+  int ndarray_partition(
+    ffi.Pointer<ndarray> x,
+    int kth,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_partition(
+      x,
+      kth,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_partitionPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int64,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_partition');
+  late final _ndarray_partition = _ndarray_partitionPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, int, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the indices which would partially sort ndarray elements along a
+  /// specified dimension.
+  int ndarray_argpartition(
+    ffi.Pointer<ndarray> x,
+    int kth,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_argpartition(
+      x,
+      kth,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_argpartitionPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int64,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_argpartition');
+  late final _ndarray_argpartition = _ndarray_argpartitionPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, int, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Selects the `k` smallest (or largest) ndarray elements along a specified
+  /// dimension.
+  int ndarray_topk(
+    ffi.Pointer<ndarray> x,
+    int k,
+    int axis,
+    int largest,
+    int nthreads,
+    ffi.Pointer<ndarray> values,
+    ffi.Pointer<ndarray> indices,
+  ) {
+    return _ndarray_topk(
+      x,
+      k,
+      axis,
+      largest,
+      nthreads,
+      values,
+      indices,
+    );
+  }
+
+  late final _ndarray_topkPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Int64,
+              ffi.Int8,
+              ffi.Int32,
+              ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>)>>('ndarray_topk');
+  late final _ndarray_topk = _ndarray_topkPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, int, int,
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the quantile of ndarray elements along a specified dimension.
+  int ndarray_quantile(
+    ffi.Pointer<ndarray> x,
+    double q,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_quantile(
+      x,
+      q,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_quantilePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Double, ffi.Int64,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_quantile');
+  late final _ndarray_quantile = _ndarray_quantilePtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, double, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the percentile of ndarray elements along a specified dimension.
+  int ndarray_percentile(
+    ffi.Pointer<ndarray> x,
+    double p,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_percentile(
+      x,
+      p,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_percentilePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Double, ffi.Int64,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_percentile');
+  late final _ndarray_percentile = _ndarray_percentilePtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, double, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the histogram of ndarray elements using equal-width bins
+  /// spanning a specified range.
+  int ndarray_histogram(
+    ffi.Pointer<ndarray> x,
+    int nbins,
+    double lo,
+    double hi,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_histogram(
+      x,
+      nbins,
+      lo,
+      hi,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_histogramPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Double,
+              ffi.Double, ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_histogram');
+  late final _ndarray_histogram = _ndarray_histogramPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, double, double, int,
+          ffi.Pointer<ndarray>)>();
+
+  /// Computes the histogram of ndarray elements using specified bin edges.
+  int ndarray_histogram_edges(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> edges,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_histogram_edges(
+      x,
+      edges,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_histogram_edgesPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Int32, ffi.Pointer<ndarray>)>>('ndarray_histogram_edges');
+  late final _ndarray_histogram_edges = _ndarray_histogram_edgesPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int,
+          ffi.Pointer<ndarray>)>();
+
+  /// Counts the number of occurrences of each non-negative integer value in an
+  /// ndarray.
+  int ndarray_bincount(
+    ffi.Pointer<ndarray> x,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_bincount(
+      x,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_bincountPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_bincount');
+  late final _ndarray_bincount = _ndarray_bincountPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, ffi.Pointer<ndarray>)>();
+
+  /// Adds the elements of two ndarrays as complex numbers.
+  int ndarray_complex_add(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> y,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_add(
+      x,
+      y,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_addPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>)>>('ndarray_complex_add');
+  late final _ndarray_complex_add = _ndarray_complex_addPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Subtracts the elements of one ndarray from the elements of another ndarray
+  /// as complex numbers.
+  int ndarray_complex_sub(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> y,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_sub(
+      x,
+      y,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_subPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>)>>('ndarray_complex_sub');
+  late final _ndarray_complex_sub = _ndarray_complex_subPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Multiplies the elements of two ndarrays as complex numbers.
+  int ndarray_complex_mul(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> y,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_mul(
+      x,
+      y,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_mulPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>)>>('ndarray_complex_mul');
+  late final _ndarray_complex_mul = _ndarray_complex_mulPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Divides the elements of one ndarray by the elements of another ndarray as
+  /// complex numbers.
+  int ndarray_complex_div(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> y,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_div(
+      x,
+      y,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_divPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>)>>('ndarray_complex_div');
+  late final _ndarray_complex_div = _ndarray_complex_divPtr.asFunction<
+      int Function(
+          ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the complex conjugate of each ndarray element.
+  int ndarray_complex_conj(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_conj(
+      x,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_conjPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>>('ndarray_complex_conj');
+  late final _ndarray_complex_conj = _ndarray_complex_conjPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the complex exponential of each ndarray element.
+  int ndarray_complex_exp(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_exp(
+      x,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_expPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>>('ndarray_complex_exp');
+  late final _ndarray_complex_exp = _ndarray_complex_expPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the absolute value (modulus) of each ndarray element as a complex
+  /// number.
+  int ndarray_complex_abs(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_abs(
+      x,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_absPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>>('ndarray_complex_abs');
+  late final _ndarray_complex_abs = _ndarray_complex_absPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the argument (phase angle) of each ndarray element as a complex
+  /// number.
+  int ndarray_complex_arg(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_complex_arg(
+      x,
+      out,
+    );
+  }
+
+  late final _ndarray_complex_argPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>>('ndarray_complex_arg');
+  late final _ndarray_complex_arg = _ndarray_complex_argPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>)>();
+
+  /// Computes the discrete Fourier transform of ndarray elements along a
+  /// specified dimension.
+  int ndarray_fft(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_fft(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_fftPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_fft');
+  late final _ndarray_fft = _ndarray_fftPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the inverse discrete Fourier transform of ndarray elements along
+  /// a specified dimension.
+  int ndarray_ifft(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_ifft(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_ifftPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_ifft');
+  late final _ndarray_ifft = _ndarray_ifftPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the discrete Fourier transform of real-valued ndarray elements
+  /// along a specified dimension, returning the non-negative frequency terms.
+  int ndarray_rfft(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_rfft(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_rfftPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_rfft');
+  late final _ndarray_rfft = _ndarray_rfftPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Computes the inverse of a real-input discrete Fourier transform along a
+  /// specified dimension.
+  int ndarray_irfft(
+    ffi.Pointer<ndarray> x,
+    int axis,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_irfft(
+      x,
+      axis,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_irfftPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Pointer<ndarray>, ffi.Int64, ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_irfft');
+  late final _ndarray_irfft = _ndarray_irfftPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, int, int, ffi.Pointer<ndarray>)>();
+
+  /// Releases cached transform plans.
+  void ndarray_fft_clear_cache() {
+    return _ndarray_fft_clear_cache();
+  }
+
+  late final _ndarray_fft_clear_cachePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>(
+          'ndarray_fft_clear_cache');
+  late final _ndarray_fft_clear_cache =
+      _ndarray_fft_clear_cachePtr.asFunction<void Function()>();
+
+  /// Convolves ndarray elements with a one-dimensional kernel along a specified
+  /// dimension.
+  int ndarray_convolve(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> kernel,
+    int axis,
+    int mode,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_convolve(
+      x,
+      kernel,
+      axis,
+      mode,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_convolvePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Int8,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_convolve');
+  late final _ndarray_convolve = _ndarray_convolvePtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int, int, int,
+          ffi.Pointer<ndarray>)>();
+
+  /// Correlates ndarray elements with a one-dimensional kernel along a specified
+  /// dimension.
+  int ndarray_correlate(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> kernel,
+    int axis,
+    int mode,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_correlate(
+      x,
+      kernel,
+      axis,
+      mode,
+      nthreads,
+      out,
+    );
+  }
+
+  late final _ndarray_correlatePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Int8,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_correlate');
+  late final _ndarray_correlate = _ndarray_correlatePtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int, int, int,
+          ffi.Pointer<ndarray>)>();
+
+  /// Convolves ndarray elements with a two-dimensional kernel along two specified
+  /// dimensions.
+  int ndarray_convolve2d(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> kernel,
+    int axis0,
+    int axis1,
+    int mode,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
   ) {
-    return _ndarray_function_free(
-      obj,
+    return _ndarray_convolve2d(
+      x,
+      kernel,
+      axis0,
+      axis1,
+      mode,
+      nthreads,
+      out,
     );
   }
 
-  late final _ndarray_function_freePtr = _lookup<
+  late final _ndarray_convolve2dPtr = _lookup<
       ffi.NativeFunction<
-          ffi.Void Function(
-              ffi.Pointer<ndarrayFunctionObject>)>>('ndarray_function_free');
-  late final _ndarray_function_free = _ndarray_function_freePtr
-      .asFunction<void Function(ffi.Pointer<ndarrayFunctionObject>)>();
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Int64,
+              ffi.Int8,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_convolve2d');
+  late final _ndarray_convolve2d = _ndarray_convolve2dPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int, int, int,
+          int, ffi.Pointer<ndarray>)>();
+
+  /// Correlates ndarray elements with a two-dimensional kernel along two specified
+  /// dimensions.
+  int ndarray_correlate2d(
+    ffi.Pointer<ndarray> x,
+    ffi.Pointer<ndarray> kernel,
+    int axis0,
+    int axis1,
+    int mode,
+    int nthreads,
+    ffi.Pointer<ndarray> out,
+  ) {
+    return _ndarray_correlate2d(
+      x,
+      kernel,
+      axis0,
+      axis1,
+      mode,
+      nthreads,
+      out,
+    );
+  }
 
-  /// Returns the first index of a function whose signature satisfies a provided
-  /// list of array types.
-  int ndarray_function_dispatch_index_of(
-    ffi.Pointer<ndarrayFunctionObject> obj,
+  late final _ndarray_correlate2dPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(
+              ffi.Pointer<ndarray>,
+              ffi.Pointer<ndarray>,
+              ffi.Int64,
+              ffi.Int64,
+              ffi.Int8,
+              ffi.Int32,
+              ffi.Pointer<ndarray>)>>('ndarray_correlate2d');
+  late final _ndarray_correlate2d = _ndarray_correlate2dPtr.asFunction<
+      int Function(ffi.Pointer<ndarray>, ffi.Pointer<ndarray>, int, int, int,
+          int, ffi.Pointer<ndarray>)>();
+
+  /// Returns the smallest data type to which a list of data types can be
+  /// safely cast.
+  int ndarray_result_type(
+    int N,
     ffi.Pointer<ffi.Int32> types,
   ) {
-    return _ndarray_function_dispatch_index_of(
-      obj,
+    return _ndarray_result_type(
+      N,
       types,
     );
   }
 
-  late final _ndarray_function_dispatch_index_ofPtr = _lookup<
-      ffi.NativeFunction<
-          ffi.Int64 Function(ffi.Pointer<ndarrayFunctionObject>,
-              ffi.Pointer<ffi.Int32>)>>('ndarray_function_dispatch_index_of');
-  late final _ndarray_function_dispatch_index_of =
-      _ndarray_function_dispatch_index_ofPtr.asFunction<
-          int Function(
-              ffi.Pointer<ndarrayFunctionObject>, ffi.Pointer<ffi.Int32>)>();
+  late final _ndarray_result_typePtr = _lookup<
+          ffi.NativeFunction<ffi.Int32 Function(ffi.Int32, ffi.Pointer<ffi.Int32>)>>(
+      'ndarray_result_type');
+  late final _ndarray_result_type = _ndarray_result_typePtr
+      .asFunction<int Function(int, ffi.Pointer<ffi.Int32>)>();
 
   /// Computes the minimum and maximum linear indices (in bytes) in an
   /// underlying data buffer accessible to an array view.
@@ -1360,7 +2806,7 @@ class NDArray {
   }
 
   late final _ndarray_is_allowed_data_type_castPtr = _lookup<
-          ffi.NativeFunction<ffi.Int8 Function(ffi.Int8, ffi.Int8, ffi.Int32)>>(
+          ffi.NativeFunction<ffi.Int8 Function(ffi.Int16, ffi.Int16, ffi.Int32)>>(
       'ndarray_is_allowed_data_type_cast');
   late final _ndarray_is_allowed_data_type_cast =
       _ndarray_is_allowed_data_type_castPtr
@@ -1553,7 +2999,7 @@ class NDArray {
   }
 
   late final _ndarray_is_safe_data_type_castPtr =
-      _lookup<ffi.NativeFunction<ffi.Int8 Function(ffi.Int8, ffi.Int8)>>(
+      _lookup<ffi.NativeFunction<ffi.Int8 Function(ffi.Int16, ffi.Int16)>>(
           'ndarray_is_safe_data_type_cast');
   late final _ndarray_is_safe_data_type_cast =
       _ndarray_is_safe_data_type_castPtr.asFunction<int Function(int, int)>();
@@ -1571,7 +3017,7 @@ class NDArray {
   }
 
   late final _ndarray_is_same_kind_data_type_castPtr =
-      _lookup<ffi.NativeFunction<ffi.Int8 Function(ffi.Int8, ffi.Int8)>>(
+      _lookup<ffi.NativeFunction<ffi.Int8 Function(ffi.Int16, ffi.Int16)>>(
           'ndarray_is_same_kind_data_type_cast');
   late final _ndarray_is_same_kind_data_type_cast =
       _ndarray_is_same_kind_data_type_castPtr
@@ -3780,6 +5226,274 @@ class NDArray {
               ffi.Pointer<ndarray>, ffi.Int64, ffi.Bool)>>('ndarray_iset_bool');
   late final _ndarray_iset_bool = _ndarray_iset_boolPtr
       .asFunction<int Function(ffi.Pointer<ndarray>, int, bool)>();
+
+  /// Returns memory accounting statistics for a specified category.
+  int ndarray_memory_stats(
+    int category,
+    ffi.Pointer<ndarrayMemoryStats> out,
+  ) {
+    return _ndarray_memory_stats(
+      category,
+      out,
+    );
+  }
+
+  late final _ndarray_memory_statsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Int8,
+              ffi.Pointer<ndarrayMemoryStats>)>>('ndarray_memory_stats');
+  late final _ndarray_memory_stats = _ndarray_memory_statsPtr
+      .asFunction<int Function(int, ffi.Pointer<ndarrayMemoryStats>)>();
+
+  /// Returns the number of bytes currently allocated for a specified category.
+  int ndarray_memory_bytes(
+    int category,
+  ) {
+    return _ndarray_memory_bytes(
+      category,
+    );
+  }
+
+  late final _ndarray_memory_bytesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int8)>>(
+          'ndarray_memory_bytes');
+  late final _ndarray_memory_bytes =
+      _ndarray_memory_bytesPtr.asFunction<int Function(int)>();
+
+  /// Returns the peak number of bytes allocated for a specified category.
+  int ndarray_memory_peak_bytes(
+    int category,
+  ) {
+    return _ndarray_memory_peak_bytes(
+      category,
+    );
+  }
+
+  late final _ndarray_memory_peak_bytesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int8)>>(
+          'ndarray_memory_peak_bytes');
+  late final _ndarray_memory_peak_bytes =
+      _ndarray_memory_peak_bytesPtr.asFunction<int Function(int)>();
+
+  /// Returns the number of allocations for a specified category.
+  int ndarray_memory_allocations(
+    int category,
+  ) {
+    return _ndarray_memory_allocations(
+      category,
+    );
+  }
+
+  late final _ndarray_memory_allocationsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int8)>>(
+          'ndarray_memory_allocations');
+  late final _ndarray_memory_allocations =
+      _ndarray_memory_allocationsPtr.asFunction<int Function(int)>();
+
+  /// Resets peak byte counts to the number of bytes currently allocated.
+  void ndarray_memory_reset_peak() {
+    return _ndarray_memory_reset_peak();
+  }
+
+  late final _ndarray_memory_reset_peakPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>(
+          'ndarray_memory_reset_peak');
+  late final _ndarray_memory_reset_peak =
+      _ndarray_memory_reset_peakPtr.asFunction<void Function()>();
+
+  /// Sets a callback to invoke when the total number of bytes allocated by the
+  /// library exceeds a threshold.
+  void ndarray_memory_set_hook(
+    int threshold,
+    ndarrayMemoryHook hook,
+    ffi.Pointer<ffi.Void> ctx,
+  ) {
+    return _ndarray_memory_set_hook(
+      threshold,
+      hook,
+      ctx,
+    );
+  }
+
+  late final _ndarray_memory_set_hookPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int64, ndarrayMemoryHook,
+              ffi.Pointer<ffi.Void>)>>('ndarray_memory_set_hook');
+  late final _ndarray_memory_set_hook = _ndarray_memory_set_hookPtr.asFunction<
+      void Function(int, ndarrayMemoryHook, ffi.Pointer<ffi.Void>)>();
+
+  /// Records an allocation in the memory accounting statistics.
+  void ndarray_memory_record_allocation(
+    int category,
+    int nbytes,
+  ) {
+    return _ndarray_memory_record_allocation(
+      category,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_memory_record_allocationPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int8, ffi.Int64)>>(
+          'ndarray_memory_record_allocation');
+  late final _ndarray_memory_record_allocation =
+      _ndarray_memory_record_allocationPtr
+          .asFunction<void Function(int, int)>();
+
+  /// Records a deallocation in the memory accounting statistics.
+  void ndarray_memory_record_free(
+    int category,
+    int nbytes,
+  ) {
+    return _ndarray_memory_record_free(
+      category,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_memory_record_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int8, ffi.Int64)>>(
+          'ndarray_memory_record_free');
+  late final _ndarray_memory_record_free =
+      _ndarray_memory_record_freePtr.asFunction<void Function(int, int)>();
+
+  /// Allocates memory and records the allocation.
+  ffi.Pointer<ffi.Void> ndarray_memory_malloc(
+    int category,
+    int nbytes,
+  ) {
+    return _ndarray_memory_malloc(
+      category,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_memory_mallocPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<ffi.Void> Function(
+              ffi.Int8, ffi.Int64)>>('ndarray_memory_malloc');
+  late final _ndarray_memory_malloc = _ndarray_memory_mallocPtr
+      .asFunction<ffi.Pointer<ffi.Void> Function(int, int)>();
+
+  /// Allocates zero-initialized memory and records the allocation.
+  ffi.Pointer<ffi.Void> ndarray_memory_calloc(
+    int category,
+    int nbytes,
+  ) {
+    return _ndarray_memory_calloc(
+      category,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_memory_callocPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<ffi.Void> Function(
+              ffi.Int8, ffi.Int64)>>('ndarray_memory_calloc');
+  late final _ndarray_memory_calloc = _ndarray_memory_callocPtr
+      .asFunction<ffi.Pointer<ffi.Void> Function(int, int)>();
+
+  /// Frees memory and records the deallocation.
+  void ndarray_memory_free(
+    int category,
+    ffi.Pointer<ffi.Void> ptr,
+    int nbytes,
+  ) {
+    return _ndarray_memory_free(
+      category,
+      ptr,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_memory_freePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int8, ffi.Pointer<ffi.Void>,
+              ffi.Int64)>>('ndarray_memory_free');
+  late final _ndarray_memory_free = _ndarray_memory_freePtr
+      .asFunction<void Function(int, ffi.Pointer<ffi.Void>, int)>();
+
+  /// Returns the default number of threads used by parallel ndarray functions.
+  int ndarray_parallel_num_threads() {
+    return _ndarray_parallel_num_threads();
+  }
+
+  late final _ndarray_parallel_num_threadsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function()>>(
+          'ndarray_parallel_num_threads');
+  late final _ndarray_parallel_num_threads =
+      _ndarray_parallel_num_threadsPtr.asFunction<int Function()>();
+
+  /// Executes a number of independent tasks using a specified number of threads.
+  int ndarray_parallel_for(
+    int n,
+    int nthreads,
+    ndarrayParallelFcn fcn,
+    ffi.Pointer<ffi.Void> ctx,
+  ) {
+    return _ndarray_parallel_for(
+      n,
+      nthreads,
+      fcn,
+      ctx,
+    );
+  }
+
+  late final _ndarray_parallel_forPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Int8 Function(ffi.Int64, ffi.Int32, ndarrayParallelFcn,
+              ffi.Pointer<ffi.Void>)>>('ndarray_parallel_for');
+  late final _ndarray_parallel_for = _ndarray_parallel_forPtr.asFunction<
+      int Function(int, int, ndarrayParallelFcn, ffi.Pointer<ffi.Void>)>();
+
+  /// Returns the number of NUMA nodes available to the current process.
+  int ndarray_buffer_numa_nodes() {
+    return _ndarray_buffer_numa_nodes();
+  }
+
+  late final _ndarray_buffer_numa_nodesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function()>>(
+          'ndarray_buffer_numa_nodes');
+  late final _ndarray_buffer_numa_nodes =
+      _ndarray_buffer_numa_nodesPtr.asFunction<int Function()>();
+
+  /// Returns a pointer to a dynamically allocated, zero-initialized ndarray data
+  /// buffer.
+  ffi.Pointer<ffi.Uint8> ndarray_buffer_allocate(
+    int nbytes,
+    ffi.Pointer<ndarrayBufferOptions> opts,
+  ) {
+    return _ndarray_buffer_allocate(
+      nbytes,
+      opts,
+    );
+  }
+
+  late final _ndarray_buffer_allocatePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<ffi.Uint8> Function(ffi.Int64,
+              ffi.Pointer<ndarrayBufferOptions>)>>('ndarray_buffer_allocate');
+  late final _ndarray_buffer_allocate = _ndarray_buffer_allocatePtr.asFunction<
+      ffi.Pointer<ffi.Uint8> Function(
+          int, ffi.Pointer<ndarrayBufferOptions>)>();
+
+  /// Frees an ndarray data buffer.
+  void ndarray_buffer_free(
+    ffi.Pointer<ffi.Uint8> buf,
+    int nbytes,
+  ) {
+    return _ndarray_buffer_free(
+      buf,
+      nbytes,
+    );
+  }
+
+  late final _ndarray_buffer_freePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<ffi.Uint8>, ffi.Int64)>>('ndarray_buffer_free');
+  late final _ndarray_buffer_free = _ndarray_buffer_freePtr
+      .asFunction<void Function(ffi.Pointer<ffi.Uint8>, int)>();
 }
 
 /// Enumeration of underlying ndarray data types.
@@ -3860,6 +5574,96 @@ abstract class NDARRAY_CASTING_MODE {
   static const int NDARRAY_UNSAFE_CASTING = 4;
 }
 
+/// Enumeration of ndarray reduction operations.
+abstract class NDARRAY_REDUCE_OP {
+  /// Sum of elements:
+  static const int NDARRAY_REDUCE_SUM = 0;
+
+  /// Product of elements:
+  static const int NDARRAY_REDUCE_PROD = 1;
+
+  /// Minimum value (note: propagates `NaN`):
+  static const int NDARRAY_REDUCE_MIN = 2;
+
+  /// Maximum value (note: propagates `NaN`):
+  static const int NDARRAY_REDUCE_MAX = 3;
+
+  /// Arithmetic mean:
+  static const int NDARRAY_REDUCE_MEAN = 4;
+}
+
+/// Enumeration of policies for handling `NaN` values when searching ndarray
+/// elements.
+abstract class NDARRAY_NAN_POLICY {
+  /// Treat `NaN` as the result (i.e., return the first `NaN`):
+  static const int NDARRAY_NAN_PROPAGATE = 0;
+
+  /// Ignore `NaN` values:
+  static const int NDARRAY_NAN_OMIT = 1;
+}
+
+/// Enumeration of element-wise predicates for testing ndarray elements.
+abstract class NDARRAY_PREDICATE {
+  /// Element is not equal to zero (note: `NaN` is nonzero):
+  static const int NDARRAY_PREDICATE_NONZERO = 0;
+
+  /// Element is `NaN` (note: a complex number is `NaN` if either component is
+  /// `NaN`):
+  static const int NDARRAY_PREDICATE_NAN = 1;
+
+  /// Element is positive or negative infinity (note: a complex number is
+  /// infinite if either component is infinite):
+  static const int NDARRAY_PREDICATE_INFINITE = 2;
+
+  /// Element is neither infinite nor `NaN`:
+  static const int NDARRAY_PREDICATE_FINITE = 3;
+
+  /// Element is greater than zero:
+  static const int NDARRAY_PREDICATE_POSITIVE = 4;
+
+  /// Element is less than zero:
+  static const int NDARRAY_PREDICATE_NEGATIVE = 5;
+
+  /// Element is greater than or equal to zero:
+  static const int NDARRAY_PREDICATE_NONNEGATIVE = 6;
+}
+
+/// Enumeration of statistics computed from accumulated moments.
+abstract class NDARRAY_MOMENT_STAT {
+  /// Arithmetic mean:
+  static const int NDARRAY_MOMENT_MEAN = 0;
+
+  /// Variance (note: the denominator is the number of elements minus a
+  /// specified delta degrees of freedom):
+  static const int NDARRAY_MOMENT_VARIANCE = 1;
+
+  /// Standard deviation (i.e., the square root of the variance):
+  static const int NDARRAY_MOMENT_STDEV = 2;
+
+  /// Sample skewness (i.e., the Fisher-Pearson coefficient of skewness, which
+  /// is not corrected for statistical bias):
+  static const int NDARRAY_MOMENT_SKEWNESS = 3;
+}
+
+/// Structure containing accumulated moments of a sequence of values.
+class ndarrayMoments extends ffi.Struct {
+  /// Number of values:
+  @ffi.Int64()
+  external int count;
+
+  /// Arithmetic mean:
+  @ffi.Double()
+  external double mean;
+
+  /// Sum of squared deviations from the mean:
+  @ffi.Double()
+  external double m2;
+
+  /// Sum of cubed deviations from the mean:
+  @ffi.Double()
+  external double m3;
+}
+
 /// An opaque type definition for a single-precision complex floating-point
 /// number.
 ///
@@ -4329,6 +6133,19 @@ abstract class NDARRAY_DTYPE_CHAR {
 /// };
 /// obj->data = data;
 ///
+/// // Without a type signature lookup table, dispatch uses a linear search:
+/// obj->lookup = NULL;
+/// obj->nlookup = 0;
+///
+/// // Apply functions directly (i.e., without dimension-specialized kernels) and
+/// // without caching resolved functions:
+/// obj->dispatch = NULL;
+/// obj->cache = NULL;
+///
+/// // Without alternative implementations for specific CPU features:
+/// obj->variants = NULL;
+/// obj->features = NULL;
+///
 /// // Free allocated memory:
 /// free(obj);
 class ndarrayFunctionObject extends ffi.Struct {
@@ -4364,8 +6181,40 @@ class ndarrayFunctionObject extends ffi.Struct {
   /// should be passed to a respective ndarray function (note: the number of
   /// pointers should match the number of ndarray functions):
   external ffi.Pointer<ffi.Pointer<ffi.Void>> data;
+
+  /// Open-addressing hash table mapping type signatures to function indices,
+  /// where empty slots are `-1` (note: if `NULL`, dispatch falls back to a
+  /// linear search over `types`):
+  external ffi.Pointer<ffi.Int32> lookup;
+
+  /// Number of hash table slots (a power of two):
+  @ffi.Int32()
+  external int nlookup;
+
+  /// Array of unary dispatch objects (one per ndarray function) for selecting
+  /// kernels specialized for the dimensionality and memory layout of ndarray
+  /// arguments (note: if `NULL`, or if an element is `NULL`, the corresponding
+  /// ndarray function is applied directly):
+  external ffi.Pointer<ffi.Pointer<ndarrayUnaryDispatchObject>> dispatch;
+
+  /// Inline cache of resolved kernels (note: if `NULL`, kernels are resolved on
+  /// every call to `ndarray_function_apply`):
+  external ffi.Pointer<ndarrayFunctionCache> cache;
+
+  /// Array of ndarray function implementations selected for the running CPU
+  /// (one per ndarray function; note: if `NULL`, no alternative implementations
+  /// have been registered):
+  external ffi.Pointer<ndarrayFcn> variants;
+
+  /// Array of CPU features (bit masks) required by the selected ndarray
+  /// function implementations, where `0` indicates that the corresponding
+  /// ndarray function in `functions` is selected:
+  external ffi.Pointer<ffi.Int64> features;
 }
 
+/// Inline cache of resolved ndarray function kernels.
+class ndarrayFunctionCache extends ffi.Opaque {}
+
 /// Function pointer type for an ndarray function.
 ///
 /// @param arrays   array containing pointers to input and output ndarrays
@@ -4376,6 +6225,160 @@ typedef ndarrayFcn = ffi.Pointer<
         ffi.Int8 Function(
             ffi.Pointer<ffi.Pointer<ndarray>>, ffi.Pointer<ffi.Void>)>>;
 
+/// Function pointer type for a strided cast function.
+///
+/// @param in    pointer to the first input element
+/// @param sin   input stride (in bytes)
+/// @param out   pointer to the first output element
+/// @param sout  output stride (in bytes)
+/// @param n     number of elements
+typedef ndarrayStridedCastFcn = ffi.Pointer<
+    ffi.NativeFunction<
+        ffi.Void Function(ffi.Pointer<ffi.Uint8>, ffi.Int64,
+            ffi.Pointer<ffi.Uint8>, ffi.Int64, ffi.Int64)>>;
+
+/// Function pointer type for a function applied to buffered chunks.
+///
+/// @param arrays  array containing pointers to one-dimensional input and output
+///                ndarray chunks
+/// @param ctx     function context
+/// @return        status code
+typedef ndarrayBufferedFcn = ffi.Pointer<
+    ffi.NativeFunction<
+        ffi.Int8 Function(
+            ffi.Pointer<ffi.Pointer<ndarray>>, ffi.Pointer<ffi.Void>)>>;
+
 const int NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG = 1;
 
 const int NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG = 2;
+
+/// Enumeration of CPU features used when selecting ndarray function
+/// implementations (note: features are bit flags, which are ordered such that
+/// newer instruction set extensions have larger values).
+abstract class NDARRAY_CPU_FEATURE {
+  /// x86 instruction set extensions:
+  static const int NDARRAY_CPU_SSE2 = 1;
+  static const int NDARRAY_CPU_SSE41 = 2;
+  static const int NDARRAY_CPU_SSE42 = 4;
+  static const int NDARRAY_CPU_AVX = 8;
+  static const int NDARRAY_CPU_AVX2 = 16;
+  static const int NDARRAY_CPU_FMA = 32;
+  static const int NDARRAY_CPU_AVX512F = 64;
+  static const int NDARRAY_CPU_AVX512DQ = 128;
+  static const int NDARRAY_CPU_AVX512BW = 256;
+  static const int NDARRAY_CPU_AVX512VL = 512;
+
+  /// ARM instruction set extensions:
+  static const int NDARRAY_CPU_NEON = 65536;
+}
+
+/// Enumeration of categories used when accounting for memory allocated by the
+/// library.
+abstract class NDARRAY_MEMORY_CATEGORY {
+  /// ndarray and ndarray function object structures (i.e., meta data):
+  static const int NDARRAY_MEMORY_HEADER = 0;
+
+  /// ndarray data buffers:
+  static const int NDARRAY_MEMORY_DATA = 1;
+
+  /// Temporary workspace used internally by ndarray functions:
+  static const int NDARRAY_MEMORY_SCRATCH = 2;
+
+  /// Sum over all categories (note: this must always be the last member):
+  static const int NDARRAY_MEMORY_TOTAL = 3;
+}
+
+/// Structure containing memory accounting statistics for a single category.
+///
+/// @example
+/// #include "ndarray/base/memory.h"
+/// #include "ndarray/memory_categories.h"
+///
+/// struct ndarrayMemoryStats stats;
+///
+/// int8_t status = ndarray_memory_stats(NDARRAY_MEMORY_TOTAL, &stats);
+class ndarrayMemoryStats extends ffi.Struct {
+  /// Number of bytes currently allocated:
+  @ffi.Int64()
+  external int bytes;
+
+  /// Maximum number of bytes allocated at any one time (since the last reset):
+  @ffi.Int64()
+  external int peak;
+
+  /// Number of allocations:
+  @ffi.Int64()
+  external int allocations;
+
+  /// Number of deallocations:
+  @ffi.Int64()
+  external int deallocations;
+}
+
+/// Function pointer type for a callback invoked when the total number of bytes
+/// allocated by the library exceeds a threshold.
+///
+/// @param bytes      total number of bytes currently allocated
+/// @param threshold  threshold which was exceeded
+/// @param ctx        user-provided context
+typedef ndarrayMemoryHook = ffi.Pointer<
+    ffi.NativeFunction<
+        ffi.Void Function(ffi.Int64, ffi.Int64, ffi.Pointer<ffi.Void>)>>;
+
+/// Function pointer type for a parallel task.
+///
+/// @param i    task index
+/// @param tid  index of the thread executing the task (`0 <= tid < nthreads`)
+/// @param ctx  task context
+typedef ndarrayParallelFcn = ffi.Pointer<
+    ffi.NativeFunction<
+        ffi.Void Function(ffi.Int64, ffi.Int32, ffi.Pointer<ffi.Void>)>>;
+
+/// Enumeration of NUMA memory placement policies for ndarray data buffers.
+abstract class NDARRAY_NUMA_POLICY {
+  /// Use the operating system's default placement (i.e., pages are placed on the
+  /// node of the thread which first touches them):
+  static const int NDARRAY_NUMA_DEFAULT = 0;
+
+  /// Place all pages on a single specified node:
+  static const int NDARRAY_NUMA_BIND = 1;
+
+  /// Interleave pages across all nodes in a round-robin fashion:
+  static const int NDARRAY_NUMA_INTERLEAVE = 2;
+}
+
+/// Structure for specifying how an ndarray data buffer should be allocated.
+///
+/// @example
+/// #include "ndarray/base/buffer.h"
+/// #include "ndarray/numa_policies.h"
+///
+/// struct ndarrayBufferOptions opts = {
+///     1,                        // huge_pages
+///     NDARRAY_NUMA_INTERLEAVE,  // numa_policy
+///     0,                        // numa_node
+///     1                         // first_touch
+/// };
+class ndarrayBufferOptions extends ffi.Struct {
+  /// Boolean indicating whether to request transparent huge pages:
+  @ffi.Int8()
+  external int huge_pages;
+
+  /// NUMA memory placement policy (see `enum NDARRAY_NUMA_POLICY`):
+  @ffi.Int8()
+  external int numa_policy;
+
+  /// NUMA node on which to place pages when using `NDARRAY_NUMA_BIND`:
+  @ffi.Int32()
+  external int numa_node;
+
+  /// Boolean indicating whether to eagerly zero-fill the buffer using one thread
+  /// per NUMA node, such that pages are faulted in near the threads which will
+  /// subsequently use them:
+  @ffi.Int8()
+  external int first_touch;
+}
+
+const int NDARRAY_BUFFER_MAP_THRESHOLD = 2097152;
+
+const int NDARRAY_BUFFER_HUGE_PAGE_SIZE = 2097152;
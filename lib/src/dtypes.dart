@@ -12,12 +12,12 @@ enum DType {
   /// Integer data types:
   int8(NDARRAY_DTYPE.NDARRAY_INT8, NDARRAY_DTYPE_CHAR.NDARRAY_INT8_CHAR),
   uInt8(NDARRAY_DTYPE.NDARRAY_UINT8, NDARRAY_DTYPE_CHAR.NDARRAY_UINT8_CHAR),
-  uInt8C(NDARRAY_DTYPE.NDARRAY_UINT8C, NDARRAY_DTYPE_CHAR.NDARRAY_UINT8_CHAR),
+  uInt8C(NDARRAY_DTYPE.NDARRAY_UINT8C, NDARRAY_DTYPE_CHAR.NDARRAY_UINT8C_CHAR),
   int16(NDARRAY_DTYPE.NDARRAY_INT16, NDARRAY_DTYPE_CHAR.NDARRAY_INT16_CHAR),
   uInt16(NDARRAY_DTYPE.NDARRAY_UINT16, NDARRAY_DTYPE_CHAR.NDARRAY_UINT16_CHAR),
   int32(NDARRAY_DTYPE.NDARRAY_INT32, NDARRAY_DTYPE_CHAR.NDARRAY_INT32_CHAR),
-  uInt32(NDARRAY_DTYPE.NDARRAY_UINT32, NDARRAY_DTYPE_CHAR.NDARRAY_UINT8_CHAR),
-  int64(NDARRAY_DTYPE.NDARRAY_INT64, NDARRAY_DTYPE_CHAR.NDARRAY_UINT32_CHAR),
+  uInt32(NDARRAY_DTYPE.NDARRAY_UINT32, NDARRAY_DTYPE_CHAR.NDARRAY_UINT32_CHAR),
+  int64(NDARRAY_DTYPE.NDARRAY_INT64, NDARRAY_DTYPE_CHAR.NDARRAY_INT64_CHAR),
   uInt64(NDARRAY_DTYPE.NDARRAY_UINT64, NDARRAY_DTYPE_CHAR.NDARRAY_UINT64_CHAR),
   int128(NDARRAY_DTYPE.NDARRAY_INT128, NDARRAY_DTYPE_CHAR.NDARRAY_INT128_CHAR),
   uInt128(
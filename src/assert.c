@@ -9,6 +9,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/dtype_registry.h"
 #include "ndarray/base/iteration_order.h"
 #include "ndarray/base/minmax_view_buffer_index.h"
 #include "ndarray/base/numel.h"
@@ -38,7 +39,8 @@
  * // returns 1
  */
 int8_t ndarray_is_allowed_data_type_cast(
-    const int8_t from, const int8_t to, const enum NDARRAY_CASTING_MODE casting
+    const int16_t from, const int16_t to,
+    const enum NDARRAY_CASTING_MODE casting
 ) {
   // Anything goes for "unsafe" casting...
   if (casting == NDARRAY_UNSAFE_CASTING) {
@@ -371,11 +373,15 @@ int8_t ndarray_is_row_major_contiguous(
  * int8_t b = ndarray_is_safe_data_type_cast(2, 2);
  * // returns 1
  */
-int8_t ndarray_is_safe_data_type_cast(const int8_t from, const int8_t to) {
+int8_t ndarray_is_safe_data_type_cast(const int16_t from, const int16_t to) {
   if (from == to) {
     return 1;
   }
-  if (from < NDARRAY_NDTYPES && to < NDARRAY_NDTYPES) {
+  if (from >= NDARRAY_USERDEFINED_TYPE || to >= NDARRAY_USERDEFINED_TYPE) {
+    return ndarray_dtype_is_allowed_cast(from, to, NDARRAY_SAFE_CASTING);
+  }
+  if (from >= 0 && from < NDARRAY_NDTYPES && to >= 0 && to < NDARRAY_NDTYPES &&
+      NDARRAY_SAFE_CASTS[from] != NULL) {
     return NDARRAY_SAFE_CASTS[from][to];
   }
   return 0;
@@ -399,11 +405,17 @@ int8_t ndarray_is_safe_data_type_cast(const int8_t from, const int8_t to) {
  * int8_t b = ndarray_is_same_kind_data_type_cast(2, 2);
  * // returns 1
  */
-int8_t ndarray_is_same_kind_data_type_cast(const int8_t from, const int8_t to) {
+int8_t ndarray_is_same_kind_data_type_cast(
+    const int16_t from, const int16_t to
+) {
   if (from == to) {
     return 1;
   }
-  if (from < NDARRAY_NDTYPES && to < NDARRAY_NDTYPES) {
+  if (from >= NDARRAY_USERDEFINED_TYPE || to >= NDARRAY_USERDEFINED_TYPE) {
+    return ndarray_dtype_is_allowed_cast(from, to, NDARRAY_SAME_KIND_CASTING);
+  }
+  if (from >= 0 && from < NDARRAY_NDTYPES && to >= 0 && to < NDARRAY_NDTYPES &&
+      NDARRAY_SAME_KIND_CASTS[from] != NULL) {
     return NDARRAY_SAME_KIND_CASTS[from][to];
   }
   return 0;
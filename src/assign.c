@@ -0,0 +1,321 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/assign.h"
+#include <stdint.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/assert.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/min_view_buffer_index.h"
+#include "ndarray/base/minmax_view_buffer_index.h"
+#include "ndarray/base/numel.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/memory_categories.h"
+
+// Define the maximum number of bytes occupied by a pair of input and output
+// tiles when copying between ndarrays having different memory layouts (note:
+// this should comfortably fit within L1 cache):
+#define NDARRAY_ASSIGN_TILE_BYTES 16384
+
+// Define the maximum tile size (in elements along each tiled dimension):
+#define NDARRAY_ASSIGN_MAX_TILE_SIZE 64
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_assign_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Tests whether ndarray elements occupy a single contiguous memory segment.
+ *
+ * @private
+ * @param arr     input ndarray
+ * @param len     number of elements
+ * @param nbytes  number of bytes per element
+ * @return        boolean indicating whether elements are contiguous
+ */
+static int8_t ndarray_assign_is_contiguous(
+    const struct ndarray* arr, const int64_t len, const int64_t nbytes
+) {
+  int64_t tmp[2];
+
+  ndarray_minmax_view_buffer_index(
+      arr->ndims, arr->shape, arr->strides, arr->offset, tmp
+  );
+  return ((len * nbytes) == ((tmp[1] - tmp[0]) + nbytes)) ? 1 : 0;
+}
+
+/**
+ * Tests whether two ndarrays having the same shape have the same memory layout
+ * (i.e., whether their strides, expressed in units of elements, are equal for
+ * all non-singleton dimensions).
+ *
+ * @private
+ * @param dst  output ndarray
+ * @param dbe  number of bytes per output ndarray element
+ * @param src  input ndarray
+ * @param sbe  number of bytes per input ndarray element
+ * @return     boolean indicating whether the layouts are the same
+ */
+static int8_t ndarray_assign_is_same_layout(
+    const struct ndarray* dst, const int64_t dbe, const struct ndarray* src,
+    const int64_t sbe
+) {
+  int64_t i;
+  for (i = 0; i < dst->ndims; i++) {
+    if (dst->shape[i] > 1 && dst->strides[i] * sbe != src->strides[i] * dbe) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Assigns the elements of an input ndarray to an output ndarray, converting
+ * between data types and memory layouts.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same shape.
+ * -   The input ndarray data type must be castable to the output ndarray data
+ *     type according to the specified casting mode (see
+ *     `ndarray_is_allowed_data_type_cast`), and a conversion between the two
+ *     data types must be supported (see `ndarray_strided_cast_function`).
+ * -   The input and output ndarrays must **not** share overlapping memory
+ *     (unless they are the same ndarray view).
+ * -   The function chooses among the following strategies:
+ *
+ *     -   If both ndarrays are contiguous and have the same memory layout, the
+ *         function copies a single memory segment (using `memcpy` when the data
+ *         types are the same).
+ *     -   If both ndarrays have the same fastest varying dimension, the
+ *         function converts elements along that dimension for each index of
+ *         the remaining dimensions, visiting the remaining dimensions in output
+ *         memory order.
+ *     -   Otherwise (e.g., when copying from a row-major ndarray to a
+ *         column-major ndarray), the function copies cache-sized tiles spanning
+ *         the fastest varying dimensions of both ndarrays, such that both reads
+ *         and writes reuse cache lines.
+ *
+ * -   The function does **not** modify the output ndarray meta data (e.g.,
+ *     flags).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param dst      output ndarray
+ * @param src      input ndarray
+ * @param casting  casting mode
+ * @return         status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/assign.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major input ndarray:
+ * float xbuf[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+ * int64_t shape[] = {2, 3};
+ * int64_t xstrides[] = {12, 4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT32, (uint8_t *)xbuf, 2, shape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create a column-major output ndarray:
+ * double ybuf[] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+ * int64_t ystrides[] = {8, 16};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ybuf, 2, shape, ystrides, 0,
+ *     NDARRAY_COLUMN_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int8_t status = ndarray_assign(y, x, NDARRAY_SAFE_CASTING);
+ * // ybuf => {1.0, 4.0, 2.0, 5.0, 3.0, 6.0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_assign(
+    struct ndarray* dst, const struct ndarray* src,
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  ndarrayStridedCastFcn fcn;
+  const uint8_t* ip;
+  int64_t* outer;
+  int64_t* sub;
+  uint8_t* op;
+  int64_t ndims;
+  int64_t len;
+  int64_t dbe;
+  int64_t sbe;
+  int64_t no;
+  int64_t ta;
+  int64_t tb;
+  int64_t i0;
+  int64_t j0;
+  int64_t d;
+  int64_t a;
+  int64_t b;
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  int64_t T;
+
+  if (dst == NULL || src == NULL || dst->ndims != src->ndims) {
+    return -1;
+  }
+  ndims = dst->ndims;
+  for (i = 0; i < ndims; i++) {
+    if (dst->shape[i] != src->shape[i]) {
+      return -1;
+    }
+  }
+  if (!ndarray_is_allowed_data_type_cast(src->dtype, dst->dtype, casting)) {
+    return -1;
+  }
+  fcn = ndarray_strided_cast_function(src->dtype, dst->dtype);
+  if (fcn == NULL) {
+    return -1;
+  }
+  len = (ndims == 0) ? 1 : ndarray_numel(ndims, dst->shape);
+  if (len == 0) {
+    return 0;
+  }
+  dbe = ndarray_bytes_per_element(dst->dtype);
+  sbe = ndarray_bytes_per_element(src->dtype);
+
+  // Check whether we can copy a single contiguous memory segment...
+  if (ndarray_assign_is_contiguous(dst, len, dbe) &&
+      ndarray_assign_is_contiguous(src, len, sbe) &&
+      ndarray_assign_is_same_layout(dst, dbe, src, sbe)) {
+    op = dst->data + ndarray_min_view_buffer_index(
+                         ndims, dst->shape, dst->strides, dst->offset
+                     );
+    ip = src->data + ndarray_min_view_buffer_index(
+                         ndims, src->shape, src->strides, src->offset
+                     );
+    if (dst->dtype == src->dtype) {
+      if (op != ip) {
+        memcpy(op, ip, (size_t)(len * dbe));
+      }
+    } else {
+      fcn(ip, sbe, op, dbe, len);
+    }
+    return 0;
+  }
+  // Allocate scratch memory for tracking outer loop dimensions and subscripts:
+  outer = ndarray_memory_malloc(
+      NDARRAY_MEMORY_SCRATCH, sizeof(int64_t) * ndims * 2
+  );
+  if (outer == NULL) {
+    return -1;
+  }
+  sub = outer + ndims;
+
+  // Find the fastest varying (non-singleton) dimension of each ndarray...
+  a = -1;
+  b = -1;
+  for (i = 0; i < ndims; i++) {
+    if (dst->shape[i] == 1) {
+      continue;
+    }
+    if (a < 0 || ndarray_assign_abs(dst->strides[i]) <
+                     ndarray_assign_abs(dst->strides[a])) {
+      a = i;
+    }
+    if (b < 0 || ndarray_assign_abs(src->strides[i]) <
+                     ndarray_assign_abs(src->strides[b])) {
+      b = i;
+    }
+  }
+  // Prefer a single inner dimension when doing so is equally cache friendly:
+  if (ndarray_assign_abs(src->strides[a]) ==
+      ndarray_assign_abs(src->strides[b])) {
+    b = a;
+  }
+  // Collect the remaining dimensions, sorted by increasing output stride, such
+  // that the outer loops visit output elements in memory order...
+  no = 0;
+  for (i = 0; i < ndims; i++) {
+    if (dst->shape[i] == 1 || i == a || i == b) {
+      continue;
+    }
+    for (j = no; j > 0 && ndarray_assign_abs(dst->strides[outer[j - 1]]) >
+                              ndarray_assign_abs(dst->strides[i]);
+         j--) {
+      outer[j] = outer[j - 1];
+    }
+    outer[j] = i;
+    sub[no]  = 0;
+    no += 1;
+  }
+  // Determine the tile size when tiling over two dimensions:
+  T = NDARRAY_ASSIGN_MAX_TILE_SIZE;
+  while (T > 1 && T * T * (dbe + sbe) > NDARRAY_ASSIGN_TILE_BYTES) {
+    T /= 2;
+  }
+  ip = src->data + src->offset;
+  op = dst->data + dst->offset;
+  do {
+    if (a == b) {
+      // Convert elements along the shared fastest varying dimension:
+      fcn(ip, src->strides[a], op, dst->strides[a], dst->shape[a]);
+    } else {
+      // Copy tiles spanning the fastest varying dimensions, writing along the
+      // output's fastest varying dimension while reading along the input's
+      // fastest varying dimension in the adjacent loop:
+      for (j0 = 0; j0 < dst->shape[b]; j0 += T) {
+        tb = (dst->shape[b] - j0 < T) ? dst->shape[b] - j0 : T;
+        for (i0 = 0; i0 < dst->shape[a]; i0 += T) {
+          ta = (dst->shape[a] - i0 < T) ? dst->shape[a] - i0 : T;
+          for (j = j0; j < j0 + tb; j++) {
+            fcn(
+                ip + (j * src->strides[b]) + (i0 * src->strides[a]),
+                src->strides[a],
+                op + (j * dst->strides[b]) + (i0 * dst->strides[a]),
+                dst->strides[a], ta
+            );
+          }
+        }
+      }
+    }
+    // Advance the outer loop subscripts...
+    for (k = 0; k < no; k++) {
+      d = outer[k];
+      sub[k] += 1;
+      ip += src->strides[d];  // pointer arithmetic
+      op += dst->strides[d];  // pointer arithmetic
+      if (sub[k] < dst->shape[d]) {
+        break;
+      }
+      ip -= src->strides[d] * dst->shape[d];  // pointer arithmetic
+      op -= dst->strides[d] * dst->shape[d];  // pointer arithmetic
+      sub[k] = 0;
+    }
+  } while (k < no);
+
+  ndarray_memory_free(
+      NDARRAY_MEMORY_SCRATCH, outer, sizeof(int64_t) * ndims * 2
+  );
+  return 0;
+}
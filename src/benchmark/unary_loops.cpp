@@ -0,0 +1,467 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+/**
+ * Benchmark comparing the `nd::unary` loops against hand-written loop nests.
+ *
+ * ## Notes
+ *
+ * -   The reference loop nests follow the structure of the per-rank loop macros
+ *     which preceded `nd::unary` (i.e., a single pointer per ndarray which is
+ *     incremented in place, and blocks visited in reverse order), such that
+ *     the reported ratios measure the cost of generating loops from
+ *     templates.
+ * -   Each case reports the minimum time over a number of interleaved
+ *     repetitions, and a ratio greater than `1` indicates that `nd::unary` is
+ *     faster than the reference.
+ * -   Build and run from the repository root:
+ *
+ *     ```bash
+ *     mkdir -p build/benchmark && cd build/benchmark
+ *     cc -std=gnu11 -O2 -I../../src/include -c ../../src/[a-z]*.c
+ *     c++ -std=c++17 -O2 -I../../src/include \
+ *         ../../src/benchmark/unary_loops.cpp *.o -lpthread -lm -o unary_loops
+ *     ./unary_loops
+ *     ```
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// `ndarray.h` does not declare C linkage (include it before any header which
+// includes it):
+extern "C" {
+#include "ndarray.h"
+}
+
+#include "ndarray/base/unary/constants.h"
+#include "ndarray/base/unary/loops.hpp"
+#include "ndarray/dtypes.h"
+#include "ndarray/index_modes.h"
+#include "ndarray/orders.h"
+
+namespace {
+
+// Define the number of timed repetitions per case:
+constexpr int REPETITIONS = 100;
+
+/**
+ * Inlined element operation.
+ */
+struct square {
+  using types = std::tuple<double, double>;
+  explicit square(void*) {}
+  double operator()(const double x) const { return (x * x) + 1.0; }
+};
+
+/**
+ * Element operation which invokes a callback.
+ */
+using callback = nd::unary::clbk<double, double>;
+
+double fsquare(const double x) {
+  return (x * x) + 1.0;
+}
+
+/**
+ * Reference two-dimensional loop (row-major).
+ */
+template <typename Op>
+int8_t ref_2d(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const int64_t* shape = arrays[0]->shape;
+  const int64_t* sx1   = arrays[0]->strides;
+  const int64_t* sx2   = arrays[1]->strides;
+  uint8_t* px1         = arrays[0]->data + arrays[0]->offset;
+  uint8_t* px2         = arrays[1]->data + arrays[1]->offset;
+  const int64_t S0     = shape[1];
+  const int64_t S1     = shape[0];
+  const int64_t d0x1   = sx1[1];
+  const int64_t d1x1   = sx1[0] - (S0 * sx1[1]);
+  const int64_t d0x2   = sx2[1];
+  const int64_t d1x2   = sx2[0] - (S0 * sx2[1]);
+  int64_t i0;
+  int64_t i1;
+
+  for (i1 = 0; i1 < S1; i1++, px1 += d1x1, px2 += d1x2) {
+    for (i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2) {
+      *reinterpret_cast<double*>(px2) = op(*reinterpret_cast<double*>(px1));
+    }
+  }
+  return 0;
+}
+
+/**
+ * Reference three-dimensional loop (row-major).
+ */
+template <typename Op>
+int8_t ref_3d(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const int64_t* shape = arrays[0]->shape;
+  const int64_t* sx1   = arrays[0]->strides;
+  const int64_t* sx2   = arrays[1]->strides;
+  uint8_t* px1         = arrays[0]->data + arrays[0]->offset;
+  uint8_t* px2         = arrays[1]->data + arrays[1]->offset;
+  const int64_t S0     = shape[2];
+  const int64_t S1     = shape[1];
+  const int64_t S2     = shape[0];
+  const int64_t d0x1   = sx1[2];
+  const int64_t d1x1   = sx1[1] - (S0 * sx1[2]);
+  const int64_t d2x1   = sx1[0] - (S1 * sx1[1]);
+  const int64_t d0x2   = sx2[2];
+  const int64_t d1x2   = sx2[1] - (S0 * sx2[2]);
+  const int64_t d2x2   = sx2[0] - (S1 * sx2[1]);
+  int64_t i0;
+  int64_t i1;
+  int64_t i2;
+
+  for (i2 = 0; i2 < S2; i2++, px1 += d2x1, px2 += d2x2) {
+    for (i1 = 0; i1 < S1; i1++, px1 += d1x1, px2 += d1x2) {
+      for (i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2) {
+        *reinterpret_cast<double*>(px2) = op(*reinterpret_cast<double*>(px1));
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Reference four-dimensional loop (row-major).
+ */
+template <typename Op>
+int8_t ref_4d(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const int64_t* shape = arrays[0]->shape;
+  const int64_t* sx1   = arrays[0]->strides;
+  const int64_t* sx2   = arrays[1]->strides;
+  uint8_t* px1         = arrays[0]->data + arrays[0]->offset;
+  uint8_t* px2         = arrays[1]->data + arrays[1]->offset;
+  const int64_t S0     = shape[3];
+  const int64_t S1     = shape[2];
+  const int64_t S2     = shape[1];
+  const int64_t S3     = shape[0];
+  const int64_t d0x1   = sx1[3];
+  const int64_t d1x1   = sx1[2] - (S0 * sx1[3]);
+  const int64_t d2x1   = sx1[1] - (S1 * sx1[2]);
+  const int64_t d3x1   = sx1[0] - (S2 * sx1[1]);
+  const int64_t d0x2   = sx2[3];
+  const int64_t d1x2   = sx2[2] - (S0 * sx2[3]);
+  const int64_t d2x2   = sx2[1] - (S1 * sx2[2]);
+  const int64_t d3x2   = sx2[0] - (S2 * sx2[1]);
+  int64_t i0;
+  int64_t i1;
+  int64_t i2;
+  int64_t i3;
+
+  for (i3 = 0; i3 < S3; i3++, px1 += d3x1, px2 += d3x2) {
+    for (i2 = 0; i2 < S2; i2++, px1 += d2x1, px2 += d2x2) {
+      for (i1 = 0; i1 < S1; i1++, px1 += d1x1, px2 += d1x2) {
+        for (i0 = 0; i0 < S0; i0++, px1 += d0x1, px2 += d0x2) {
+          *reinterpret_cast<double*>(px2) =
+              op(*reinterpret_cast<double*>(px1));
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Sorts dimension indices by increasing input stride magnitude.
+ */
+template <std::size_t N>
+std::array<std::size_t, N> stride_order(const struct ndarray* x) {
+  std::array<std::size_t, N> idx;
+  std::size_t i;
+
+  for (i = 0; i < N; i++) {
+    idx[i] = i;
+  }
+  std::stable_sort(idx.begin(), idx.end(), [x](std::size_t a, std::size_t b) {
+    return std::abs(x->strides[a]) < std::abs(x->strides[b]);
+  });
+  return idx;
+}
+
+/**
+ * Reference two-dimensional blocked loop.
+ */
+template <typename Op>
+int8_t ref_2d_blocked(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const std::array<std::size_t, 2> idx = stride_order<2>(arrays[0]);
+  const int64_t bsize = NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES / sizeof(double);
+  const int64_t shape[] = {
+      arrays[0]->shape[idx[0]],
+      arrays[0]->shape[idx[1]],
+  };
+  const int64_t sx1[] = {
+      arrays[0]->strides[idx[0]],
+      arrays[0]->strides[idx[1]],
+  };
+  const int64_t sx2[] = {
+      arrays[1]->strides[idx[0]],
+      arrays[1]->strides[idx[1]],
+  };
+  uint8_t* pbx1 = arrays[0]->data + arrays[0]->offset;
+  uint8_t* pbx2 = arrays[1]->data + arrays[1]->offset;
+  uint8_t* px1;
+  uint8_t* px2;
+  int64_t d1x1;
+  int64_t d1x2;
+  int64_t s0;
+  int64_t s1;
+  int64_t i0;
+  int64_t i1;
+  int64_t j0;
+  int64_t j1;
+
+  for (j1 = shape[1]; j1 > 0;) {
+    if (j1 < bsize) {
+      s1 = j1;
+      j1 = 0;
+    } else {
+      s1 = bsize;
+      j1 -= bsize;
+    }
+    for (j0 = shape[0]; j0 > 0;) {
+      if (j0 < bsize) {
+        s0 = j0;
+        j0 = 0;
+      } else {
+        s0 = bsize;
+        j0 -= bsize;
+      }
+      px1  = pbx1 + (j1 * sx1[1]) + (j0 * sx1[0]);
+      px2  = pbx2 + (j1 * sx2[1]) + (j0 * sx2[0]);
+      d1x1 = sx1[1] - (s0 * sx1[0]);
+      d1x2 = sx2[1] - (s0 * sx2[0]);
+      for (i1 = 0; i1 < s1; i1++, px1 += d1x1, px2 += d1x2) {
+        for (i0 = 0; i0 < s0; i0++, px1 += sx1[0], px2 += sx2[0]) {
+          *reinterpret_cast<double*>(px2) =
+              op(*reinterpret_cast<double*>(px1));
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Reference three-dimensional blocked loop.
+ */
+template <typename Op>
+int8_t ref_3d_blocked(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const std::array<std::size_t, 3> idx = stride_order<3>(arrays[0]);
+  const int64_t bsize = NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES / sizeof(double);
+  const int64_t shape[] = {
+      arrays[0]->shape[idx[0]],
+      arrays[0]->shape[idx[1]],
+      arrays[0]->shape[idx[2]],
+  };
+  const int64_t sx1[] = {
+      arrays[0]->strides[idx[0]],
+      arrays[0]->strides[idx[1]],
+      arrays[0]->strides[idx[2]],
+  };
+  const int64_t sx2[] = {
+      arrays[1]->strides[idx[0]],
+      arrays[1]->strides[idx[1]],
+      arrays[1]->strides[idx[2]],
+  };
+  uint8_t* pbx1 = arrays[0]->data + arrays[0]->offset;
+  uint8_t* pbx2 = arrays[1]->data + arrays[1]->offset;
+  uint8_t* px1;
+  uint8_t* px2;
+  int64_t d1x1;
+  int64_t d2x1;
+  int64_t d1x2;
+  int64_t d2x2;
+  int64_t s0;
+  int64_t s1;
+  int64_t s2;
+  int64_t i0;
+  int64_t i1;
+  int64_t i2;
+  int64_t j0;
+  int64_t j1;
+  int64_t j2;
+
+  for (j2 = shape[2]; j2 > 0;) {
+    if (j2 < bsize) {
+      s2 = j2;
+      j2 = 0;
+    } else {
+      s2 = bsize;
+      j2 -= bsize;
+    }
+    for (j1 = shape[1]; j1 > 0;) {
+      if (j1 < bsize) {
+        s1 = j1;
+        j1 = 0;
+      } else {
+        s1 = bsize;
+        j1 -= bsize;
+      }
+      d2x1 = sx1[2] - (s1 * sx1[1]);
+      d2x2 = sx2[2] - (s1 * sx2[1]);
+      for (j0 = shape[0]; j0 > 0;) {
+        if (j0 < bsize) {
+          s0 = j0;
+          j0 = 0;
+        } else {
+          s0 = bsize;
+          j0 -= bsize;
+        }
+        px1 = pbx1 + (j2 * sx1[2]) + (j1 * sx1[1]) + (j0 * sx1[0]);
+        px2 = pbx2 + (j2 * sx2[2]) + (j1 * sx2[1]) + (j0 * sx2[0]);
+        d1x1 = sx1[1] - (s0 * sx1[0]);
+        d1x2 = sx2[1] - (s0 * sx2[0]);
+        for (i2 = 0; i2 < s2; i2++, px1 += d2x1, px2 += d2x2) {
+          for (i1 = 0; i1 < s1; i1++, px1 += d1x1, px2 += d1x2) {
+            for (i0 = 0; i0 < s0; i0++, px1 += sx1[0], px2 += sx2[0]) {
+              *reinterpret_cast<double*>(px2) =
+                  op(*reinterpret_cast<double*>(px1));
+            }
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Returns the minimum time (in seconds) of a loop over repetitions which are
+ * interleaved with a second loop.
+ */
+std::pair<double, double> time_pair(
+    ndarrayUnaryFcn a, ndarrayUnaryFcn b, struct ndarray* arrays[]
+) {
+  using clock = std::chrono::steady_clock;
+  double ta = 1.0e30;
+  double tb = 1.0e30;
+  int i;
+
+  for (i = 0; i < REPETITIONS; i++) {
+    auto t0 = clock::now();
+    a(arrays, reinterpret_cast<void*>(fsquare));
+    auto t1 = clock::now();
+    b(arrays, reinterpret_cast<void*>(fsquare));
+    auto t2 = clock::now();
+    ta = std::min(ta, std::chrono::duration<double>(t1 - t0).count());
+    tb = std::min(tb, std::chrono::duration<double>(t2 - t1).count());
+  }
+  return {ta, tb};
+}
+
+struct benchmark_case {
+  const char* name;
+  ndarrayUnaryFcn reference;
+  ndarrayUnaryFcn loop;
+  std::vector<int64_t> shape;
+  std::vector<int64_t> sx;
+  std::vector<int64_t> sy;
+};
+
+/**
+ * Runs a benchmark case and prints the timings.
+ */
+bool run(
+    benchmark_case& c, std::vector<double>& x, std::vector<double>& y,
+    std::vector<double>& z
+) {
+  int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+  const int64_t ndims = static_cast<int64_t>(c.shape.size());
+  struct ndarray* arrays[2];
+  bool ok;
+
+  arrays[0] = ndarray_allocate(
+      NDARRAY_FLOAT64, reinterpret_cast<uint8_t*>(x.data()), ndims,
+      c.shape.data(), c.sx.data(), 0, NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR,
+      1, submodes
+  );
+  arrays[1] = ndarray_allocate(
+      NDARRAY_FLOAT64, reinterpret_cast<uint8_t*>(y.data()), ndims,
+      c.shape.data(), c.sy.data(), 0, NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR,
+      1, submodes
+  );
+  if (arrays[0] == nullptr || arrays[1] == nullptr) {
+    std::fprintf(stderr, "Error allocating memory.\n");
+    return false;
+  }
+
+  // Check that both loops compute the same results:
+  c.reference(arrays, reinterpret_cast<void*>(fsquare));
+  z = y;
+  std::fill(y.begin(), y.end(), 0.0);
+  c.loop(arrays, reinterpret_cast<void*>(fsquare));
+  ok = (y == z);
+
+  const auto [tr, tl] = time_pair(c.reference, c.loop, arrays);
+  std::printf(
+      "%-28s reference %8.3f ms  nd::unary %8.3f ms  ratio %.2f%s\n", c.name,
+      tr * 1.0e3, tl * 1.0e3, tr / tl, ok ? "" : "  MISMATCH"
+  );
+  ndarray_free(arrays[0]);
+  ndarray_free(arrays[1]);
+  return ok;
+}
+
+}  // namespace
+
+int main() {
+  using nd::unary::blocked;
+  using nd::unary::loop;
+
+  const int64_t n = 1 << 20;
+  std::vector<double> x(n);
+  std::vector<double> y(n);
+  std::vector<double> z(n);
+  bool ok = true;
+  int64_t i;
+
+  for (i = 0; i < n; i++) {
+    x[i] = static_cast<double>(i) * 1.0e-3;
+  }
+
+  // Row-major strides (contiguous) and column-major strides (transposed):
+  const std::vector<int64_t> rm2 = {8192, 8};
+  const std::vector<int64_t> cm2 = {8, 8192};
+  const std::vector<int64_t> rm3 = {65536, 512, 8};
+  const std::vector<int64_t> cm3 = {8, 1024, 131072};
+  const std::vector<int64_t> rm4 = {262144, 8192, 256, 8};
+
+  std::vector<benchmark_case> cases = {
+      {"clbk 2d contiguous", ref_2d<callback>, loop<2, callback>,
+       {1024, 1024}, rm2, rm2},
+      {"clbk 3d contiguous", ref_3d<callback>, loop<3, callback>,
+       {128, 128, 64}, rm3, rm3},
+      {"inline 2d contiguous", ref_2d<square>, loop<2, square>,
+       {1024, 1024}, rm2, rm2},
+      {"inline 4d contiguous", ref_4d<square>, loop<4, square>,
+       {32, 32, 32, 32}, rm4, rm4},
+      {"inline 2d row->col blocked", ref_2d_blocked<square>,
+       blocked<2, square>, {1024, 1024}, rm2, cm2},
+      {"clbk 2d row->col blocked", ref_2d_blocked<callback>,
+       blocked<2, callback>, {1024, 1024}, rm2, cm2},
+      {"inline 3d row->col blocked", ref_3d_blocked<square>,
+       blocked<3, square>, {128, 128, 64}, rm3, cm3},
+  };
+  for (auto& c : cases) {
+    ok = run(c, x, y, z) && ok;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,438 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+// Expose `sched_setaffinity` and the `CPU_*` macros on Linux:
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "ndarray/base/buffer.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/numa_policies.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+
+// Define the kernel memory policy modes (see `<numaif.h>`; defined here in
+// order to avoid a dependency on `libnuma`):
+#define NDARRAY_BUFFER_MPOL_BIND       2
+#define NDARRAY_BUFFER_MPOL_INTERLEAVE 3
+
+// Define the maximum number of NUMA nodes supported when building node masks:
+#define NDARRAY_BUFFER_MAX_NODES 1024
+
+/**
+ * Parses a Linux "list" formatted string (e.g., `0-3,8,10-11`) and sets the
+ * corresponding bits in an output bit mask.
+ *
+ * @private
+ * @param str    input string
+ * @param mask   output bit mask (may be `NULL`)
+ * @param nbits  number of bits in the output bit mask
+ * @return       one plus the largest listed index or `-1` if unable to parse
+ */
+static int64_t ndarray_buffer_parse_list(
+    const char* str, unsigned long* mask, const int64_t nbits
+) {
+  const int64_t w = (int64_t)(8 * sizeof(unsigned long));
+  int64_t max;
+  int64_t lo;
+  int64_t hi;
+  int64_t i;
+  char* end;
+
+  max = -1;
+  while (*str != '\0' && *str != '\n') {
+    lo = strtol(str, &end, 10);
+    if (end == str) {
+      return -1;
+    }
+    hi  = lo;
+    str = end;
+    if (*str == '-') {
+      str += 1;
+      hi = strtol(str, &end, 10);
+      if (end == str) {
+        return -1;
+      }
+      str = end;
+    }
+    for (i = lo; i <= hi; i++) {
+      if (mask != NULL && i < nbits) {
+        mask[i / w] |= (1UL << (i % w));
+      }
+    }
+    if (hi + 1 > max) {
+      max = hi + 1;
+    }
+    if (*str == ',') {
+      str += 1;
+    }
+  }
+  return max;
+}
+
+/**
+ * Reads a Linux "list" formatted file (e.g., from `/sys`) into a bit mask.
+ *
+ * @private
+ * @param path   file path
+ * @param mask   output bit mask (may be `NULL`)
+ * @param nbits  number of bits in the output bit mask
+ * @return       one plus the largest listed index or `-1` if unable to read
+ */
+static int64_t ndarray_buffer_read_list(
+    const char* path, unsigned long* mask, const int64_t nbits
+) {
+  char buf[4096];
+  FILE* f;
+
+  f = fopen(path, "r");
+  if (f == NULL) {
+    return -1;
+  }
+  if (fgets(buf, sizeof buf, f) == NULL) {
+    fclose(f);
+    return -1;
+  }
+  fclose(f);
+  return ndarray_buffer_parse_list(buf, mask, nbits);
+}
+
+/**
+ * Structure describing a first-touch initialization.
+ *
+ * @private
+ */
+struct ndarrayBufferFirstTouch {
+  // Buffer to initialize:
+  uint8_t* buf;
+
+  // Buffer length (in bytes):
+  int64_t len;
+
+  // Number of slices (one per NUMA node):
+  int64_t nslices;
+
+  // Page size (in bytes):
+  int64_t page;
+};
+
+/**
+ * Zero-fills a single buffer slice from a thread pinned to the slice's NUMA
+ * node.
+ *
+ * @private
+ * @param i    slice index (and NUMA node)
+ * @param tid  thread index
+ * @param ctx  first-touch context
+ */
+static void ndarray_buffer_first_touch_task(int64_t i, int32_t tid, void* ctx) {
+  struct ndarrayBufferFirstTouch* ft = (struct ndarrayBufferFirstTouch*)ctx;
+  unsigned long mask[CPU_SETSIZE / (8 * sizeof(unsigned long))];
+  cpu_set_t prev;
+  cpu_set_t set;
+  char path[64];
+  int8_t pinned;
+  int64_t start;
+  int64_t end;
+  int64_t c;
+
+  (void)tid;
+
+  // Split the buffer into page aligned slices...
+  start = ((ft->len / ft->nslices) * i) / ft->page * ft->page;
+  if (i == ft->nslices - 1) {
+    end = ft->len;
+  } else {
+    end = ((ft->len / ft->nslices) * (i + 1)) / ft->page * ft->page;
+  }
+  if (end <= start) {
+    return;
+  }
+  // Temporarily pin the current thread to the CPUs of the slice's node...
+  pinned = 0;
+  snprintf(
+      path, sizeof path, "/sys/devices/system/node/node%d/cpulist", (int)i
+  );
+  memset(mask, 0, sizeof mask);
+  if (ndarray_buffer_read_list(path, mask, CPU_SETSIZE) > 0 &&
+      sched_getaffinity(0, sizeof prev, &prev) == 0) {
+    CPU_ZERO(&set);
+    for (c = 0; c < CPU_SETSIZE; c++) {
+      if (mask[c / (8 * sizeof(unsigned long))] &
+          (1UL << (c % (8 * sizeof(unsigned long))))) {
+        CPU_SET(c, &set);
+      }
+    }
+    if (sched_setaffinity(0, sizeof set, &set) == 0) {
+      pinned = 1;
+    }
+  }
+  // Touch (and thus fault in) the slice's pages:
+  memset(ft->buf + start, 0, end - start);
+
+  // Restore the thread's original affinity:
+  if (pinned) {
+    sched_setaffinity(0, sizeof prev, &prev);
+  }
+}
+
+#endif
+
+/**
+ * Returns the number of NUMA nodes available to the current process.
+ *
+ * ## Notes
+ *
+ * -   On platforms which do not expose NUMA topology, the function returns `1`.
+ *
+ * @return  number of NUMA nodes
+ *
+ * @example
+ * #include "ndarray/base/buffer.h"
+ *
+ * int32_t n = ndarray_buffer_numa_nodes();
+ */
+int32_t ndarray_buffer_numa_nodes(void) {
+#if defined(__linux__)
+  int64_t n = ndarray_buffer_read_list(
+      "/sys/devices/system/node/online", NULL, 0
+  );
+  if (n < 1) {
+    return 1;
+  }
+  if (n > NDARRAY_BUFFER_MAX_NODES) {
+    return NDARRAY_BUFFER_MAX_NODES;
+  }
+  return (int32_t)n;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Returns a pointer to a dynamically allocated, zero-initialized ndarray data
+ * buffer.
+ *
+ * ## Notes
+ *
+ * -   The user is responsible for freeing the allocated memory using
+ *     `ndarray_buffer_free` (and **not** `free`), passing the same number of
+ *     bytes as provided to this function.
+ * -   Buffers smaller than `NDARRAY_BUFFER_MAP_THRESHOLD` bytes are allocated
+ *     from the heap and allocation options are ignored. Larger buffers are
+ *     mapped directly from the operating system, such that
+ *
+ *     -   if `huge_pages` is set, the buffer is aligned to a huge page boundary
+ *         and transparent huge pages are requested via `madvise`.
+ *     -   if `numa_policy` is `NDARRAY_NUMA_BIND`, all pages are placed on
+ *         `numa_node`.
+ *     -   if `numa_policy` is `NDARRAY_NUMA_INTERLEAVE`, pages are interleaved
+ *         across all available NUMA nodes.
+ *     -   if `first_touch` is set, the buffer is eagerly zero-filled by one
+ *         thread per NUMA node, where each thread is pinned to its node and
+ *         initializes a contiguous slice of the buffer. Otherwise, pages are
+ *         faulted in lazily by whichever thread first accesses them.
+ *
+ * -   Huge page and NUMA options are hints. On platforms which do not support
+ *     them (i.e., anything other than Linux), options are ignored.
+ * -   Allocated buffers are recorded under `NDARRAY_MEMORY_DATA` in the
+ *     library's memory accounting statistics (see `ndarray_memory_stats`).
+ *     Mapped buffers are recorded using their page-rounded size.
+ * -   If `opts` is a null pointer, the function uses default options (i.e., no
+ *     huge pages, default NUMA placement, and lazy initialization).
+ *
+ * @param nbytes  number of bytes
+ * @param opts    allocation options
+ * @return        pointer to a dynamically allocated buffer or, if unable to
+ *                allocate memory, a null pointer
+ *
+ * @example
+ * #include "ndarray/base/buffer.h"
+ * #include "ndarray/numa_policies.h"
+ * #include <stdint.h>
+ * #include <stdlib.h>
+ * #include <stdio.h>
+ *
+ * struct ndarrayBufferOptions opts = {1, NDARRAY_NUMA_DEFAULT, 0, 1};
+ *
+ * int64_t nbytes = 1 << 30;
+ * uint8_t *buf = ndarray_buffer_allocate(nbytes, &opts);
+ * if (buf == NULL) {
+ *     fprintf(stderr, "Error allocating memory.\n");
+ *     exit(1);
+ * }
+ *
+ * // ...
+ *
+ * // Free allocated memory:
+ * ndarray_buffer_free(buf, nbytes);
+ */
+uint8_t* ndarray_buffer_allocate(
+    int64_t nbytes, const struct ndarrayBufferOptions* opts
+) {
+#if defined(__linux__)
+  struct ndarrayBufferFirstTouch ft;
+  unsigned long mask[NDARRAY_BUFFER_MAX_NODES / (8 * sizeof(unsigned long))];
+  uint8_t* aligned;
+  uint8_t* ptr;
+  int64_t nnodes;
+  int64_t maplen;
+  int64_t page;
+  int64_t len;
+  int64_t w;
+  int64_t i;
+#endif
+
+  if (nbytes < 0) {
+    return NULL;
+  }
+#if defined(__linux__)
+  if (nbytes >= NDARRAY_BUFFER_MAP_THRESHOLD) {
+    page = (int64_t)sysconf(_SC_PAGESIZE);
+    if (page <= 0) {
+      page = 4096;
+    }
+    len = ((nbytes + page - 1) / page) * page;
+
+    // Reserve the address range, over-allocating when huge pages are requested
+    // so that the buffer can be aligned to a huge page boundary...
+    if (opts != NULL && opts->huge_pages) {
+      maplen = len + NDARRAY_BUFFER_HUGE_PAGE_SIZE;
+    } else {
+      maplen = len;
+    }
+    ptr = mmap(
+        NULL, maplen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+    );
+    if (ptr == MAP_FAILED) {
+      return NULL;
+    }
+    aligned = ptr;
+    if (maplen > len) {
+      aligned = (uint8_t*)(
+          ((uintptr_t)ptr + NDARRAY_BUFFER_HUGE_PAGE_SIZE - 1) &
+          ~(uintptr_t)(NDARRAY_BUFFER_HUGE_PAGE_SIZE - 1)
+      );
+
+      // Return the unused head and tail of the reservation:
+      if (aligned > ptr) {
+        munmap(ptr, aligned - ptr);
+      }
+      if ((ptr + maplen) > (aligned + len)) {
+        munmap(aligned + len, (ptr + maplen) - (aligned + len));
+      }
+#if defined(MADV_HUGEPAGE)
+      madvise(aligned, len, MADV_HUGEPAGE);
+#endif
+    }
+    // Apply the NUMA placement policy before any page is touched...
+    nnodes = ndarray_buffer_numa_nodes();
+#if defined(SYS_mbind)
+    if (opts != NULL && opts->numa_policy != NDARRAY_NUMA_DEFAULT &&
+        nnodes > 1) {
+      w = (int64_t)(8 * sizeof(unsigned long));
+      memset(mask, 0, sizeof mask);
+      if (opts->numa_policy == NDARRAY_NUMA_BIND) {
+        if (opts->numa_node >= 0 && opts->numa_node < nnodes) {
+          mask[opts->numa_node / w] |= (1UL << (opts->numa_node % w));
+          syscall(
+              SYS_mbind, aligned, len, NDARRAY_BUFFER_MPOL_BIND, mask,
+              (unsigned long)(nnodes + 1), 0
+          );
+        }
+      } else if (opts->numa_policy == NDARRAY_NUMA_INTERLEAVE) {
+        for (i = 0; i < nnodes; i++) {
+          mask[i / w] |= (1UL << (i % w));
+        }
+        syscall(
+            SYS_mbind, aligned, len, NDARRAY_BUFFER_MPOL_INTERLEAVE, mask,
+            (unsigned long)(nnodes + 1), 0
+        );
+      }
+    }
+#endif
+    // Fault in pages near the threads which will use them...
+    if (opts != NULL && opts->first_touch) {
+      ft.buf     = aligned;
+      ft.len     = len;
+      ft.nslices = nnodes;
+      ft.page    = page;
+      if (nnodes > 1) {
+        ndarray_parallel_for(
+            nnodes, (int32_t)nnodes, ndarray_buffer_first_touch_task, &ft
+        );
+      } else {
+        memset(aligned, 0, len);
+      }
+    }
+    ndarray_memory_record_allocation(NDARRAY_MEMORY_DATA, len);
+    return aligned;
+  }
+#endif
+  // Anonymous mappings are zero-initialized, so, for consistency, initialize
+  // heap allocations as well:
+  return ndarray_memory_calloc(NDARRAY_MEMORY_DATA, nbytes);
+}
+
+/**
+ * Frees an ndarray data buffer.
+ *
+ * ## Notes
+ *
+ * -   The buffer **must** have been allocated using `ndarray_buffer_allocate`
+ *     and `nbytes` **must** equal the number of bytes which was requested when
+ *     allocating the buffer.
+ *
+ * @param buf     buffer
+ * @param nbytes  number of bytes
+ *
+ * @example
+ * #include "ndarray/base/buffer.h"
+ * #include <stdint.h>
+ *
+ * uint8_t *buf = ndarray_buffer_allocate(64, NULL);
+ *
+ * // ...
+ *
+ * ndarray_buffer_free(buf, 64);
+ */
+void ndarray_buffer_free(uint8_t* buf, int64_t nbytes) {
+#if defined(__linux__)
+  int64_t page;
+  int64_t len;
+#endif
+  if (buf == NULL) {
+    return;
+  }
+#if defined(__linux__)
+  if (nbytes >= NDARRAY_BUFFER_MAP_THRESHOLD) {
+    page = (int64_t)sysconf(_SC_PAGESIZE);
+    if (page <= 0) {
+      page = 4096;
+    }
+    len = ((nbytes + page - 1) / page) * page;
+    munmap(buf, len);
+    ndarray_memory_record_free(NDARRAY_MEMORY_DATA, len);
+    return;
+  }
+#endif
+  ndarray_memory_free(NDARRAY_MEMORY_DATA, buf, nbytes);
+}
@@ -0,0 +1,410 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/buffered.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/assert.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/iteration_order.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/min_view_buffer_index.h"
+#include "ndarray/base/numel.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/macros.h"
+#include "ndarray/memory_categories.h"
+
+// Define the maximum number of bytes occupied by the scratch buffers of all
+// converted operands (note: this should comfortably fit within L1 cache):
+#define NDARRAY_BUFFERED_BYTES 16384
+
+// Define the minimum number of elements per chunk:
+#define NDARRAY_BUFFERED_MIN_CHUNK 16
+
+// Define the alignment (in bytes) of each scratch buffer:
+#define NDARRAY_BUFFERED_ALIGNMENT 16
+
+/**
+ * Structure describing the iteration state of an operand.
+ *
+ * @private
+ */
+struct ndarrayBufferedOperand {
+  // Conversion function (note: `NULL` if the operand is not converted):
+  ndarrayStridedCastFcn cast;
+
+  // Pointer to the first element along the iterated dimension:
+  uint8_t* ptr;
+
+  // Stride (in bytes) along the iterated dimension:
+  int64_t stride;
+
+  // Scratch buffer (note: `NULL` if the operand is not converted):
+  uint8_t* buf;
+
+  // Stride (in bytes) of the one-dimensional chunk view:
+  int64_t vstride;
+};
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_buffered_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Returns the number of bytes occupied by a scratch buffer.
+ *
+ * @private
+ * @param n       number of elements
+ * @param nbytes  number of bytes per element
+ * @return        number of bytes (rounded up to the buffer alignment)
+ */
+static inline int64_t ndarray_buffered_size(
+    const int64_t n, const int64_t nbytes
+) {
+  int64_t a = NDARRAY_BUFFERED_ALIGNMENT;
+  return (((n * nbytes) + a - 1) / a) * a;
+}
+
+/**
+ * Applies a function to chunks of ndarrays, converting operands to specified
+ * data types via small scratch buffers.
+ *
+ * ## Notes
+ *
+ * -   All ndarrays must have the same shape (i.e., the function is intended
+ *     for element-wise operations).
+ * -   For each operand whose data type differs from the corresponding data
+ *     type in `types`, the function allocates a scratch buffer holding a chunk
+ *     of elements. Before invoking `fcn` for a chunk, input chunks are
+ *     converted into their scratch buffers, and, afterward, output chunks are
+ *     converted from their scratch buffers back into the output ndarrays.
+ *     Operands whose data types match are passed to `fcn` as views without
+ *     copying.
+ * -   The chunk size is chosen such that the scratch buffers of all converted
+ *     operands fit within L1 cache, thus keeping converted data in cache while
+ *     `fcn` processes it and bounding peak memory regardless of ndarray size.
+ *     Scratch buffers are allocated per call, and, thus, concurrent calls
+ *     from multiple threads never share buffers.
+ * -   `fcn` is always invoked with one-dimensional ndarrays having the data
+ *     types specified in `types`. If all operands are contiguous and have the
+ *     same memory layout, chunks span the operands' underlying byte arrays.
+ *     Otherwise, chunks span the output ndarray's fastest varying dimension,
+ *     and the remaining dimensions are iterated in output memory order.
+ * -   Chunks are one-dimensional even if no operand requires conversion, in
+ *     which case non-contiguous operands are processed one run along the
+ *     output's fastest varying dimension at a time. Hence, callers having an
+ *     N-dimensional path (e.g., `ndarray_function_apply`) must **not** route
+ *     operands whose data types exactly match `types` through this function
+ *     (see `ndarray_function_apply_casting`).
+ * -   Casts from input data types to `types` and from `types` to output data
+ *     types must be allowed according to the specified casting mode.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param nin      number of input ndarrays
+ * @param narrays  total number of ndarrays (inputs followed by outputs)
+ * @param arrays   array containing pointers to input and output ndarrays
+ * @param types    data types expected by `fcn`
+ * @param casting  casting mode
+ * @param fcn      function to apply to each chunk
+ * @param ctx      function context
+ * @return         status code
+ *
+ * @example
+ * #include "ndarray/base/buffered.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray.h"
+ * #include <stdint.h>
+ *
+ * static int8_t sqrt_f64(struct ndarray *arrays[], void *ctx) {
+ *     // ...
+ * }
+ *
+ * // ...
+ *
+ * // Apply a `float64` kernel to a `float32` input and a `float32` output:
+ * struct ndarray *arrays[] = {x, y};
+ * int32_t types[] = {NDARRAY_FLOAT64, NDARRAY_FLOAT64};
+ *
+ * int8_t status = ndarray_buffered_apply(
+ *     1, 2, arrays, types, NDARRAY_SAME_KIND_CASTING, sqrt_f64, NULL
+ * );
+ */
+int8_t ndarray_buffered_apply(
+    const int32_t nin, const int32_t narrays, struct ndarray* arrays[],
+    const int32_t* types, const enum NDARRAY_CASTING_MODE casting,
+    ndarrayBufferedFcn fcn, void* ctx
+) {
+  struct ndarrayBufferedOperand* ops;
+  struct ndarrayBufferedOperand* op;
+  struct ndarray** args;
+  struct ndarray* views;
+  struct ndarray* out;
+  struct ndarray* arr;
+  int64_t shape[1];
+  int64_t* outer;
+  uint8_t* bufs;
+  int64_t nbytes;
+  int64_t flags;
+  int64_t ndims;
+  int64_t nbuf;
+  int64_t meta;
+  int64_t len;
+  int64_t off;
+  uint8_t* p;
+  int8_t status;
+  int16_t from;
+  int16_t to;
+  int8_t io;
+  int64_t* sub;
+  int64_t no;
+  int64_t N;
+  int64_t B;
+  int64_t n;
+  int64_t a;
+  int64_t d;
+  int64_t i;
+  int64_t j;
+  int32_t k;
+
+  if (arrays == NULL || types == NULL || fcn == NULL || narrays < 1 ||
+      nin < 0 || nin > narrays) {
+    return -1;
+  }
+  out   = arrays[narrays - 1];
+  ndims = out->ndims;
+
+  // Validate the operands and determine which operands require conversion...
+  nbuf = 0;
+  for (k = 0; k < narrays; k++) {
+    arr = arrays[k];
+    if (arr->ndims != ndims) {
+      return -1;
+    }
+    for (i = 0; i < ndims; i++) {
+      if (arr->shape[i] != out->shape[i]) {
+        return -1;
+      }
+    }
+    if (types[k] == arr->dtype) {
+      continue;
+    }
+    if (types[k] < 0 || types[k] > INT16_MAX) {
+      return -1;
+    }
+    // Inputs are converted to `types`, and outputs are converted from
+    // `types`...
+    if (k < nin) {
+      from = arr->dtype;
+      to   = (int16_t)types[k];
+    } else {
+      from = (int16_t)types[k];
+      to   = arr->dtype;
+    }
+    if (!ndarray_is_allowed_data_type_cast(from, to, casting) ||
+        ndarray_strided_cast_function(from, to) == NULL) {
+      return -1;
+    }
+    nbuf += ndarray_bytes_per_element(types[k]);
+  }
+  len = (ndims == 0) ? 1 : ndarray_numel(ndims, out->shape);
+  if (len == 0) {
+    return 0;
+  }
+  // Allocate scratch memory for operand state, chunk views, and outer loop
+  // dimensions and subscripts:
+  meta = (narrays * (int64_t)(sizeof(struct ndarrayBufferedOperand) +
+                              sizeof(struct ndarray) + sizeof(struct ndarray*))
+         ) +
+         (2 * ndims * (int64_t)sizeof(int64_t));
+  ops = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, meta);
+  if (ops == NULL) {
+    return -1;
+  }
+  views = (struct ndarray*)(ops + narrays);
+  args  = (struct ndarray**)(views + narrays);
+  outer = (int64_t*)(args + narrays);
+  sub   = outer + ndims;
+
+  // Determine whether we can iterate over the operands' underlying byte
+  // arrays (i.e., whether all operands are contiguous and have the same memory
+  // layout)...
+  flags = NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG |
+          NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG;
+  io    = ndarray_iteration_order(ndims, out->strides);
+  for (k = 0; k < narrays; k++) {
+    flags &= arrays[k]->flags;
+    if (ndarray_iteration_order(ndims, arrays[k]->strides) != io) {
+      flags = 0;
+    }
+  }
+  no = 0;
+  if (ndims == 0 || (flags != 0 && io != 0)) {
+    N = len;
+    for (k = 0; k < narrays; k++) {
+      arr           = arrays[k];
+      ops[k].ptr    = arr->data + ndarray_min_view_buffer_index(
+                                   ndims, arr->shape, arr->strides, arr->offset
+                               );
+      ops[k].stride = arr->BYTES_PER_ELEMENT;
+    }
+  } else {
+    // Find the output's fastest varying (non-singleton) dimension...
+    a = ndims - 1;
+    for (i = 0; i < ndims; i++) {
+      if (out->shape[i] > 1 &&
+          (out->shape[a] == 1 || ndarray_buffered_abs(out->strides[i]) <
+                                     ndarray_buffered_abs(out->strides[a]))) {
+        a = i;
+      }
+    }
+    N = out->shape[a];
+    for (k = 0; k < narrays; k++) {
+      arr           = arrays[k];
+      ops[k].ptr    = arr->data + arr->offset;
+      ops[k].stride = arr->strides[a];
+    }
+    // Collect the remaining dimensions, sorted by increasing output stride,
+    // such that the outer loops visit output elements in memory order...
+    for (i = 0; i < ndims; i++) {
+      if (out->shape[i] == 1 || i == a) {
+        continue;
+      }
+      for (j = no; j > 0 && ndarray_buffered_abs(out->strides[outer[j - 1]]) >
+                                ndarray_buffered_abs(out->strides[i]);
+           j--) {
+        outer[j] = outer[j - 1];
+      }
+      outer[j] = i;
+      sub[no]  = 0;
+      no += 1;
+    }
+  }
+  // Determine the chunk size:
+  B = N;
+  if (nbuf > 0) {
+    B = NDARRAY_BUFFERED_BYTES / nbuf;
+    if (B < NDARRAY_BUFFERED_MIN_CHUNK) {
+      B = NDARRAY_BUFFERED_MIN_CHUNK;
+    }
+    if (B > N) {
+      B = N;
+    }
+  }
+  // Allocate scratch buffers for the converted operands:
+  nbuf = 0;
+  for (k = 0; k < narrays; k++) {
+    if (types[k] != arrays[k]->dtype) {
+      nbuf += ndarray_buffered_size(B, ndarray_bytes_per_element(types[k]));
+    }
+  }
+  bufs = NULL;
+  if (nbuf > 0) {
+    bufs = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbuf);
+    if (bufs == NULL) {
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, ops, meta);
+      return -1;
+    }
+  }
+  // Initialize the chunk views...
+  off = 0;
+  for (k = 0; k < narrays; k++) {
+    arr      = arrays[k];
+    op       = &(ops[k]);
+    views[k] = *arr;
+    if (types[k] == arr->dtype) {
+      op->cast    = NULL;
+      op->buf     = NULL;
+      op->vstride = op->stride;
+    } else {
+      nbytes = ndarray_bytes_per_element(types[k]);
+      if (k < nin) {
+        op->cast = ndarray_strided_cast_function(arr->dtype, (int16_t)types[k]);
+      } else {
+        op->cast = ndarray_strided_cast_function((int16_t)types[k], arr->dtype);
+      }
+      op->buf     = bufs + off;
+      op->vstride = nbytes;
+      off += ndarray_buffered_size(B, nbytes);
+
+      views[k].dtype             = (int16_t)types[k];
+      views[k].data              = op->buf;
+      views[k].offset            = 0;
+      views[k].BYTES_PER_ELEMENT = nbytes;
+    }
+    views[k].ndims   = 1;
+    views[k].shape   = shape;
+    views[k].strides = &(op->vstride);
+    views[k].flags   = (ndarray_buffered_abs(op->vstride) ==
+                      views[k].BYTES_PER_ELEMENT)
+                           ? (NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG |
+                              NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG)
+                           : 0;
+    args[k] = &(views[k]);
+  }
+  status = 0;
+  do {
+    for (j = 0; j < N; j += B) {
+      n        = (N - j < B) ? N - j : B;
+      shape[0] = n;
+      for (k = 0; k < narrays; k++) {
+        op = &(ops[k]);
+        p  = op->ptr + (j * op->stride);  // pointer arithmetic
+        if (op->cast == NULL) {
+          views[k].offset = p - views[k].data;
+        } else if (k < nin) {
+          op->cast(p, op->stride, op->buf, op->vstride, n);
+        }
+        views[k].length     = n;
+        views[k].byteLength = n * views[k].BYTES_PER_ELEMENT;
+      }
+      status = fcn(args, ctx);
+      if (status != 0) {
+        break;
+      }
+      for (k = nin; k < narrays; k++) {
+        op = &(ops[k]);
+        if (op->cast != NULL) {
+          p = op->ptr + (j * op->stride);  // pointer arithmetic
+          op->cast(op->buf, op->vstride, p, op->stride, n);
+        }
+      }
+    }
+    if (status != 0) {
+      break;
+    }
+    // Advance the outer loop subscripts...
+    for (i = 0; i < no; i++) {
+      d = outer[i];
+      sub[i] += 1;
+      for (k = 0; k < narrays; k++) {
+        ops[k].ptr += arrays[k]->strides[d];  // pointer arithmetic
+      }
+      if (sub[i] < out->shape[d]) {
+        break;
+      }
+      for (k = 0; k < narrays; k++) {
+        ops[k].ptr -= arrays[k]->strides[d] * out->shape[d];
+      }
+      sub[i] = 0;
+    }
+  } while (i < no);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, bufs, nbuf);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, ops, meta);
+  return (status == 0) ? 0 : -1;
+}
@@ -7,6 +7,7 @@
 
 #include "ndarray/base/bytes_per_element.h"
 #include <stdint.h>
+#include "ndarray/base/dtype_registry.h"
 #include "ndarray/dtypes.h"
 
 /**
@@ -14,6 +15,8 @@
  *
  * ## Notes
  *
+ * -   The function supports registered user-defined data types (see
+ *     `ndarray_dtype_register`).
  * -   If unable to resolve a provided data type, the function returns `0`.
  *
  * @param dtype  data type (number)
@@ -68,6 +71,7 @@ int64_t ndarray_bytes_per_element(enum NDARRAY_DTYPE dtype) {
       return NDARRAY_COMPLEX128_BYTES_PER_ELEMENT;
 
     default:
-      return 0;  // data type is not currently supported
+      // Check whether the data type is a registered user-defined data type:
+      return ndarray_dtype_bytes_per_element(dtype);
   }
 }
@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/cast.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray/base/dtype_registry.h"
+#include "ndarray/dtypes.h"
+
+/**
+ * Converts a double-precision floating-point number to a clamped unsigned 8-bit
+ * integer (i.e., rounding to the nearest integer and clamping to `[0,255]`).
+ *
+ * @private
+ * @param x  input value
+ * @return   clamped value
+ */
+static inline uint8_t ndarray_cast_clamp_uint8(const double x) {
+  if (x > 0.0) {
+    if (x >= 255.0) {
+      return 255;
+    }
+    return (uint8_t)lrint(x);
+  }
+  // Note: this branch also handles `NaN`...
+  return 0;
+}
+
+// Define a macro which evaluates to `1` if an integer type is signed (note:
+// comparing against `1`, rather than `0`, avoids "always false" warnings for
+// unsigned types):
+#define NDARRAY_CAST_IS_SIGNED(type) ((type)-1 < (type)1)
+
+// Define a macro which evaluates to the maximum value of an integer type:
+#define NDARRAY_CAST_MAX(type)                                                 \
+  (NDARRAY_CAST_IS_SIGNED(type)                                                \
+       ? (type)((UINT64_C(1) << (8 * sizeof(type) - 1)) - 1)                   \
+       : (type)UINT64_MAX)
+
+// Define a macro which evaluates to the minimum value of an integer type:
+#define NDARRAY_CAST_MIN(type)                                                 \
+  (NDARRAY_CAST_IS_SIGNED(type) ? (type)(-NDARRAY_CAST_MAX(type) - 1)          \
+                                : (type)0)
+
+// Define a macro for converting a double-precision floating-point number to an
+// integer type, truncating toward zero, clamping to the range of the integer
+// type, and converting `NaN` to `0` (note: the bounds are exclusive, such that
+// they remain exact when rounded to double precision, e.g., `2^63` for
+// `int64_t`):
+#define NDARRAY_CAST_CLAMP(type, x)                                            \
+  (((x) != (x)) ? (type)0                                                      \
+   : ((x) >= (double)NDARRAY_CAST_MAX(type) + 1.0) ? NDARRAY_CAST_MAX(type)    \
+   : ((x) <= (double)NDARRAY_CAST_MIN(type) - 1.0) ? NDARRAY_CAST_MIN(type)    \
+   : (type)(x))
+
+// Define a list of supported input data types in the form
+// `(dtype, char, type, kind)`, where `kind` is one of `R` (integer; including
+// booleans when read as input), `F` (real floating-point), or `C` (complex; in
+// which case `type` is the type of each complex component):
+#define NDARRAY_CAST_INPUT_DTYPES(X)   \
+  X(NDARRAY_BOOL, x, bool, R)          \
+  X(NDARRAY_INT8, s, int8_t, R)        \
+  X(NDARRAY_UINT8, b, uint8_t, R)      \
+  X(NDARRAY_UINT8C, a, uint8_t, R)     \
+  X(NDARRAY_INT16, k, int16_t, R)      \
+  X(NDARRAY_UINT16, t, uint16_t, R)    \
+  X(NDARRAY_INT32, i, int32_t, R)      \
+  X(NDARRAY_UINT32, u, uint32_t, R)    \
+  X(NDARRAY_INT64, l, int64_t, R)      \
+  X(NDARRAY_UINT64, v, uint64_t, R)    \
+  X(NDARRAY_FLOAT32, f, float, F)      \
+  X(NDARRAY_FLOAT64, d, double, F)     \
+  X(NDARRAY_COMPLEX64, c, float, C)    \
+  X(NDARRAY_COMPLEX128, z, double, C)
+
+// Define a list of supported output data types in the form
+// `(..., dtype, char, type, kind)`, where `kind` is one of `B` (boolean), `I`
+// (integer), `R` (real floating-point), `A` (clamped unsigned 8-bit integer),
+// or `C` (complex):
+#define NDARRAY_CAST_OUTPUT_DTYPES(X, ...)        \
+  X(__VA_ARGS__, NDARRAY_BOOL, x, bool, B)        \
+  X(__VA_ARGS__, NDARRAY_INT8, s, int8_t, I)      \
+  X(__VA_ARGS__, NDARRAY_UINT8, b, uint8_t, I)    \
+  X(__VA_ARGS__, NDARRAY_UINT8C, a, uint8_t, A)   \
+  X(__VA_ARGS__, NDARRAY_INT16, k, int16_t, I)    \
+  X(__VA_ARGS__, NDARRAY_UINT16, t, uint16_t, I)  \
+  X(__VA_ARGS__, NDARRAY_INT32, i, int32_t, I)    \
+  X(__VA_ARGS__, NDARRAY_UINT32, u, uint32_t, I)  \
+  X(__VA_ARGS__, NDARRAY_INT64, l, int64_t, I)    \
+  X(__VA_ARGS__, NDARRAY_UINT64, v, uint64_t, I)  \
+  X(__VA_ARGS__, NDARRAY_FLOAT32, f, float, R)    \
+  X(__VA_ARGS__, NDARRAY_FLOAT64, d, double, R)   \
+  X(__VA_ARGS__, NDARRAY_COMPLEX64, c, float, C)  \
+  X(__VA_ARGS__, NDARRAY_COMPLEX128, z, double, C)
+
+// Define a macro for generating the signature of a strided cast function:
+#define NDARRAY_CAST_SIGNATURE(name)                                           \
+  static void name(                                                            \
+      const uint8_t* in, const int64_t sin, uint8_t* out, const int64_t sout,  \
+      const int64_t n                                                          \
+  )
+
+// real => boolean:
+#define NDARRAY_CAST_R_B(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = (*(const tin*)in != 0);                                    \
+    }                                                                          \
+  }
+
+// real => real:
+#define NDARRAY_CAST_R_R(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = (tout)(*(const tin*)in);                                   \
+    }                                                                          \
+  }
+
+// integer => integer (note: conversion between integer types is well-defined,
+// such that a plain cast suffices):
+#define NDARRAY_CAST_R_I NDARRAY_CAST_R_R
+
+// real => clamped unsigned 8-bit integer:
+#define NDARRAY_CAST_R_A(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = ndarray_cast_clamp_uint8((double)(*(const tin*)in));       \
+    }                                                                          \
+  }
+
+// real => complex:
+#define NDARRAY_CAST_R_C(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      ((tout*)out)[0] = (tout)(*(const tin*)in);                               \
+      ((tout*)out)[1] = (tout)0;                                               \
+    }                                                                          \
+  }
+
+// floating-point => boolean, real, clamped unsigned 8-bit integer, or complex:
+#define NDARRAY_CAST_F_B NDARRAY_CAST_R_B
+#define NDARRAY_CAST_F_R NDARRAY_CAST_R_R
+#define NDARRAY_CAST_F_A NDARRAY_CAST_R_A
+#define NDARRAY_CAST_F_C NDARRAY_CAST_R_C
+
+// floating-point => integer (note: a bare cast is undefined for `NaN`,
+// infinities, and out-of-range values, so values are clamped instead):
+#define NDARRAY_CAST_F_I(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    double x;                                                                  \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      x           = (double)(*(const tin*)in);                                 \
+      *(tout*)out = NDARRAY_CAST_CLAMP(tout, x);                               \
+    }                                                                          \
+  }
+
+// complex => boolean (note: a complex number is "truthy" if either component is
+// nonzero):
+#define NDARRAY_CAST_C_B(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = (((const tin*)in)[0] != 0 || ((const tin*)in)[1] != 0);    \
+    }                                                                          \
+  }
+
+// complex => real (note: the imaginary component is discarded):
+#define NDARRAY_CAST_C_R(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = (tout)(((const tin*)in)[0]);                               \
+    }                                                                          \
+  }
+
+// complex => integer (note: the imaginary component is discarded, and the real
+// component is clamped as for floating-point numbers):
+#define NDARRAY_CAST_C_I(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    double x;                                                                  \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      x           = (double)(((const tin*)in)[0]);                             \
+      *(tout*)out = NDARRAY_CAST_CLAMP(tout, x);                               \
+    }                                                                          \
+  }
+
+// complex => clamped unsigned 8-bit integer:
+#define NDARRAY_CAST_C_A(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      *(tout*)out = ndarray_cast_clamp_uint8((double)(((const tin*)in)[0]));   \
+    }                                                                          \
+  }
+
+// complex => complex (note: if both input and output elements are contiguous,
+// components are converted as a single flat sequence, which compilers can
+// vectorize, e.g., when converting between single- and double-precision):
+#define NDARRAY_CAST_C_C(name, tin, tout)                                      \
+  NDARRAY_CAST_SIGNATURE(name) {                                               \
+    const tin* pin;                                                            \
+    tout* pout;                                                                \
+    int64_t i;                                                                 \
+    if (sin == 2 * (int64_t)sizeof(tin) &&                                     \
+        sout == 2 * (int64_t)sizeof(tout)) {                                   \
+      pin  = (const tin*)in;                                                   \
+      pout = (tout*)out;                                                       \
+      for (i = 0; i < 2 * n; i++) {                                            \
+        pout[i] = (tout)pin[i];                                                \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      ((tout*)out)[0] = (tout)(((const tin*)in)[0]);                           \
+      ((tout*)out)[1] = (tout)(((const tin*)in)[1]);                           \
+    }                                                                          \
+  }
+
+// Define a macro for defining a single strided cast function:
+#define NDARRAY_CAST_DEFINE(din, cin, tin, kin, dout, cout, tout, kout) \
+  NDARRAY_CAST_##kin##_##kout(ndarray_cast_##cin##_##cout, tin, tout)
+
+// Define a macro for defining all strided cast functions for an input type:
+#define NDARRAY_CAST_DEFINE_ROW(din, cin, tin, kin) \
+  NDARRAY_CAST_OUTPUT_DTYPES(NDARRAY_CAST_DEFINE, din, cin, tin, kin)
+
+// Define strided cast functions for all pairs of supported data types:
+NDARRAY_CAST_INPUT_DTYPES(NDARRAY_CAST_DEFINE_ROW)
+
+// Define a macro for generating a single cast table entry:
+#define NDARRAY_CAST_TABLE_ENTRY(din, cin, dout, cout, tout, kout) \
+  [dout] = ndarray_cast_##cin##_##cout,
+
+// Define a macro for generating a cast table row:
+#define NDARRAY_CAST_TABLE_ROW(din, cin, tin, kin) \
+  [din] = {NDARRAY_CAST_OUTPUT_DTYPES(NDARRAY_CAST_TABLE_ENTRY, din, cin)},
+
+// Define a table of strided cast functions, where the first index is the input
+// data type and the second index is the output data type:
+static const ndarrayStridedCastFcn NDARRAY_CAST_TABLE[NDARRAY_NDTYPES]
+                                                     [NDARRAY_NDTYPES] = {
+    NDARRAY_CAST_INPUT_DTYPES(NDARRAY_CAST_TABLE_ROW)};
+
+/**
+ * Returns a function for converting strided elements from one data type to
+ * another data type.
+ *
+ * ## Notes
+ *
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers (including clamped unsigned 8-bit integers), single- and
+ *     double-precision floating-point numbers, and single- and double-precision
+ *     complex floating-point numbers.
+ * -   Conversions follow C conversion semantics, with the following
+ *     exceptions:
+ *
+ *     -   Conversion to a boolean yields `true` if a value is nonzero (for
+ *         complex numbers, if either component is nonzero).
+ *     -   Conversion to a clamped unsigned 8-bit integer rounds to the nearest
+ *         integer and clamps to `[0,255]` (`NaN` converts to `0`).
+ *     -   Conversion from a floating-point or complex number to any other
+ *         integer type truncates toward zero and clamps to the range of the
+ *         integer type (`NaN` converts to `0`), as a plain C conversion is
+ *         undefined for `NaN`, infinities, and out-of-range values.
+ *     -   Conversion from a complex number to a real number discards the
+ *         imaginary component.
+ *
+ * -   The function does **not** check whether a conversion is "allowed" (see
+ *     `ndarray_is_allowed_data_type_cast`).
+ * -   Conversions involving user-defined data types must be registered (see
+ *     `ndarray_dtype_register_cast`), except for copying elements of a
+ *     user-defined data type.
+ * -   If a conversion is not supported, the function returns a null pointer.
+ *
+ * @param from  input data type
+ * @param to    output data type
+ * @return      strided cast function
+ *
+ * @example
+ * #include "ndarray/base/cast.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * double x[] = {1.0, 2.0, 3.0, 4.0};
+ * float y[] = {0.0f, 0.0f};
+ *
+ * ndarrayStridedCastFcn f = ndarray_strided_cast_function(
+ *     NDARRAY_FLOAT64, NDARRAY_FLOAT32);
+ *
+ * // Convert every other element:
+ * f((uint8_t *)x, 16, (uint8_t *)y, 4, 2);
+ * // y => {1.0f, 3.0f}
+ */
+ndarrayStridedCastFcn ndarray_strided_cast_function(
+    const int16_t from, const int16_t to
+) {
+  // Check whether a conversion involves a user-defined data type...
+  if (from >= NDARRAY_USERDEFINED_TYPE || to >= NDARRAY_USERDEFINED_TYPE) {
+    return ndarray_dtype_cast_function(from, to);
+  }
+  if (from < 0 || from >= NDARRAY_NDTYPES || to < 0 || to >= NDARRAY_NDTYPES) {
+    return NULL;
+  }
+  return NDARRAY_CAST_TABLE[from][to];
+}
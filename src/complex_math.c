@@ -0,0 +1,1213 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/complex_math.h"
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/buffered.h"
+#include "ndarray/base/cpu_features.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/cpu_features.h"
+#include "ndarray/dtypes.h"
+
+// Only compile vectorized kernels for x86 targets when the compiler supports
+// enabling instruction sets on a per function basis:
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NDARRAY_COMPLEX_X86 1
+#include <immintrin.h>
+#define NDARRAY_COMPLEX_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Define the supported operations:
+#define NDARRAY_COMPLEX_OP_ADD 0
+#define NDARRAY_COMPLEX_OP_SUB 1
+#define NDARRAY_COMPLEX_OP_MUL 2
+#define NDARRAY_COMPLEX_OP_DIV 3
+#define NDARRAY_COMPLEX_OP_CONJ 4
+#define NDARRAY_COMPLEX_OP_EXP 5
+#define NDARRAY_COMPLEX_OP_ABS 6
+#define NDARRAY_COMPLEX_OP_ARG 7
+
+/**
+ * Function pointer type for a strided kernel applying a binary operation to
+ * interleaved complex numbers.
+ *
+ * @private
+ * @param x    first input elements
+ * @param sx   first input stride (in bytes)
+ * @param y    second input elements
+ * @param sy   second input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+typedef void (*ndarrayComplexBinaryFcn)(
+    const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,
+    uint8_t* out, const int64_t so, const int64_t n
+);
+
+/**
+ * Function pointer type for a strided kernel applying a unary operation to
+ * interleaved complex numbers (note: the output elements may be complex or
+ * real numbers, depending on the operation).
+ *
+ * @private
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+typedef void (*ndarrayComplexUnaryFcn)(
+    const uint8_t* x, const int64_t sx, uint8_t* out, const int64_t so,
+    const int64_t n
+);
+
+/**
+ * Structure describing a binary kernel implementation.
+ *
+ * @private
+ */
+struct ndarrayComplexBinaryKernel {
+  // Operation:
+  int8_t op;
+
+  // Complex data type:
+  int16_t dtype;
+
+  // Required CPU features:
+  int64_t features;
+
+  // Kernel:
+  ndarrayComplexBinaryFcn fcn;
+};
+
+/**
+ * Structure describing a unary kernel implementation.
+ *
+ * @private
+ */
+struct ndarrayComplexUnaryKernel {
+  // Operation:
+  int8_t op;
+
+  // Complex data type:
+  int16_t dtype;
+
+  // Required CPU features:
+  int64_t features;
+
+  // Kernel:
+  ndarrayComplexUnaryFcn fcn;
+};
+
+// Define macros for resolving single- (`c`) and double-precision (`z`) math
+// functions:
+#define NDARRAY_COMPLEX_MATH_c(fcn) fcn##f
+#define NDARRAY_COMPLEX_MATH_z(fcn) fcn
+
+// Define a macro for defining scalar operations on complex numbers having
+// components of a specified type (note: each operation receives components by
+// value, such that the output may alias the input):
+#define NDARRAY_COMPLEX_DEFINE_SCALAR(c, type)                                 \
+  static inline void ndarray_complex_add_scalar_##c(                           \
+      const type ar, const type ai, const type br, const type bi, type* o      \
+  ) {                                                                          \
+    o[0] = ar + br;                                                            \
+    o[1] = ai + bi;                                                            \
+  }                                                                            \
+  static inline void ndarray_complex_sub_scalar_##c(                           \
+      const type ar, const type ai, const type br, const type bi, type* o      \
+  ) {                                                                          \
+    o[0] = ar - br;                                                            \
+    o[1] = ai - bi;                                                            \
+  }                                                                            \
+  static inline void ndarray_complex_mul_scalar_##c(                           \
+      const type ar, const type ai, const type br, const type bi, type* o      \
+  ) {                                                                          \
+    o[0] = (ar * br) - (ai * bi);                                              \
+    o[1] = (ar * bi) + (ai * br);                                              \
+  }                                                                            \
+  static inline void ndarray_complex_div_scalar_##c(                           \
+      const type ar, const type ai, const type br, const type bi, type* o      \
+  ) {                                                                          \
+    type abr = NDARRAY_COMPLEX_MATH_##c(fabs)(br);                             \
+    type abi = NDARRAY_COMPLEX_MATH_##c(fabs)(bi);                             \
+    type rat;                                                                  \
+    type scl;                                                                  \
+    type p;                                                                    \
+    type q;                                                                    \
+    type u;                                                                    \
+    type v;                                                                    \
+    if (abr == 0 && abi == 0) {                                                \
+      o[0] = ar / abr;                                                         \
+      o[1] = ai / abi;                                                         \
+      return;                                                                  \
+    }                                                                          \
+    if (abr >= abi) {                                                          \
+      p = br;                                                                  \
+      q = bi;                                                                  \
+      u = ar;                                                                  \
+      v = ai;                                                                  \
+    } else {                                                                   \
+      p = bi;                                                                  \
+      q = br;                                                                  \
+      u = ai;                                                                  \
+      v = ar;                                                                  \
+    }                                                                          \
+    rat  = q / p;                                                              \
+    scl  = (type)1 / (p + (q * rat));                                          \
+    o[0] = (u + (v * rat)) * scl;                                              \
+    o[1] = (v - (u * rat)) * scl;                                              \
+    if (!(abr >= abi)) {                                                       \
+      o[1] = -o[1];                                                            \
+    }                                                                          \
+  }                                                                            \
+  static inline void ndarray_complex_conj_scalar_##c(                          \
+      const type ar, const type ai, type* o                                    \
+  ) {                                                                          \
+    o[0] = ar;                                                                 \
+    o[1] = -ai;                                                                \
+  }                                                                            \
+  static inline void ndarray_complex_exp_scalar_##c(                           \
+      const type ar, const type ai, type* o                                    \
+  ) {                                                                          \
+    type e = NDARRAY_COMPLEX_MATH_##c(exp)(ar);                                \
+    if (ai == 0) {                                                             \
+      o[0] = e;                                                                \
+      o[1] = ai;                                                               \
+      return;                                                                  \
+    }                                                                          \
+    o[0] = e * NDARRAY_COMPLEX_MATH_##c(cos)(ai);                              \
+    o[1] = e * NDARRAY_COMPLEX_MATH_##c(sin)(ai);                              \
+  }                                                                            \
+  static inline void ndarray_complex_abs_scalar_##c(                           \
+      const type ar, const type ai, type* o                                    \
+  ) {                                                                          \
+    o[0] = NDARRAY_COMPLEX_MATH_##c(hypot)(ar, ai);                            \
+  }                                                                            \
+  static inline void ndarray_complex_arg_scalar_##c(                           \
+      const type ar, const type ai, type* o                                    \
+  ) {                                                                          \
+    o[0] = NDARRAY_COMPLEX_MATH_##c(atan2)(ai, ar);                            \
+  }
+
+NDARRAY_COMPLEX_DEFINE_SCALAR(c, float)
+NDARRAY_COMPLEX_DEFINE_SCALAR(z, double)
+
+// Define a macro for defining a generic strided kernel for a binary operation
+// (note: contiguous elements are processed by a separate loop, which compilers
+// can vectorize):
+#define NDARRAY_COMPLEX_DEFINE_BINARY(op, c, type)                             \
+  static void ndarray_complex_##op##_##c(                                      \
+      const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,  \
+      uint8_t* out, const int64_t so, const int64_t n                          \
+  ) {                                                                          \
+    const int64_t s = 2 * (int64_t)sizeof(type);                               \
+    const type* a;                                                             \
+    const type* b;                                                             \
+    type* o;                                                                   \
+    int64_t i;                                                                 \
+    if (sx == s && sy == s && so == s) {                                       \
+      a = (const type*)x;                                                      \
+      b = (const type*)y;                                                      \
+      o = (type*)out;                                                          \
+      for (i = 0; i < n; i++) {                                                \
+        ndarray_complex_##op##_scalar_##c(                                     \
+            a[2 * i], a[(2 * i) + 1], b[2 * i], b[(2 * i) + 1], o + (2 * i)    \
+        );                                                                     \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    for (i = 0; i < n; i++, x += sx, y += sy, out += so) {                     \
+      a = (const type*)x;                                                      \
+      b = (const type*)y;                                                      \
+      ndarray_complex_##op##_scalar_##c(a[0], a[1], b[0], b[1], (type*)out);   \
+    }                                                                          \
+  }
+
+// Define a macro for defining a generic strided kernel for a unary operation
+// producing `N` output components per element:
+#define NDARRAY_COMPLEX_DEFINE_UNARY(op, c, type, N)                           \
+  static void ndarray_complex_##op##_##c(                                      \
+      const uint8_t* x, const int64_t sx, uint8_t* out, const int64_t so,      \
+      const int64_t n                                                          \
+  ) {                                                                          \
+    const type* a;                                                             \
+    type* o;                                                                   \
+    int64_t i;                                                                 \
+    if (sx == 2 * (int64_t)sizeof(type) && so == N * (int64_t)sizeof(type)) {  \
+      a = (const type*)x;                                                      \
+      o = (type*)out;                                                          \
+      for (i = 0; i < n; i++) {                                                \
+        ndarray_complex_##op##_scalar_##c(                                     \
+            a[2 * i], a[(2 * i) + 1], o + (N * i)                              \
+        );                                                                     \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    for (i = 0; i < n; i++, x += sx, out += so) {                              \
+      a = (const type*)x;                                                      \
+      ndarray_complex_##op##_scalar_##c(a[0], a[1], (type*)out);               \
+    }                                                                          \
+  }
+
+NDARRAY_COMPLEX_DEFINE_BINARY(add, c, float)
+NDARRAY_COMPLEX_DEFINE_BINARY(add, z, double)
+NDARRAY_COMPLEX_DEFINE_BINARY(sub, c, float)
+NDARRAY_COMPLEX_DEFINE_BINARY(sub, z, double)
+NDARRAY_COMPLEX_DEFINE_BINARY(mul, c, float)
+NDARRAY_COMPLEX_DEFINE_BINARY(mul, z, double)
+NDARRAY_COMPLEX_DEFINE_BINARY(div, c, float)
+NDARRAY_COMPLEX_DEFINE_BINARY(div, z, double)
+NDARRAY_COMPLEX_DEFINE_UNARY(conj, c, float, 2)
+NDARRAY_COMPLEX_DEFINE_UNARY(conj, z, double, 2)
+NDARRAY_COMPLEX_DEFINE_UNARY(exp, c, float, 2)
+NDARRAY_COMPLEX_DEFINE_UNARY(exp, z, double, 2)
+NDARRAY_COMPLEX_DEFINE_UNARY(abs, c, float, 1)
+NDARRAY_COMPLEX_DEFINE_UNARY(abs, z, double, 1)
+NDARRAY_COMPLEX_DEFINE_UNARY(arg, c, float, 1)
+NDARRAY_COMPLEX_DEFINE_UNARY(arg, z, double, 1)
+
+#ifdef NDARRAY_COMPLEX_X86
+/**
+ * Multiplies single-precision complex numbers using AVX2 and FMA
+ * instructions.
+ *
+ * ## Notes
+ *
+ * -   Each vector holds four interleaved complex numbers. The real and
+ *     imaginary components of the second operand are broadcast within each
+ *     complex number (`moveldup` and `movehdup`), and the components of the
+ *     first operand are swapped (`permute`), such that a single `fmaddsub`
+ *     computes `ar*br - ai*bi` in even lanes and `ai*br + ar*bi` in odd lanes.
+ * -   Non-contiguous elements and remaining elements are processed by the
+ *     generic kernel.
+ *
+ * @private
+ * @param x    first input elements
+ * @param sx   first input stride (in bytes)
+ * @param y    second input elements
+ * @param sy   second input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_mul_avx2_c(
+    const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,
+    uint8_t* out, const int64_t so, const int64_t n
+) {
+  const float* a = (const float*)x;
+  const float* b = (const float*)y;
+  float* o       = (float*)out;
+  __m256 va;
+  __m256 vb;
+  __m256 t;
+  int64_t i;
+
+  if (sx != 8 || sy != 8 || so != 8) {
+    ndarray_complex_mul_c(x, sx, y, sy, out, so, n);
+    return;
+  }
+  for (i = 0; i + 4 <= n; i += 4) {
+    va = _mm256_loadu_ps(a + (2 * i));
+    vb = _mm256_loadu_ps(b + (2 * i));
+    t  = _mm256_mul_ps(_mm256_permute_ps(va, 0xB1), _mm256_movehdup_ps(vb));
+    _mm256_storeu_ps(
+        o + (2 * i), _mm256_fmaddsub_ps(va, _mm256_moveldup_ps(vb), t)
+    );
+  }
+  ndarray_complex_mul_c(
+      x + (i * 8), sx, y + (i * 8), sy, out + (i * 8), so, n - i
+  );
+}
+
+/**
+ * Multiplies double-precision complex numbers using AVX2 and FMA
+ * instructions.
+ *
+ * ## Notes
+ *
+ * -   Each vector holds two interleaved complex numbers (see
+ *     `ndarray_complex_mul_avx2_c`).
+ *
+ * @private
+ * @param x    first input elements
+ * @param sx   first input stride (in bytes)
+ * @param y    second input elements
+ * @param sy   second input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_mul_avx2_z(
+    const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,
+    uint8_t* out, const int64_t so, const int64_t n
+) {
+  const double* a = (const double*)x;
+  const double* b = (const double*)y;
+  double* o       = (double*)out;
+  __m256d va;
+  __m256d vb;
+  __m256d t;
+  int64_t i;
+
+  if (sx != 16 || sy != 16 || so != 16) {
+    ndarray_complex_mul_z(x, sx, y, sy, out, so, n);
+    return;
+  }
+  for (i = 0; i + 2 <= n; i += 2) {
+    va = _mm256_loadu_pd(a + (2 * i));
+    vb = _mm256_loadu_pd(b + (2 * i));
+    t  = _mm256_mul_pd(_mm256_permute_pd(va, 0x5), _mm256_permute_pd(vb, 0xF));
+    _mm256_storeu_pd(
+        o + (2 * i), _mm256_fmaddsub_pd(va, _mm256_movedup_pd(vb), t)
+    );
+  }
+  ndarray_complex_mul_z(
+      x + (i * 16), sx, y + (i * 16), sy, out + (i * 16), so, n - i
+  );
+}
+
+/**
+ * Divides single-precision complex numbers using AVX2 instructions.
+ *
+ * ## Notes
+ *
+ * -   Eight complex numbers are de-interleaved into vectors of real and
+ *     imaginary components, such that Smith's algorithm can be evaluated for
+ *     all lanes using blends instead of branches. The results match
+ *     `ndarray_complex_div_scalar_c`, including for zero divisors.
+ *
+ * @private
+ * @param x    first input elements
+ * @param sx   first input stride (in bytes)
+ * @param y    second input elements
+ * @param sy   second input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_div_avx2_c(
+    const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,
+    uint8_t* out, const int64_t so, const int64_t n
+) {
+  const float* a = (const float*)x;
+  const float* b = (const float*)y;
+  float* o       = (float*)out;
+  __m256 sign;
+  __m256 zero;
+  __m256 one;
+  __m256 xr;
+  __m256 xi;
+  __m256 yr;
+  __m256 yi;
+  __m256 abr;
+  __m256 abi;
+  __m256 ca;
+  __m256 cz;
+  __m256 rat;
+  __m256 scl;
+  __m256 re;
+  __m256 im;
+  __m256 p;
+  __m256 q;
+  __m256 u;
+  __m256 v;
+  __m256 t0;
+  __m256 t1;
+  int64_t i;
+
+  if (sx != 8 || sy != 8 || so != 8) {
+    ndarray_complex_div_c(x, sx, y, sy, out, so, n);
+    return;
+  }
+  sign = _mm256_set1_ps(-0.0f);
+  zero = _mm256_setzero_ps();
+  one  = _mm256_set1_ps(1.0f);
+  for (i = 0; i + 8 <= n; i += 8) {
+    // De-interleave the components (note: lanes are permuted identically for
+    // all operands and are restored when interleaving the results):
+    t0  = _mm256_loadu_ps(a + (2 * i));
+    t1  = _mm256_loadu_ps(a + (2 * i) + 8);
+    xr  = _mm256_shuffle_ps(t0, t1, 0x88);
+    xi  = _mm256_shuffle_ps(t0, t1, 0xDD);
+    t0  = _mm256_loadu_ps(b + (2 * i));
+    t1  = _mm256_loadu_ps(b + (2 * i) + 8);
+    yr  = _mm256_shuffle_ps(t0, t1, 0x88);
+    yi  = _mm256_shuffle_ps(t0, t1, 0xDD);
+    abr = _mm256_andnot_ps(sign, yr);
+    abi = _mm256_andnot_ps(sign, yi);
+
+    // Order the divisor components by magnitude:
+    ca = _mm256_cmp_ps(abr, abi, _CMP_GE_OQ);
+    p  = _mm256_blendv_ps(yi, yr, ca);
+    q  = _mm256_blendv_ps(yr, yi, ca);
+    u  = _mm256_blendv_ps(xi, xr, ca);
+    v  = _mm256_blendv_ps(xr, xi, ca);
+
+    rat = _mm256_div_ps(q, p);
+    scl = _mm256_div_ps(one, _mm256_add_ps(p, _mm256_mul_ps(q, rat)));
+    re  = _mm256_mul_ps(_mm256_add_ps(u, _mm256_mul_ps(v, rat)), scl);
+    im  = _mm256_mul_ps(_mm256_sub_ps(v, _mm256_mul_ps(u, rat)), scl);
+    im  = _mm256_blendv_ps(_mm256_xor_ps(im, sign), im, ca);
+
+    // Handle zero divisors:
+    cz = _mm256_and_ps(
+        _mm256_cmp_ps(abr, zero, _CMP_EQ_OQ),
+        _mm256_cmp_ps(abi, zero, _CMP_EQ_OQ)
+    );
+    re = _mm256_blendv_ps(re, _mm256_div_ps(xr, abr), cz);
+    im = _mm256_blendv_ps(im, _mm256_div_ps(xi, abi), cz);
+
+    _mm256_storeu_ps(o + (2 * i), _mm256_unpacklo_ps(re, im));
+    _mm256_storeu_ps(o + (2 * i) + 8, _mm256_unpackhi_ps(re, im));
+  }
+  ndarray_complex_div_c(
+      x + (i * 8), sx, y + (i * 8), sy, out + (i * 8), so, n - i
+  );
+}
+
+/**
+ * Divides double-precision complex numbers using AVX2 instructions.
+ *
+ * ## Notes
+ *
+ * -   Four complex numbers are processed at a time (see
+ *     `ndarray_complex_div_avx2_c`).
+ *
+ * @private
+ * @param x    first input elements
+ * @param sx   first input stride (in bytes)
+ * @param y    second input elements
+ * @param sy   second input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_div_avx2_z(
+    const uint8_t* x, const int64_t sx, const uint8_t* y, const int64_t sy,
+    uint8_t* out, const int64_t so, const int64_t n
+) {
+  const double* a = (const double*)x;
+  const double* b = (const double*)y;
+  double* o       = (double*)out;
+  __m256d sign;
+  __m256d zero;
+  __m256d one;
+  __m256d xr;
+  __m256d xi;
+  __m256d yr;
+  __m256d yi;
+  __m256d abr;
+  __m256d abi;
+  __m256d ca;
+  __m256d cz;
+  __m256d rat;
+  __m256d scl;
+  __m256d re;
+  __m256d im;
+  __m256d p;
+  __m256d q;
+  __m256d u;
+  __m256d v;
+  __m256d t0;
+  __m256d t1;
+  int64_t i;
+
+  if (sx != 16 || sy != 16 || so != 16) {
+    ndarray_complex_div_z(x, sx, y, sy, out, so, n);
+    return;
+  }
+  sign = _mm256_set1_pd(-0.0);
+  zero = _mm256_setzero_pd();
+  one  = _mm256_set1_pd(1.0);
+  for (i = 0; i + 4 <= n; i += 4) {
+    // De-interleave the components:
+    t0  = _mm256_loadu_pd(a + (2 * i));
+    t1  = _mm256_loadu_pd(a + (2 * i) + 4);
+    xr  = _mm256_unpacklo_pd(t0, t1);
+    xi  = _mm256_unpackhi_pd(t0, t1);
+    t0  = _mm256_loadu_pd(b + (2 * i));
+    t1  = _mm256_loadu_pd(b + (2 * i) + 4);
+    yr  = _mm256_unpacklo_pd(t0, t1);
+    yi  = _mm256_unpackhi_pd(t0, t1);
+    abr = _mm256_andnot_pd(sign, yr);
+    abi = _mm256_andnot_pd(sign, yi);
+
+    // Order the divisor components by magnitude:
+    ca = _mm256_cmp_pd(abr, abi, _CMP_GE_OQ);
+    p  = _mm256_blendv_pd(yi, yr, ca);
+    q  = _mm256_blendv_pd(yr, yi, ca);
+    u  = _mm256_blendv_pd(xi, xr, ca);
+    v  = _mm256_blendv_pd(xr, xi, ca);
+
+    rat = _mm256_div_pd(q, p);
+    scl = _mm256_div_pd(one, _mm256_add_pd(p, _mm256_mul_pd(q, rat)));
+    re  = _mm256_mul_pd(_mm256_add_pd(u, _mm256_mul_pd(v, rat)), scl);
+    im  = _mm256_mul_pd(_mm256_sub_pd(v, _mm256_mul_pd(u, rat)), scl);
+    im  = _mm256_blendv_pd(_mm256_xor_pd(im, sign), im, ca);
+
+    // Handle zero divisors:
+    cz = _mm256_and_pd(
+        _mm256_cmp_pd(abr, zero, _CMP_EQ_OQ),
+        _mm256_cmp_pd(abi, zero, _CMP_EQ_OQ)
+    );
+    re = _mm256_blendv_pd(re, _mm256_div_pd(xr, abr), cz);
+    im = _mm256_blendv_pd(im, _mm256_div_pd(xi, abi), cz);
+
+    _mm256_storeu_pd(o + (2 * i), _mm256_unpacklo_pd(re, im));
+    _mm256_storeu_pd(o + (2 * i) + 4, _mm256_unpackhi_pd(re, im));
+  }
+  ndarray_complex_div_z(
+      x + (i * 16), sx, y + (i * 16), sy, out + (i * 16), so, n - i
+  );
+}
+
+/**
+ * Computes the absolute values of single-precision complex numbers using AVX2
+ * instructions.
+ *
+ * ## Notes
+ *
+ * -   Components are squared and summed in double precision, which can
+ *     neither overflow nor underflow for finite single-precision components,
+ *     and the square root is rounded to single precision.
+ * -   Vectors containing infinite or `NaN` components are processed by the
+ *     generic kernel, thus preserving the semantics of `hypot` (e.g., the
+ *     absolute value of a complex number having an infinite component is
+ *     infinite, even if the other component is `NaN`).
+ *
+ * @private
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_abs_avx2_c(
+    const uint8_t* x, const int64_t sx, uint8_t* out, const int64_t so,
+    const int64_t n
+) {
+  const float* a = (const float*)x;
+  float* o       = (float*)out;
+  __m256d max;
+  __m256d lo;
+  __m256d hi;
+  __m256d s;
+  __m256 v;
+  int64_t i;
+
+  if (sx != 8 || so != 4) {
+    ndarray_complex_abs_c(x, sx, out, so, n);
+    return;
+  }
+  max = _mm256_set1_pd(DBL_MAX);
+  for (i = 0; i + 4 <= n; i += 4) {
+    v  = _mm256_loadu_ps(a + (2 * i));
+    lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+    hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+
+    // Sum squared components (note: horizontal addition yields elements in the
+    // order 0, 2, 1, 3):
+    s = _mm256_hadd_pd(_mm256_mul_pd(lo, lo), _mm256_mul_pd(hi, hi));
+    s = _mm256_permute4x64_pd(s, 0xD8);
+    if (_mm256_movemask_pd(_mm256_cmp_pd(s, max, _CMP_LE_OQ)) != 0xF) {
+      ndarray_complex_abs_c(x + (i * 8), sx, out + (i * 4), so, 4);
+      continue;
+    }
+    _mm_storeu_ps(o + i, _mm256_cvtpd_ps(_mm256_sqrt_pd(s)));
+  }
+  ndarray_complex_abs_c(x + (i * 8), sx, out + (i * 4), so, n - i);
+}
+
+/**
+ * Computes the absolute values of double-precision complex numbers using AVX2
+ * instructions.
+ *
+ * ## Notes
+ *
+ * -   The absolute value is computed as the square root of the sum of squared
+ *     components. Vectors for which the sum of squares overflows, underflows
+ *     (except for zero), or is `NaN` are processed by the generic kernel,
+ *     which uses `hypot`.
+ *
+ * @private
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param out  output elements
+ * @param so   output stride (in bytes)
+ * @param n    number of elements
+ */
+static NDARRAY_COMPLEX_TARGET("avx2,fma") void ndarray_complex_abs_avx2_z(
+    const uint8_t* x, const int64_t sx, uint8_t* out, const int64_t so,
+    const int64_t n
+) {
+  const double* a = (const double*)x;
+  double* o       = (double*)out;
+  __m256d sign;
+  __m256d zero;
+  __m256d min;
+  __m256d max;
+  __m256d t0;
+  __m256d t1;
+  __m256d ok;
+  __m256d m;
+  __m256d s;
+  int64_t i;
+
+  if (sx != 16 || so != 8) {
+    ndarray_complex_abs_z(x, sx, out, so, n);
+    return;
+  }
+  sign = _mm256_set1_pd(-0.0);
+  zero = _mm256_setzero_pd();
+  min  = _mm256_set1_pd(DBL_MIN);
+  max  = _mm256_set1_pd(DBL_MAX);
+  for (i = 0; i + 4 <= n; i += 4) {
+    t0 = _mm256_loadu_pd(a + (2 * i));
+    t1 = _mm256_loadu_pd(a + (2 * i) + 4);
+
+    // Sum squared components (note: horizontal addition yields elements in the
+    // order 0, 2, 1, 3):
+    s = _mm256_hadd_pd(_mm256_mul_pd(t0, t0), _mm256_mul_pd(t1, t1));
+    s = _mm256_permute4x64_pd(s, 0xD8);
+
+    // Check for overflow and underflow (allowing exact zeros):
+    m  = _mm256_hadd_pd(_mm256_andnot_pd(sign, t0), _mm256_andnot_pd(sign, t1));
+    m  = _mm256_permute4x64_pd(m, 0xD8);
+    ok = _mm256_and_pd(
+        _mm256_cmp_pd(s, min, _CMP_GE_OQ), _mm256_cmp_pd(s, max, _CMP_LE_OQ)
+    );
+    ok = _mm256_or_pd(ok, _mm256_cmp_pd(m, zero, _CMP_EQ_OQ));
+    if (_mm256_movemask_pd(ok) != 0xF) {
+      ndarray_complex_abs_z(x + (i * 16), sx, out + (i * 8), so, 4);
+      continue;
+    }
+    _mm256_storeu_pd(o + i, _mm256_sqrt_pd(s));
+  }
+  ndarray_complex_abs_z(x + (i * 16), sx, out + (i * 8), so, n - i);
+}
+#endif
+
+// Define tables of kernels in order of preference (note: the first kernel
+// whose operation and data type match and whose required CPU features are
+// available is selected):
+static const struct ndarrayComplexBinaryKernel NDARRAY_COMPLEX_BINARY[] = {
+#ifdef NDARRAY_COMPLEX_X86
+    {NDARRAY_COMPLEX_OP_MUL, NDARRAY_COMPLEX64,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_mul_avx2_c},
+    {NDARRAY_COMPLEX_OP_MUL, NDARRAY_COMPLEX128,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_mul_avx2_z},
+    {NDARRAY_COMPLEX_OP_DIV, NDARRAY_COMPLEX64,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_div_avx2_c},
+    {NDARRAY_COMPLEX_OP_DIV, NDARRAY_COMPLEX128,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_div_avx2_z},
+#endif
+    {NDARRAY_COMPLEX_OP_ADD, NDARRAY_COMPLEX64, 0, ndarray_complex_add_c},
+    {NDARRAY_COMPLEX_OP_ADD, NDARRAY_COMPLEX128, 0, ndarray_complex_add_z},
+    {NDARRAY_COMPLEX_OP_SUB, NDARRAY_COMPLEX64, 0, ndarray_complex_sub_c},
+    {NDARRAY_COMPLEX_OP_SUB, NDARRAY_COMPLEX128, 0, ndarray_complex_sub_z},
+    {NDARRAY_COMPLEX_OP_MUL, NDARRAY_COMPLEX64, 0, ndarray_complex_mul_c},
+    {NDARRAY_COMPLEX_OP_MUL, NDARRAY_COMPLEX128, 0, ndarray_complex_mul_z},
+    {NDARRAY_COMPLEX_OP_DIV, NDARRAY_COMPLEX64, 0, ndarray_complex_div_c},
+    {NDARRAY_COMPLEX_OP_DIV, NDARRAY_COMPLEX128, 0, ndarray_complex_div_z},
+};
+
+static const struct ndarrayComplexUnaryKernel NDARRAY_COMPLEX_UNARY[] = {
+#ifdef NDARRAY_COMPLEX_X86
+    {NDARRAY_COMPLEX_OP_ABS, NDARRAY_COMPLEX64,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_abs_avx2_c},
+    {NDARRAY_COMPLEX_OP_ABS, NDARRAY_COMPLEX128,
+     NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, ndarray_complex_abs_avx2_z},
+#endif
+    {NDARRAY_COMPLEX_OP_CONJ, NDARRAY_COMPLEX64, 0, ndarray_complex_conj_c},
+    {NDARRAY_COMPLEX_OP_CONJ, NDARRAY_COMPLEX128, 0, ndarray_complex_conj_z},
+    {NDARRAY_COMPLEX_OP_EXP, NDARRAY_COMPLEX64, 0, ndarray_complex_exp_c},
+    {NDARRAY_COMPLEX_OP_EXP, NDARRAY_COMPLEX128, 0, ndarray_complex_exp_z},
+    {NDARRAY_COMPLEX_OP_ABS, NDARRAY_COMPLEX64, 0, ndarray_complex_abs_c},
+    {NDARRAY_COMPLEX_OP_ABS, NDARRAY_COMPLEX128, 0, ndarray_complex_abs_z},
+    {NDARRAY_COMPLEX_OP_ARG, NDARRAY_COMPLEX64, 0, ndarray_complex_arg_c},
+    {NDARRAY_COMPLEX_OP_ARG, NDARRAY_COMPLEX128, 0, ndarray_complex_arg_z},
+};
+
+/**
+ * Applies a binary kernel to a chunk of one-dimensional ndarrays.
+ *
+ * @private
+ * @param arrays  array containing pointers to input and output ndarray chunks
+ * @param ctx     binary kernel
+ * @return        status code
+ */
+static int8_t ndarray_complex_binary_chunk(
+    struct ndarray* arrays[], void* ctx
+) {
+  const struct ndarrayComplexBinaryKernel* k;
+
+  k = (const struct ndarrayComplexBinaryKernel*)ctx;
+  k->fcn(
+      arrays[0]->data + arrays[0]->offset, arrays[0]->strides[0],
+      arrays[1]->data + arrays[1]->offset, arrays[1]->strides[0],
+      arrays[2]->data + arrays[2]->offset, arrays[2]->strides[0],
+      arrays[2]->shape[0]
+  );
+  return 0;
+}
+
+/**
+ * Applies a unary kernel to a chunk of one-dimensional ndarrays.
+ *
+ * @private
+ * @param arrays  array containing pointers to input and output ndarray chunks
+ * @param ctx     unary kernel
+ * @return        status code
+ */
+static int8_t ndarray_complex_unary_chunk(struct ndarray* arrays[], void* ctx) {
+  const struct ndarrayComplexUnaryKernel* k;
+
+  k = (const struct ndarrayComplexUnaryKernel*)ctx;
+  k->fcn(
+      arrays[0]->data + arrays[0]->offset, arrays[0]->strides[0],
+      arrays[1]->data + arrays[1]->offset, arrays[1]->strides[0],
+      arrays[1]->shape[0]
+  );
+  return 0;
+}
+
+/**
+ * Tests whether an ndarray can be processed by single-precision kernels
+ * without loss of precision.
+ *
+ * @private
+ * @param x  input ndarray
+ * @return   boolean indicating whether an ndarray is single-precision
+ */
+static int8_t ndarray_complex_is_single(const struct ndarray* x) {
+  switch (x->dtype) {
+    case NDARRAY_BOOL:
+    case NDARRAY_INT8:
+    case NDARRAY_UINT8:
+    case NDARRAY_UINT8C:
+    case NDARRAY_INT16:
+    case NDARRAY_UINT16:
+    case NDARRAY_FLOAT32:
+    case NDARRAY_COMPLEX64:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Applies a binary operation to the elements of two ndarrays as complex
+ * numbers.
+ *
+ * ## Notes
+ *
+ * -   Elements are computed in single precision if the output ndarray is a
+ *     single-precision complex ndarray and neither input ndarray requires
+ *     double precision. Otherwise, elements are computed in double precision.
+ *
+ * @private
+ * @param op   operation
+ * @param x    first input ndarray
+ * @param y    second input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ */
+static int8_t ndarray_complex_binary(
+    const int8_t op, const struct ndarray* x, const struct ndarray* y,
+    struct ndarray* out
+) {
+  const struct ndarrayComplexBinaryKernel* k;
+  struct ndarray* arrays[3];
+  int32_t types[3];
+  int16_t dtype;
+  size_t i;
+
+  if (x == NULL || y == NULL || out == NULL ||
+      (out->dtype != NDARRAY_COMPLEX64 && out->dtype != NDARRAY_COMPLEX128)) {
+    return -1;
+  }
+  dtype = NDARRAY_COMPLEX128;
+  if (out->dtype == NDARRAY_COMPLEX64 && ndarray_complex_is_single(x) &&
+      ndarray_complex_is_single(y)) {
+    dtype = NDARRAY_COMPLEX64;
+  }
+  // Resolve the preferred kernel supported by the current CPU...
+  k = NULL;
+  for (i = 0;
+       i < sizeof(NDARRAY_COMPLEX_BINARY) / sizeof(NDARRAY_COMPLEX_BINARY[0]);
+       i++) {
+    if (NDARRAY_COMPLEX_BINARY[i].op == op &&
+        NDARRAY_COMPLEX_BINARY[i].dtype == dtype &&
+        ndarray_cpu_has_features(NDARRAY_COMPLEX_BINARY[i].features)) {
+      k = &(NDARRAY_COMPLEX_BINARY[i]);
+      break;
+    }
+  }
+  if (k == NULL) {
+    return -1;
+  }
+  arrays[0] = (struct ndarray*)x;
+  arrays[1] = (struct ndarray*)y;
+  arrays[2] = out;
+  types[0]  = dtype;
+  types[1]  = dtype;
+  types[2]  = dtype;
+  return ndarray_buffered_apply(
+      2, 3, arrays, types, NDARRAY_SAME_KIND_CASTING,
+      ndarray_complex_binary_chunk, (void*)k
+  );
+}
+
+/**
+ * Applies a unary operation to the elements of an ndarray as complex numbers.
+ *
+ * ## Notes
+ *
+ * -   Operations producing complex numbers require a complex output ndarray,
+ *     and operations producing real numbers require a real-valued
+ *     floating-point output ndarray.
+ * -   Elements are computed in single precision if the output ndarray is a
+ *     single-precision ndarray and the input ndarray does not require double
+ *     precision. Otherwise, elements are computed in double precision.
+ *
+ * @private
+ * @param op   operation
+ * @param x    input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ */
+static int8_t ndarray_complex_unary(
+    const int8_t op, const struct ndarray* x, struct ndarray* out
+) {
+  const struct ndarrayComplexUnaryKernel* k;
+  struct ndarray* arrays[2];
+  int32_t types[2];
+  int16_t single;
+  int16_t dtype;
+  int8_t real;
+  size_t i;
+
+  if (x == NULL || out == NULL) {
+    return -1;
+  }
+  real = (op == NDARRAY_COMPLEX_OP_ABS || op == NDARRAY_COMPLEX_OP_ARG);
+  if (real) {
+    single = NDARRAY_FLOAT32;
+    if (out->dtype != NDARRAY_FLOAT32 && out->dtype != NDARRAY_FLOAT64) {
+      return -1;
+    }
+  } else {
+    single = NDARRAY_COMPLEX64;
+    if (out->dtype != NDARRAY_COMPLEX64 && out->dtype != NDARRAY_COMPLEX128) {
+      return -1;
+    }
+  }
+  dtype = NDARRAY_COMPLEX128;
+  if (out->dtype == single && ndarray_complex_is_single(x)) {
+    dtype = NDARRAY_COMPLEX64;
+  }
+  // Resolve the preferred kernel supported by the current CPU...
+  k = NULL;
+  for (i = 0;
+       i < sizeof(NDARRAY_COMPLEX_UNARY) / sizeof(NDARRAY_COMPLEX_UNARY[0]);
+       i++) {
+    if (NDARRAY_COMPLEX_UNARY[i].op == op &&
+        NDARRAY_COMPLEX_UNARY[i].dtype == dtype &&
+        ndarray_cpu_has_features(NDARRAY_COMPLEX_UNARY[i].features)) {
+      k = &(NDARRAY_COMPLEX_UNARY[i]);
+      break;
+    }
+  }
+  if (k == NULL) {
+    return -1;
+  }
+  arrays[0] = (struct ndarray*)x;
+  arrays[1] = out;
+  types[0]  = dtype;
+  types[1]  = dtype;
+  if (real) {
+    types[1] =
+        (dtype == NDARRAY_COMPLEX64) ? NDARRAY_FLOAT32 : NDARRAY_FLOAT64;
+  }
+  return ndarray_buffered_apply(
+      1, 2, arrays, types, NDARRAY_SAME_KIND_CASTING,
+      ndarray_complex_unary_chunk, (void*)k
+  );
+}
+
+/**
+ * Adds the elements of two ndarrays as complex numbers.
+ *
+ * ## Notes
+ *
+ * -   The input ndarrays and the output ndarray must have the same shape.
+ * -   The output ndarray must be a complex ndarray. Input ndarrays may have any
+ *     data type which can be safely cast to a complex data type.
+ * -   Elements are computed in single precision if the output ndarray is a
+ *     `complex64` ndarray and neither input ndarray is a `complex128`,
+ *     `float64`, or 32- or 64-bit integer ndarray. Otherwise, elements are
+ *     computed in double precision.
+ * -   Operands are processed in chunks (see `ndarray_buffered_apply`), such
+ *     that operands having a different data type are converted via small
+ *     scratch buffers. The output ndarray may be one of the input ndarrays.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    first input ndarray
+ * @param y    second input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/complex_math.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create two one-dimensional complex ndarrays (interleaved components):
+ * double xbuf[] = {1.0, 2.0, 3.0, 4.0};
+ * double ybuf[] = {5.0, 6.0, 7.0, 8.0};
+ * int64_t shape[] = {2};
+ * int64_t strides[] = {16};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_COMPLEX128, (uint8_t *)xbuf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_COMPLEX128, (uint8_t *)ybuf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Add the elements in place:
+ * int8_t status = ndarray_complex_add(x, y, x);
+ * // xbuf => {6.0, 8.0, 10.0, 12.0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_complex_add(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+) {
+  return ndarray_complex_binary(NDARRAY_COMPLEX_OP_ADD, x, y, out);
+}
+
+/**
+ * Subtracts the elements of one ndarray from the elements of another ndarray
+ * as complex numbers.
+ *
+ * ## Notes
+ *
+ * -   See `ndarray_complex_add` for a description of supported ndarrays.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    first input ndarray
+ * @param y    second input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * // Compute `x - y`:
+ * int8_t status = ndarray_complex_sub(x, y, out);
+ */
+int8_t ndarray_complex_sub(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+) {
+  return ndarray_complex_binary(NDARRAY_COMPLEX_OP_SUB, x, y, out);
+}
+
+/**
+ * Multiplies the elements of two ndarrays as complex numbers.
+ *
+ * ## Notes
+ *
+ * -   See `ndarray_complex_add` for a description of supported ndarrays.
+ * -   On CPUs supporting AVX2 and FMA, contiguous elements are multiplied
+ *     using shuffles and fused multiply-adds. As the products of components
+ *     are not rounded before being summed, results may differ from the
+ *     portable kernel in the last bit.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    first input ndarray
+ * @param y    second input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * // Compute `x * y`:
+ * int8_t status = ndarray_complex_mul(x, y, out);
+ */
+int8_t ndarray_complex_mul(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+) {
+  return ndarray_complex_binary(NDARRAY_COMPLEX_OP_MUL, x, y, out);
+}
+
+/**
+ * Divides the elements of one ndarray by the elements of another ndarray as
+ * complex numbers.
+ *
+ * ## Notes
+ *
+ * -   See `ndarray_complex_add` for a description of supported ndarrays.
+ * -   Quotients are computed using Smith's algorithm, which avoids overflow
+ *     and underflow in intermediate results, thus mirroring NumPy. Dividing by
+ *     zero divides each component of the dividend by zero.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    first input ndarray
+ * @param y    second input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * // Compute `x / y`:
+ * int8_t status = ndarray_complex_div(x, y, out);
+ */
+int8_t ndarray_complex_div(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+) {
+  return ndarray_complex_binary(NDARRAY_COMPLEX_OP_DIV, x, y, out);
+}
+
+/**
+ * Computes the complex conjugate of each ndarray element.
+ *
+ * ## Notes
+ *
+ * -   The input ndarray and the output ndarray must have the same shape, and
+ *     the output ndarray must be a complex ndarray (see
+ *     `ndarray_complex_add`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_complex_conj(x, out);
+ */
+int8_t ndarray_complex_conj(const struct ndarray* x, struct ndarray* out) {
+  return ndarray_complex_unary(NDARRAY_COMPLEX_OP_CONJ, x, out);
+}
+
+/**
+ * Computes the complex exponential of each ndarray element.
+ *
+ * ## Notes
+ *
+ * -   The input ndarray and the output ndarray must have the same shape, and
+ *     the output ndarray must be a complex ndarray (see
+ *     `ndarray_complex_add`).
+ * -   The exponential of `a + bi` is computed as `exp(a)*(cos(b) + i*sin(b))`.
+ *     If the imaginary component is zero, the result is `exp(a)` with the
+ *     imaginary component (and its sign) preserved.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_complex_exp(x, out);
+ */
+int8_t ndarray_complex_exp(const struct ndarray* x, struct ndarray* out) {
+  return ndarray_complex_unary(NDARRAY_COMPLEX_OP_EXP, x, out);
+}
+
+/**
+ * Computes the absolute value (modulus) of each ndarray element as a complex
+ * number.
+ *
+ * ## Notes
+ *
+ * -   The input ndarray and the output ndarray must have the same shape, and
+ *     the output ndarray must be a `float32` or `float64` ndarray. Elements are
+ *     computed in single precision if the output ndarray is a `float32`
+ *     ndarray and the input ndarray does not require double precision (see
+ *     `ndarray_complex_add`).
+ * -   Absolute values are computed without undue overflow or underflow (i.e.,
+ *     as if by `hypot`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_complex_abs(x, out);
+ */
+int8_t ndarray_complex_abs(const struct ndarray* x, struct ndarray* out) {
+  return ndarray_complex_unary(NDARRAY_COMPLEX_OP_ABS, x, out);
+}
+
+/**
+ * Computes the argument (phase angle) of each ndarray element as a complex
+ * number.
+ *
+ * ## Notes
+ *
+ * -   See `ndarray_complex_abs` for a description of supported ndarrays.
+ * -   The argument of `a + bi` is computed as `atan2(b, a)` and lies on the
+ *     interval `[-pi, pi]`.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x    input ndarray
+ * @param out  output ndarray
+ * @return     status code
+ *
+ * @example
+ * #include "ndarray/base/complex_math.h"
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_complex_arg(x, out);
+ */
+int8_t ndarray_complex_arg(const struct ndarray* x, struct ndarray* out) {
+  return ndarray_complex_unary(NDARRAY_COMPLEX_OP_ARG, x, out);
+}
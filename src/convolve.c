@@ -0,0 +1,1099 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/convolve.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/assert.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/internal/fft.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/base/wrap_index.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/index_modes.h"
+#include "ndarray/memory_categories.h"
+
+// Define the number of outputs per chunk when computing a convolution directly
+// (note: a chunk of outputs remains in cache while being updated for each
+// kernel element):
+#define NDARRAY_CONVOLVE_CHUNK 512
+
+// Define the maximum number of bytes of extended rows gathered per stripe:
+#define NDARRAY_CONVOLVE_STRIPE_BYTES 262144
+
+// Define the minimum number of elements processed by a task:
+#define NDARRAY_CONVOLVE_GROUP 16384
+
+// Define the minimum transform length of an overlap-save segment as a multiple
+// of the kernel length along the last convolved dimension:
+#define NDARRAY_CONVOLVE_SEGMENT 8
+
+// Define the cost of a complex multiply-accumulate, relative to a real
+// multiply-accumulate, when estimating the cost of a transform-based
+// convolution:
+#define NDARRAY_CONVOLVE_MAC_COST 2.0
+
+// Define the cost per element and pass (i.e., per element and power of two) of
+// a real-input transform, relative to a real multiply-accumulate:
+#define NDARRAY_CONVOLVE_FFT_COST 1.5
+
+/**
+ * Structure containing the state of a convolution.
+ *
+ * ## Notes
+ *
+ * -   A convolution is computed along the last convolved dimension ("rows")
+ *     for stripes of consecutive rows along the first convolved dimension. For
+ *     one-dimensional convolutions, the first convolved dimension is an outer
+ *     dimension (or a virtual dimension of length `1`) and the kernel has a
+ *     single row.
+ * -   Rows are extended by the elements required beyond either end, which are
+ *     resolved according to the index mode, and stripes are extended by the
+ *     rows required beyond either end, such that each output element is a
+ *     correlation of the extended rows with the (flipped, for convolutions)
+ *     kernel.
+ *
+ * @private
+ */
+struct ndarrayConvolveLoop {
+  // Function for computing a stripe of output rows from extended rows:
+  void (*compute)(
+      const struct ndarrayConvolveLoop* loop, const uint8_t* e, uint8_t* y,
+      const int64_t nr, uint8_t* work
+  );
+
+  // Function for converting input elements to buffer elements:
+  ndarrayStridedCastFcn load;
+
+  // Function for converting buffer elements to output elements:
+  ndarrayStridedCastFcn store;
+
+  // Pointer to the first input element:
+  const uint8_t* x;
+
+  // Pointer to the first output element:
+  uint8_t* out;
+
+  // Index mode:
+  int8_t mode;
+
+  // Number of elements along the first convolved dimension:
+  int64_t n0;
+
+  // Number of elements along the last convolved dimension:
+  int64_t n1;
+
+  // Number of kernel rows:
+  int64_t m0;
+
+  // Number of kernel columns:
+  int64_t m1;
+
+  // Kernel origin along the first convolved dimension:
+  int64_t c0;
+
+  // Kernel origin along the last convolved dimension:
+  int64_t c1;
+
+  // Number of elements per extended row:
+  int64_t L1;
+
+  // Input stride (in bytes) along the first convolved dimension:
+  int64_t xs0;
+
+  // Input stride (in bytes) along the last convolved dimension:
+  int64_t xs1;
+
+  // Output stride (in bytes) along the first convolved dimension:
+  int64_t os0;
+
+  // Output stride (in bytes) along the last convolved dimension:
+  int64_t os1;
+
+  // Boolean indicating whether to gather and scatter the k-th elements of
+  // all rows in a stripe together (i.e., when adjacent rows are closer in
+  // memory than adjacent elements of a row):
+  int8_t blocked;
+
+  // Number of bytes per buffer element:
+  int64_t esz;
+
+  // Number of bytes per extended row:
+  int64_t rb;
+
+  // Number of bytes per output row:
+  int64_t yb;
+
+  // Kernel, in row-major order and working precision, flipped along each
+  // dimension for convolutions:
+  const uint8_t* w;
+
+  // Transform plan (or `NULL` if computing convolutions directly):
+  const struct ndarrayFFTPlan* plan;
+
+  // Transform length per overlap-save segment:
+  int64_t nfft;
+
+  // Number of outputs per overlap-save segment:
+  int64_t nseg;
+
+  // Transforms of reversed and zero-padded kernel rows:
+  const uint8_t* spectra;
+
+  // Number of output rows per stripe:
+  int64_t stripe;
+
+  // Number of stripes along the first convolved dimension:
+  int64_t nstripes;
+
+  // Number of outer dimensions:
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension output strides:
+  int64_t* oos;
+
+  // Total number of stripes:
+  int64_t nunits;
+
+  // Number of stripes per task:
+  int64_t group;
+
+  // Per-thread scratch buffers (note: extended rows, followed by output rows
+  // and a workspace):
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+// Define a macro for defining functions which compute a stripe of output rows
+// from extended rows of a specified type, either directly or using
+// overlap-save segments, and a function which computes the transforms of
+// kernel rows:
+#define NDARRAY_CONVOLVE_DEFINE(c, type)                                       \
+  static void ndarray_convolve_direct_##c(                                     \
+      const struct ndarrayConvolveLoop* loop, const uint8_t* e, uint8_t* y,    \
+      const int64_t nr, uint8_t* work                                          \
+  ) {                                                                          \
+    const type* w = (const type*)loop->w;                                      \
+    const type* u;                                                             \
+    type* v;                                                                   \
+    type wj;                                                                   \
+    int64_t k0;                                                                \
+    int64_t kn;                                                                \
+    int64_t j0;                                                                \
+    int64_t j1;                                                                \
+    int64_t i;                                                                 \
+    int64_t k;                                                                 \
+    (void)work;                                                                \
+    for (i = 0; i < nr; i++) {                                                 \
+      for (k0 = 0; k0 < loop->n1; k0 += NDARRAY_CONVOLVE_CHUNK) {              \
+        kn = loop->n1 - k0;                                                    \
+        if (kn > NDARRAY_CONVOLVE_CHUNK) {                                     \
+          kn = NDARRAY_CONVOLVE_CHUNK;                                         \
+        }                                                                      \
+        v = (type*)y + (i * loop->n1) + k0; /* pointer arithmetic */           \
+        for (k = 0; k < kn; k++) {                                             \
+          v[k] = 0;                                                            \
+        }                                                                      \
+        /* Update the chunk for each kernel element, such that the inner */    \
+        /* loop is vectorizable and outputs are accumulated in order... */     \
+        for (j0 = 0; j0 < loop->m0; j0++) {                                    \
+          for (j1 = 0; j1 < loop->m1; j1++) {                                  \
+            wj = w[(j0 * loop->m1) + j1];                                      \
+            u  = (const type*)e + ((i + j0) * loop->L1) + k0 + j1;             \
+            for (k = 0; k < kn; k++) {                                         \
+              v[k] += wj * u[k];                                               \
+            }                                                                  \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_convolve_fft_##c(                                        \
+      const struct ndarrayConvolveLoop* loop, const uint8_t* e, uint8_t* y,    \
+      const int64_t nr, uint8_t* work                                          \
+  ) {                                                                          \
+    const type* g = (const type*)loop->spectra;                                \
+    const int64_t fb = loop->nfft + 2;                                         \
+    const int64_t ne = nr + loop->m0 - 1;                                      \
+    type* F = (type*)work;                                                     \
+    type* a = F + (ne * fb);          /* pointer arithmetic */                 \
+    uint8_t* ws = (uint8_t*)(a + fb); /* pointer arithmetic */                 \
+    const type* p;                                                             \
+    const type* q;                                                             \
+    type* f;                                                                   \
+    int64_t cnt;                                                               \
+    int64_t len;                                                               \
+    int64_t s0;                                                                \
+    int64_t j0;                                                                \
+    int64_t i;                                                                 \
+    int64_t k;                                                                 \
+    for (s0 = 0; s0 < loop->n1; s0 += loop->nseg) {                            \
+      cnt = loop->n1 - s0;                                                     \
+      if (cnt > loop->nseg) {                                                  \
+        cnt = loop->nseg;                                                      \
+      }                                                                        \
+      len = loop->L1 - s0;                                                     \
+      if (len > loop->nfft) {                                                  \
+        len = loop->nfft;                                                      \
+      }                                                                        \
+      /* Transform the zero-padded segments of the extended rows... */         \
+      for (i = 0; i < ne; i++) {                                               \
+        f = F + (i * fb); /* pointer arithmetic */                             \
+        memcpy(                                                                \
+            f, (const type*)e + (i * loop->L1) + s0,                           \
+            (size_t)len * sizeof(type)                                         \
+        );                                                                     \
+        for (k = len; k < loop->nfft; k++) {                                   \
+          f[k] = 0;                                                            \
+        }                                                                      \
+        ndarray_internal_fft_real(loop->plan, 0, (uint8_t*)f, ws);             \
+      }                                                                        \
+      /* Accumulate the products of segment and kernel row transforms, */      \
+      /* keeping the outputs unaffected by circular wrap-around... */          \
+      for (i = 0; i < nr; i++) {                                               \
+        for (k = 0; k < fb; k++) {                                             \
+          a[k] = 0;                                                            \
+        }                                                                      \
+        for (j0 = 0; j0 < loop->m0; j0++) {                                    \
+          p = F + ((i + j0) * fb); /* pointer arithmetic */                    \
+          q = g + (j0 * fb);       /* pointer arithmetic */                    \
+          for (k = 0; k < fb; k += 2) {                                        \
+            a[k] += (p[k] * q[k]) - (p[k + 1] * q[k + 1]);                     \
+            a[k + 1] += (p[k] * q[k + 1]) + (p[k + 1] * q[k]);                 \
+          }                                                                    \
+        }                                                                      \
+        ndarray_internal_fft_real(loop->plan, 1, (uint8_t*)a, ws);             \
+        memcpy(                                                                \
+            (type*)y + (i * loop->n1) + s0, a + loop->m1 - 1,                  \
+            (size_t)cnt * sizeof(type)                                         \
+        );                                                                     \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_convolve_spectra_##c(                                    \
+      const struct ndarrayConvolveLoop* loop, uint8_t* spectra, uint8_t* work  \
+  ) {                                                                          \
+    const type* w = (const type*)loop->w;                                      \
+    const int64_t fb = loop->nfft + 2;                                         \
+    type* f;                                                                   \
+    int64_t j0;                                                                \
+    int64_t k;                                                                 \
+    for (j0 = 0; j0 < loop->m0; j0++) {                                        \
+      f = (type*)spectra + (j0 * fb); /* pointer arithmetic */                 \
+      for (k = 0; k < loop->m1; k++) {                                         \
+        f[k] = w[(j0 * loop->m1) + loop->m1 - 1 - k];                          \
+      }                                                                        \
+      for (; k < loop->nfft; k++) {                                            \
+        f[k] = 0;                                                              \
+      }                                                                        \
+      ndarray_internal_fft_real(loop->plan, 0, (uint8_t*)f, work);             \
+    }                                                                          \
+  }
+
+NDARRAY_CONVOLVE_DEFINE(f, float)
+NDARRAY_CONVOLVE_DEFINE(d, double)
+
+/**
+ * Resolves the index of an element along a dimension according to an index
+ * mode.
+ *
+ * @private
+ * @param idx   index
+ * @param n     number of elements along the dimension
+ * @param mode  index mode
+ * @return      resolved index (or `-1` if the element is zero)
+ */
+static int64_t ndarray_convolve_index(
+    const int64_t idx, const int64_t n, const int8_t mode
+) {
+  if (idx >= 0 && idx < n) {
+    return idx;
+  }
+  if (mode == NDARRAY_INDEX_CLAMP) {
+    return (idx < 0) ? 0 : n - 1;
+  }
+  if (mode == NDARRAY_INDEX_WRAP) {
+    return ndarray_wrap_index(idx, n - 1);
+  }
+  return -1;
+}
+
+/**
+ * Loads an element beyond either end of a row into an extended row.
+ *
+ * @private
+ * @param loop  convolution
+ * @param x     pointer to the first element of the row
+ * @param e     extended row
+ * @param t     index of the element in the extended row
+ */
+static void ndarray_convolve_halo(
+    const struct ndarrayConvolveLoop* loop, const uint8_t* x, uint8_t* e,
+    const int64_t t
+) {
+  int64_t idx = ndarray_convolve_index(t - loop->c1, loop->n1, loop->mode);
+  if (idx < 0) {
+    memset(e + (t * loop->esz), 0, loop->esz);
+  } else {
+    loop->load(
+        x + (idx * loop->xs1), loop->xs1, e + (t * loop->esz), loop->esz, 1
+    );
+  }
+}
+
+/**
+ * Gathers consecutive rows into extended rows.
+ *
+ * @private
+ * @param loop  convolution
+ * @param x     pointer to the first element of the first row
+ * @param nr    number of rows
+ * @param e     first extended row
+ */
+static void ndarray_convolve_gather(
+    const struct ndarrayConvolveLoop* loop, const uint8_t* x,
+    const int64_t nr, uint8_t* e
+) {
+  const uint8_t* xr;
+  uint8_t* er;
+  int64_t idx;
+  int64_t r;
+  int64_t t;
+
+  // Load the k-th elements of all rows together, such that adjacent rows
+  // share cache lines:
+  if (nr > 1 && loop->blocked) {
+    for (t = 0; t < loop->L1; t++) {
+      idx = ndarray_convolve_index(t - loop->c1, loop->n1, loop->mode);
+      if (idx >= 0) {
+        loop->load(
+            x + (idx * loop->xs1), loop->xs0, e + (t * loop->esz), loop->rb,
+            nr
+        );
+        continue;
+      }
+      for (r = 0; r < nr; r++) {
+        memset(e + (r * loop->rb) + (t * loop->esz), 0, loop->esz);
+      }
+    }
+    return;
+  }
+  for (r = 0; r < nr; r++) {
+    xr = x + (r * loop->xs0);  // pointer arithmetic
+    er = e + (r * loop->rb);   // pointer arithmetic
+    loop->load(
+        xr, loop->xs1, er + (loop->c1 * loop->esz), loop->esz, loop->n1
+    );
+    for (t = 0; t < loop->c1; t++) {
+      ndarray_convolve_halo(loop, xr, er, t);
+    }
+    for (t = loop->c1 + loop->n1; t < loop->L1; t++) {
+      ndarray_convolve_halo(loop, xr, er, t);
+    }
+  }
+}
+
+/**
+ * Gathers the extended rows required to compute a stripe of output rows.
+ *
+ * ## Notes
+ *
+ * -   Rows within bounds are gathered together. Rows beyond either end are
+ *     resolved according to the index mode and gathered individually (or
+ *     zeroed).
+ *
+ * @private
+ * @param loop  convolution
+ * @param x     pointer to the first input element of the plane
+ * @param i0    index of the first output row
+ * @param nr    number of output rows
+ * @param e     extended rows
+ */
+static void ndarray_convolve_gather_stripe(
+    const struct ndarrayConvolveLoop* loop, const uint8_t* x, const int64_t i0,
+    const int64_t nr, uint8_t* e
+) {
+  int64_t idx;
+  int64_t ne;
+  int64_t p0;
+  int64_t lo;
+  int64_t hi;
+  int64_t q;
+
+  ne = nr + loop->m0 - 1;
+  p0 = i0 - loop->c0;
+  lo = (p0 < 0) ? 0 : p0;
+  hi = (p0 + ne > loop->n0) ? loop->n0 : p0 + ne;
+  ndarray_convolve_gather(
+      loop, x + (lo * loop->xs0), hi - lo, e + ((lo - p0) * loop->rb)
+  );
+  for (q = 0; q < ne; q++) {
+    if (p0 + q >= lo && p0 + q < hi) {
+      continue;
+    }
+    idx = ndarray_convolve_index(p0 + q, loop->n0, loop->mode);
+    if (idx < 0) {
+      memset(e + (q * loop->rb), 0, loop->rb);
+    } else {
+      ndarray_convolve_gather(
+          loop, x + (idx * loop->xs0), 1, e + (q * loop->rb)
+      );
+    }
+  }
+}
+
+/**
+ * Scatters a stripe of output rows.
+ *
+ * @private
+ * @param loop  convolution
+ * @param y     output rows
+ * @param nr    number of output rows
+ * @param out   pointer to the first output element of the first row
+ */
+static void ndarray_convolve_scatter(
+    const struct ndarrayConvolveLoop* loop, const uint8_t* y, const int64_t nr,
+    uint8_t* out
+) {
+  int64_t r;
+  int64_t k;
+  if (nr > 1 && loop->blocked) {
+    for (k = 0; k < loop->n1; k++) {
+      loop->store(
+          y + (k * loop->esz), loop->yb, out + (k * loop->os1), loop->os0, nr
+      );
+    }
+    return;
+  }
+  for (r = 0; r < nr; r++) {
+    loop->store(
+        y + (r * loop->yb), loop->esz, out + (r * loop->os0), loop->os1,
+        loop->n1
+    );
+  }
+}
+
+/**
+ * Callback invoked by `ndarray_parallel_for` to compute a group of stripes.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  convolution
+ */
+static void ndarray_convolve_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayConvolveLoop* loop =
+      (const struct ndarrayConvolveLoop*)ctx;
+  const uint8_t* x;
+  uint8_t* work;
+  uint8_t* e;
+  uint8_t* y;
+  uint8_t* o;
+  int64_t end;
+  int64_t nr;
+  int64_t i0;
+  int64_t u;
+  int64_t r;
+  int64_t s;
+  int64_t d;
+
+  e    = loop->scratch + (tid * loop->sb);                // pointer arithmetic
+  y    = e + ((loop->stripe + loop->m0 - 1) * loop->rb);  // pointer arithmetic
+  work = y + (loop->stripe * loop->yb);                   // pointer arithmetic
+  u    = i * loop->group;
+  end  = u + loop->group;
+  if (end > loop->nunits) {
+    end = loop->nunits;
+  }
+  for (; u < end; u++) {
+    x = loop->x;
+    o = loop->out;
+    r = u / loop->nstripes;
+    for (d = 0; d < loop->no; d++) {
+      s = r % loop->oshape[d];
+      r /= loop->oshape[d];
+      x += s * loop->oxs[d];  // pointer arithmetic
+      o += s * loop->oos[d];  // pointer arithmetic
+    }
+    i0 = (u % loop->nstripes) * loop->stripe;
+    nr = loop->n0 - i0;
+    if (nr > loop->stripe) {
+      nr = loop->stripe;
+    }
+    ndarray_convolve_gather_stripe(loop, x, i0, nr, e);
+    loop->compute(loop, e, y, nr, work);
+    ndarray_convolve_scatter(loop, y, nr, o + (i0 * loop->os0));
+  }
+}
+
+/**
+ * Returns the smallest even transform length, greater than or equal to a
+ * specified length, having no prime factors other than `2`, `3`, and `5`.
+ *
+ * @private
+ * @param n  minimum length
+ * @return   transform length
+ */
+static int64_t ndarray_convolve_fft_length(int64_t n) {
+  int64_t m;
+  if (n % 2) {
+    n += 1;
+  }
+  for (;; n += 2) {
+    m = n;
+    while (m % 2 == 0) {
+      m /= 2;
+    }
+    while (m % 3 == 0) {
+      m /= 3;
+    }
+    while (m % 5 == 0) {
+      m /= 5;
+    }
+    if (m == 1) {
+      return n;
+    }
+  }
+}
+
+/**
+ * Resolves whether to compute a convolution using overlap-save segments and,
+ * if so, the segment transform length.
+ *
+ * ## Notes
+ *
+ * -   The function compares the number of multiply-accumulates per output
+ *     element of a direct convolution with an estimate of the cost per output
+ *     element of transforming segments, multiplying transforms, and inverting
+ *     the products.
+ *
+ * @private
+ * @param loop  convolution
+ * @return      segment transform length (or `0` to compute the convolution
+ *              directly)
+ */
+static int64_t ndarray_convolve_method(const struct ndarrayConvolveLoop* loop) {
+  double direct;
+  double cost;
+  double lg;
+  int64_t nfft;
+  int64_t t;
+
+  if (loop->m1 < 2) {
+    return 0;
+  }
+  t = NDARRAY_CONVOLVE_SEGMENT * loop->m1;
+  nfft = ndarray_convolve_fft_length((loop->L1 < t) ? loop->L1 : t);
+  lg = 0.0;
+  for (t = 1; t < nfft; t *= 2) {
+    lg += 1.0;
+  }
+  // Forward transforms are amortized over the output rows of a stripe, except
+  // for the rows required beyond either end of the stripe:
+  cost = (double)loop->m0 * NDARRAY_CONVOLVE_MAC_COST *
+         (double)((nfft / 2) + 1);
+  cost += (2.0 + ((double)(loop->m0 - 1) / (double)loop->stripe)) *
+          NDARRAY_CONVOLVE_FFT_COST * (double)nfft * lg;
+  cost /= (double)(nfft - loop->m1 + 1);
+  direct = (double)loop->m0 * (double)loop->m1;
+  return (cost < direct) ? nfft : 0;
+}
+
+/**
+ * Computes a convolution (or correlation) along one or two dimensions.
+ *
+ * @private
+ * @param x         input ndarray
+ * @param kernel    kernel
+ * @param axis0     first dimension along which to operate (or `-1` for
+ *                  one-dimensional convolutions)
+ * @param axis1     last dimension along which to operate
+ * @param ndk       number of convolved dimensions
+ * @param flip      boolean indicating whether to compute a convolution
+ *                  (i.e., whether to flip the kernel)
+ * @param mode      index mode
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ */
+static int8_t ndarray_convolve_execute(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis0,
+    const int64_t axis1, const int64_t ndk, const int8_t flip,
+    const int8_t mode, int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayConvolveLoop loop;
+  struct ndarrayFFTPlan* plan;
+  ndarrayStridedCastFcn kload;
+  const uint8_t* kd;
+  uint8_t* spectra;
+  uint8_t tmp[8];
+  uint8_t* w;
+  int16_t wtype;
+  int8_t single;
+  int64_t nspectra;
+  int64_t nplanes;
+  int64_t nbytes;
+  int64_t nmeta;
+  int64_t ntasks;
+  int64_t nwork;
+  int64_t ndims;
+  int64_t nw;
+  int64_t a0;
+  int64_t a1;
+  int64_t i;
+  int64_t j;
+  int64_t t;
+  int8_t status;
+
+  if (x == NULL || kernel == NULL || out == NULL) {
+    return -1;
+  }
+  if (mode != NDARRAY_INDEX_ERROR && mode != NDARRAY_INDEX_CLAMP &&
+      mode != NDARRAY_INDEX_WRAP) {
+    return -1;
+  }
+  ndims = x->ndims;
+  a1    = (axis1 < 0) ? axis1 + ndims : axis1;
+  a0    = (axis0 < 0) ? axis0 + ndims : axis0;
+  if (a1 < 0 || a1 >= ndims || kernel->ndims != ndk) {
+    return -1;
+  }
+  if (ndk == 2 && (a0 < 0 || a0 >= ndims || a0 == a1)) {
+    return -1;
+  }
+  if (out->ndims != ndims) {
+    return -1;
+  }
+  for (i = 0; i < ndims; i++) {
+    if (out->shape[i] != x->shape[i]) {
+      return -1;
+    }
+  }
+  // Resolve the working precision:
+  if (out->dtype == NDARRAY_FLOAT32) {
+    single = 1;
+  } else if (out->dtype == NDARRAY_FLOAT64) {
+    single = 0;
+  } else {
+    return -1;
+  }
+  wtype = (single) ? NDARRAY_FLOAT32 : NDARRAY_FLOAT64;
+  if (!ndarray_is_allowed_data_type_cast(
+          x->dtype, wtype, NDARRAY_SAME_KIND_CASTING
+      ) ||
+      !ndarray_is_allowed_data_type_cast(
+          kernel->dtype, wtype, NDARRAY_SAME_KIND_CASTING
+      )) {
+    return -1;
+  }
+  loop.load  = ndarray_strided_cast_function(x->dtype, wtype);
+  loop.store = ndarray_strided_cast_function(wtype, out->dtype);
+  kload      = ndarray_strided_cast_function(kernel->dtype, wtype);
+  if (loop.load == NULL || loop.store == NULL || kload == NULL) {
+    return -1;
+  }
+  loop.m0 = (ndk == 2) ? kernel->shape[0] : 1;
+  loop.m1 = kernel->shape[ndk - 1];
+  if (loop.m0 < 1 || loop.m1 < 1) {
+    return -1;
+  }
+  // For one-dimensional convolutions, treat the outer dimension having the
+  // smallest input stride as the first convolved dimension, such that rows
+  // may be gathered together:
+  if (ndk == 1) {
+    a0 = -1;
+    for (i = 0; i < ndims; i++) {
+      if (i != a1 && x->shape[i] > 1 &&
+          (a0 < 0 || llabs(x->strides[i]) < llabs(x->strides[a0]))) {
+        a0 = i;
+      }
+    }
+  }
+  nplanes = 1;
+  for (i = 0; i < ndims; i++) {
+    if (i != a0 && i != a1) {
+      nplanes *= x->shape[i];
+    }
+  }
+  loop.n0 = (a0 >= 0) ? x->shape[a0] : 1;
+  loop.n1 = x->shape[a1];
+  if (nplanes == 0 || loop.n0 == 0 || loop.n1 == 0) {
+    return 0;
+  }
+  loop.x       = x->data + x->offset;  // pointer arithmetic
+  loop.out     = out->data + out->offset;
+  loop.mode    = mode;
+  loop.c0      = loop.m0 / 2;
+  loop.c1      = loop.m1 / 2;
+  loop.L1      = loop.n1 + loop.m1 - 1;
+  loop.xs0     = (a0 >= 0) ? x->strides[a0] : 0;
+  loop.xs1     = x->strides[a1];
+  loop.os0     = (a0 >= 0) ? out->strides[a0] : 0;
+  loop.os1     = out->strides[a1];
+  loop.blocked = (loop.n0 > 1 && llabs(loop.xs0) < llabs(loop.xs1));
+  loop.esz     = ndarray_bytes_per_element(wtype);
+  loop.rb      = loop.L1 * loop.esz;
+  loop.yb      = loop.n1 * loop.esz;
+
+  // Allocate scratch memory for outer dimension meta data and the kernel:
+  nw    = loop.m0 * loop.m1;
+  nmeta = (sizeof(int64_t) * ((ndims * 3) + 1)) + (nw * loop.esz);
+  loop.oshape = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (loop.oshape == NULL) {
+    return -1;
+  }
+  loop.oxs = loop.oshape + ndims;
+  loop.oos = loop.oxs + ndims;
+  w        = (uint8_t*)(loop.oos + ndims + 1);  // pointer arithmetic
+  loop.w   = w;
+  loop.no  = 0;
+  for (i = 0; i < ndims; i++) {
+    if (i == a0 || i == a1 || x->shape[i] == 1) {
+      continue;
+    }
+    loop.oshape[loop.no] = x->shape[i];
+    loop.oxs[loop.no]    = x->strides[i];
+    loop.oos[loop.no]    = out->strides[i];
+    loop.no += 1;
+  }
+  // Load the kernel in row-major order, flipping the kernel along each
+  // dimension for convolutions:
+  kd = kernel->data + kernel->offset;  // pointer arithmetic
+  for (i = 0; i < loop.m0; i++) {
+    kload(
+        kd + ((ndk == 2) ? i * kernel->strides[0] : 0),
+        kernel->strides[ndk - 1], w + (i * loop.m1 * loop.esz), loop.esz,
+        loop.m1
+    );
+  }
+  if (flip) {
+    for (i = 0, j = nw - 1; i < j; i++, j--) {
+      memcpy(tmp, w + (i * loop.esz), loop.esz);
+      memcpy(w + (i * loop.esz), w + (j * loop.esz), loop.esz);
+      memcpy(w + (j * loop.esz), tmp, loop.esz);
+    }
+  }
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  // Resolve the number of output rows per stripe, such that extended rows
+  // remain in cache, while limiting the overhead of gathering the rows
+  // required beyond either end of a stripe and providing enough stripes for
+  // all threads:
+  loop.stripe = NDARRAY_CONVOLVE_STRIPE_BYTES / loop.rb;
+  if (loop.stripe < 4 * loop.m0) {
+    loop.stripe = 4 * loop.m0;
+  }
+  loop.stripe -= loop.m0 - 1;
+  t = (nplanes * loop.n0) / (4 * (int64_t)nthreads);
+  if (t < loop.stripe) {
+    loop.stripe = (t < loop.m0) ? loop.m0 : t;
+  }
+  if (loop.stripe > loop.n0) {
+    loop.stripe = loop.n0;
+  }
+  loop.nstripes = (loop.n0 + loop.stripe - 1) / loop.stripe;
+  loop.nunits   = nplanes * loop.nstripes;
+
+  // Resolve the method and, for transform-based convolutions, compute the
+  // transforms of the kernel rows:
+  loop.plan    = NULL;
+  loop.spectra = NULL;
+  loop.nfft    = ndarray_convolve_method(&loop);
+  loop.nseg    = loop.n1;
+  loop.compute = (single) ? ndarray_convolve_direct_f
+                          : ndarray_convolve_direct_d;
+  plan         = NULL;
+  spectra      = NULL;
+  nspectra     = 0;
+  nwork        = 0;
+  if (loop.nfft > 0) {
+    plan = ndarray_internal_fft_real_plan(loop.nfft, single);
+    if (plan == NULL) {
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+      return -1;
+    }
+    nwork    = 2 * ndarray_internal_fft_workspace(plan) * loop.esz;
+    nspectra = (loop.m0 * (loop.nfft + 2) * loop.esz) + nwork;
+    spectra  = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nspectra);
+    if (spectra == NULL) {
+      ndarray_internal_fft_release(plan);
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+      return -1;
+    }
+    loop.plan    = plan;
+    loop.spectra = spectra;
+    loop.nseg    = loop.nfft - loop.m1 + 1;
+    loop.compute = (single) ? ndarray_convolve_fft_f : ndarray_convolve_fft_d;
+    if (single) {
+      ndarray_convolve_spectra_f(&loop, spectra, spectra + nspectra - nwork);
+    } else {
+      ndarray_convolve_spectra_d(&loop, spectra, spectra + nspectra - nwork);
+    }
+    // Include segment transforms, an accumulator, and a transform workspace
+    // in each thread's workspace:
+    nwork += (loop.stripe + loop.m0) * (loop.nfft + 2) * loop.esz;
+  }
+  // Group stripes of short rows, such that each task processes a minimum
+  // number of elements:
+  loop.group = NDARRAY_CONVOLVE_GROUP / (loop.stripe * loop.n1);
+  if (loop.group < 1) {
+    loop.group = 1;
+  }
+  ntasks = (loop.nunits + loop.group - 1) / loop.group;
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory for extended rows, output rows, and a
+  // workspace:
+  loop.sb = ((loop.stripe + loop.m0 - 1) * loop.rb) +
+            (loop.stripe * loop.yb) + nwork;
+  loop.sb = ((loop.sb + 15) / 16) * 16;
+  nbytes  = loop.sb * nthreads;
+  loop.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.scratch == NULL) {
+    status = -1;
+  } else {
+    status =
+        ndarray_parallel_for(ntasks, nthreads, ndarray_convolve_task, &loop);
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.scratch, nbytes);
+  }
+  if (spectra != NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, spectra, nspectra);
+  }
+  ndarray_internal_fft_release(plan);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+  return status;
+}
+
+/**
+ * Convolves ndarray elements with a one-dimensional kernel along a specified
+ * dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray and a
+ *     real-valued floating-point data type (`float32` or `float64`), which
+ *     determines the working precision. Input and kernel elements are
+ *     converted to the output data type according to `same_kind` casting
+ *     rules.
+ * -   For a kernel `k` of length `m`, the function computes
+ *     `y_i = sum_j k_j x_(i-j+(m-1)/2)` (rounded down), such that the kernel is
+ *     centered on each output element and the output matches the central part
+ *     of a full convolution having the same length as the input (e.g., as
+ *     computed by NumPy's `convolve` with `mode='same'`).
+ * -   Elements beyond either end of the dimension are resolved according to
+ *     the index mode. `NDARRAY_INDEX_CLAMP` repeats the edge elements,
+ *     `NDARRAY_INDEX_WRAP` treats the dimension as periodic, and
+ *     `NDARRAY_INDEX_ERROR` treats the elements as zeros. Only the elements
+ *     required by each line are resolved, and, thus, the function never
+ *     materializes a padded copy of the input ndarray.
+ * -   Short kernels are applied directly, updating chunks of outputs for each
+ *     kernel element. For long kernels, lines are split into overlapping
+ *     segments which are convolved by multiplying real-input transforms
+ *     (overlap-save), such that each output requires `O(log m)` operations.
+ *     The method is selected according to an estimate of the cost of each.
+ * -   Lines are processed in parallel. If `nthreads` is less than or equal to
+ *     zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   The input and output ndarrays must **not** share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param kernel    one-dimensional kernel
+ * @param axis      dimension along which to convolve
+ * @param mode      index mode for elements beyond either end of the dimension
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/convolve.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major ndarray and a kernel:
+ * double xbuf[] = {1.0, 2.0, 3.0, 4.0};
+ * double kbuf[] = {1.0, 1.0, 1.0};
+ * double ybuf[] = {0.0, 0.0, 0.0, 0.0};
+ * int64_t shape[] = {4};
+ * int64_t kshape[] = {3};
+ * int64_t strides[] = {8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)xbuf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ * struct ndarray *k = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)kbuf, 1, kshape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ybuf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute a moving sum, repeating the edge elements:
+ * int8_t status = ndarray_convolve(x, k, 0, NDARRAY_INDEX_CLAMP, 1, y);
+ * // ybuf => {4.0, 6.0, 9.0, 11.0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(k);
+ * ndarray_free(y);
+ */
+int8_t ndarray_convolve(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis,
+    const int8_t mode, int32_t nthreads, struct ndarray* out
+) {
+  return ndarray_convolve_execute(
+      x, kernel, -1, axis, 1, 1, mode, nthreads, out
+  );
+}
+
+/**
+ * Correlates ndarray elements with a one-dimensional kernel along a specified
+ * dimension.
+ *
+ * ## Notes
+ *
+ * -   For a kernel `k` of length `m`, the function computes
+ *     `y_i = sum_j k_j x_(i+j-m/2)` (rounded down), such that the output
+ *     matches the central part of a full correlation having the same length as
+ *     the input (e.g., as computed by NumPy's `correlate` with `mode='same'`).
+ * -   The function otherwise follows the conventions of `ndarray_convolve`.
+ *
+ * @param x         input ndarray
+ * @param kernel    one-dimensional kernel
+ * @param axis      dimension along which to correlate
+ * @param mode      index mode for elements beyond either end of the dimension
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/convolve.h"
+ * #include "ndarray/index_modes.h"
+ *
+ * // ...
+ *
+ * // Correlate each row with a template, treating rows as periodic:
+ * int8_t status = ndarray_correlate(x, k, -1, NDARRAY_INDEX_WRAP, 0, y);
+ */
+int8_t ndarray_correlate(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis,
+    const int8_t mode, int32_t nthreads, struct ndarray* out
+) {
+  return ndarray_convolve_execute(
+      x, kernel, -1, axis, 1, 0, mode, nthreads, out
+  );
+}
+
+/**
+ * Convolves ndarray elements with a two-dimensional kernel along two specified
+ * dimensions.
+ *
+ * ## Notes
+ *
+ * -   The first and second kernel dimensions correspond to `axis0` and
+ *     `axis1`, respectively, and the kernel is centered on each output element
+ *     along each dimension as described for `ndarray_convolve`.
+ * -   Kernels are applied directly to stripes of rows along `axis1`. For
+ *     kernels which are long along `axis1`, each row is convolved with each
+ *     kernel row by multiplying real-input transforms of overlap-save
+ *     segments, and the products are accumulated before inverting the
+ *     transforms.
+ * -   Stripes of rows are processed in parallel, such that a single
+ *     two-dimensional plane is processed by multiple threads.
+ * -   Separable kernels are applied more efficiently as two one-dimensional
+ *     convolutions (see `ndarray_convolve`).
+ * -   The function otherwise follows the conventions of `ndarray_convolve`.
+ *
+ * @param x         input ndarray
+ * @param kernel    two-dimensional kernel
+ * @param axis0     first dimension along which to convolve
+ * @param axis1     second dimension along which to convolve
+ * @param mode      index mode for elements beyond either end of a dimension
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/convolve.h"
+ * #include "ndarray/index_modes.h"
+ *
+ * // ...
+ *
+ * // Smooth each image in a stack of images, repeating edge pixels:
+ * int8_t status = ndarray_convolve2d(x, k, -2, -1, NDARRAY_INDEX_CLAMP, 0, y);
+ */
+int8_t ndarray_convolve2d(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis0,
+    const int64_t axis1, const int8_t mode, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_convolve_execute(
+      x, kernel, axis0, axis1, 2, 1, mode, nthreads, out
+  );
+}
+
+/**
+ * Correlates ndarray elements with a two-dimensional kernel along two specified
+ * dimensions.
+ *
+ * ## Notes
+ *
+ * -   The function follows the conventions of `ndarray_correlate` along each
+ *     dimension and of `ndarray_convolve2d` otherwise.
+ *
+ * @param x         input ndarray
+ * @param kernel    two-dimensional kernel
+ * @param axis0     first dimension along which to correlate
+ * @param axis1     second dimension along which to correlate
+ * @param mode      index mode for elements beyond either end of a dimension
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/convolve.h"
+ * #include "ndarray/index_modes.h"
+ *
+ * // ...
+ *
+ * // Match a template against each image, treating images as periodic:
+ * int8_t status = ndarray_correlate2d(x, k, 0, 1, NDARRAY_INDEX_WRAP, 0, y);
+ */
+int8_t ndarray_correlate2d(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis0,
+    const int64_t axis1, const int8_t mode, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_convolve_execute(
+      x, kernel, axis0, axis1, 2, 0, mode, nthreads, out
+  );
+}
@@ -0,0 +1,289 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/cpu_features.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ndarray/base/internal/atomics.h"
+#include "ndarray/cpu_features.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define NDARRAY_CPU_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// Define the name of the environment variable for overriding detected CPU
+// features:
+#define NDARRAY_CPU_FEATURES_ENV "NDARRAY_CPU_FEATURES"
+
+/**
+ * Structure mapping a CPU feature name to a CPU feature.
+ *
+ * @private
+ */
+struct ndarrayCPUFeatureName {
+  // Feature name:
+  const char* name;
+
+  // Feature bit mask:
+  int64_t feature;
+};
+
+// Define a table of recognized CPU feature names:
+static const struct ndarrayCPUFeatureName NDARRAY_CPU_FEATURE_NAMES[] = {
+    {"sse2", NDARRAY_CPU_SSE2},         {"sse4.1", NDARRAY_CPU_SSE41},
+    {"sse41", NDARRAY_CPU_SSE41},       {"sse4.2", NDARRAY_CPU_SSE42},
+    {"sse42", NDARRAY_CPU_SSE42},       {"avx", NDARRAY_CPU_AVX},
+    {"avx2", NDARRAY_CPU_AVX2},         {"fma", NDARRAY_CPU_FMA},
+    {"avx512f", NDARRAY_CPU_AVX512F},   {"avx512dq", NDARRAY_CPU_AVX512DQ},
+    {"avx512bw", NDARRAY_CPU_AVX512BW}, {"avx512vl", NDARRAY_CPU_AVX512VL},
+    {"neon", NDARRAY_CPU_NEON},         {"none", 0},
+    {"all", -1},
+};
+
+// Cached CPU features (note: `-1` until features have been resolved):
+static volatile int64_t NDARRAY_CPU_FEATURES_CACHE = -1;
+
+#ifdef NDARRAY_CPU_X86
+/**
+ * Queries a CPUID leaf.
+ *
+ * @private
+ * @param leaf     leaf
+ * @param subleaf  subleaf
+ * @param out      output array for the EAX, EBX, ECX, and EDX registers
+ * @return         boolean indicating whether the leaf is supported
+ */
+static int8_t ndarray_cpu_cpuid(
+    const uint32_t leaf, const uint32_t subleaf, uint32_t out[4]
+) {
+#if defined(_MSC_VER)
+  int regs[4];
+
+  __cpuid(regs, 0);
+  if ((uint32_t)regs[0] < leaf) {
+    return 0;
+  }
+  __cpuidex(regs, (int)leaf, (int)subleaf);
+  out[0] = (uint32_t)regs[0];
+  out[1] = (uint32_t)regs[1];
+  out[2] = (uint32_t)regs[2];
+  out[3] = (uint32_t)regs[3];
+  return 1;
+#else
+  if (__get_cpuid_max(0, NULL) < leaf) {
+    return 0;
+  }
+  __cpuid_count(leaf, subleaf, out[0], out[1], out[2], out[3]);
+  return 1;
+#endif
+}
+
+/**
+ * Returns the extended control register XCR0, which indicates the register
+ * state saved by the operating system.
+ *
+ * @private
+ * @return  register value
+ */
+static uint64_t ndarray_cpu_xgetbv(void) {
+#if defined(_MSC_VER)
+  return (uint64_t)_xgetbv(0);
+#else
+  uint32_t eax;
+  uint32_t edx;
+
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif
+}
+#endif
+
+/**
+ * Detects the CPU features supported by the running CPU and operating system.
+ *
+ * @private
+ * @return  bit mask of CPU features
+ */
+static int64_t ndarray_cpu_detect(void) {
+  int64_t features = 0;
+#ifdef NDARRAY_CPU_X86
+  uint32_t regs[4];
+  uint64_t xcr0;
+
+  if (!ndarray_cpu_cpuid(1, 0, regs)) {
+    return 0;
+  }
+  if (regs[3] & (1u << 26)) {
+    features |= NDARRAY_CPU_SSE2;
+  }
+  if (regs[2] & (1u << 19)) {
+    features |= NDARRAY_CPU_SSE41;
+  }
+  if (regs[2] & (1u << 20)) {
+    features |= NDARRAY_CPU_SSE42;
+  }
+  // AVX requires operating system support for saving YMM registers...
+  if (!(regs[2] & (1u << 27))) {
+    return features;
+  }
+  xcr0 = ndarray_cpu_xgetbv();
+  if ((xcr0 & 0x6) != 0x6) {
+    return features;
+  }
+  if (regs[2] & (1u << 28)) {
+    features |= NDARRAY_CPU_AVX;
+  }
+  if ((regs[2] & (1u << 12)) && (features & NDARRAY_CPU_AVX)) {
+    features |= NDARRAY_CPU_FMA;
+  }
+  if (!ndarray_cpu_cpuid(7, 0, regs)) {
+    return features;
+  }
+  if ((regs[1] & (1u << 5)) && (features & NDARRAY_CPU_AVX)) {
+    features |= NDARRAY_CPU_AVX2;
+  }
+  // AVX-512 requires operating system support for saving ZMM and opmask
+  // registers...
+  if ((xcr0 & 0xe6) != 0xe6 || !(regs[1] & (1u << 16))) {
+    return features;
+  }
+  features |= NDARRAY_CPU_AVX512F;
+  if (regs[1] & (1u << 17)) {
+    features |= NDARRAY_CPU_AVX512DQ;
+  }
+  if (regs[1] & (1u << 30)) {
+    features |= NDARRAY_CPU_AVX512BW;
+  }
+  if (regs[1] & (1u << 31)) {
+    features |= NDARRAY_CPU_AVX512VL;
+  }
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+  // NEON is mandatory on AArch64 (and enabled at compile time otherwise):
+  features |= NDARRAY_CPU_NEON;
+#endif
+  return features;
+}
+
+/**
+ * Parses a list of CPU feature names.
+ *
+ * ## Notes
+ *
+ * -   Feature names (e.g., `sse4.2`, `avx2`, `fma`, `avx512f`, `neon`) may be
+ *     separated by commas, spaces, semicolons, or plus signs (e.g.,
+ *     `avx2+fma`).
+ * -   The name `none` corresponds to no features (e.g., to force scalar
+ *     implementations), and the name `all` corresponds to all features.
+ * -   Unrecognized names are ignored.
+ *
+ * @param str  list of CPU feature names
+ * @return     bit mask of CPU features
+ *
+ * @example
+ * #include "ndarray/base/cpu_features.h"
+ * #include <stdint.h>
+ *
+ * int64_t features = ndarray_cpu_parse_features("sse4.2,avx2+fma");
+ * // returns NDARRAY_CPU_SSE42 | NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA
+ */
+int64_t ndarray_cpu_parse_features(const char* str) {
+  int64_t features;
+  size_t len;
+  size_t n;
+  size_t i;
+
+  features = 0;
+  if (str == NULL) {
+    return features;
+  }
+  n = sizeof(NDARRAY_CPU_FEATURE_NAMES) / sizeof(NDARRAY_CPU_FEATURE_NAMES[0]);
+  while (*str != '\0') {
+    len = strcspn(str, ", ;+");
+    for (i = 0; i < n; i++) {
+      if (strlen(NDARRAY_CPU_FEATURE_NAMES[i].name) == len &&
+          strncmp(str, NDARRAY_CPU_FEATURE_NAMES[i].name, len) == 0) {
+        features |= NDARRAY_CPU_FEATURE_NAMES[i].feature;
+        break;
+      }
+    }
+    str += len;  // pointer arithmetic
+    if (*str != '\0') {
+      str += 1;  // skip the separator
+    }
+  }
+  return features;
+}
+
+/**
+ * Returns a bit mask of CPU features supported by the running CPU.
+ *
+ * ## Notes
+ *
+ * -   Features are detected once (via CPUID on x86) and cached for the
+ *     lifetime of the process.
+ * -   If the `NDARRAY_CPU_FEATURES` environment variable is set, the returned
+ *     features are restricted to those listed in the environment variable
+ *     (see `ndarray_cpu_parse_features`), thus allowing implementations for
+ *     older CPUs to be tested on newer CPUs (e.g., `NDARRAY_CPU_FEATURES=none`
+ *     forces scalar implementations). Features not supported by the running
+ *     CPU are never reported.
+ *
+ * @return  bit mask of CPU features
+ *
+ * @example
+ * #include "ndarray/base/cpu_features.h"
+ * #include "ndarray/cpu_features.h"
+ * #include <stdint.h>
+ *
+ * int64_t features = ndarray_cpu_features();
+ * if (features & NDARRAY_CPU_AVX2) {
+ *     // ...
+ * }
+ */
+int64_t ndarray_cpu_features(void) {
+  const char* env;
+  int64_t features;
+
+  features = ndarray_internal_atomic_load(&NDARRAY_CPU_FEATURES_CACHE);
+  if (features >= 0) {
+    return features;
+  }
+  // Note: concurrent callers may both detect features, but they always
+  // compute the same result...
+  features = ndarray_cpu_detect();
+  env      = getenv(NDARRAY_CPU_FEATURES_ENV);
+  if (env != NULL) {
+    features &= ndarray_cpu_parse_features(env);
+  }
+  ndarray_internal_atomic_store(&NDARRAY_CPU_FEATURES_CACHE, features);
+  return features;
+}
+
+/**
+ * Tests whether the running CPU supports a set of CPU features.
+ *
+ * @param features  bit mask of CPU features
+ * @return          boolean indicating whether all features are supported
+ *
+ * @example
+ * #include "ndarray/base/cpu_features.h"
+ * #include "ndarray/cpu_features.h"
+ * #include <stdint.h>
+ *
+ * int8_t b = ndarray_cpu_has_features(NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA);
+ */
+int8_t ndarray_cpu_has_features(const int64_t features) {
+  return ((ndarray_cpu_features() & features) == features) ? 1 : 0;
+}
@@ -0,0 +1,518 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/dtype_registry.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/internal/atomics.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/dtypes.h"
+
+// Define the maximum number of user-defined data types:
+#define NDARRAY_DTYPE_MAX_TYPES 64
+
+// Define the maximum number of registered conversions:
+#define NDARRAY_DTYPE_MAX_CASTS 256
+
+// Define the maximum supported alignment (in bytes), which matches the
+// alignment of scratch memory allocated by the library:
+#define NDARRAY_DTYPE_MAX_ALIGNMENT 16
+
+/**
+ * Structure describing a user-defined data type.
+ *
+ * @private
+ */
+struct ndarrayDataType {
+  // Data type name:
+  const char* name;
+
+  // Number of bytes per element:
+  int64_t nbytes;
+
+  // Element alignment (in bytes):
+  int64_t alignment;
+
+  // Function for copying strided elements:
+  ndarrayStridedCastFcn copy;
+};
+
+/**
+ * Structure describing a registered conversion.
+ *
+ * @private
+ */
+struct ndarrayDataTypeCast {
+  // Input data type:
+  int16_t from;
+
+  // Output data type:
+  int16_t to;
+
+  // Least permissive casting mode in which the conversion is allowed:
+  int8_t casting;
+
+  // Conversion function:
+  ndarrayStridedCastFcn fcn;
+};
+
+// Registered user-defined data types:
+static struct ndarrayDataType NDARRAY_DTYPE_TYPES[NDARRAY_DTYPE_MAX_TYPES];
+
+// Number of registered user-defined data types (note: entries are published by
+// incrementing the count after an entry has been written):
+static volatile int64_t NDARRAY_DTYPE_NTYPES = 0;
+
+// Registered conversions:
+static struct ndarrayDataTypeCast NDARRAY_DTYPE_CASTS[NDARRAY_DTYPE_MAX_CASTS];
+
+// Number of registered conversions:
+static volatile int64_t NDARRAY_DTYPE_NCASTS = 0;
+
+// Lock serializing registrations:
+static volatile int64_t NDARRAY_DTYPE_LOCK = 0;
+
+// Define a macro for generating a function which copies strided elements
+// having a fixed size:
+#define NDARRAY_DTYPE_COPY(name, N)                                            \
+  static void name(                                                            \
+      const uint8_t* in, const int64_t sin, uint8_t* out, const int64_t sout,  \
+      const int64_t n                                                          \
+  ) {                                                                          \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, in += sin, out += sout) {                          \
+      memcpy(out, in, N);                                                      \
+    }                                                                          \
+  }
+
+NDARRAY_DTYPE_COPY(ndarray_dtype_copy1, 1)
+NDARRAY_DTYPE_COPY(ndarray_dtype_copy2, 2)
+NDARRAY_DTYPE_COPY(ndarray_dtype_copy4, 4)
+NDARRAY_DTYPE_COPY(ndarray_dtype_copy8, 8)
+NDARRAY_DTYPE_COPY(ndarray_dtype_copy16, 16)
+
+/**
+ * Acquires the registration lock.
+ *
+ * @private
+ */
+static void ndarray_dtype_lock(void) {
+  while (!ndarray_internal_atomic_compare_exchange(&NDARRAY_DTYPE_LOCK, 0, 1)) {
+    // Registrations are rare and brief, so spin...
+  }
+}
+
+/**
+ * Releases the registration lock.
+ *
+ * @private
+ */
+static void ndarray_dtype_unlock(void) {
+  ndarray_internal_atomic_store(&NDARRAY_DTYPE_LOCK, 0);
+}
+
+/**
+ * Returns a pointer to the description of a registered user-defined data type
+ * (or `NULL` if the data type is not registered).
+ *
+ * @private
+ * @param dtype  data type
+ * @return       data type description
+ */
+static const struct ndarrayDataType* ndarray_dtype_get(const int16_t dtype) {
+  int64_t n = ndarray_internal_atomic_load(&NDARRAY_DTYPE_NTYPES);
+  if (dtype < NDARRAY_USERDEFINED_TYPE ||
+      dtype - NDARRAY_USERDEFINED_TYPE >= n) {
+    return NULL;
+  }
+  return &(NDARRAY_DTYPE_TYPES[dtype - NDARRAY_USERDEFINED_TYPE]);
+}
+
+/**
+ * Returns a pointer to a registered conversion (or `NULL` if a conversion is
+ * not registered).
+ *
+ * @private
+ * @param from  input data type
+ * @param to    output data type
+ * @return      registered conversion
+ */
+static const struct ndarrayDataTypeCast* ndarray_dtype_get_cast(
+    const int16_t from, const int16_t to
+) {
+  int64_t n;
+  int64_t i;
+
+  n = ndarray_internal_atomic_load(&NDARRAY_DTYPE_NCASTS);
+  for (i = 0; i < n; i++) {
+    if (NDARRAY_DTYPE_CASTS[i].from == from &&
+        NDARRAY_DTYPE_CASTS[i].to == to) {
+      return &(NDARRAY_DTYPE_CASTS[i]);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Registers a user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   The function assigns a data type number greater than or equal to
+ *     `NDARRAY_USERDEFINED_TYPE`, which may be used wherever the library
+ *     accepts a data type (e.g., when creating ndarrays or as part of ndarray
+ *     function type signatures). Once registered, the library determines the
+ *     number of bytes per element of a user-defined data type (see
+ *     `ndarray_bytes_per_element`), and, thus, ndarray flags, contiguity
+ *     checks, blocking, and copying treat the data type like a built-in data
+ *     type.
+ * -   The alignment must be a power of two which does not exceed the number of
+ *     bytes per element or `16`.
+ * -   The copy function copies strided elements without conversion. If `copy`
+ *     is `NULL` and the number of bytes per element is `1`, `2`, `4`, `8`, or
+ *     `16`, the function uses a built-in copy function; otherwise, a copy
+ *     function must be provided.
+ * -   The data type name is **not** copied and must remain valid for the
+ *     lifetime of the process. Names must be unique.
+ * -   Data types cannot be unregistered.
+ * -   If unable to register a data type, the function returns `-1`.
+ *
+ * @param name       data type name
+ * @param nbytes     number of bytes per element
+ * @param alignment  element alignment (in bytes)
+ * @param copy       function for copying strided elements (or `NULL`)
+ * @return           data type number
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include <stdint.h>
+ *
+ * // Register a 32-bit fixed-point data type:
+ * int16_t dtype = ndarray_dtype_register("q16.16", 4, 4, NULL);
+ */
+int16_t ndarray_dtype_register(
+    const char* name, const int64_t nbytes, const int64_t alignment,
+    ndarrayStridedCastFcn copy
+) {
+  struct ndarrayDataType* t;
+  int64_t n;
+
+  if (name == NULL || nbytes <= 0 || alignment <= 0 ||
+      (alignment & (alignment - 1)) != 0 || alignment > nbytes ||
+      alignment > NDARRAY_DTYPE_MAX_ALIGNMENT) {
+    return -1;
+  }
+  if (copy == NULL) {
+    switch (nbytes) {
+      case 1:
+        copy = ndarray_dtype_copy1;
+        break;
+      case 2:
+        copy = ndarray_dtype_copy2;
+        break;
+      case 4:
+        copy = ndarray_dtype_copy4;
+        break;
+      case 8:
+        copy = ndarray_dtype_copy8;
+        break;
+      case 16:
+        copy = ndarray_dtype_copy16;
+        break;
+      default:
+        return -1;
+    }
+  }
+  ndarray_dtype_lock();
+  n = NDARRAY_DTYPE_NTYPES;
+  if (n >= NDARRAY_DTYPE_MAX_TYPES || ndarray_dtype_lookup(name) >= 0) {
+    ndarray_dtype_unlock();
+    return -1;
+  }
+  t            = &(NDARRAY_DTYPE_TYPES[n]);
+  t->name      = name;
+  t->nbytes    = nbytes;
+  t->alignment = alignment;
+  t->copy      = copy;
+
+  // Publish the data type:
+  ndarray_internal_atomic_store(&NDARRAY_DTYPE_NTYPES, n + 1);
+  ndarray_dtype_unlock();
+
+  return (int16_t)(NDARRAY_USERDEFINED_TYPE + n);
+}
+
+/**
+ * Registers a conversion between data types, at least one of which is a
+ * user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   The casting mode specifies the least permissive casting mode in which the
+ *     conversion is allowed (e.g., `NDARRAY_SAFE_CASTING` for a conversion
+ *     which preserves values or `NDARRAY_SAME_KIND_CASTING` for a conversion
+ *     between data types of the same kind). Registered conversions are always
+ *     allowed in `NDARRAY_UNSAFE_CASTING` mode.
+ * -   Registering a conversion which has already been registered replaces the
+ *     previously registered conversion.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param from     input data type
+ * @param to       output data type
+ * @param fcn      conversion function
+ * @param casting  least permissive casting mode allowing the conversion
+ * @return         status code
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_dtype_register_cast(
+ *     dtype, NDARRAY_FLOAT64, fixed_to_float64, NDARRAY_SAFE_CASTING
+ * );
+ */
+int8_t ndarray_dtype_register_cast(
+    const int16_t from, const int16_t to, ndarrayStridedCastFcn fcn,
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  struct ndarrayDataTypeCast* c;
+  int64_t n;
+
+  // Conversions between built-in data types cannot be registered...
+  if (fcn == NULL || from == to ||
+      (from < NDARRAY_USERDEFINED_TYPE && to < NDARRAY_USERDEFINED_TYPE) ||
+      ndarray_bytes_per_element(from) == 0 ||
+      ndarray_bytes_per_element(to) == 0) {
+    return -1;
+  }
+  ndarray_dtype_lock();
+  c = (struct ndarrayDataTypeCast*)ndarray_dtype_get_cast(from, to);
+  if (c != NULL) {
+    c->casting = (int8_t)casting;
+    c->fcn     = fcn;
+    ndarray_dtype_unlock();
+    return 0;
+  }
+  n = NDARRAY_DTYPE_NCASTS;
+  if (n >= NDARRAY_DTYPE_MAX_CASTS) {
+    ndarray_dtype_unlock();
+    return -1;
+  }
+  c          = &(NDARRAY_DTYPE_CASTS[n]);
+  c->from    = from;
+  c->to      = to;
+  c->casting = (int8_t)casting;
+  c->fcn     = fcn;
+
+  // Publish the conversion:
+  ndarray_internal_atomic_store(&NDARRAY_DTYPE_NCASTS, n + 1);
+  ndarray_dtype_unlock();
+
+  return 0;
+}
+
+/**
+ * Returns the data type number of a registered user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   If a data type having the specified name has not been registered, the
+ *     function returns `-1`.
+ *
+ * @param name  data type name
+ * @return      data type number
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include <stdint.h>
+ *
+ * int16_t dtype = ndarray_dtype_lookup("q16.16");
+ */
+int16_t ndarray_dtype_lookup(const char* name) {
+  int64_t n;
+  int64_t i;
+
+  if (name == NULL) {
+    return -1;
+  }
+  n = ndarray_internal_atomic_load(&NDARRAY_DTYPE_NTYPES);
+  for (i = 0; i < n; i++) {
+    if (strcmp(NDARRAY_DTYPE_TYPES[i].name, name) == 0) {
+      return (int16_t)(NDARRAY_USERDEFINED_TYPE + i);
+    }
+  }
+  return -1;
+}
+
+/**
+ * Returns the name of a user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   If provided a built-in or unregistered data type, the function returns a
+ *     null pointer.
+ *
+ * @param dtype  data type
+ * @return       data type name
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ *
+ * // ...
+ *
+ * const char* name = ndarray_dtype_name(dtype);
+ */
+const char* ndarray_dtype_name(const int16_t dtype) {
+  const struct ndarrayDataType* t = ndarray_dtype_get(dtype);
+  return (t == NULL) ? NULL : t->name;
+}
+
+/**
+ * Returns the number of bytes per element of a user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   If provided a built-in or unregistered data type, the function returns
+ *     `0` (see `ndarray_bytes_per_element` for built-in data types).
+ *
+ * @param dtype  data type
+ * @return       number of bytes per element
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * int64_t nbytes = ndarray_dtype_bytes_per_element(dtype);
+ */
+int64_t ndarray_dtype_bytes_per_element(const int16_t dtype) {
+  const struct ndarrayDataType* t = ndarray_dtype_get(dtype);
+  return (t == NULL) ? 0 : t->nbytes;
+}
+
+/**
+ * Returns the alignment (in bytes) of a data type.
+ *
+ * ## Notes
+ *
+ * -   Built-in data types are aligned to their number of bytes per element,
+ *     except for complex data types, which are aligned to their components.
+ * -   If provided an unsupported data type, the function returns `0`.
+ *
+ * @param dtype  data type
+ * @return       alignment
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * int64_t a = ndarray_dtype_alignment(NDARRAY_COMPLEX128);
+ * // returns 8
+ */
+int64_t ndarray_dtype_alignment(const int16_t dtype) {
+  const struct ndarrayDataType* t;
+
+  if (dtype == NDARRAY_COMPLEX64 || dtype == NDARRAY_COMPLEX128) {
+    return ndarray_bytes_per_element(dtype) / 2;
+  }
+  if (dtype < NDARRAY_USERDEFINED_TYPE) {
+    return ndarray_bytes_per_element(dtype);
+  }
+  t = ndarray_dtype_get(dtype);
+  return (t == NULL) ? 0 : t->alignment;
+}
+
+/**
+ * Returns a registered function for converting strided elements between data
+ * types, at least one of which is a user-defined data type.
+ *
+ * ## Notes
+ *
+ * -   If the data types are the same user-defined data type, the function
+ *     returns the data type's copy function.
+ * -   If a conversion is not registered, the function returns a null pointer.
+ *
+ * @param from  input data type
+ * @param to    output data type
+ * @return      strided cast function
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include "ndarray/base/cast.h"
+ * #include "ndarray/dtypes.h"
+ *
+ * // ...
+ *
+ * ndarrayStridedCastFcn f = ndarray_dtype_cast_function(
+ *     dtype, NDARRAY_FLOAT64
+ * );
+ */
+ndarrayStridedCastFcn ndarray_dtype_cast_function(
+    const int16_t from, const int16_t to
+) {
+  const struct ndarrayDataTypeCast* c;
+  const struct ndarrayDataType* t;
+
+  if (from == to) {
+    t = ndarray_dtype_get(from);
+    return (t == NULL) ? NULL : t->copy;
+  }
+  c = ndarray_dtype_get_cast(from, to);
+  return (c == NULL) ? NULL : c->fcn;
+}
+
+/**
+ * Determines if a registered conversion between data types is allowed
+ * according to a specified casting mode.
+ *
+ * ## Notes
+ *
+ * -   A conversion from a user-defined data type to itself is always allowed.
+ * -   If a conversion is not registered, the function returns `0`.
+ *
+ * @param from     input data type
+ * @param to       output data type
+ * @param casting  casting mode
+ * @return         boolean indicating whether a conversion is allowed
+ *
+ * @example
+ * #include "ndarray/base/dtype_registry.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * int8_t b = ndarray_dtype_is_allowed_cast(
+ *     dtype, NDARRAY_FLOAT64, NDARRAY_SAFE_CASTING
+ * );
+ */
+int8_t ndarray_dtype_is_allowed_cast(
+    const int16_t from, const int16_t to,
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  const struct ndarrayDataTypeCast* c;
+
+  if (from == to) {
+    return (ndarray_dtype_get(from) == NULL) ? 0 : 1;
+  }
+  c = ndarray_dtype_get_cast(from, to);
+  if (c == NULL) {
+    return 0;
+  }
+  return ((int8_t)casting >= c->casting) ? 1 : 0;
+}
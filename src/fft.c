@@ -0,0 +1,1785 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/fft.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/assert.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/internal/atomics.h"
+#include "ndarray/base/internal/fft.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+
+// Define the number of cached plans:
+#define NDARRAY_FFT_CACHE_SIZE 16
+
+// Define the largest prime factor computed using a mixed-radix pass (note:
+// transforms whose lengths have larger prime factors are computed as
+// convolutions using Bluestein's algorithm):
+#define NDARRAY_FFT_MAX_RADIX 64
+
+// Define the maximum number of factors of a transform length:
+#define NDARRAY_FFT_MAX_FACTORS 64
+
+// Define the maximum number of lines gathered into a block:
+#define NDARRAY_FFT_BLOCK 16
+
+// Define the maximum number of bytes of line buffers per block:
+#define NDARRAY_FFT_BLOCK_BYTES 262144
+
+// Define the minimum number of elements processed by a task:
+#define NDARRAY_FFT_GROUP 16384
+
+// Define the supported operations:
+#define NDARRAY_FFT_OP_FFT 0
+#define NDARRAY_FFT_OP_IFFT 1
+#define NDARRAY_FFT_OP_RFFT 2
+#define NDARRAY_FFT_OP_IRFFT 3
+
+// Define the plan kinds:
+#define NDARRAY_FFT_KIND_COMPLEX 0
+#define NDARRAY_FFT_KIND_REAL 1
+
+/**
+ * Structure describing a transform plan.
+ *
+ * ## Notes
+ *
+ * -   Plans are immutable once created and are shared between threads and
+ *     calls via a cache. A plan is freed when its last reference is released.
+ *
+ * @private
+ */
+struct ndarrayFFTPlan {
+  // Transform length:
+  int64_t n;
+
+  // Plan kind:
+  int8_t kind;
+
+  // Boolean indicating whether the plan operates on single-precision
+  // floating-point numbers:
+  int8_t single;
+
+  // Reference count (note: the cache holds a reference to each cached plan):
+  volatile int64_t refs;
+
+  // Number of factors (i.e., mixed-radix passes):
+  int64_t nfactors;
+
+  // Factors of the transform length:
+  int64_t factors[NDARRAY_FFT_MAX_FACTORS];
+
+  // Convolution length (note: `0` unless the plan uses Bluestein's
+  // algorithm):
+  int64_t nb;
+
+  // Twiddle factors, roots of unity, chirps, or convolution kernels, as
+  // interleaved complex numbers in plan precision:
+  void* twiddles;
+
+  // Sub-plan (note: a complex plan of length `nb` for Bluestein's algorithm, a
+  // complex plan of length `n/2` (even lengths) or `n` (odd lengths) for real
+  // plans, and `NULL` otherwise):
+  struct ndarrayFFTPlan* sub;
+
+  // Number of complex numbers of workspace required to execute the plan:
+  int64_t nwork;
+
+  // Number of allocated bytes:
+  int64_t nbytes;
+};
+
+/**
+ * Function pointer type for a function which transforms a line stored in a
+ * contiguous buffer.
+ *
+ * @private
+ * @param plan  plan
+ * @param op    operation
+ * @param buf   line buffer
+ * @param work  workspace
+ */
+typedef void (*ndarrayFFTLineFcn)(
+    const struct ndarrayFFTPlan* plan, const int8_t op, uint8_t* buf,
+    uint8_t* work
+);
+
+/**
+ * Structure containing the state of a transform along a dimension.
+ *
+ * @private
+ */
+struct ndarrayFFTLoop {
+  // Operation:
+  int8_t op;
+
+  // Plan:
+  const struct ndarrayFFTPlan* plan;
+
+  // Function for transforming a line:
+  ndarrayFFTLineFcn line;
+
+  // Function for converting input elements to line buffer elements:
+  ndarrayStridedCastFcn load;
+
+  // Function for converting line buffer elements to output elements:
+  ndarrayStridedCastFcn store;
+
+  // Pointer to the first input element:
+  const uint8_t* x;
+
+  // Pointer to the first output element:
+  uint8_t* out;
+
+  // Number of input elements along the transformed dimension:
+  int64_t nin;
+
+  // Number of output elements along the transformed dimension:
+  int64_t nout;
+
+  // Input stride (in bytes) along the transformed dimension:
+  int64_t xsa;
+
+  // Output stride (in bytes) along the transformed dimension:
+  int64_t osa;
+
+  // Number of bytes per line buffer element when loading input elements:
+  int64_t ib;
+
+  // Number of bytes per line buffer element when storing output elements:
+  int64_t ob;
+
+  // Number of bytes per line buffer:
+  int64_t lb;
+
+  // Number of outer dimensions (note: the first outer dimension has the
+  // smallest input stride, such that lines in a block are adjacent):
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension output strides:
+  int64_t* oos;
+
+  // Number of lines per block:
+  int64_t block;
+
+  // Number of blocks along the first outer dimension:
+  int64_t nblk;
+
+  // Total number of blocks:
+  int64_t nblocks;
+
+  // Number of blocks per task:
+  int64_t group;
+
+  // Per-thread scratch buffers (note: line buffers followed by a workspace):
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+// Cached plans:
+static struct ndarrayFFTPlan* NDARRAY_FFT_CACHE[NDARRAY_FFT_CACHE_SIZE];
+
+// Index of the next cache entry to replace:
+static int64_t NDARRAY_FFT_NEXT = 0;
+
+// Lock serializing cache accesses:
+static volatile int64_t NDARRAY_FFT_LOCK = 0;
+
+// Define a macro for defining mixed-radix passes of a Stockham autosort
+// transform over interleaved complex numbers having components of a specified
+// type (note: a pass computes `s*m` transforms of length `p`, reading
+// transform inputs at a stride of `s*m` elements and writing twiddled
+// transform outputs at a stride of `s` elements, such that no bit reversal is
+// necessary):
+#define NDARRAY_FFT_DEFINE_PASSES(c, type)                                     \
+  static inline void ndarray_fft_twiddle_##c(                                  \
+      type* b, const type er, const type ei, const type* t                     \
+  ) {                                                                          \
+    b[0] = (er * t[0]) - (ei * t[1]);                                          \
+    b[1] = (er * t[1]) + (ei * t[0]);                                          \
+  }                                                                            \
+  static void ndarray_fft_pass2_##c(                                           \
+      const type* x, type* y, const int64_t s, const int64_t m, const type* w  \
+  ) {                                                                          \
+    const type* a0;                                                            \
+    const type* a1;                                                            \
+    type* b0;                                                                  \
+    type* b1;                                                                  \
+    int64_t j;                                                                 \
+    int64_t q;                                                                 \
+    for (j = 0; j < m; j++) {                                                  \
+      a0 = x + (2 * s * j);  /* pointer arithmetic */                          \
+      a1 = a0 + (2 * s * m); /* pointer arithmetic */                          \
+      b0 = y + (4 * s * j);  /* pointer arithmetic */                          \
+      b1 = b0 + (2 * s);     /* pointer arithmetic */                          \
+      for (q = 0; q < 2 * s; q += 2) {                                         \
+        b0[q]     = a0[q] + a1[q];                                             \
+        b0[q + 1] = a0[q + 1] + a1[q + 1];                                     \
+        ndarray_fft_twiddle_##c(                                               \
+            b1 + q, a0[q] - a1[q], a0[q + 1] - a1[q + 1], w + (2 * j)          \
+        );                                                                     \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_pass3_##c(                                           \
+      const type* x, type* y, const int64_t s, const int64_t m, const type* w  \
+  ) {                                                                          \
+    const type h = (type)0.866025403784438646763723170752936183L;              \
+    const type* a0;                                                            \
+    const type* a1;                                                            \
+    const type* a2;                                                            \
+    const type* t;                                                             \
+    type* b0;                                                                  \
+    type* b1;                                                                  \
+    type* b2;                                                                  \
+    type tr;                                                                   \
+    type ti;                                                                   \
+    type cr;                                                                   \
+    type ci;                                                                   \
+    type dr;                                                                   \
+    type di;                                                                   \
+    int64_t j;                                                                 \
+    int64_t q;                                                                 \
+    for (j = 0; j < m; j++) {                                                  \
+      t  = w + (4 * j);      /* pointer arithmetic */                          \
+      a0 = x + (2 * s * j);  /* pointer arithmetic */                          \
+      a1 = a0 + (2 * s * m); /* pointer arithmetic */                          \
+      a2 = a1 + (2 * s * m); /* pointer arithmetic */                          \
+      b0 = y + (6 * s * j);  /* pointer arithmetic */                          \
+      b1 = b0 + (2 * s);     /* pointer arithmetic */                          \
+      b2 = b1 + (2 * s);     /* pointer arithmetic */                          \
+      for (q = 0; q < 2 * s; q += 2) {                                         \
+        tr        = a1[q] + a2[q];                                             \
+        ti        = a1[q + 1] + a2[q + 1];                                     \
+        b0[q]     = a0[q] + tr;                                                \
+        b0[q + 1] = a0[q + 1] + ti;                                            \
+        cr        = a0[q] - ((type)0.5 * tr);                                  \
+        ci        = a0[q + 1] - ((type)0.5 * ti);                              \
+        dr        = h * (a1[q + 1] - a2[q + 1]);                               \
+        di        = h * (a2[q] - a1[q]);                                       \
+        ndarray_fft_twiddle_##c(b1 + q, cr + dr, ci + di, t);                  \
+        ndarray_fft_twiddle_##c(b2 + q, cr - dr, ci - di, t + 2);              \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_pass4_##c(                                           \
+      const type* x, type* y, const int64_t s, const int64_t m, const type* w  \
+  ) {                                                                          \
+    const type* a0;                                                            \
+    const type* a1;                                                            \
+    const type* a2;                                                            \
+    const type* a3;                                                            \
+    const type* t;                                                             \
+    type* b0;                                                                  \
+    type* b1;                                                                  \
+    type* b2;                                                                  \
+    type* b3;                                                                  \
+    type t0r;                                                                  \
+    type t0i;                                                                  \
+    type t1r;                                                                  \
+    type t1i;                                                                  \
+    type t2r;                                                                  \
+    type t2i;                                                                  \
+    type t3r;                                                                  \
+    type t3i;                                                                  \
+    int64_t j;                                                                 \
+    int64_t q;                                                                 \
+    for (j = 0; j < m; j++) {                                                  \
+      t  = w + (6 * j);      /* pointer arithmetic */                          \
+      a0 = x + (2 * s * j);  /* pointer arithmetic */                          \
+      a1 = a0 + (2 * s * m); /* pointer arithmetic */                          \
+      a2 = a1 + (2 * s * m); /* pointer arithmetic */                          \
+      a3 = a2 + (2 * s * m); /* pointer arithmetic */                          \
+      b0 = y + (8 * s * j);  /* pointer arithmetic */                          \
+      b1 = b0 + (2 * s);     /* pointer arithmetic */                          \
+      b2 = b1 + (2 * s);     /* pointer arithmetic */                          \
+      b3 = b2 + (2 * s);     /* pointer arithmetic */                          \
+      for (q = 0; q < 2 * s; q += 2) {                                         \
+        t0r = a0[q] + a2[q];                                                   \
+        t0i = a0[q + 1] + a2[q + 1];                                           \
+        t1r = a0[q] - a2[q];                                                   \
+        t1i = a0[q + 1] - a2[q + 1];                                           \
+        t2r = a1[q] + a3[q];                                                   \
+        t2i = a1[q + 1] + a3[q + 1];                                           \
+        /* Multiply the difference of odd inputs by `-i`... */                 \
+        t3r       = a1[q + 1] - a3[q + 1];                                     \
+        t3i       = a3[q] - a1[q];                                             \
+        b0[q]     = t0r + t2r;                                                 \
+        b0[q + 1] = t0i + t2i;                                                 \
+        ndarray_fft_twiddle_##c(b1 + q, t1r + t3r, t1i + t3i, t);              \
+        ndarray_fft_twiddle_##c(b2 + q, t0r - t2r, t0i - t2i, t + 2);          \
+        ndarray_fft_twiddle_##c(b3 + q, t1r - t3r, t1i - t3i, t + 4);          \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_pass5_##c(                                           \
+      const type* x, type* y, const int64_t s, const int64_t m, const type* w  \
+  ) {                                                                          \
+    const type c1 = (type)0.309016994374947424102293417182819059L;             \
+    const type c2 = (type)-0.809016994374947424102293417182819059L;            \
+    const type s1 = (type)0.951056516295153572116439333379382143L;             \
+    const type s2 = (type)0.587785252292473129168705954639072769L;             \
+    const type* a0;                                                            \
+    const type* a1;                                                            \
+    const type* a2;                                                            \
+    const type* a3;                                                            \
+    const type* a4;                                                            \
+    const type* t;                                                             \
+    type* b0;                                                                  \
+    type* b1;                                                                  \
+    type* b2;                                                                  \
+    type* b3;                                                                  \
+    type* b4;                                                                  \
+    type t1r;                                                                  \
+    type t1i;                                                                  \
+    type t2r;                                                                  \
+    type t2i;                                                                  \
+    type t3r;                                                                  \
+    type t3i;                                                                  \
+    type t4r;                                                                  \
+    type t4i;                                                                  \
+    type r1r;                                                                  \
+    type r1i;                                                                  \
+    type r2r;                                                                  \
+    type r2i;                                                                  \
+    type i1r;                                                                  \
+    type i1i;                                                                  \
+    type i2r;                                                                  \
+    type i2i;                                                                  \
+    int64_t j;                                                                 \
+    int64_t q;                                                                 \
+    for (j = 0; j < m; j++) {                                                  \
+      t  = w + (8 * j);      /* pointer arithmetic */                          \
+      a0 = x + (2 * s * j);  /* pointer arithmetic */                          \
+      a1 = a0 + (2 * s * m); /* pointer arithmetic */                          \
+      a2 = a1 + (2 * s * m); /* pointer arithmetic */                          \
+      a3 = a2 + (2 * s * m); /* pointer arithmetic */                          \
+      a4 = a3 + (2 * s * m); /* pointer arithmetic */                          \
+      b0 = y + (10 * s * j); /* pointer arithmetic */                          \
+      b1 = b0 + (2 * s);     /* pointer arithmetic */                          \
+      b2 = b1 + (2 * s);     /* pointer arithmetic */                          \
+      b3 = b2 + (2 * s);     /* pointer arithmetic */                          \
+      b4 = b3 + (2 * s);     /* pointer arithmetic */                          \
+      for (q = 0; q < 2 * s; q += 2) {                                         \
+        t1r       = a1[q] + a4[q];                                             \
+        t1i       = a1[q + 1] + a4[q + 1];                                     \
+        t2r       = a2[q] + a3[q];                                             \
+        t2i       = a2[q + 1] + a3[q + 1];                                     \
+        t3r       = a1[q] - a4[q];                                             \
+        t3i       = a1[q + 1] - a4[q + 1];                                     \
+        t4r       = a2[q] - a3[q];                                             \
+        t4i       = a2[q + 1] - a3[q + 1];                                     \
+        b0[q]     = a0[q] + t1r + t2r;                                         \
+        b0[q + 1] = a0[q + 1] + t1i + t2i;                                     \
+        r1r       = a0[q] + (c1 * t1r) + (c2 * t2r);                           \
+        r1i       = a0[q + 1] + (c1 * t1i) + (c2 * t2i);                       \
+        r2r       = a0[q] + (c2 * t1r) + (c1 * t2r);                           \
+        r2i       = a0[q + 1] + (c2 * t1i) + (c1 * t2i);                       \
+        i1r       = (s1 * t3r) + (s2 * t4r);                                   \
+        i1i       = (s1 * t3i) + (s2 * t4i);                                   \
+        i2r       = (s2 * t3r) - (s1 * t4r);                                   \
+        i2i       = (s2 * t3i) - (s1 * t4i);                                   \
+        ndarray_fft_twiddle_##c(b1 + q, r1r + i1i, r1i - i1r, t);              \
+        ndarray_fft_twiddle_##c(b2 + q, r2r + i2i, r2i - i2r, t + 2);          \
+        ndarray_fft_twiddle_##c(b3 + q, r2r - i2i, r2i + i2r, t + 4);          \
+        ndarray_fft_twiddle_##c(b4 + q, r1r - i1i, r1i + i1r, t + 6);          \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_passg_##c(                                           \
+      const type* x, type* y, const int64_t s, const int64_t m,                \
+      const int64_t p, const type* w, const type* roots                        \
+  ) {                                                                          \
+    type ar[NDARRAY_FFT_MAX_RADIX];                                            \
+    type ai[NDARRAY_FFT_MAX_RADIX];                                            \
+    const type* a;                                                             \
+    const type* t;                                                             \
+    type* b;                                                                   \
+    type sr;                                                                   \
+    type si;                                                                   \
+    int64_t j;                                                                 \
+    int64_t q;                                                                 \
+    int64_t r;                                                                 \
+    int64_t u;                                                                 \
+    int64_t k;                                                                 \
+    for (j = 0; j < m; j++) {                                                  \
+      t = w + (2 * (p - 1) * j); /* pointer arithmetic */                      \
+      a = x + (2 * s * j);       /* pointer arithmetic */                      \
+      b = y + (2 * s * p * j);   /* pointer arithmetic */                      \
+      for (q = 0; q < 2 * s; q += 2) {                                         \
+        sr = 0;                                                                \
+        si = 0;                                                                \
+        for (r = 0; r < p; r++) {                                              \
+          ar[r] = a[q + (2 * s * m * r)];                                      \
+          ai[r] = a[q + (2 * s * m * r) + 1];                                  \
+          sr += ar[r];                                                         \
+          si += ai[r];                                                         \
+        }                                                                      \
+        b[q]     = sr;                                                         \
+        b[q + 1] = si;                                                         \
+        for (u = 1; u < p; u++) {                                              \
+          sr = ar[0];                                                          \
+          si = ai[0];                                                          \
+          k  = 0;                                                              \
+          for (r = 1; r < p; r++) {                                            \
+            /* Resolve the index of the root of unity `W_p^(r*u)`... */        \
+            k += u;                                                            \
+            if (k >= p) {                                                      \
+              k -= p;                                                          \
+            }                                                                  \
+            sr += (ar[r] * roots[2 * k]) - (ai[r] * roots[(2 * k) + 1]);       \
+            si += (ar[r] * roots[(2 * k) + 1]) + (ai[r] * roots[2 * k]);       \
+          }                                                                    \
+          ndarray_fft_twiddle_##c(                                             \
+              b + q + (2 * s * u), sr, si, t + (2 * (u - 1))                   \
+          );                                                                   \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+NDARRAY_FFT_DEFINE_PASSES(c, float)
+NDARRAY_FFT_DEFINE_PASSES(z, double)
+
+// Define a macro for defining a function which computes an in-place forward
+// transform of interleaved complex numbers having components of a specified
+// type (note: the workspace must provide `plan->nwork` complex numbers):
+#define NDARRAY_FFT_DEFINE_TRANSFORM(c, type)                                  \
+  static void ndarray_fft_transform_##c(                                       \
+      const struct ndarrayFFTPlan* plan, type* x, type* work                   \
+  ) {                                                                          \
+    const type* w = (const type*)plan->twiddles;                               \
+    const int64_t n = plan->n;                                                 \
+    const type* k;                                                             \
+    type* src;                                                                 \
+    type* dst;                                                                 \
+    type* tmp;                                                                 \
+    type ar;                                                                   \
+    type ai;                                                                   \
+    int64_t nb;                                                                \
+    int64_t f;                                                                 \
+    int64_t i;                                                                 \
+    int64_t l;                                                                 \
+    int64_t m;                                                                 \
+    int64_t p;                                                                 \
+    int64_t s;                                                                 \
+    if (plan->nb > 0) {                                                        \
+      /* Compute the transform as a circular convolution of the input */       \
+      /* multiplied by a chirp and the conjugated chirp, whose transform */    \
+      /* is stored after the chirp (Bluestein's algorithm)... */               \
+      nb = plan->nb;                                                           \
+      k  = w + (2 * n); /* pointer arithmetic */                               \
+      for (i = 0; i < n; i++) {                                                \
+        ndarray_fft_twiddle_##c(                                               \
+            work + (2 * i), x[2 * i], x[(2 * i) + 1], w + (2 * i)              \
+        );                                                                     \
+      }                                                                        \
+      for (i = 2 * n; i < 2 * nb; i++) {                                       \
+        work[i] = 0;                                                           \
+      }                                                                        \
+      ndarray_fft_transform_##c(plan->sub, work, work + (2 * nb));             \
+      /* Conjugate the product of the transforms, such that a forward */       \
+      /* transform computes the (conjugated) inverse transform (note: the */   \
+      /* stored transform includes the normalization factor)... */             \
+      for (i = 0; i < nb; i++) {                                               \
+        ar                = work[2 * i];                                       \
+        ai                = work[(2 * i) + 1];                                 \
+        work[2 * i]       = (ar * k[2 * i]) - (ai * k[(2 * i) + 1]);           \
+        work[(2 * i) + 1] = -((ar * k[(2 * i) + 1]) + (ai * k[2 * i]));        \
+      }                                                                        \
+      ndarray_fft_transform_##c(plan->sub, work, work + (2 * nb));             \
+      for (i = 0; i < n; i++) {                                                \
+        ndarray_fft_twiddle_##c(                                               \
+            x + (2 * i), work[2 * i], -work[(2 * i) + 1], w + (2 * i)          \
+        );                                                                     \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    /* Alternate between the input and workspace buffers, such that each */    \
+    /* pass reads the output of the previous pass... */                        \
+    src = x;                                                                   \
+    dst = work;                                                                \
+    l   = n;                                                                   \
+    s   = 1;                                                                   \
+    for (f = 0; f < plan->nfactors; f++) {                                     \
+      p = plan->factors[f];                                                    \
+      m = l / p;                                                               \
+      switch (p) {                                                             \
+        case 2:                                                                \
+          ndarray_fft_pass2_##c(src, dst, s, m, w);                            \
+          break;                                                               \
+        case 3:                                                                \
+          ndarray_fft_pass3_##c(src, dst, s, m, w);                            \
+          break;                                                               \
+        case 4:                                                                \
+          ndarray_fft_pass4_##c(src, dst, s, m, w);                            \
+          break;                                                               \
+        case 5:                                                                \
+          ndarray_fft_pass5_##c(src, dst, s, m, w);                            \
+          break;                                                               \
+        default:                                                               \
+          /* Roots of unity are stored after the twiddle factors... */         \
+          ndarray_fft_passg_##c(src, dst, s, m, p, w, w + (2 * (p - 1) * m));  \
+          w += 2 * p; /* pointer arithmetic */                                 \
+          break;                                                               \
+      }                                                                        \
+      w += 2 * (p - 1) * m; /* pointer arithmetic */                           \
+      l   = m;                                                                 \
+      s  *= p;                                                                 \
+      tmp = src;                                                               \
+      src = dst;                                                               \
+      dst = tmp;                                                               \
+    }                                                                          \
+    if (src != x) {                                                            \
+      memcpy(x, src, 2 * n * sizeof(type));                                    \
+    }                                                                          \
+  }
+
+NDARRAY_FFT_DEFINE_TRANSFORM(c, float)
+NDARRAY_FFT_DEFINE_TRANSFORM(z, double)
+
+// Define a macro for defining functions which compute forward and inverse
+// transforms of real numbers having a specified type (note: for even lengths,
+// pairs of real numbers are transformed as complex numbers of half length,
+// and the transforms of even and odd samples are then separated using the
+// twiddle factors `W_n^k`, such that the work is roughly half of a complex
+// transform):
+#define NDARRAY_FFT_DEFINE_REAL(c, type)                                       \
+  static void ndarray_fft_real_forward_##c(                                    \
+      const struct ndarrayFFTPlan* plan, type* x, type* work                   \
+  ) {                                                                          \
+    const type* w = (const type*)plan->twiddles;                               \
+    const int64_t n = plan->n;                                                 \
+    type ar;                                                                   \
+    type ai;                                                                   \
+    type br;                                                                   \
+    type bi;                                                                   \
+    type er;                                                                   \
+    type ei;                                                                   \
+    type dr;                                                                   \
+    type di;                                                                   \
+    type tr;                                                                   \
+    type ti;                                                                   \
+    int64_t h;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    int64_t k;                                                                 \
+    if (n % 2) {                                                               \
+      /* Expand real numbers to complex numbers in-place, proceeding from */   \
+      /* the end of the buffer... */                                           \
+      for (i = n - 1; i >= 0; i--) {                                           \
+        x[2 * i]       = x[i];                                                 \
+        x[(2 * i) + 1] = 0;                                                    \
+      }                                                                        \
+      ndarray_fft_transform_##c(plan->sub, x, work);                           \
+      return;                                                                  \
+    }                                                                          \
+    h = n / 2;                                                                 \
+    ndarray_fft_transform_##c(plan->sub, x, work);                             \
+    ar             = x[0];                                                     \
+    ai             = x[1];                                                     \
+    x[0]           = ar + ai;                                                  \
+    x[1]           = 0;                                                        \
+    x[2 * h]       = ar - ai;                                                  \
+    x[(2 * h) + 1] = 0;                                                        \
+    for (k = 1; k <= h / 2; k++) {                                             \
+      j  = h - k;                                                              \
+      ar = x[2 * k];                                                           \
+      ai = x[(2 * k) + 1];                                                     \
+      br = x[2 * j];                                                           \
+      bi = x[(2 * j) + 1];                                                     \
+      /* Compute the even sample transform `E = (Z_k + conj(Z_j))/2` and */    \
+      /* the odd sample transform `O = (Z_k - conj(Z_j))/2i`... */             \
+      er = (type)0.5 * (ar + br);                                              \
+      ei = (type)0.5 * (ai - bi);                                              \
+      dr = (type)0.5 * (ai + bi);                                              \
+      di = (type)0.5 * (br - ar);                                              \
+      tr = (dr * w[2 * k]) - (di * w[(2 * k) + 1]);                            \
+      ti = (dr * w[(2 * k) + 1]) + (di * w[2 * k]);                            \
+      /* Note: `X_j = conj(E - W^k*O)`... */                                   \
+      x[2 * k]       = er + tr;                                                \
+      x[(2 * k) + 1] = ei + ti;                                                \
+      x[2 * j]       = er - tr;                                                \
+      x[(2 * j) + 1] = ti - ei;                                                \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_real_inverse_##c(                                    \
+      const struct ndarrayFFTPlan* plan, type* x, type* work                   \
+  ) {                                                                          \
+    const type* w = (const type*)plan->twiddles;                               \
+    const int64_t n = plan->n;                                                 \
+    type scl;                                                                  \
+    type ar;                                                                   \
+    type ai;                                                                   \
+    type br;                                                                   \
+    type bi;                                                                   \
+    type er;                                                                   \
+    type ei;                                                                   \
+    type dr;                                                                   \
+    type di;                                                                   \
+    type or_;                                                                  \
+    type oi;                                                                   \
+    int64_t h;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    int64_t k;                                                                 \
+    h = n / 2;                                                                 \
+    if (n % 2) {                                                               \
+      /* Expand the half spectrum to a conjugated full spectrum, such that */  \
+      /* a forward transform computes the (conjugated) inverse transform */    \
+      /* (note: the imaginary component of the first element is ignored)... */ \
+      for (k = 1; k <= h; k++) {                                               \
+        x[2 * (n - k)]       = x[2 * k];                                       \
+        x[(2 * (n - k)) + 1] = x[(2 * k) + 1];                                 \
+        x[(2 * k) + 1]       = -x[(2 * k) + 1];                                \
+      }                                                                        \
+      x[1] = 0;                                                                \
+      ndarray_fft_transform_##c(plan->sub, x, work);                           \
+      scl = (type)1 / (type)n;                                                 \
+      for (i = 0; i < n; i++) {                                                \
+        x[i] = x[2 * i] * scl;                                                 \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    /* Recover the transform of pairs of real numbers as complex numbers, */   \
+    /* storing conjugated elements, such that a forward transform computes */  \
+    /* the (conjugated) inverse transform (note: the imaginary components */   \
+    /* of the first and last elements are ignored)... */                       \
+    ar   = x[0];                                                               \
+    br   = x[2 * h];                                                           \
+    x[0] = (type)0.5 * (ar + br);                                              \
+    x[1] = (type)0.5 * (br - ar);                                              \
+    for (k = 1; k <= h / 2; k++) {                                             \
+      j   = h - k;                                                             \
+      ar  = x[2 * k];                                                          \
+      ai  = x[(2 * k) + 1];                                                    \
+      br  = x[2 * j];                                                          \
+      bi  = x[(2 * j) + 1];                                                    \
+      er  = (type)0.5 * (ar + br);                                             \
+      ei  = (type)0.5 * (ai - bi);                                             \
+      dr  = (type)0.5 * (ar - br);                                             \
+      di  = (type)0.5 * (ai + bi);                                             \
+      or_ = (dr * w[2 * k]) + (di * w[(2 * k) + 1]);                           \
+      oi  = (di * w[2 * k]) - (dr * w[(2 * k) + 1]);                           \
+      /* Note: `Z_k = E + i*O` and `Z_j = conj(E) + i*conj(O)`... */           \
+      x[2 * k]       = er - oi;                                                \
+      x[(2 * k) + 1] = -(ei + or_);                                            \
+      x[2 * j]       = er + oi;                                                \
+      x[(2 * j) + 1] = ei - or_;                                               \
+    }                                                                          \
+    ndarray_fft_transform_##c(plan->sub, x, work);                             \
+    scl = (type)1 / (type)h;                                                   \
+    for (i = 0; i < h; i++) {                                                  \
+      x[2 * i]       *= scl;                                                   \
+      x[(2 * i) + 1] *= -scl;                                                  \
+    }                                                                          \
+  }
+
+NDARRAY_FFT_DEFINE_REAL(c, float)
+NDARRAY_FFT_DEFINE_REAL(z, double)
+
+// Define a macro for defining a function which transforms a line stored in a
+// contiguous buffer and a function which computes the stored transform of a
+// conjugated chirp:
+#define NDARRAY_FFT_DEFINE_LINE(c, type)                                       \
+  static void ndarray_fft_line_##c(                                            \
+      const struct ndarrayFFTPlan* plan, const int8_t op, uint8_t* buf,        \
+      uint8_t* work                                                            \
+  ) {                                                                          \
+    type* x = (type*)buf;                                                      \
+    type* w = (type*)work;                                                     \
+    type scl;                                                                  \
+    int64_t i;                                                                 \
+    switch (op) {                                                              \
+      case NDARRAY_FFT_OP_FFT:                                                 \
+        ndarray_fft_transform_##c(plan, x, w);                                 \
+        return;                                                                \
+      case NDARRAY_FFT_OP_IFFT:                                                \
+        /* Compute the inverse transform as `conj(fft(conj(x)))/n`... */       \
+        for (i = 0; i < plan->n; i++) {                                        \
+          x[(2 * i) + 1] = -x[(2 * i) + 1];                                    \
+        }                                                                      \
+        ndarray_fft_transform_##c(plan, x, w);                                 \
+        scl = (type)1 / (type)plan->n;                                         \
+        for (i = 0; i < plan->n; i++) {                                        \
+          x[2 * i]       *= scl;                                               \
+          x[(2 * i) + 1] *= -scl;                                              \
+        }                                                                      \
+        return;                                                                \
+      case NDARRAY_FFT_OP_RFFT:                                                \
+        ndarray_fft_real_forward_##c(plan, x, w);                              \
+        return;                                                                \
+      default:                                                                 \
+        ndarray_fft_real_inverse_##c(plan, x, w);                              \
+        return;                                                                \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_fft_chirp_##c(                                           \
+      const struct ndarrayFFTPlan* plan, uint8_t* work                         \
+  ) {                                                                          \
+    type* k = (type*)plan->twiddles + (2 * plan->n); /* pointer arithmetic */  \
+    type scl = (type)1 / (type)plan->nb;                                       \
+    int64_t i;                                                                 \
+    ndarray_fft_transform_##c(plan->sub, k, (type*)work);                      \
+    for (i = 0; i < 2 * plan->nb; i++) {                                       \
+      k[i] *= scl;                                                             \
+    }                                                                          \
+  }
+
+NDARRAY_FFT_DEFINE_LINE(c, float)
+NDARRAY_FFT_DEFINE_LINE(z, double)
+
+/**
+ * Computes the root of unity `exp(-2*pi*i*k/L)`.
+ *
+ * ## Notes
+ *
+ * -   Multiples of a quarter turn are exact. Otherwise, the angle is computed
+ *     in extended precision (where available), such that the components are
+ *     accurate to within rounding of the result.
+ *
+ * @private
+ * @param k   numerator
+ * @param L   denominator
+ * @param re  output real component
+ * @param im  output imaginary component
+ */
+static void ndarray_fft_root(
+    const int64_t k, const int64_t L, double* re, double* im
+) {
+  static const double EXACT[4][2] = {{1.0, 0.0}, {0.0, -1.0}, {-1.0, 0.0},
+                                     {0.0, 1.0}};
+  long double t;
+  if ((4 * k) % L == 0) {
+    *re = EXACT[((4 * k) / L) % 4][0];
+    *im = EXACT[((4 * k) / L) % 4][1];
+    return;
+  }
+  t   = (6.283185307179586476925286766559005768L * (long double)k) /
+      (long double)L;
+  *re = (double)cosl(t);
+  *im = (double)-sinl(t);
+}
+
+/**
+ * Stores a complex number in a plan's twiddle factors.
+ *
+ * @private
+ * @param plan  plan
+ * @param i     element index
+ * @param re    real component
+ * @param im    imaginary component
+ */
+static void ndarray_fft_set(
+    const struct ndarrayFFTPlan* plan, const int64_t i, const double re,
+    const double im
+) {
+  float* f;
+  double* d;
+  if (plan->single) {
+    f              = (float*)plan->twiddles;
+    f[2 * i]       = (float)re;
+    f[(2 * i) + 1] = (float)im;
+  } else {
+    d              = (double*)plan->twiddles;
+    d[2 * i]       = re;
+    d[(2 * i) + 1] = im;
+  }
+}
+
+/**
+ * Factors a transform length into radices computed using mixed-radix passes.
+ *
+ * ## Notes
+ *
+ * -   Radix-4 passes are preferred over radix-2 passes, as they require fewer
+ *     passes over the data.
+ * -   The function returns the product of prime factors larger than
+ *     `NDARRAY_FFT_MAX_RADIX` (i.e., `1` if the length can be computed using
+ *     mixed-radix passes).
+ *
+ * @private
+ * @param n         transform length
+ * @param factors   output factors
+ * @param nfactors  output number of factors
+ * @return          remaining factor
+ */
+static int64_t ndarray_fft_factor(
+    int64_t n, int64_t* factors, int64_t* nfactors
+) {
+  int64_t nf;
+  int64_t p;
+
+  nf = 0;
+  while (n % 4 == 0) {
+    factors[nf] = 4;
+    nf += 1;
+    n /= 4;
+  }
+  if (n % 2 == 0) {
+    factors[nf] = 2;
+    nf += 1;
+    n /= 2;
+  }
+  for (p = 3; p <= NDARRAY_FFT_MAX_RADIX && p <= n; p += 2) {
+    while (n % p == 0) {
+      factors[nf] = p;
+      nf += 1;
+      n /= p;
+    }
+  }
+  *nfactors = nf;
+  return n;
+}
+
+/**
+ * Releases a reference to a plan, freeing the plan when releasing the last
+ * reference.
+ *
+ * @private
+ * @param plan  plan (or `NULL`)
+ */
+static void ndarray_fft_plan_release(struct ndarrayFFTPlan* plan) {
+  if (plan == NULL) {
+    return;
+  }
+  if (ndarray_internal_atomic_fetch_add(&(plan->refs), -1) == 1) {
+    ndarray_fft_plan_release(plan->sub);
+    ndarray_memory_free(NDARRAY_MEMORY_HEADER, plan, plan->nbytes);
+  }
+}
+
+/**
+ * Acquires the cache lock.
+ *
+ * @private
+ */
+static void ndarray_fft_lock(void) {
+  while (!ndarray_internal_atomic_compare_exchange(&NDARRAY_FFT_LOCK, 0, 1)) {
+    // Cache accesses are brief, so spin...
+  }
+}
+
+/**
+ * Releases the cache lock.
+ *
+ * @private
+ */
+static void ndarray_fft_unlock(void) {
+  ndarray_internal_atomic_store(&NDARRAY_FFT_LOCK, 0);
+}
+
+/**
+ * Searches the cache for a plan and, if found, acquires a reference to the
+ * plan.
+ *
+ * ## Notes
+ *
+ * -   The cache lock must be held when calling this function.
+ *
+ * @private
+ * @param n       transform length
+ * @param kind    plan kind
+ * @param single  boolean indicating whether to use single precision
+ * @return        plan (or `NULL`)
+ */
+static struct ndarrayFFTPlan* ndarray_fft_cache_find(
+    const int64_t n, const int8_t kind, const int8_t single
+) {
+  struct ndarrayFFTPlan* plan;
+  int64_t i;
+  for (i = 0; i < NDARRAY_FFT_CACHE_SIZE; i++) {
+    plan = NDARRAY_FFT_CACHE[i];
+    if (plan != NULL && plan->n == n && plan->kind == kind &&
+        plan->single == single) {
+      ndarray_internal_atomic_fetch_add(&(plan->refs), 1);
+      return plan;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Returns the length of the complex sub-plan required by a plan.
+ *
+ * @private
+ * @param n     transform length
+ * @param kind  plan kind
+ * @return      sub-plan length (or `0` if the plan does not require a sub-plan)
+ */
+static int64_t ndarray_fft_sub_length(const int64_t n, const int8_t kind) {
+  int64_t factors[NDARRAY_FFT_MAX_FACTORS];
+  int64_t nf;
+  int64_t nb;
+  if (kind == NDARRAY_FFT_KIND_REAL) {
+    return (n % 2) ? n : n / 2;
+  }
+  if (ndarray_fft_factor(n, factors, &nf) == 1) {
+    return 0;
+  }
+  // Resolve the power-of-two convolution length for Bluestein's algorithm:
+  nb = 1;
+  while (nb < (2 * n) - 1) {
+    nb *= 2;
+  }
+  return nb;
+}
+
+/**
+ * Creates a plan.
+ *
+ * ## Notes
+ *
+ * -   The returned plan has a single reference, which is owned by the caller.
+ * -   If unable to create the plan, the function releases the sub-plan.
+ * -   Complex plans whose lengths only have prime factors less than or equal to
+ *     `NDARRAY_FFT_MAX_RADIX` store, for each mixed-radix pass of length
+ *     `L = p*m`, the twiddle factors `W_L^(j*t)`, for `j < m` and `0 < t < p`,
+ *     followed, for generic radices, by the roots of unity `W_p^r`.
+ * -   Other complex plans store the chirp `exp(-pi*i*k^2/n)`, for `k < n`,
+ *     followed by the transform of the conjugated chirp, which is zero-padded
+ *     and wrapped to the convolution length `nb >= 2n-1` (Bluestein's
+ *     algorithm).
+ * -   Real plans of even length store the twiddle factors `W_n^k`, for
+ *     `k <= n/4`.
+ *
+ * @private
+ * @param n       transform length
+ * @param kind    plan kind
+ * @param single  boolean indicating whether to use single precision
+ * @param sub     sub-plan (or `NULL`), whose reference is owned by the plan
+ * @return        plan (or `NULL`)
+ */
+static struct ndarrayFFTPlan* ndarray_fft_plan_create(
+    const int64_t n, const int8_t kind, const int8_t single,
+    struct ndarrayFFTPlan* sub
+) {
+  int64_t factors[NDARRAY_FFT_MAX_FACTORS];
+  struct ndarrayFFTPlan* plan;
+  int64_t nfactors;
+  int64_t nbytes;
+  int64_t nwork;
+  int64_t esz;
+  int64_t ntw;
+  int64_t hb;
+  int64_t nb;
+  uint8_t* w;
+  double re;
+  double im;
+  int64_t i;
+  int64_t j;
+  int64_t k;
+  int64_t l;
+  int64_t m;
+  int64_t p;
+  int64_t t;
+  int64_t f;
+
+  nb       = 0;
+  nfactors = 0;
+  if (kind == NDARRAY_FFT_KIND_REAL) {
+    ntw   = (n % 2) ? 0 : (n / 4) + 1;
+    nwork = sub->nwork;
+  } else if (sub != NULL) {
+    nb    = sub->n;
+    ntw   = n + nb;
+    nwork = nb + sub->nwork;
+  } else {
+    ndarray_fft_factor(n, factors, &nfactors);
+    ntw = 0;
+    l   = n;
+    for (f = 0; f < nfactors; f++) {
+      p = factors[f];
+      l /= p;
+      ntw += (p - 1) * l;
+      if (p > 5) {
+        ntw += p;
+      }
+    }
+    nwork = (n > 0) ? n : 1;
+  }
+  esz = (single) ? 2 * (int64_t)sizeof(float) : 2 * (int64_t)sizeof(double);
+
+  // Store twiddle factors after the plan, aligned to the alignment of scratch
+  // memory:
+  hb     = (((int64_t)sizeof(struct ndarrayFFTPlan) + 15) / 16) * 16;
+  nbytes = hb + (ntw * esz);
+  plan   = ndarray_memory_malloc(NDARRAY_MEMORY_HEADER, nbytes);
+  if (plan == NULL) {
+    ndarray_fft_plan_release(sub);
+    return NULL;
+  }
+  plan->n        = n;
+  plan->kind     = kind;
+  plan->single   = single;
+  plan->refs     = 1;
+  plan->nfactors = nfactors;
+  plan->nb       = nb;
+  plan->twiddles = (uint8_t*)plan + hb;  // pointer arithmetic
+  plan->sub      = sub;
+  plan->nwork    = nwork;
+  plan->nbytes   = nbytes;
+  for (f = 0; f < nfactors; f++) {
+    plan->factors[f] = factors[f];
+  }
+  if (kind == NDARRAY_FFT_KIND_REAL) {
+    for (k = 0; k < ntw; k++) {
+      ndarray_fft_root(k, n, &re, &im);
+      ndarray_fft_set(plan, k, re, im);
+    }
+    return plan;
+  }
+  if (nb > 0) {
+    // Compute the chirp, where `k^2 mod 2n` is updated incrementally to avoid
+    // overflow and loss of precision:
+    t = 0;
+    for (k = 0; k < n; k++) {
+      ndarray_fft_root(t, 2 * n, &re, &im);
+      ndarray_fft_set(plan, k, re, im);
+      t = (t + (2 * k) + 1) % (2 * n);
+    }
+    // Wrap the conjugated chirp to the convolution length:
+    memset((uint8_t*)plan->twiddles + (n * esz), 0, nb * esz);
+    ndarray_fft_set(plan, n, 1.0, 0.0);
+    t = 1;
+    for (k = 1; k < n; k++) {
+      ndarray_fft_root(t, 2 * n, &re, &im);
+      ndarray_fft_set(plan, n + k, re, -im);
+      ndarray_fft_set(plan, n + nb - k, re, -im);
+      t = (t + (2 * k) + 1) % (2 * n);
+    }
+    w = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, sub->nwork * esz);
+    if (w == NULL) {
+      ndarray_fft_plan_release(plan);
+      return NULL;
+    }
+    if (single) {
+      ndarray_fft_chirp_c(plan, w);
+    } else {
+      ndarray_fft_chirp_z(plan, w);
+    }
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, w, sub->nwork * esz);
+    return plan;
+  }
+  i = 0;
+  l = n;
+  for (f = 0; f < nfactors; f++) {
+    p = factors[f];
+    m = l / p;
+    for (j = 0; j < m; j++) {
+      for (t = 1; t < p; t++) {
+        ndarray_fft_root(j * t, l, &re, &im);
+        ndarray_fft_set(plan, i, re, im);
+        i += 1;
+      }
+    }
+    if (p > 5) {
+      for (t = 0; t < p; t++) {
+        ndarray_fft_root(t, p, &re, &im);
+        ndarray_fft_set(plan, i, re, im);
+        i += 1;
+      }
+    }
+    l = m;
+  }
+  return plan;
+}
+
+/**
+ * Acquires a reference to a plan, creating and caching the plan if the plan
+ * is not cached.
+ *
+ * ## Notes
+ *
+ * -   The returned plan must be released using `ndarray_fft_plan_release`.
+ * -   Plans are created without holding the cache lock. If another thread
+ *     caches an equivalent plan in the meantime, the cached plan is used.
+ * -   Cache entries are replaced in a round-robin fashion. A replaced plan
+ *     remains valid until released by all threads using the plan.
+ *
+ * @private
+ * @param n       transform length
+ * @param kind    plan kind
+ * @param single  boolean indicating whether to use single precision
+ * @return        plan (or `NULL`)
+ */
+static struct ndarrayFFTPlan* ndarray_fft_plan_acquire(
+    const int64_t n, const int8_t kind, const int8_t single
+) {
+  struct ndarrayFFTPlan* plan;
+  struct ndarrayFFTPlan* prev;
+  struct ndarrayFFTPlan* sub;
+  struct ndarrayFFTPlan* old;
+  int64_t m;
+
+  ndarray_fft_lock();
+  plan = ndarray_fft_cache_find(n, kind, single);
+  ndarray_fft_unlock();
+  if (plan != NULL) {
+    return plan;
+  }
+  // Acquire a sub-plan (e.g., of half length for real plans) before creating
+  // the plan:
+  sub = NULL;
+  m   = ndarray_fft_sub_length(n, kind);
+  if (m > 0) {
+    sub = ndarray_fft_plan_acquire(m, NDARRAY_FFT_KIND_COMPLEX, single);
+    if (sub == NULL) {
+      return NULL;
+    }
+  }
+  plan = ndarray_fft_plan_create(n, kind, single, sub);
+  if (plan == NULL) {
+    return NULL;
+  }
+  ndarray_fft_lock();
+  prev = ndarray_fft_cache_find(n, kind, single);
+  old  = NULL;
+  if (prev == NULL) {
+    ndarray_internal_atomic_fetch_add(&(plan->refs), 1);
+    old                                  = NDARRAY_FFT_CACHE[NDARRAY_FFT_NEXT];
+    NDARRAY_FFT_CACHE[NDARRAY_FFT_NEXT] = plan;
+    NDARRAY_FFT_NEXT = (NDARRAY_FFT_NEXT + 1) % NDARRAY_FFT_CACHE_SIZE;
+  }
+  ndarray_fft_unlock();
+
+  // Release references outside of the lock, as releasing a plan may release
+  // sub-plans...
+  ndarray_fft_plan_release(old);
+  if (prev != NULL) {
+    ndarray_fft_plan_release(plan);
+    return prev;
+  }
+  return plan;
+}
+
+/**
+ * Processes a group of blocks of lines.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  transform
+ */
+static void ndarray_fft_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayFFTLoop* loop = (const struct ndarrayFFTLoop*)ctx;
+  const uint8_t* x;
+  uint8_t* scratch;
+  uint8_t* work;
+  uint8_t* y;
+  int64_t end;
+  int64_t b;
+  int64_t j;
+  int64_t r;
+  int64_t s;
+  int64_t d;
+  int64_t k;
+  int64_t l;
+  int64_t n;
+
+  scratch = loop->scratch + (tid * loop->sb);       // pointer arithmetic
+  work    = scratch + (loop->block * loop->lb);     // pointer arithmetic
+  b       = i * loop->group;
+  end     = b + loop->group;
+  if (end > loop->nblocks) {
+    end = loop->nblocks;
+  }
+  for (; b < end; b++) {
+    x = loop->x;
+    y = loop->out;
+    n = 1;
+    if (loop->no > 0) {
+      // Resolve the first line of the block along the first outer dimension:
+      j = (b % loop->nblk) * loop->block;
+      n = loop->oshape[0] - j;
+      if (n > loop->block) {
+        n = loop->block;
+      }
+      x += j * loop->oxs[0];  // pointer arithmetic
+      y += j * loop->oos[0];  // pointer arithmetic
+      r = b / loop->nblk;
+      for (d = 1; d < loop->no; d++) {
+        s = r % loop->oshape[d];
+        r /= loop->oshape[d];
+        x += s * loop->oxs[d];  // pointer arithmetic
+        y += s * loop->oos[d];  // pointer arithmetic
+      }
+    }
+    // Gather lines into contiguous line buffers, where, for blocks of lines,
+    // the k-th elements of all lines are loaded together, such that adjacent
+    // lines share cache lines:
+    if (n == 1) {
+      loop->load(x, loop->xsa, scratch, loop->ib, loop->nin);
+    } else {
+      for (k = 0; k < loop->nin; k++) {
+        loop->load(
+            x + (k * loop->xsa), loop->oxs[0], scratch + (k * loop->ib),
+            loop->lb, n
+        );
+      }
+    }
+    for (l = 0; l < n; l++) {
+      loop->line(loop->plan, loop->op, scratch + (l * loop->lb), work);
+    }
+    // Scatter transformed lines:
+    if (n == 1) {
+      loop->store(scratch, loop->ob, y, loop->osa, loop->nout);
+    } else {
+      for (k = 0; k < loop->nout; k++) {
+        loop->store(
+            scratch + (k * loop->ob), loop->lb, y + (k * loop->osa),
+            loop->oos[0], n
+        );
+      }
+    }
+  }
+}
+
+/**
+ * Validates the shape of an output ndarray.
+ *
+ * @private
+ * @param x  input ndarray
+ * @param a  dimension along which to operate
+ * @param m  expected output length along the dimension
+ * @param y  output ndarray
+ * @return   status code
+ */
+static int8_t ndarray_fft_check(
+    const struct ndarray* x, const int64_t a, const int64_t m,
+    const struct ndarray* y
+) {
+  int64_t i;
+  if (y->ndims != x->ndims) {
+    return -1;
+  }
+  for (i = 0; i < x->ndims; i++) {
+    if (y->shape[i] != ((i == a) ? m : x->shape[i])) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Computes a transform along a specified dimension.
+ *
+ * @private
+ * @param x         input ndarray
+ * @param axis      dimension along which to operate
+ * @param op        operation
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ */
+static int8_t ndarray_fft_execute(
+    const struct ndarray* x, const int64_t axis, const int8_t op,
+    int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayFFTPlan* plan;
+  struct ndarrayFFTLoop loop;
+  int16_t wtype;
+  int16_t itype;
+  int16_t otype;
+  int8_t single;
+  int8_t kind;
+  int64_t nmeta;
+  int64_t nbytes;
+  int64_t ntasks;
+  int64_t nlines;
+  int64_t ndims;
+  int64_t esz;
+  int64_t a;
+  int64_t n;
+  int64_t m;
+  int64_t i;
+  int64_t t;
+  int8_t status;
+
+  if (x == NULL || out == NULL) {
+    return -1;
+  }
+  ndims = x->ndims;
+  a     = (axis < 0) ? axis + ndims : axis;
+  if (a < 0 || a >= ndims || out->ndims != ndims) {
+    return -1;
+  }
+  // Resolve the transform length, the working precision, and the data types
+  // of line buffer elements when loading and storing elements:
+  if (op == NDARRAY_FFT_OP_IRFFT) {
+    n = out->shape[a];
+    m = n;
+    if (n < 1 || x->shape[a] != (n / 2) + 1) {
+      return -1;
+    }
+    if (out->dtype == NDARRAY_FLOAT32) {
+      single = 1;
+    } else if (out->dtype == NDARRAY_FLOAT64) {
+      single = 0;
+    } else {
+      return -1;
+    }
+    itype = (single) ? NDARRAY_COMPLEX64 : NDARRAY_COMPLEX128;
+    otype = out->dtype;
+  } else {
+    n = x->shape[a];
+    m = (op == NDARRAY_FFT_OP_RFFT) ? (n / 2) + 1 : n;
+    if (op == NDARRAY_FFT_OP_RFFT && n < 1) {
+      return -1;
+    }
+    if (out->dtype == NDARRAY_COMPLEX64) {
+      single = 1;
+    } else if (out->dtype == NDARRAY_COMPLEX128) {
+      single = 0;
+    } else {
+      return -1;
+    }
+    itype = out->dtype;
+    if (op == NDARRAY_FFT_OP_RFFT) {
+      itype = (single) ? NDARRAY_FLOAT32 : NDARRAY_FLOAT64;
+    }
+    otype = out->dtype;
+  }
+  if ((op == NDARRAY_FFT_OP_IRFFT) ? ndarray_fft_check(out, a, (n / 2) + 1, x)
+                                   : ndarray_fft_check(x, a, m, out)) {
+    return -1;
+  }
+  wtype = (single) ? NDARRAY_FLOAT32 : NDARRAY_FLOAT64;
+  if (!ndarray_is_allowed_data_type_cast(
+          x->dtype, itype, NDARRAY_SAME_KIND_CASTING
+      )) {
+    return -1;
+  }
+  loop.load  = ndarray_strided_cast_function(x->dtype, itype);
+  loop.store = ndarray_strided_cast_function(otype, otype);
+  if (loop.load == NULL || loop.store == NULL) {
+    return -1;
+  }
+  nlines = 1;
+  for (i = 0; i < ndims; i++) {
+    if (i != a) {
+      nlines *= x->shape[i];
+    }
+  }
+  if (nlines == 0 || n == 0) {
+    return 0;
+  }
+  kind = (op == NDARRAY_FFT_OP_RFFT || op == NDARRAY_FFT_OP_IRFFT)
+             ? NDARRAY_FFT_KIND_REAL
+             : NDARRAY_FFT_KIND_COMPLEX;
+  plan = ndarray_fft_plan_acquire(n, kind, single);
+  if (plan == NULL) {
+    return -1;
+  }
+  esz       = 2 * ndarray_bytes_per_element(wtype);
+  loop.op   = op;
+  loop.plan = plan;
+  loop.line = (single) ? ndarray_fft_line_c : ndarray_fft_line_z;
+  loop.x    = x->data + x->offset;  // pointer arithmetic
+  loop.out  = out->data + out->offset;
+  loop.nin  = x->shape[a];
+  loop.nout = out->shape[a];
+  loop.xsa  = x->strides[a];
+  loop.osa  = out->strides[a];
+  loop.ib   = ndarray_bytes_per_element(itype);
+  loop.ob   = ndarray_bytes_per_element(otype);
+
+  // Resolve the number of complex numbers per line buffer (note: real
+  // transforms of even length store half of a spectrum and odd lengths
+  // require a full complex transform):
+  loop.lb = n;
+  if (kind == NDARRAY_FFT_KIND_REAL && n % 2 == 0) {
+    loop.lb = (n / 2) + 1;
+  }
+  loop.lb *= esz;
+
+  // Allocate scratch memory for outer dimension meta data:
+  nmeta = sizeof(int64_t) * ((ndims * 3) + 1);
+  loop.oshape = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (loop.oshape == NULL) {
+    ndarray_fft_plan_release(plan);
+    return -1;
+  }
+  loop.oxs = loop.oshape + ndims;
+  loop.oos = loop.oxs + ndims;
+  loop.no  = 0;
+  for (i = 0; i < ndims; i++) {
+    if (i == a || x->shape[i] == 1) {
+      continue;
+    }
+    loop.oshape[loop.no] = x->shape[i];
+    loop.oxs[loop.no]    = x->strides[i];
+    loop.oos[loop.no]    = out->strides[i];
+
+    // Move the dimension having the smallest input stride to the front:
+    if (loop.no > 0 && llabs(x->strides[i]) < llabs(loop.oxs[0])) {
+      t                    = loop.oshape[0];
+      loop.oshape[0]       = loop.oshape[loop.no];
+      loop.oshape[loop.no] = t;
+      t                    = loop.oxs[0];
+      loop.oxs[0]          = loop.oxs[loop.no];
+      loop.oxs[loop.no]    = t;
+      t                    = loop.oos[0];
+      loop.oos[0]          = loop.oos[loop.no];
+      loop.oos[loop.no]    = t;
+    }
+    loop.no += 1;
+  }
+  // Gather blocks of lines when adjacent lines are closer in memory than
+  // adjacent elements along the transformed dimension (e.g., when transforming
+  // the columns of a row-major matrix):
+  loop.block = 1;
+  if (loop.no > 0 && llabs(loop.oxs[0]) < llabs(loop.xsa)) {
+    loop.block = NDARRAY_FFT_BLOCK_BYTES / loop.lb;
+    if (loop.block > NDARRAY_FFT_BLOCK) {
+      loop.block = NDARRAY_FFT_BLOCK;
+    }
+    if (loop.block > loop.oshape[0]) {
+      loop.block = loop.oshape[0];
+    }
+    if (loop.block < 1) {
+      loop.block = 1;
+    }
+  }
+  loop.nblk    = (loop.no > 0) ? (loop.oshape[0] + loop.block - 1) / loop.block
+                               : 1;
+  loop.nblocks = (loop.no > 0) ? loop.nblk * (nlines / loop.oshape[0]) : 1;
+
+  // Group blocks of short lines, such that each task processes a minimum
+  // number of elements:
+  loop.group = NDARRAY_FFT_GROUP / (n * loop.block);
+  if (loop.group < 1) {
+    loop.group = 1;
+  }
+  ntasks = (loop.nblocks + loop.group - 1) / loop.group;
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory for line buffers and a workspace:
+  loop.sb      = (loop.block * loop.lb) + (plan->nwork * esz);
+  loop.sb      = ((loop.sb + 15) / 16) * 16;
+  nbytes       = loop.sb * nthreads;
+  loop.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.scratch == NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+    ndarray_fft_plan_release(plan);
+    return -1;
+  }
+  status = ndarray_parallel_for(ntasks, nthreads, ndarray_fft_task, &loop);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.scratch, nbytes);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+  ndarray_fft_plan_release(plan);
+  return status;
+}
+
+/**
+ * Computes the discrete Fourier transform of ndarray elements along a
+ * specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray and a
+ *     complex-valued data type (`complex64` or `complex128`), which determines
+ *     the working precision. Input elements are converted to the output data
+ *     type according to `same_kind` casting rules (e.g., real elements are
+ *     transformed as complex numbers having zero imaginary components).
+ * -   The transform is unnormalized (i.e.,
+ *     `X_k = sum_j x_j exp(-2*pi*i*j*k/n)`).
+ * -   Transforms are computed using a mixed-radix Stockham autosort algorithm
+ *     with specialized radix-2, radix-3, radix-4, and radix-5 passes. Lengths
+ *     having prime factors larger than `64` are computed as convolutions of
+ *     power-of-two length (Bluestein's algorithm), such that every length
+ *     requires `O(n log n)` operations.
+ * -   Plans (i.e., factorizations and precomputed twiddle factors) are cached
+ *     per length and precision and reused across calls (see
+ *     `ndarray_fft_clear_cache`).
+ * -   Each line along the transformed dimension is copied into a contiguous
+ *     buffer before being transformed, and, thus, the transformed dimension may
+ *     have an arbitrary stride. When adjacent lines are closer in memory than
+ *     adjacent elements of a line, blocks of lines are gathered together.
+ * -   Independent lines are transformed in parallel. If `nthreads` is less than
+ *     or equal to zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   The output ndarray may be the input ndarray (i.e., elements may be
+ *     transformed in-place); otherwise, the input and output ndarrays must
+ *     **not** share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to compute the transform
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/fft.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major ndarray of complex numbers:
+ * double buf[] = {1.0, 0.0, 2.0, 0.0, 3.0, 0.0, 4.0, 0.0};
+ * int64_t shape[] = {4};
+ * int64_t strides[] = {16};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_COMPLEX128, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Transform the elements in-place:
+ * int8_t status = ndarray_fft(x, 0, 1, x);
+ * // buf => {10.0, 0.0, -2.0, 2.0, -2.0, 0.0, -2.0, -2.0}
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_fft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_fft_execute(x, axis, NDARRAY_FFT_OP_FFT, nthreads, out);
+}
+
+/**
+ * Computes the inverse discrete Fourier transform of ndarray elements along a
+ * specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray and a
+ *     complex-valued data type, which determines the working precision.
+ * -   The transform is normalized by `1/n`, such that `ndarray_ifft` inverts
+ *     `ndarray_fft`.
+ * -   The function otherwise follows the conventions of `ndarray_fft`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to compute the transform
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/fft.h"
+ *
+ * // ...
+ *
+ * // Invert a transform along the last dimension:
+ * int8_t status = ndarray_ifft(x, -1, 0, out);
+ */
+int8_t ndarray_ifft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_fft_execute(x, axis, NDARRAY_FFT_OP_IFFT, nthreads, out);
+}
+
+/**
+ * Computes the discrete Fourier transform of real-valued ndarray elements
+ * along a specified dimension, returning the non-negative frequency terms.
+ *
+ * ## Notes
+ *
+ * -   The input ndarray must have a real-valued data type. The output ndarray
+ *     must have a complex-valued data type, which determines the working
+ *     precision, and the same shape as the input ndarray, except along the
+ *     transformed dimension, which must have length `n/2+1` (rounded down),
+ *     where `n` is the input length along the transformed dimension.
+ * -   As the transform of real numbers is conjugate symmetric, the omitted
+ *     negative frequency terms are the conjugates of the returned terms.
+ * -   For even lengths, pairs of real numbers are transformed as complex
+ *     numbers of half length, such that the transform requires roughly half
+ *     the work of a complex transform.
+ * -   The input and output ndarrays must **not** share overlapping memory.
+ * -   The function otherwise follows the conventions of `ndarray_fft`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to compute the transform
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/fft.h"
+ *
+ * // ...
+ *
+ * // Transform 8 real samples into 5 complex frequency terms:
+ * int8_t status = ndarray_rfft(x, 0, 1, out);
+ */
+int8_t ndarray_rfft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_fft_execute(x, axis, NDARRAY_FFT_OP_RFFT, nthreads, out);
+}
+
+/**
+ * Computes the inverse of a real-input discrete Fourier transform along a
+ * specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The output length `n` along the transformed dimension is given by the
+ *     output ndarray, which must have a real-valued floating-point data type
+ *     (`float32` or `float64`) that determines the working precision. The
+ *     input ndarray must contain the non-negative frequency terms and have
+ *     length `n/2+1` (rounded down) along the transformed dimension.
+ * -   The imaginary component of the zero frequency term (and, for even
+ *     lengths, of the last term) is ignored.
+ * -   The transform is normalized by `1/n`, such that `ndarray_irfft` inverts
+ *     `ndarray_rfft`.
+ * -   The input and output ndarrays must **not** share overlapping memory.
+ * -   The function otherwise follows the conventions of `ndarray_fft`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to compute the transform
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/fft.h"
+ *
+ * // ...
+ *
+ * // Recover 8 real samples from 5 complex frequency terms:
+ * int8_t status = ndarray_irfft(x, 0, 1, out);
+ */
+int8_t ndarray_irfft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_fft_execute(x, axis, NDARRAY_FFT_OP_IRFFT, nthreads, out);
+}
+
+/**
+ * Releases cached transform plans.
+ *
+ * ## Notes
+ *
+ * -   Plans in use by concurrent transforms remain valid and are freed once
+ *     the transforms complete.
+ *
+ * @example
+ * #include "ndarray/base/fft.h"
+ *
+ * ndarray_fft_clear_cache();
+ */
+void ndarray_fft_clear_cache(void) {
+  struct ndarrayFFTPlan* plans[NDARRAY_FFT_CACHE_SIZE];
+  int64_t i;
+
+  ndarray_fft_lock();
+  for (i = 0; i < NDARRAY_FFT_CACHE_SIZE; i++) {
+    plans[i]             = NDARRAY_FFT_CACHE[i];
+    NDARRAY_FFT_CACHE[i] = NULL;
+  }
+  NDARRAY_FFT_NEXT = 0;
+  ndarray_fft_unlock();
+  for (i = 0; i < NDARRAY_FFT_CACHE_SIZE; i++) {
+    ndarray_fft_plan_release(plans[i]);
+  }
+}
+
+/**
+ * Acquires a reference to a plan for real-input transforms of a specified
+ * length.
+ *
+ * ## Notes
+ *
+ * -   The returned plan must be released using `ndarray_internal_fft_release`.
+ *
+ * @param n       transform length
+ * @param single  boolean indicating whether to use single precision
+ * @return        plan (or `NULL`)
+ */
+struct ndarrayFFTPlan* ndarray_internal_fft_real_plan(
+    const int64_t n, const int8_t single
+) {
+  if (n < 1) {
+    return NULL;
+  }
+  return ndarray_fft_plan_acquire(n, NDARRAY_FFT_KIND_REAL, single);
+}
+
+/**
+ * Releases a reference to a plan.
+ *
+ * @param plan  plan (or `NULL`)
+ */
+void ndarray_internal_fft_release(struct ndarrayFFTPlan* plan) {
+  ndarray_fft_plan_release(plan);
+}
+
+/**
+ * Returns the number of complex numbers of workspace required to execute a
+ * plan.
+ *
+ * @param plan  plan
+ * @return      number of complex numbers
+ */
+int64_t ndarray_internal_fft_workspace(const struct ndarrayFFTPlan* plan) {
+  return plan->nwork;
+}
+
+/**
+ * Computes a real-input transform (or its inverse) of a line stored in a
+ * contiguous buffer.
+ *
+ * ## Notes
+ *
+ * -   The buffer must have room for `n/2+1` complex numbers (even lengths) or
+ *     `n` complex numbers (odd lengths) in plan precision. The forward
+ *     transform replaces `n` real numbers with the non-negative frequency
+ *     terms, and the inverse transform replaces the terms with `n` real
+ *     numbers normalized by `1/n`.
+ *
+ * @param plan     plan
+ * @param inverse  boolean indicating whether to compute the inverse transform
+ * @param buf      line buffer
+ * @param work     workspace
+ */
+void ndarray_internal_fft_real(
+    const struct ndarrayFFTPlan* plan, const int8_t inverse, uint8_t* buf,
+    uint8_t* work
+) {
+  int8_t op = (inverse) ? NDARRAY_FFT_OP_IRFFT : NDARRAY_FFT_OP_RFFT;
+  if (plan->single) {
+    ndarray_fft_line_c(plan, op, buf, work);
+  } else {
+    ndarray_fft_line_z(plan, op, buf, work);
+  }
+}
@@ -8,6 +8,84 @@
 #include "ndarray/base/function_object.h"
 #include <stdint.h>
 #include <stdlib.h>
+#include "ndarray.h"
+#include "ndarray/base/assert.h"
+#include "ndarray/base/assign.h"
+#include "ndarray/base/buffered.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/cpu_features.h"
+#include "ndarray/base/internal/atomics.h"
+#include "ndarray/base/iteration_order.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/numel.h"
+#include "ndarray/base/shape2strides.h"
+#include "ndarray/base/unary/dispatch.h"
+#include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/casting_modes.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/macros.h"
+#include "ndarray/memory_categories.h"
+
+// Define the number of entries in a function object's inline cache:
+#define NDARRAY_FUNCTION_CACHE_SIZE 4
+
+// Define the maximum number of ndarray arguments for which resolved kernels are
+// cached:
+#define NDARRAY_FUNCTION_CACHE_MAX_ARRAYS 8
+
+/**
+ * Structure describing a resolved kernel.
+ *
+ * ## Notes
+ *
+ * -   Entries are written under a sequence lock: a writer makes `seq` odd
+ *     before updating an entry and even afterward, and a reader only accepts
+ *     an entry if `seq` is even and unchanged after reading the entry. Hence,
+ *     concurrent callers never observe a partially written entry.
+ * -   Fences order the entry fields with respect to `seq`: a reader issues an
+ *     acquire fence before re-reading `seq`, and a writer issues release
+ *     fences after making `seq` odd and before making `seq` even again.
+ *     Otherwise, weakly ordered CPUs (e.g., arm64) may reorder field accesses
+ *     across the `seq` accesses.
+ *
+ * @private
+ */
+struct ndarrayFunctionCacheEntry {
+  // Sequence number (odd while the entry is being written):
+  volatile int64_t seq;
+
+  // Number of output ndarray dimensions:
+  int64_t ndims;
+
+  // Resolved kernel (note: `NULL` if the entry is empty):
+  ndarrayFcn kernel;
+
+  // Kernel "data" (e.g., a callback):
+  void* data;
+
+  // Data types of the ndarray arguments:
+  int16_t types[NDARRAY_FUNCTION_CACHE_MAX_ARRAYS];
+
+  // Memory layouts of the ndarray arguments (see `ndarray_function_layout`):
+  int8_t layouts[NDARRAY_FUNCTION_CACHE_MAX_ARRAYS];
+
+  // Boolean indicating whether to apply the kernel to one-dimensional views:
+  int8_t linear;
+};
+
+/**
+ * Structure for caching resolved kernels.
+ *
+ * @private
+ */
+struct ndarrayFunctionCache {
+  // Cache entries:
+  struct ndarrayFunctionCacheEntry entries[NDARRAY_FUNCTION_CACHE_SIZE];
+
+  // Counter used for round-robin replacement:
+  volatile int64_t next;
+};
 
 /**
  * Returns the first row index at which a given one-dimensional array of types
@@ -139,12 +217,214 @@ static int64_t ndarray_function_dispatch_types_index_of(
   return -1;
 }
 
+/**
+ * Returns a hash of a type signature.
+ *
+ * @private
+ * @param M      number of types
+ * @param types  type signature
+ * @return       hash
+ */
+static inline uint32_t ndarray_function_hash_types(
+    const int64_t M, const int32_t* types
+) {
+  uint32_t h;
+  int64_t j;
+
+  // Use FNV-1a, followed by a final avalanche step so that the low bits (which
+  // determine the hash table slot) depend on all types...
+  h = 2166136261u;
+  for (j = 0; j < M; j++) {
+    h ^= (uint32_t)types[j];
+    h *= 16777619u;
+  }
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  return h;
+}
+
+/**
+ * Tests whether two type signatures are equal.
+ *
+ * @private
+ * @param M  number of types
+ * @param X  first type signature
+ * @param Y  second type signature
+ * @return   boolean indicating whether type signatures are equal
+ */
+static inline int8_t ndarray_function_types_equal(
+    const int64_t M, const int32_t* X, const int32_t* Y
+) {
+  int64_t j;
+  for (j = 0; j < M; j++) {
+    if (X[j] != Y[j]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * Builds a hash table mapping the type signatures of an ndarray function object
+ * to function indices.
+ *
+ * ## Notes
+ *
+ * -   The table uses open addressing with linear probing and is sized to a
+ *     power of two which is at least twice the number of functions, such that
+ *     lookups require, on average, a small constant number of probes regardless
+ *     of the number of functions.
+ * -   If a type signature occurs more than once, the table maps the signature
+ *     to its first occurrence, thus matching the behavior of a linear search.
+ * -   If unable to allocate memory, the function leaves the table unset, and
+ *     dispatch falls back to a linear search.
+ *
+ * @private
+ * @param obj  ndarray function object
+ */
+static void ndarray_function_build_lookup(struct ndarrayFunctionObject* obj) {
+  const int32_t* row;
+  int32_t* table;
+  uint32_t mask;
+  int64_t M;
+  int64_t n;
+  int64_t h;
+  int64_t i;
+
+  obj->lookup  = NULL;
+  obj->nlookup = 0;
+  if (obj->types == NULL || obj->nfunctions <= 0) {
+    return;
+  }
+  M = obj->narrays;
+  n = 1;
+  while (n < 2 * (int64_t)(obj->nfunctions)) {
+    n <<= 1;
+  }
+  if (n > INT32_MAX) {
+    return;
+  }
+  table = ndarray_memory_malloc(NDARRAY_MEMORY_HEADER, sizeof(int32_t) * n);
+  if (table == NULL) {
+    return;
+  }
+  for (i = 0; i < n; i++) {
+    table[i] = -1;
+  }
+  mask = (uint32_t)(n - 1);
+  for (i = 0; i < obj->nfunctions; i++) {
+    row = obj->types + (i * M);
+    h   = ndarray_function_hash_types(M, row) & mask;
+    while (table[h] >= 0) {
+      if (ndarray_function_types_equal(M, obj->types + (table[h] * M), row)) {
+        break;
+      }
+      h = (h + 1) & mask;
+    }
+    if (table[h] < 0) {
+      table[h] = (int32_t)i;
+    }
+  }
+  obj->lookup  = table;
+  obj->nlookup = (int32_t)n;
+}
+
+/**
+ * Returns a code summarizing the memory layout of an ndarray.
+ *
+ * ## Notes
+ *
+ * -   The lower two bits are the ndarray contiguity flags, and the next two
+ *     bits encode the ndarray iteration order.
+ *
+ * @private
+ * @param arr  input ndarray
+ * @return     layout code
+ */
+static inline int8_t ndarray_function_layout(const struct ndarray* arr) {
+  int8_t io = ndarray_iteration_order(arr->ndims, arr->strides);
+  return (int8_t)((arr->flags & (NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG |
+                                 NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG)) |
+                  ((io + 1) << 2));
+}
+
+/**
+ * Resolves the kernel which should be applied to provided ndarrays.
+ *
+ * @private
+ * @param obj     ndarray function object
+ * @param arrays  array containing pointers to input and output ndarrays
+ * @param types   ndarray data types
+ * @param kernel  output address for the resolved kernel
+ * @param data    output address for the kernel "data"
+ * @param linear  output address for a boolean indicating whether to apply the
+ *                kernel to one-dimensional views
+ * @return        status code
+ */
+static int8_t ndarray_function_resolve(
+    const struct ndarrayFunctionObject* obj, struct ndarray* arrays[],
+    const int32_t* types, ndarrayFcn* kernel, void** data, int8_t* linear
+) {
+  int64_t idx;
+
+  idx = ndarray_function_dispatch_index_of(obj, types);
+  if (idx < 0) {
+    return -1;
+  }
+  *data   = (obj->data == NULL) ? NULL : obj->data[idx];
+  *linear = 0;
+  if (obj->features != NULL && obj->features[idx] != 0) {
+    *kernel = obj->variants[idx];
+  } else if (obj->dispatch != NULL && obj->dispatch[idx] != NULL &&
+             obj->nin == 1 && obj->nout == 1) {
+    *kernel = ndarray_unary_dispatch_select(obj->dispatch[idx], arrays, linear);
+  } else {
+    *kernel = obj->functions[idx];
+  }
+  return (*kernel == NULL) ? -1 : 0;
+}
+
+/**
+ * Invokes a resolved kernel.
+ *
+ * @private
+ * @param M       number of ndarray arguments
+ * @param arrays  array containing pointers to input and output ndarrays
+ * @param kernel  resolved kernel
+ * @param data    kernel "data"
+ * @param linear  boolean indicating whether to apply the kernel to
+ *                one-dimensional views
+ * @return        status code
+ */
+static inline int8_t ndarray_function_invoke(
+    const int32_t M, struct ndarray* arrays[], ndarrayFcn kernel, void* data,
+    const int8_t linear
+) {
+  // Determine whether we can avoid iteration altogether...
+  if (arrays[M - 1]->ndims > 0 && arrays[M - 1]->length == 0) {
+    return 0;
+  }
+  if (linear) {
+    return ndarray_unary_dispatch_linear(kernel, arrays, data);
+  }
+  return kernel(arrays, data);
+}
+
 /**
  * Returns a pointer to a dynamically allocated ndarray function object.
  *
  * ## Notes
  *
  * -   The user is responsible for freeing the allocated memory.
+ * -   The function builds a hash table over the provided type signatures, such
+ *     that dispatching on a list of array types (see
+ *     `ndarray_function_dispatch_index_of`) takes constant time on average,
+ *     regardless of the number of functions. Accordingly, the `types` array
+ *     should not be mutated after creating the function object.
+ * -   The function allocates an inline cache of resolved kernels used by
+ *     `ndarray_function_apply`. Dispatch objects (see `obj->dispatch`) should
+ *     be assigned before first applying the function object.
  *
  * @param name        ndarray function name
  * @param nin         number of input ndarrays
@@ -240,8 +520,9 @@ struct ndarrayFunctionObject* ndarray_function_allocate(
     const char* name, int32_t nin, int32_t nout, ndarrayFcn* functions,
     int32_t nfunctions, int32_t* types, void* data[]
 ) {
-  struct ndarrayFunctionObject* obj =
-      malloc(sizeof(struct ndarrayFunctionObject));
+  struct ndarrayFunctionObject* obj = ndarray_memory_malloc(
+      NDARRAY_MEMORY_HEADER, sizeof(struct ndarrayFunctionObject)
+  );
   if (obj == NULL) {
     return NULL;
   }
@@ -253,6 +534,16 @@ struct ndarrayFunctionObject* ndarray_function_allocate(
   obj->nfunctions = nfunctions;
   obj->types      = types;
   obj->data       = data;
+  obj->dispatch   = NULL;
+  obj->variants   = NULL;
+  obj->features   = NULL;
+
+  ndarray_function_build_lookup(obj);
+
+  // Note: if unable to allocate a cache, kernels are resolved on every call...
+  obj->cache = ndarray_memory_calloc(
+      NDARRAY_MEMORY_HEADER, sizeof(struct ndarrayFunctionCache)
+  );
   return obj;
 }
 
@@ -309,7 +600,20 @@ void ndarray_function_free(struct ndarrayFunctionObject* obj) {
   if (obj == NULL) {
     return;
   }
-  free(obj);
+  ndarray_memory_free(
+      NDARRAY_MEMORY_HEADER, obj->lookup, sizeof(int32_t) * obj->nlookup
+  );
+  ndarray_memory_free(
+      NDARRAY_MEMORY_HEADER, obj->cache, sizeof(struct ndarrayFunctionCache)
+  );
+  // Note: selected implementations share an allocation with their features...
+  ndarray_memory_free(
+      NDARRAY_MEMORY_HEADER, obj->features,
+      (sizeof(ndarrayFcn) + sizeof(int64_t)) * obj->nfunctions
+  );
+  ndarray_memory_free(
+      NDARRAY_MEMORY_HEADER, obj, sizeof(struct ndarrayFunctionObject)
+  );
 }
 
 /**
@@ -319,6 +623,9 @@ void ndarray_function_free(struct ndarrayFunctionObject* obj) {
  * ## Notes
  *
  * -   The function returns `-1` if unable to find a function.
+ * -   If the function object has a type signature lookup table (e.g., as built
+ *     by `ndarray_function_allocate`), the function performs a hash table
+ *     lookup; otherwise, the function performs a linear search.
  *
  * @param obj    ndarray function object
  * @param types  list of array types on which to dispatch
@@ -392,9 +699,27 @@ void ndarray_function_free(struct ndarrayFunctionObject* obj) {
 int64_t ndarray_function_dispatch_index_of(
     const struct ndarrayFunctionObject* obj, const int32_t* types
 ) {
+  uint32_t mask;
+  int64_t h;
+  int32_t k;
+
   if (obj == NULL) {
     return -1;
   }
+  // If available, use the lookup table...
+  if (obj->lookup != NULL && obj->nlookup > 0) {
+    mask = (uint32_t)(obj->nlookup - 1);
+    h    = ndarray_function_hash_types(obj->narrays, types) & mask;
+    for (k = obj->lookup[h]; k >= 0; k = obj->lookup[h]) {
+      if (ndarray_function_types_equal(
+              obj->narrays, obj->types + ((int64_t)k * obj->narrays), types
+          )) {
+        return k;
+      }
+      h = (h + 1) & mask;
+    }
+    return -1;
+  }
   // Retrieve the number of functions (and thus the number of type signatures):
   int32_t N = obj->nfunctions;
 
@@ -406,3 +731,638 @@ int64_t ndarray_function_dispatch_index_of(
       (int64_t)N, M, obj->types, M, 1, types, 1
   );
 }
+
+/**
+ * Applies an ndarray function to provided ndarrays, resolving a kernel based on
+ * the ndarray data types, dimensionality, and memory layout.
+ *
+ * ## Notes
+ *
+ * -   The function resolves a kernel by first finding the ndarray function
+ *     whose signature matches the ndarray data types (see
+ *     `ndarray_function_dispatch_index_of`). If the function object has a
+ *     unary dispatch object for that ndarray function, the function then
+ *     selects a kernel specialized for the ndarray dimensionality and memory
+ *     layout (see `ndarray_unary_dispatch_select`).
+ * -   Resolved kernels are stored in a small inline cache keyed by the ndarray
+ *     data types, the number of output dimensions, and each ndarray's
+ *     contiguity flags and iteration order (which determines whether blocked
+ *     iteration is required). Repeated calls with ndarrays sharing these
+ *     properties skip type matching and kernel selection entirely.
+ * -   The cache is safe to use from multiple threads.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param obj     ndarray function object
+ * @param arrays  array containing pointers to input and output ndarrays
+ * @return        status code
+ *
+ * @example
+ * #include "ndarray/base/function_object.h"
+ * #include "ndarray.h"
+ *
+ * // ...
+ *
+ * struct ndarray *arrays[] = {x, y};
+ *
+ * int8_t status = ndarray_function_apply(obj, arrays);
+ */
+int8_t ndarray_function_apply(
+    struct ndarrayFunctionObject* obj, struct ndarray* arrays[]
+) {
+  int8_t layouts[NDARRAY_FUNCTION_CACHE_MAX_ARRAYS];
+  int32_t types[NDARRAY_FUNCTION_CACHE_MAX_ARRAYS];
+  struct ndarrayFunctionCacheEntry* e;
+  struct ndarrayFunctionCache* cache;
+  ndarrayFcn kernel;
+  int32_t* buf;
+  int64_t ndims;
+  int8_t linear;
+  int8_t status;
+  void* data;
+  int64_t s;
+  int32_t M;
+  int32_t i;
+  int32_t k;
+
+  if (obj == NULL || arrays == NULL || obj->narrays < 1) {
+    return -1;
+  }
+  M     = obj->narrays;
+  cache = obj->cache;
+
+  // If we cannot use the cache, resolve a kernel on every call...
+  if (cache == NULL || M > NDARRAY_FUNCTION_CACHE_MAX_ARRAYS) {
+    buf = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, sizeof(int32_t) * M);
+    if (buf == NULL) {
+      return -1;
+    }
+    for (i = 0; i < M; i++) {
+      buf[i] = arrays[i]->dtype;
+    }
+    status = ndarray_function_resolve(
+        obj, arrays, buf, &kernel, &data, &linear
+    );
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, buf, sizeof(int32_t) * M);
+    if (status != 0) {
+      return -1;
+    }
+    return ndarray_function_invoke(M, arrays, kernel, data, linear);
+  }
+  // Compute the cache key...
+  ndims = arrays[M - 1]->ndims;
+  for (i = 0; i < M; i++) {
+    types[i]   = arrays[i]->dtype;
+    layouts[i] = ndarray_function_layout(arrays[i]);
+  }
+  // Search the cache for a resolved kernel...
+  for (k = 0; k < NDARRAY_FUNCTION_CACHE_SIZE; k++) {
+    e = &(cache->entries[k]);
+    s = ndarray_internal_atomic_load(&(e->seq));
+    if ((s & 1) || e->kernel == NULL || e->ndims != ndims) {
+      continue;
+    }
+    for (i = 0; i < M; i++) {
+      if (e->types[i] != types[i] || e->layouts[i] != layouts[i]) {
+        break;
+      }
+    }
+    if (i < M) {
+      continue;
+    }
+    kernel = e->kernel;
+    data   = e->data;
+    linear = e->linear;
+
+    // Ensure that the entry was not modified while reading it:
+    ndarray_internal_atomic_fence_acquire();
+    if (ndarray_internal_atomic_load(&(e->seq)) == s) {
+      return ndarray_function_invoke(M, arrays, kernel, data, linear);
+    }
+  }
+  // Resolve the kernel and add it to the cache (replacing entries in a
+  // round-robin fashion)...
+  if (ndarray_function_resolve(obj, arrays, types, &kernel, &data, &linear)) {
+    return -1;
+  }
+  k = (int32_t)(ndarray_internal_atomic_fetch_add(&(cache->next), 1) %
+                NDARRAY_FUNCTION_CACHE_SIZE);
+  e = &(cache->entries[k]);
+  s = ndarray_internal_atomic_load(&(e->seq));
+
+  // Note: if another thread is writing the entry, we skip caching...
+  if (!(s & 1) &&
+      ndarray_internal_atomic_compare_exchange(&(e->seq), s, s + 1)) {
+    ndarray_internal_atomic_fence_release();
+    e->ndims  = ndims;
+    e->kernel = kernel;
+    e->data   = data;
+    e->linear = linear;
+    for (i = 0; i < M; i++) {
+      e->types[i]   = (int16_t)types[i];
+      e->layouts[i] = layouts[i];
+    }
+    ndarray_internal_atomic_fence_release();
+    ndarray_internal_atomic_store(&(e->seq), s + 2);
+  }
+  return ndarray_function_invoke(M, arrays, kernel, data, linear);
+}
+
+/**
+ * Registers an alternative ndarray function implementation requiring specific
+ * CPU features.
+ *
+ * ## Notes
+ *
+ * -   An implementation is only selected if the running CPU supports all of the
+ *     required features (see `ndarray_cpu_features`). Among supported
+ *     implementations for the same ndarray function, the implementation
+ *     requiring the newest instruction set extensions (i.e., having the largest
+ *     feature bit mask) is selected. The ndarray function in `functions` serves
+ *     as the baseline (e.g., scalar) implementation.
+ * -   Selection happens once, at registration time. Hence, implementations
+ *     should be registered when initializing the library, before applying the
+ *     function object.
+ * -   A selected implementation takes precedence over a unary dispatch object
+ *     registered for the same ndarray function (see `obj->dispatch`).
+ * -   The `NDARRAY_CPU_FEATURES` environment variable restricts the set of
+ *     features considered supported, which is useful for testing baseline
+ *     implementations on newer CPUs.
+ * -   If successful, the function returns `0`, regardless of whether the
+ *     implementation was selected; otherwise, the function returns `-1`.
+ *
+ * @param obj       ndarray function object
+ * @param idx       index of the ndarray function (i.e., type signature)
+ * @param features  bit mask of required CPU features
+ * @param fcn       ndarray function implementation
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray/base/function_object.h"
+ * #include "ndarray/cpu_features.h"
+ *
+ * // ...
+ *
+ * ndarray_function_register_variant(
+ *     obj, 0, NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, scale_float64_avx2
+ * );
+ * ndarray_function_register_variant(
+ *     obj, 0, NDARRAY_CPU_AVX512F, scale_float64_avx512
+ * );
+ */
+int8_t ndarray_function_register_variant(
+    struct ndarrayFunctionObject* obj, const int64_t idx,
+    const int64_t features, ndarrayFcn fcn
+) {
+  struct ndarrayFunctionCacheEntry* e;
+  ndarrayFcn* variants;
+  int64_t s;
+  int32_t i;
+
+  if (obj == NULL || fcn == NULL || idx < 0 || idx >= obj->nfunctions ||
+      features <= 0) {
+    return -1;
+  }
+  // Check whether the running CPU supports the implementation...
+  if (!ndarray_cpu_has_features(features)) {
+    return 0;
+  }
+  if (obj->variants == NULL) {
+    // Store the selected implementations and their CPU features in a single
+    // allocation:
+    variants = ndarray_memory_malloc(
+        NDARRAY_MEMORY_HEADER,
+        (sizeof(ndarrayFcn) + sizeof(int64_t)) * obj->nfunctions
+    );
+    if (variants == NULL) {
+      return -1;
+    }
+    obj->features = (int64_t*)variants;
+    obj->variants = (ndarrayFcn*)(obj->features + obj->nfunctions);
+    for (i = 0; i < obj->nfunctions; i++) {
+      obj->features[i] = 0;
+      obj->variants[i] = obj->functions[i];
+    }
+  }
+  if (features <= obj->features[idx]) {
+    return 0;
+  }
+  obj->features[idx] = features;
+  obj->variants[idx] = fcn;
+
+  // Invalidate previously resolved kernels:
+  if (obj->cache != NULL) {
+    for (i = 0; i < NDARRAY_FUNCTION_CACHE_SIZE; i++) {
+      e = &(obj->cache->entries[i]);
+      s = ndarray_internal_atomic_load(&(e->seq));
+      if (!(s & 1) &&
+          ndarray_internal_atomic_compare_exchange(&(e->seq), s, s + 1)) {
+        ndarray_internal_atomic_fence_release();
+        e->kernel = NULL;
+        ndarray_internal_atomic_fence_release();
+        ndarray_internal_atomic_store(&(e->seq), s + 2);
+      }
+    }
+  }
+  return 0;
+}
+
+/**
+ * Returns the cost of converting between two data types (or `-1` if a
+ * conversion is not allowed).
+ *
+ * ## Notes
+ *
+ * -   The cost is the number of bytes read and written per converted element.
+ *
+ * @private
+ * @param from     data type
+ * @param to       data type
+ * @param casting  casting mode
+ * @return         conversion cost
+ */
+static int64_t ndarray_function_cast_cost(
+    const int32_t from, const int32_t to,
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  if (from == to) {
+    return 0;
+  }
+  if (from < 0 || from > INT16_MAX || to < 0 || to > INT16_MAX) {
+    return -1;
+  }
+  if (!ndarray_is_allowed_data_type_cast(
+          (int16_t)from, (int16_t)to, casting
+      ) ||
+      ndarray_strided_cast_function((int16_t)from, (int16_t)to) == NULL) {
+    return -1;
+  }
+  return ndarray_bytes_per_element(from) + ndarray_bytes_per_element(to);
+}
+
+/**
+ * Returns the index of the least costly function whose signature can be
+ * satisfied by a provided list of array types when casting is allowed (or `-1`
+ * if no such function exists).
+ *
+ * ## Notes
+ *
+ * -   If a function signature exactly matches the provided array types, the
+ *     function returns the index of that function (see
+ *     `ndarray_function_dispatch_index_of`).
+ * -   Otherwise, a function signature is satisfiable if each input array type
+ *     can be cast to the corresponding signature type and each signature
+ *     output type can be cast to the corresponding output array type according
+ *     to the specified casting mode.
+ * -   Among satisfiable signatures, the function returns the index of the
+ *     signature requiring the fewest bytes to be converted per element (see
+ *     `ndarray_result_type` for the matching promotion rules). Ties are broken
+ *     in favor of the first registered function.
+ * -   If `obj` or `types` is `NULL`, the function returns `-1`.
+ *
+ * @param obj      ndarray function object
+ * @param types    list of array types
+ * @param casting  casting mode
+ * @return         index
+ *
+ * @example
+ * #include "ndarray/base/function_object.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * // Resolve a function for an `int8` input and a `float64` output:
+ * int32_t types[] = {NDARRAY_INT8, NDARRAY_FLOAT64};
+ *
+ * int64_t idx = ndarray_function_resolve_index_of(
+ *     obj, types, NDARRAY_SAFE_CASTING
+ * );
+ */
+int64_t ndarray_function_resolve_index_of(
+    const struct ndarrayFunctionObject* obj, const int32_t* types,
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  const int32_t* sig;
+  int64_t cost;
+  int64_t best;
+  int64_t idx;
+  int64_t c;
+  int32_t M;
+  int32_t i;
+  int32_t j;
+
+  if (obj == NULL || types == NULL) {
+    return -1;
+  }
+  idx = ndarray_function_dispatch_index_of(obj, types);
+  if (idx >= 0 || casting == NDARRAY_NO_CASTING ||
+      casting == NDARRAY_EQUIV_CASTING) {
+    return idx;
+  }
+  M    = obj->narrays;
+  best = -1;
+  for (i = 0; i < obj->nfunctions; i++) {
+    sig  = obj->types + (i * M);
+    cost = 0;
+    for (j = 0; j < M; j++) {
+      // Inputs are converted to signature types, and signature outputs are
+      // converted to output types...
+      if (j < obj->nin) {
+        c = ndarray_function_cast_cost(types[j], sig[j], casting);
+      } else {
+        c = ndarray_function_cast_cost(sig[j], types[j], casting);
+      }
+      if (c < 0) {
+        break;
+      }
+      cost += c;
+    }
+    if (j == M && (idx < 0 || cost < best)) {
+      idx  = i;
+      best = cost;
+    }
+  }
+  return idx;
+}
+
+/**
+ * Returns the number of bytes needed to store a temporary ndarray.
+ *
+ * @private
+ * @param ndims   number of dimensions
+ * @param shape   array shape
+ * @param nbytes  number of bytes per element
+ * @return        number of bytes
+ */
+static int64_t ndarray_function_temporary_bytes(
+    const int64_t ndims, int64_t* shape, const int64_t nbytes
+) {
+  int64_t len = (ndims == 0) ? 1 : ndarray_numel(ndims, shape);
+  return (ndims * (int64_t)sizeof(int64_t)) + (len * nbytes);
+}
+
+/**
+ * Returns a pointer to a dynamically allocated temporary ndarray having the
+ * same shape and order as a provided ndarray but a different data type.
+ *
+ * ## Notes
+ *
+ * -   The temporary ndarray strides and data are stored in a single block of
+ *     scratch memory, and the temporary ndarray shares the shape of the
+ *     provided ndarray. Accordingly, the temporary ndarray must be freed
+ *     (see `ndarray_function_free_temporary`) before the provided ndarray.
+ *
+ * @private
+ * @param arr    input ndarray
+ * @param dtype  temporary ndarray data type
+ * @return       temporary ndarray
+ */
+static struct ndarray* ndarray_function_temporary(
+    const struct ndarray* arr, const int32_t dtype
+) {
+  struct ndarray* tmp;
+  int64_t* strides;
+  int64_t nbytes;
+  int64_t i;
+
+  nbytes = ndarray_bytes_per_element(dtype);
+  if (nbytes == 0) {
+    return NULL;
+  }
+  strides = ndarray_memory_malloc(
+      NDARRAY_MEMORY_SCRATCH,
+      ndarray_function_temporary_bytes(arr->ndims, arr->shape, nbytes)
+  );
+  if (strides == NULL) {
+    return NULL;
+  }
+  ndarray_shape2strides(arr->ndims, arr->shape, arr->order, strides);
+  for (i = 0; i < arr->ndims; i++) {
+    strides[i] *= nbytes;
+  }
+  tmp = ndarray_allocate(
+      (int16_t)dtype, (uint8_t*)(strides + arr->ndims), arr->ndims, arr->shape,
+      strides, 0, arr->order, arr->imode, arr->nsubmodes, arr->submodes
+  );
+  if (tmp == NULL) {
+    ndarray_memory_free(
+        NDARRAY_MEMORY_SCRATCH, strides,
+        ndarray_function_temporary_bytes(arr->ndims, arr->shape, nbytes)
+    );
+  }
+  return tmp;
+}
+
+/**
+ * Frees a temporary ndarray.
+ *
+ * @private
+ * @param tmp  temporary ndarray
+ */
+static void ndarray_function_free_temporary(struct ndarray* tmp) {
+  if (tmp == NULL) {
+    return;
+  }
+  ndarray_memory_free(
+      NDARRAY_MEMORY_SCRATCH, tmp->strides,
+      ndarray_function_temporary_bytes(
+          tmp->ndims, tmp->shape, tmp->BYTES_PER_ELEMENT
+      )
+  );
+  ndarray_free(tmp);
+}
+
+/**
+ * Tests whether ndarrays have the same shape.
+ *
+ * @private
+ * @param M       number of ndarrays
+ * @param arrays  array containing pointers to ndarrays
+ * @return        boolean indicating whether all ndarrays have the same shape
+ */
+static int8_t ndarray_function_is_elementwise(
+    const int32_t M, struct ndarray* arrays[]
+) {
+  int64_t i;
+  int32_t k;
+
+  for (k = 0; k < M - 1; k++) {
+    if (arrays[k]->ndims != arrays[M - 1]->ndims) {
+      return 0;
+    }
+    for (i = 0; i < arrays[k]->ndims; i++) {
+      if (arrays[k]->shape[i] != arrays[M - 1]->shape[i]) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/**
+ * Applies an ndarray function to a chunk of converted ndarrays.
+ *
+ * @private
+ * @param arrays  array containing pointers to one-dimensional ndarray chunks
+ * @param ctx     ndarray function object
+ * @return        status code
+ */
+static int8_t ndarray_function_apply_chunk(
+    struct ndarray* arrays[], void* ctx
+) {
+  return ndarray_function_apply((struct ndarrayFunctionObject*)ctx, arrays);
+}
+
+/**
+ * Applies an ndarray function to provided ndarrays, converting ndarrays whose
+ * data types do not match any function signature.
+ *
+ * ## Notes
+ *
+ * -   The function resolves the least costly function whose signature can be
+ *     satisfied according to the specified casting mode (see
+ *     `ndarray_function_resolve_index_of`).
+ * -   If the ndarray data types exactly match a function signature, the
+ *     function applies the function via `ndarray_function_apply` without
+ *     conversion.
+ * -   Otherwise, if all ndarrays have the same shape, the function applies
+ *     the resolved function to L1-sized chunks, converting ndarrays whose data
+ *     types do not match the resolved signature via small scratch buffers (see
+ *     `ndarray_buffered_apply`). Hence, the function never allocates memory
+ *     proportional to ndarray size.
+ * -   If ndarrays have different shapes, for each ndarray whose data type does
+ *     not match the resolved signature, the function allocates a temporary
+ *     ndarray having the signature data type. Input ndarrays are converted to
+ *     temporary ndarrays before applying the resolved function, and temporary
+ *     output ndarrays are converted to the output ndarrays afterward (see
+ *     `ndarray_assign`).
+ * -   In both cases, ndarrays whose data types match the signature are passed
+ *     through without copying.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param obj      ndarray function object
+ * @param arrays   array containing pointers to input and output ndarrays
+ * @param casting  casting mode
+ * @return         status code
+ *
+ * @example
+ * #include "ndarray/base/function_object.h"
+ * #include "ndarray/casting_modes.h"
+ * #include "ndarray.h"
+ *
+ * // ...
+ *
+ * // Apply a function having only a `float64` signature to `int8` ndarrays:
+ * struct ndarray *arrays[] = {x, y};
+ *
+ * int8_t status = ndarray_function_apply_casting(
+ *     obj, arrays, NDARRAY_SAFE_CASTING
+ * );
+ */
+int8_t ndarray_function_apply_casting(
+    struct ndarrayFunctionObject* obj, struct ndarray* arrays[],
+    const enum NDARRAY_CASTING_MODE casting
+) {
+  struct ndarray** args;
+  struct ndarray** tmp;
+  const int32_t* sig;
+  int32_t* types;
+  int8_t status;
+  int64_t idx;
+  int32_t M;
+  int32_t i;
+
+  if (obj == NULL || arrays == NULL || obj->narrays < 1) {
+    return -1;
+  }
+  M = obj->narrays;
+
+  // Allocate scratch memory for the ndarray arguments, temporary ndarrays, and
+  // array types:
+  args = ndarray_memory_malloc(
+      NDARRAY_MEMORY_SCRATCH,
+      M * ((2 * sizeof(struct ndarray*)) + sizeof(int32_t))
+  );
+  if (args == NULL) {
+    return -1;
+  }
+  tmp   = args + M;
+  types = (int32_t*)(tmp + M);
+
+  for (i = 0; i < M; i++) {
+    types[i] = arrays[i]->dtype;
+    args[i]  = arrays[i];
+    tmp[i]   = NULL;
+  }
+  idx    = ndarray_function_resolve_index_of(obj, types, casting);
+  status = (idx < 0) ? -1 : 0;
+
+  // If the data types exactly match the resolved signature, apply the function
+  // directly, such that the function uses N-dimensional loops and the resolved
+  // loop cache:
+  if (status == 0) {
+    sig = obj->types + (idx * M);
+    for (i = 0; i < M; i++) {
+      if (sig[i] != types[i]) {
+        break;
+      }
+    }
+    if (i == M) {
+      ndarray_memory_free(
+          NDARRAY_MEMORY_SCRATCH, args,
+          M * ((2 * sizeof(struct ndarray*)) + sizeof(int32_t))
+      );
+      return ndarray_function_apply(obj, arrays);
+    }
+  }
+  // Check whether we can convert ndarrays in chunks...
+  if (status == 0 && ndarray_function_is_elementwise(M, arrays)) {
+    ndarray_memory_free(
+        NDARRAY_MEMORY_SCRATCH, args,
+        M * ((2 * sizeof(struct ndarray*)) + sizeof(int32_t))
+    );
+    return ndarray_buffered_apply(
+        obj->nin, M, arrays, obj->types + (idx * M), casting,
+        ndarray_function_apply_chunk, (void*)obj
+    );
+  }
+  // Allocate temporary ndarrays for those ndarrays requiring conversion...
+  if (status == 0) {
+    sig = obj->types + (idx * M);
+    for (i = 0; i < M; i++) {
+      if (sig[i] == types[i]) {
+        continue;
+      }
+      tmp[i] = ndarray_function_temporary(arrays[i], sig[i]);
+      if (tmp[i] == NULL) {
+        status = -1;
+        break;
+      }
+      args[i] = tmp[i];
+      if (i < obj->nin && ndarray_assign(tmp[i], arrays[i], casting) != 0) {
+        status = -1;
+        break;
+      }
+    }
+  }
+  if (status == 0) {
+    status = ndarray_function_apply(obj, args);
+  }
+  // Convert temporary output ndarrays to the output ndarrays:
+  for (i = obj->nin; status == 0 && i < M; i++) {
+    if (tmp[i] != NULL && ndarray_assign(arrays[i], tmp[i], casting) != 0) {
+      status = -1;
+    }
+  }
+  for (i = 0; i < M; i++) {
+    ndarray_function_free_temporary(tmp[i]);
+  }
+  ndarray_memory_free(
+      NDARRAY_MEMORY_SCRATCH, args,
+      M * ((2 * sizeof(struct ndarray*)) + sizeof(int32_t))
+  );
+  return status;
+}
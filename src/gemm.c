@@ -0,0 +1,1060 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/gemm.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/broadcast_shapes.h"
+#include "ndarray/base/cpu_features.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/cpu_features.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+
+// Only compile vectorized micro-kernels for x86 targets when the compiler
+// supports enabling instruction sets on a per function basis:
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NDARRAY_GEMM_X86 1
+#include <immintrin.h>
+#define NDARRAY_GEMM_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Define the alignment (in bytes) of packed buffers:
+#define NDARRAY_GEMM_ALIGNMENT 64
+
+// Define the minimum number of multiply-adds per thread (note: smaller
+// products are not worth the cost of dispatching work to additional threads):
+#define NDARRAY_GEMM_MIN_WORK 262144.0
+
+/**
+ * Function pointer type for a micro-kernel computing the product of a packed
+ * `mr x k` panel of `A` and a packed `k x nr` panel of `B`.
+ *
+ * ## Notes
+ *
+ * -   `A` panels are stored as `k` consecutive columns of `mr` elements, and
+ *     `B` panels are stored as `k` consecutive rows of `nr` elements.
+ * -   The product is written as a row-major `mr x nr` tile to `ab`, thus
+ *     allowing micro-kernels to ignore the output layout and edge cases.
+ *
+ * @private
+ * @param k   number of products to sum for each tile element
+ * @param a   packed panel of `A`
+ * @param b   packed panel of `B`
+ * @param ab  output tile
+ */
+typedef void (*ndarrayGemmMicroKernel)(
+    const int64_t k, const void* a, const void* b, void* ab
+);
+
+/**
+ * Function pointer type for packing a block of a strided matrix into panels.
+ *
+ * ## Notes
+ *
+ * -   The block is treated as an `n x k` matrix, which is packed into panels
+ *     of `r` rows, each of which is stored as `k` consecutive columns of `r`
+ *     elements. Rows beyond the end of the block are zero-filled.
+ * -   `B` blocks are packed by treating the block as its transpose.
+ *
+ * @private
+ * @param x    pointer to the first block element
+ * @param sn   stride (in bytes) between rows
+ * @param sk   stride (in bytes) between columns
+ * @param n    number of rows
+ * @param k    number of columns
+ * @param r    number of rows per panel
+ * @param out  output buffer
+ */
+typedef void (*ndarrayGemmPackFcn)(
+    const uint8_t* x, const int64_t sn, const int64_t sk, const int64_t n,
+    const int64_t k, const int64_t r, void* out
+);
+
+/**
+ * Function pointer type for writing (part of) a tile to a strided output
+ * matrix (i.e., `C = alpha*AB + beta*C`).
+ *
+ * ## Notes
+ *
+ * -   If `beta` is zero, output elements are not read.
+ *
+ * @private
+ * @param ab     row-major tile
+ * @param nr     number of tile columns
+ * @param c      pointer to the first output element
+ * @param rs     output row stride (in bytes)
+ * @param cs     output column stride (in bytes)
+ * @param m      number of rows to write
+ * @param n      number of columns to write
+ * @param alpha  tile scalar
+ * @param beta   output scalar
+ */
+typedef void (*ndarrayGemmStoreFcn)(
+    const void* ab, const int64_t nr, uint8_t* c, const int64_t rs,
+    const int64_t cs, const int64_t m, const int64_t n, const double alpha,
+    const double beta
+);
+
+/**
+ * Structure describing a micro-kernel and its blocking parameters.
+ *
+ * @private
+ */
+struct ndarrayGemmKernel {
+  // Data type:
+  int16_t dtype;
+
+  // CPU features required by the micro-kernel:
+  int64_t features;
+
+  // Number of micro-tile rows:
+  int64_t mr;
+
+  // Number of micro-tile columns:
+  int64_t nr;
+
+  // Number of rows per packed block of `A` (note: a multiple of `mr`, sized
+  // such that a packed block fits in the L2 cache):
+  int64_t mc;
+
+  // Number of columns per packed block of `A` (and rows per packed block of
+  // `B`), sized such that a packed panel of `B` fits in the L1 cache:
+  int64_t kc;
+
+  // Number of columns per packed block of `B` (note: a multiple of `nr`):
+  int64_t nc;
+
+  // Micro-kernel:
+  ndarrayGemmMicroKernel kernel;
+
+  // Packing function:
+  ndarrayGemmPackFcn pack;
+
+  // Tile store function:
+  ndarrayGemmStoreFcn store;
+};
+
+/**
+ * Structure containing the state of a matrix-matrix product.
+ *
+ * @private
+ */
+struct ndarrayGemmLoop {
+  // Micro-kernel:
+  const struct ndarrayGemmKernel* kernel;
+
+  // Number of rows of `A` and `C`:
+  int64_t m;
+
+  // Number of columns of `B` and `C`:
+  int64_t n;
+
+  // Number of columns of `A` and rows of `B`:
+  int64_t k;
+
+  // Pointer to the first element of `A`:
+  const uint8_t* a;
+
+  // Row and column strides (in bytes) of `A`:
+  int64_t rsa;
+  int64_t csa;
+
+  // Pointer to the first element of `B`:
+  const uint8_t* b;
+
+  // Row and column strides (in bytes) of `B`:
+  int64_t rsb;
+  int64_t csb;
+
+  // Pointer to the first element of `C`:
+  uint8_t* c;
+
+  // Row and column strides (in bytes) of `C`:
+  int64_t rsc;
+  int64_t csc;
+
+  // Scalars:
+  double alpha;
+  double beta;
+
+  // Number of (broadcasted) batch dimensions:
+  int64_t nbd;
+
+  // Batch shape:
+  int64_t* bshape;
+
+  // Batch strides (in bytes) of `A`, `B`, and `C` (note: broadcasted batch
+  // dimensions have a stride of zero):
+  int64_t* bsa;
+  int64_t* bsb;
+  int64_t* bsc;
+
+  // Number of matrices in a batch:
+  int64_t nbatch;
+
+  // Number of rows per output tile:
+  int64_t mc;
+
+  // Number of columns per output tile:
+  int64_t nc;
+
+  // Number of output tile columns:
+  int64_t ntn;
+
+  // Number of output tiles per matrix:
+  int64_t ntiles;
+
+  // Number of output tiles per task:
+  int64_t group;
+
+  // Number of bytes per packed block of `A`:
+  int64_t sa;
+
+  // Number of bytes per packed block of `B`:
+  int64_t sbb;
+
+  // Per-thread (aligned) scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+// Define a macro for defining the type-specific packing and store functions
+// for a data type (abbreviation, C type):
+#define NDARRAY_GEMM_DEFINE_TYPE(c, type)                                      \
+  static void ndarray_gemm_pack_##c(                                           \
+      const uint8_t* x, const int64_t sn, const int64_t sk, const int64_t n,   \
+      const int64_t k, const int64_t r, void* out                              \
+  ) {                                                                          \
+    type* po = (type*)out;                                                     \
+    const uint8_t* q;                                                          \
+    const type* v;                                                             \
+    int64_t nn;                                                                \
+    int64_t i0;                                                                \
+    int64_t i;                                                                 \
+    int64_t p;                                                                 \
+    for (i0 = 0; i0 < n; i0 += r) {                                            \
+      nn = (n - i0 < r) ? n - i0 : r;                                          \
+      q  = x + (i0 * sn); /* pointer arithmetic */                             \
+      for (p = 0; p < k; p++) {                                                \
+        if (sn == (int64_t)sizeof(type)) {                                     \
+          v = (const type*)q;                                                  \
+          for (i = 0; i < nn; i++) {                                           \
+            po[i] = v[i];                                                      \
+          }                                                                    \
+        } else {                                                               \
+          for (i = 0; i < nn; i++) {                                           \
+            po[i] = *(const type*)(q + (i * sn)); /* pointer arithmetic */     \
+          }                                                                    \
+        }                                                                      \
+        for (; i < r; i++) {                                                   \
+          po[i] = 0;                                                           \
+        }                                                                      \
+        po += r;                                                               \
+        q += sk;                                                               \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_gemm_store_##c(                                          \
+      const void* ab, const int64_t nr, uint8_t* out, const int64_t rs,        \
+      const int64_t cs, const int64_t m, const int64_t n, const double alpha,  \
+      const double beta                                                        \
+  ) {                                                                          \
+    const type* t = (const type*)ab;                                           \
+    const type al = (type)alpha;                                               \
+    const type be = (type)beta;                                                \
+    type* y;                                                                   \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    for (i = 0; i < m; i++) {                                                  \
+      y = (type*)(out + (i * rs)); /* pointer arithmetic */                    \
+      if (beta == 0.0) {                                                       \
+        for (j = 0; j < n; j++) {                                              \
+          *(type*)((uint8_t*)y + (j * cs)) = al * t[j];                        \
+        }                                                                      \
+      } else {                                                                 \
+        for (j = 0; j < n; j++) {                                              \
+          *(type*)((uint8_t*)y + (j * cs)) =                                   \
+              (al * t[j]) + (be * *(type*)((uint8_t*)y + (j * cs)));           \
+        }                                                                      \
+      }                                                                        \
+      t += nr;                                                                 \
+    }                                                                          \
+  }
+
+NDARRAY_GEMM_DEFINE_TYPE(f, float)
+NDARRAY_GEMM_DEFINE_TYPE(d, double)
+
+// Define a macro for defining a portable micro-kernel (abbreviation, C type,
+// micro-tile rows, micro-tile columns), which relies on the compiler to
+// vectorize the innermost loop:
+#define NDARRAY_GEMM_DEFINE_GENERIC(c, type, MR, NR)                     \
+  static void ndarray_gemm_kernel_generic_##c(                           \
+      const int64_t k, const void* a, const void* b, void* ab            \
+  ) {                                                                    \
+    const type* pa = (const type*)a;                                     \
+    const type* pb = (const type*)b;                                     \
+    type* pc       = (type*)ab;                                          \
+    type acc[(MR) * (NR)];                                               \
+    int64_t p;                                                           \
+    int64_t i;                                                           \
+    int64_t j;                                                           \
+    for (i = 0; i < (MR) * (NR); i++) {                                  \
+      acc[i] = 0;                                                        \
+    }                                                                    \
+    for (p = 0; p < k; p++) {                                            \
+      for (i = 0; i < (MR); i++) {                                       \
+        for (j = 0; j < (NR); j++) {                                     \
+          acc[(i * (NR)) + j] += pa[i] * pb[j];                          \
+        }                                                                \
+      }                                                                  \
+      pa += (MR);                                                        \
+      pb += (NR);                                                        \
+    }                                                                    \
+    for (i = 0; i < (MR) * (NR); i++) {                                  \
+      pc[i] = acc[i];                                                    \
+    }                                                                    \
+  }
+
+NDARRAY_GEMM_DEFINE_GENERIC(f, float, 4, 8)
+NDARRAY_GEMM_DEFINE_GENERIC(d, double, 4, 4)
+
+#ifdef NDARRAY_GEMM_X86
+// Define macros for declaring, updating, and storing the two vector
+// accumulators of micro-tile row `i` (note: `t` holds a broadcasted element of
+// an `A` panel, and `b0` and `b1` hold a row of a `B` panel):
+#define NDARRAY_GEMM_X86_DECLARE(vtype, i) \
+  vtype c##i##0;                           \
+  vtype c##i##1
+#define NDARRAY_GEMM_X86_ZERO(i, ZERO) \
+  c##i##0 = ZERO();                    \
+  c##i##1 = ZERO()
+#define NDARRAY_GEMM_X86_UPDATE(i, BCAST, FMA) \
+  t       = BCAST(pa + (i));                   \
+  c##i##0 = FMA(t, b0, c##i##0);               \
+  c##i##1 = FMA(t, b1, c##i##1)
+#define NDARRAY_GEMM_X86_STORE(i, VL, STORE) \
+  STORE(pc + ((i) * 2 * (VL)), c##i##0);     \
+  STORE(pc + ((i) * 2 * (VL)) + (VL), c##i##1)
+
+// Define a macro for defining a `6 x 2*VL` AVX2/FMA micro-kernel (abbreviation,
+// C type, vector type, vector length, zero, load, broadcast, multiply-add, and
+// store intrinsics):
+#define NDARRAY_GEMM_DEFINE_AVX2(c, type, vtype, VL, ZERO, LOAD, BCAST, FMA, \
+                                 STORE)                                      \
+  static NDARRAY_GEMM_TARGET("avx2,fma") void ndarray_gemm_kernel_avx2_##c(  \
+      const int64_t k, const void* a, const void* b, void* ab                \
+  ) {                                                                        \
+    const type* pa = (const type*)a;                                         \
+    const type* pb = (const type*)b;                                         \
+    type* pc       = (type*)ab;                                              \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 0);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 1);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 2);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 3);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 4);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 5);                                      \
+    vtype b0;                                                                \
+    vtype b1;                                                                \
+    vtype t;                                                                 \
+    int64_t p;                                                               \
+    NDARRAY_GEMM_X86_ZERO(0, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(1, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(2, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(3, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(4, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(5, ZERO);                                          \
+    for (p = 0; p < k; p++) {                                                \
+      b0 = LOAD(pb);                                                         \
+      b1 = LOAD(pb + (VL));                                                  \
+      NDARRAY_GEMM_X86_UPDATE(0, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(1, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(2, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(3, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(4, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(5, BCAST, FMA);                                \
+      pa += 6;                                                               \
+      pb += 2 * (VL);                                                        \
+    }                                                                        \
+    NDARRAY_GEMM_X86_STORE(0, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(1, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(2, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(3, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(4, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(5, VL, STORE);                                    \
+  }
+
+// Define a macro for defining an `8 x 2*VL` AVX-512 micro-kernel (abbreviation,
+// C type, vector type, vector length, zero, load, broadcast, multiply-add, and
+// store intrinsics):
+#define NDARRAY_GEMM_DEFINE_AVX512(c, type, vtype, VL, ZERO, LOAD, BCAST,    \
+                                   FMA, STORE)                               \
+  static NDARRAY_GEMM_TARGET("avx512f") void ndarray_gemm_kernel_avx512_##c( \
+      const int64_t k, const void* a, const void* b, void* ab                \
+  ) {                                                                        \
+    const type* pa = (const type*)a;                                         \
+    const type* pb = (const type*)b;                                         \
+    type* pc       = (type*)ab;                                              \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 0);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 1);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 2);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 3);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 4);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 5);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 6);                                      \
+    NDARRAY_GEMM_X86_DECLARE(vtype, 7);                                      \
+    vtype b0;                                                                \
+    vtype b1;                                                                \
+    vtype t;                                                                 \
+    int64_t p;                                                               \
+    NDARRAY_GEMM_X86_ZERO(0, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(1, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(2, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(3, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(4, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(5, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(6, ZERO);                                          \
+    NDARRAY_GEMM_X86_ZERO(7, ZERO);                                          \
+    for (p = 0; p < k; p++) {                                                \
+      b0 = LOAD(pb);                                                         \
+      b1 = LOAD(pb + (VL));                                                  \
+      NDARRAY_GEMM_X86_UPDATE(0, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(1, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(2, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(3, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(4, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(5, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(6, BCAST, FMA);                                \
+      NDARRAY_GEMM_X86_UPDATE(7, BCAST, FMA);                                \
+      pa += 8;                                                               \
+      pb += 2 * (VL);                                                        \
+    }                                                                        \
+    NDARRAY_GEMM_X86_STORE(0, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(1, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(2, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(3, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(4, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(5, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(6, VL, STORE);                                    \
+    NDARRAY_GEMM_X86_STORE(7, VL, STORE);                                    \
+  }
+
+// Define macros for broadcasting an element to all vector lanes:
+#define NDARRAY_GEMM_BCAST_512_F(p) _mm512_set1_ps(*(p))
+#define NDARRAY_GEMM_BCAST_512_D(p) _mm512_set1_pd(*(p))
+
+NDARRAY_GEMM_DEFINE_AVX2(
+    f, float, __m256, 8, _mm256_setzero_ps, _mm256_loadu_ps,
+    _mm256_broadcast_ss, _mm256_fmadd_ps, _mm256_storeu_ps
+)
+NDARRAY_GEMM_DEFINE_AVX2(
+    d, double, __m256d, 4, _mm256_setzero_pd, _mm256_loadu_pd,
+    _mm256_broadcast_sd, _mm256_fmadd_pd, _mm256_storeu_pd
+)
+NDARRAY_GEMM_DEFINE_AVX512(
+    f, float, __m512, 16, _mm512_setzero_ps, _mm512_loadu_ps,
+    NDARRAY_GEMM_BCAST_512_F, _mm512_fmadd_ps, _mm512_storeu_ps
+)
+NDARRAY_GEMM_DEFINE_AVX512(
+    d, double, __m512d, 8, _mm512_setzero_pd, _mm512_loadu_pd,
+    NDARRAY_GEMM_BCAST_512_D, _mm512_fmadd_pd, _mm512_storeu_pd
+)
+#endif
+
+// Define a table of micro-kernels in order of preference (note: the first
+// micro-kernel whose data type matches and whose required CPU features are
+// available is selected):
+static const struct ndarrayGemmKernel NDARRAY_GEMM_KERNELS[] = {
+#ifdef NDARRAY_GEMM_X86
+    {NDARRAY_FLOAT32, NDARRAY_CPU_AVX512F, 8, 32, 96, 512, 1024,
+     ndarray_gemm_kernel_avx512_f, ndarray_gemm_pack_f, ndarray_gemm_store_f},
+    {NDARRAY_FLOAT64, NDARRAY_CPU_AVX512F, 8, 16, 96, 256, 512,
+     ndarray_gemm_kernel_avx512_d, ndarray_gemm_pack_d, ndarray_gemm_store_d},
+    {NDARRAY_FLOAT32, NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, 6, 16, 96, 512, 1024,
+     ndarray_gemm_kernel_avx2_f, ndarray_gemm_pack_f, ndarray_gemm_store_f},
+    {NDARRAY_FLOAT64, NDARRAY_CPU_AVX2 | NDARRAY_CPU_FMA, 6, 8, 96, 256, 512,
+     ndarray_gemm_kernel_avx2_d, ndarray_gemm_pack_d, ndarray_gemm_store_d},
+#endif
+    {NDARRAY_FLOAT32, 0, 4, 8, 96, 512, 1024, ndarray_gemm_kernel_generic_f,
+     ndarray_gemm_pack_f, ndarray_gemm_store_f},
+    {NDARRAY_FLOAT64, 0, 4, 4, 96, 256, 512, ndarray_gemm_kernel_generic_d,
+     ndarray_gemm_pack_d, ndarray_gemm_store_d},
+};
+
+/**
+ * Rounds a number of bytes up to a multiple of the packed buffer alignment.
+ *
+ * @private
+ * @param n  number of bytes
+ * @return   rounded number of bytes
+ */
+static int64_t ndarray_gemm_align(const int64_t n) {
+  return (n + NDARRAY_GEMM_ALIGNMENT - 1) &
+         ~((int64_t)NDARRAY_GEMM_ALIGNMENT - 1);
+}
+
+/**
+ * Resolves the preferred micro-kernel for a data type which is supported by
+ * the current CPU.
+ *
+ * @private
+ * @param dtype  data type
+ * @return       micro-kernel (or `NULL` if the data type is not supported)
+ */
+static const struct ndarrayGemmKernel* ndarray_gemm_kernel(
+    const int16_t dtype
+) {
+  size_t i;
+
+  for (i = 0; i < sizeof(NDARRAY_GEMM_KERNELS) /
+                      sizeof(NDARRAY_GEMM_KERNELS[0]);
+       i++) {
+    if (NDARRAY_GEMM_KERNELS[i].dtype == dtype &&
+        ndarray_cpu_has_features(NDARRAY_GEMM_KERNELS[i].features)) {
+      return &(NDARRAY_GEMM_KERNELS[i]);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Computes a single output tile of a matrix-matrix product.
+ *
+ * ## Notes
+ *
+ * -   Each tile packs its own blocks of `A` and `B`, such that the elements of
+ *     `C` are computed by the same sequence of floating-point operations
+ *     regardless of the number of threads.
+ *
+ * @private
+ * @param loop  matrix-matrix product
+ * @param a     pointer to the first element of `A`
+ * @param b     pointer to the first element of `B`
+ * @param c     pointer to the first element of `C`
+ * @param t     row-major output tile index
+ * @param tid   thread index
+ */
+static void ndarray_gemm_tile(
+    const struct ndarrayGemmLoop* loop, const uint8_t* a, const uint8_t* b,
+    uint8_t* c, const int64_t t, const int32_t tid
+) {
+  const struct ndarrayGemmKernel* kernel = loop->kernel;
+  int64_t bpe;
+  uint8_t* ap;
+  uint8_t* bp;
+  uint8_t* ab;
+  double beta;
+  int64_t ic;
+  int64_t jc;
+  int64_t pc;
+  int64_t ir;
+  int64_t jr;
+  int64_t mm;
+  int64_t nn;
+  int64_t kk;
+
+  bpe = ndarray_bytes_per_element(kernel->dtype);
+  ap  = loop->scratch + (tid * loop->sb);  // pointer arithmetic
+  bp  = ap + loop->sa;                     // pointer arithmetic
+  ab  = bp + loop->sbb;                    // pointer arithmetic
+  ic  = (t / loop->ntn) * loop->mc;
+  jc  = (t % loop->ntn) * loop->nc;
+  mm  = (loop->m - ic < loop->mc) ? loop->m - ic : loop->mc;
+  nn  = (loop->n - jc < loop->nc) ? loop->n - jc : loop->nc;
+
+  // Resolve the first elements of the tile's operands:
+  a += ic * loop->rsa;                       // pointer arithmetic
+  b += jc * loop->csb;                       // pointer arithmetic
+  c += (ic * loop->rsc) + (jc * loop->csc);  // pointer arithmetic
+
+  // Accumulate the products of consecutive blocks along the inner dimension
+  // (note: the loop executes at least once, such that `C` is scaled by `beta`
+  // when the inner dimension is zero):
+  pc = 0;
+  do {
+    kk = (loop->k - pc < kernel->kc) ? loop->k - pc : kernel->kc;
+    kernel->pack(
+        b + (pc * loop->rsb), loop->csb, loop->rsb, nn, kk, kernel->nr, bp
+    );
+    kernel->pack(
+        a + (pc * loop->csa), loop->rsa, loop->csa, mm, kk, kernel->mr, ap
+    );
+    beta = (pc == 0) ? loop->beta : 1.0;
+    for (jr = 0; jr < nn; jr += kernel->nr) {
+      for (ir = 0; ir < mm; ir += kernel->mr) {
+        kernel->kernel(kk, ap + (ir * kk * bpe), bp + (jr * kk * bpe), ab);
+        kernel->store(
+            ab, kernel->nr, c + (ir * loop->rsc) + (jr * loop->csc), loop->rsc,
+            loop->csc, (mm - ir < kernel->mr) ? mm - ir : kernel->mr,
+            (nn - jr < kernel->nr) ? nn - jr : kernel->nr, loop->alpha, beta
+        );
+      }
+    }
+    pc += kk;
+  } while (pc < loop->k);
+}
+
+/**
+ * Computes a group of consecutive output tiles of a (batched) matrix-matrix
+ * product.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  matrix-matrix product
+ */
+static void ndarray_gemm_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayGemmLoop* loop = (const struct ndarrayGemmLoop*)ctx;
+  const uint8_t* a;
+  const uint8_t* b;
+  uint8_t* c;
+  int64_t end;
+  int64_t bi;
+  int64_t r;
+  int64_t s;
+  int64_t j;
+  int64_t d;
+
+  j   = i * loop->group;
+  end = j + loop->group;
+  if (end > loop->nbatch * loop->ntiles) {
+    end = loop->nbatch * loop->ntiles;
+  }
+  bi = -1;
+  a  = loop->a;
+  b  = loop->b;
+  c  = loop->c;
+  for (; j < end; j++) {
+    // Resolve the matrices of the current batch entry (note: broadcasted
+    // batch dimensions have zero strides, and, thus, broadcasted operands are
+    // never copied)...
+    if (j / loop->ntiles != bi) {
+      bi = j / loop->ntiles;
+      a  = loop->a;
+      b  = loop->b;
+      c  = loop->c;
+      r  = bi;
+      for (d = loop->nbd - 1; d >= 0; d--) {
+        s = r % loop->bshape[d];
+        r /= loop->bshape[d];
+        a += s * loop->bsa[d];  // pointer arithmetic
+        b += s * loop->bsb[d];  // pointer arithmetic
+        c += s * loop->bsc[d];  // pointer arithmetic
+      }
+    }
+    ndarray_gemm_tile(loop, a, b, c, j % loop->ntiles, tid);
+  }
+}
+
+/**
+ * Computes a (batched) matrix-matrix product whose operands have been
+ * resolved.
+ *
+ * @private
+ * @param loop      matrix-matrix product
+ * @param nthreads  number of threads
+ * @return          status code
+ */
+static int8_t ndarray_gemm_execute(
+    struct ndarrayGemmLoop* loop, int32_t nthreads
+) {
+  const struct ndarrayGemmKernel* kernel = loop->kernel;
+  uint8_t* buf;
+  int64_t nbytes;
+  int64_t ntotal;
+  int64_t ntasks;
+  int64_t ntm;
+  int64_t kc;
+  int64_t bpe;
+  double work;
+  double tw;
+  int8_t status;
+
+  if (loop->nbatch == 0 || loop->m == 0 || loop->n == 0) {
+    return 0;
+  }
+  // When the product of `A` and `B` does not contribute to the result, only
+  // scale `C`:
+  if (loop->alpha == 0.0) {
+    loop->k = 0;
+  }
+  work = (double)loop->nbatch * (double)loop->m * (double)loop->n *
+         (double)loop->k;
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((double)nthreads * NDARRAY_GEMM_MIN_WORK > work) {
+    nthreads = (int32_t)(work / NDARRAY_GEMM_MIN_WORK);
+    if (nthreads < 1) {
+      nthreads = 1;
+    }
+  }
+  // Resolve the output tile size, narrowing tiles when there are too few rows
+  // of tiles to occupy every thread (note: the tile size does not affect the
+  // order of floating-point operations for individual output elements):
+  ntm      = (loop->m + kernel->mc - 1) / kernel->mc;
+  loop->mc = kernel->mc;
+  loop->nc = kernel->nc;
+  if (loop->nbatch * ntm < (int64_t)nthreads) {
+    loop->nc = (loop->n * ntm * loop->nbatch + nthreads - 1) / nthreads;
+    loop->nc = ((loop->nc + kernel->nr - 1) / kernel->nr) * kernel->nr;
+    if (loop->nc > kernel->nc) {
+      loop->nc = kernel->nc;
+    }
+  }
+  if (loop->m < loop->mc) {
+    loop->mc = ((loop->m + kernel->mr - 1) / kernel->mr) * kernel->mr;
+  }
+  loop->ntn    = (loop->n + loop->nc - 1) / loop->nc;
+  loop->ntiles = ntm * loop->ntn;
+  ntotal       = loop->nbatch * loop->ntiles;
+
+  // Group consecutive tiles into tasks, such that each task amortizes the cost
+  // of dispatching work (e.g., when multiplying many small matrices), while
+  // still providing a task for every thread:
+  tw = (double)((loop->m < loop->mc) ? loop->m : loop->mc) *
+       (double)((loop->n < loop->nc) ? loop->n : loop->nc) *
+       (double)((loop->k > 1) ? loop->k : 1);
+  loop->group = (int64_t)(NDARRAY_GEMM_MIN_WORK / tw) + 1;
+  if (loop->group > ntotal / nthreads) {
+    loop->group = ntotal / nthreads;
+  }
+  if (loop->group < 1) {
+    loop->group = 1;
+  }
+  ntasks = (ntotal + loop->group - 1) / loop->group;
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Resolve the sizes of packed blocks, which need not exceed the size of the
+  // operands:
+  bpe       = ndarray_bytes_per_element(kernel->dtype);
+  kc        = (loop->k < kernel->kc) ? loop->k : kernel->kc;
+  loop->sa  = ndarray_gemm_align(loop->mc * kc * bpe);
+  loop->sbb = ndarray_gemm_align(loop->nc * kc * bpe);
+  loop->sb  = loop->sa + loop->sbb +
+             ndarray_gemm_align(kernel->mr * kernel->nr * bpe);
+
+  // Allocate per-thread scratch memory (note: over-allocating in order to
+  // align the buffers):
+  nbytes = (loop->sb * nthreads) + NDARRAY_GEMM_ALIGNMENT;
+  buf    = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (buf == NULL) {
+    return -1;
+  }
+  loop->scratch = buf + ndarray_gemm_align((int64_t)((uintptr_t)buf)) -
+                  (int64_t)((uintptr_t)buf);  // pointer arithmetic
+
+  status = ndarray_parallel_for(ntasks, nthreads, ndarray_gemm_task, loop);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, buf, nbytes);
+  return status;
+}
+
+/**
+ * Computes the matrix-matrix product `C = alpha*A*B + beta*C` for
+ * two-dimensional floating-point ndarrays.
+ *
+ * ## Notes
+ *
+ * -   `A` must be an `M x K` ndarray, `B` must be a `K x N` ndarray, and `C`
+ *     must be an `M x N` ndarray. All ndarrays must have the same data type,
+ *     which must be either `float32` or `float64`.
+ * -   Ndarrays may have arbitrary strides (including negative strides and
+ *     transposed views). Blocks of `A` and `B` are packed into aligned,
+ *     contiguous buffers before being multiplied, and, thus, ndarrays do
+ *     **not** need to be contiguous.
+ * -   The product is computed using a register-blocked micro-kernel selected at
+ *     runtime according to the available CPU features (AVX-512, AVX2 and FMA,
+ *     or a portable fallback), and output tiles are computed in parallel.
+ * -   Each output element is computed by the same sequence of floating-point
+ *     operations regardless of the number of threads, and, thus, results are
+ *     deterministic.
+ * -   If `beta` is zero, `C` is not read (i.e., `NaN` values in `C` do not
+ *     propagate). If `alpha` is zero or `K` is zero, `A` and `B` are not read.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   `C` must **not** share overlapping memory with either `A` or `B`.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param alpha     scalar multiplying the product of `A` and `B`
+ * @param a         first input ndarray
+ * @param b         second input ndarray
+ * @param beta      scalar multiplying `C`
+ * @param nthreads  number of threads
+ * @param c         output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/gemm.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major 2x3 ndarray:
+ * double abuf[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+ * int64_t ashape[] = {2, 3};
+ * int64_t astrides[] = {24, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *a = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)abuf, 2, ashape, astrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create a column-major 3x2 ndarray:
+ * double bbuf[] = {1.0, 0.0, 1.0, 0.0, 1.0, 1.0};
+ * int64_t bshape[] = {3, 2};
+ * int64_t bstrides[] = {8, 24};
+ *
+ * struct ndarray *b = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)bbuf, 2, bshape, bstrides, 0,
+ *     NDARRAY_COLUMN_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output 2x2 ndarray:
+ * double cbuf[] = {0.0, 0.0, 0.0, 0.0};
+ * int64_t cshape[] = {2, 2};
+ * int64_t cstrides[] = {16, 8};
+ *
+ * struct ndarray *c = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)cbuf, 2, cshape, cstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the matrix product:
+ * int8_t status = ndarray_gemm(1.0, a, b, 0.0, 1, c);
+ * // cbuf => {4.0, 5.0, 10.0, 11.0}
+ *
+ * ndarray_free(a);
+ * ndarray_free(b);
+ * ndarray_free(c);
+ */
+int8_t ndarray_gemm(
+    const double alpha, const struct ndarray* a, const struct ndarray* b,
+    const double beta, int32_t nthreads, struct ndarray* c
+) {
+  struct ndarrayGemmLoop loop;
+
+  if (a == NULL || b == NULL || c == NULL || a->ndims != 2 || b->ndims != 2 ||
+      c->ndims != 2 || a->dtype != c->dtype || b->dtype != c->dtype ||
+      a->shape[0] != c->shape[0] || b->shape[1] != c->shape[1] ||
+      a->shape[1] != b->shape[0]) {
+    return -1;
+  }
+  loop.kernel = ndarray_gemm_kernel(c->dtype);
+  if (loop.kernel == NULL) {
+    return -1;
+  }
+  loop.m      = c->shape[0];
+  loop.n      = c->shape[1];
+  loop.k      = a->shape[1];
+  loop.a      = a->data + a->offset;  // pointer arithmetic
+  loop.rsa    = a->strides[0];
+  loop.csa    = a->strides[1];
+  loop.b      = b->data + b->offset;  // pointer arithmetic
+  loop.rsb    = b->strides[0];
+  loop.csb    = b->strides[1];
+  loop.c      = c->data + c->offset;  // pointer arithmetic
+  loop.rsc    = c->strides[0];
+  loop.csc    = c->strides[1];
+  loop.alpha  = alpha;
+  loop.beta   = beta;
+  loop.nbd    = 0;
+  loop.bshape = NULL;
+  loop.bsa    = NULL;
+  loop.bsb    = NULL;
+  loop.bsc    = NULL;
+  loop.nbatch = 1;
+  return ndarray_gemm_execute(&loop, nthreads);
+}
+
+/**
+ * Computes the matrix product of two ndarrays, treating the last two
+ * dimensions of each ndarray as matrices and broadcasting the remaining
+ * (leading) dimensions.
+ *
+ * ## Notes
+ *
+ * -   Each ndarray must have at least two dimensions. For an `(..., M, K)`
+ *     ndarray `A` and a `(..., K, N)` ndarray `B`, the output ndarray must
+ *     have shape `(..., M, N)`, where the leading dimensions are the
+ *     broadcasted leading dimensions of `A` and `B` (see
+ *     `ndarray_broadcast_shapes`).
+ * -   All ndarrays must have the same data type, which must be either
+ *     `float32` or `float64`.
+ * -   Broadcasted dimensions are never materialized. Instead, broadcasted
+ *     matrices are read in-place using zero strides.
+ * -   Output tiles of all batch entries are distributed across threads, and
+ *     consecutive tiles are grouped into tasks. Thus, a batch of many small
+ *     matrices is computed using a single parallel loop, rather than one call
+ *     per matrix.
+ * -   Results are identical to computing each matrix product using
+ *     `ndarray_gemm` and do not depend on the number of threads.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   The output ndarray must **not** share overlapping memory with either
+ *     input ndarray.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param a         first input ndarray
+ * @param b         second input ndarray
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/gemm.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a stack of two 2x2 matrices:
+ * double abuf[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+ * int64_t ashape[] = {2, 2, 2};
+ * int64_t astrides[] = {32, 16, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *a = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)abuf, 3, ashape, astrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create a single 2x2 matrix, which is broadcast against the stack:
+ * double bbuf[] = {0.0, 1.0, 1.0, 0.0};
+ * int64_t bshape[] = {2, 2};
+ * int64_t bstrides[] = {16, 8};
+ *
+ * struct ndarray *b = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)bbuf, 2, bshape, bstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * double obuf[] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+ *
+ * struct ndarray *out = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)obuf, 3, ashape, astrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the batched matrix product:
+ * int8_t status = ndarray_matmul(a, b, 1, out);
+ * // obuf => {2.0, 1.0, 4.0, 3.0, 6.0, 5.0, 8.0, 7.0}
+ *
+ * ndarray_free(a);
+ * ndarray_free(b);
+ * ndarray_free(out);
+ */
+int8_t ndarray_matmul(
+    const struct ndarray* a, const struct ndarray* b, int32_t nthreads,
+    struct ndarray* out
+) {
+  struct ndarrayGemmLoop loop;
+  int64_t* shapes[2];
+  int64_t ndims[2];
+  int64_t nmeta;
+  int64_t na;
+  int64_t nb;
+  int64_t i;
+  int64_t d;
+  int8_t status;
+
+  if (a == NULL || b == NULL || out == NULL || a->ndims < 2 ||
+      b->ndims < 2 || out->ndims < 2 || a->dtype != out->dtype ||
+      b->dtype != out->dtype) {
+    return -1;
+  }
+  na       = a->ndims - 2;
+  nb       = b->ndims - 2;
+  loop.nbd = out->ndims - 2;
+  if (loop.nbd != ((na > nb) ? na : nb) ||
+      a->shape[na + 1] != b->shape[nb] ||
+      out->shape[loop.nbd] != a->shape[na] ||
+      out->shape[loop.nbd + 1] != b->shape[nb + 1]) {
+    return -1;
+  }
+  loop.kernel = ndarray_gemm_kernel(out->dtype);
+  if (loop.kernel == NULL) {
+    return -1;
+  }
+  // Allocate scratch memory for the batch shape and batch strides:
+  nmeta       = sizeof(int64_t) * loop.nbd * 4;
+  loop.bshape = NULL;
+  loop.bsa    = NULL;
+  loop.bsb    = NULL;
+  loop.bsc    = NULL;
+  if (nmeta > 0) {
+    loop.bshape = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+    if (loop.bshape == NULL) {
+      return -1;
+    }
+    loop.bsa = loop.bshape + loop.nbd;
+    loop.bsb = loop.bsa + loop.nbd;
+    loop.bsc = loop.bsb + loop.nbd;
+  }
+
+  // Broadcast the leading dimensions and verify that the output ndarray has
+  // the broadcasted shape...
+  shapes[0] = a->shape;
+  shapes[1] = b->shape;
+  ndims[0]  = na;
+  ndims[1]  = nb;
+  if (loop.nbd > 0 &&
+      ndarray_broadcast_shapes(2, shapes, ndims, loop.bshape) != 0) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.bshape, nmeta);
+    return -1;
+  }
+  loop.nbatch = 1;
+  for (i = 0; i < loop.nbd; i++) {
+    if (out->shape[i] != loop.bshape[i]) {
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.bshape, nmeta);
+      return -1;
+    }
+    // Resolve the batch strides, using a stride of zero for broadcasted
+    // dimensions:
+    d           = i - (loop.nbd - na);
+    loop.bsa[i] = (d < 0 || a->shape[d] == 1) ? 0 : a->strides[d];
+    d           = i - (loop.nbd - nb);
+    loop.bsb[i] = (d < 0 || b->shape[d] == 1) ? 0 : b->strides[d];
+    loop.bsc[i] = out->strides[i];
+    loop.nbatch *= loop.bshape[i];
+  }
+  loop.m     = out->shape[loop.nbd];
+  loop.n     = out->shape[loop.nbd + 1];
+  loop.k     = a->shape[na + 1];
+  loop.a     = a->data + a->offset;  // pointer arithmetic
+  loop.rsa   = a->strides[na];
+  loop.csa   = a->strides[na + 1];
+  loop.b     = b->data + b->offset;  // pointer arithmetic
+  loop.rsb   = b->strides[nb];
+  loop.csb   = b->strides[nb + 1];
+  loop.c     = out->data + out->offset;  // pointer arithmetic
+  loop.rsc   = out->strides[loop.nbd];
+  loop.csc   = out->strides[loop.nbd + 1];
+  loop.alpha = 1.0;
+  loop.beta  = 0.0;
+
+  status = ndarray_gemm_execute(&loop, nthreads);
+
+  if (nmeta > 0) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.bshape, nmeta);
+  }
+  return status;
+}
@@ -0,0 +1,1019 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/histogram.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/cpu_features.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/cpu_features.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+
+// Only compile vectorized kernels for x86 targets when the compiler supports
+// enabling instruction sets on a per function basis:
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NDARRAY_HISTOGRAM_X86 1
+#include <immintrin.h>
+#define NDARRAY_HISTOGRAM_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Define the maximum number of elements per block (note: bin indices are
+// computed for a block of contiguous values before incrementing any bins, such
+// that bin indices can be computed using vector instructions):
+#define NDARRAY_HISTOGRAM_BLOCK 1024
+
+// Define the number of elements per task:
+#define NDARRAY_HISTOGRAM_CHUNK 65536
+
+// Define the number of private bin arrays per thread for short histograms
+// (note: consecutive elements update different arrays, such that repeated
+// increments of the same bin do not form a single chain of dependent
+// read-modify-write operations; must be a power of two):
+#define NDARRAY_HISTOGRAM_LANES 4
+
+// Define the maximum number of bins for which to use multiple private bin
+// arrays per thread:
+#define NDARRAY_HISTOGRAM_LANES_MAX 4096
+
+// Define the supported kinds of histograms:
+#define NDARRAY_HISTOGRAM_KIND_UNIFORM 0
+#define NDARRAY_HISTOGRAM_KIND_EDGES 1
+#define NDARRAY_HISTOGRAM_KIND_BINCOUNT 2
+
+struct ndarrayHistogramLoop;
+
+/**
+ * Function pointer type for computing the bin indices of a block of
+ * contiguous values.
+ *
+ * ## Notes
+ *
+ * -   Values which do not belong to any bin are assigned the index `nbins`
+ *     (i.e., a discard bin following the last bin), such that bins can be
+ *     incremented without branching.
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+typedef void (*ndarrayHistogramBinsFcn)(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+);
+
+/**
+ * Structure describing a histogram computation.
+ *
+ * @private
+ */
+struct ndarrayHistogramLoop {
+  // Kind of histogram:
+  int8_t kind;
+
+  // Function for converting input elements to contiguous values (i.e.,
+  // double-precision floating-point numbers for histograms and signed 64-bit
+  // integers for counts):
+  ndarrayStridedCastFcn icast;
+
+  // Boolean indicating whether input elements may be read in place:
+  int8_t direct;
+
+  // Function for computing bin indices:
+  ndarrayHistogramBinsFcn bins;
+
+  // Pointer to the first indexed input element:
+  const uint8_t* x;
+
+  // Number of (coalesced) dimensions:
+  int64_t nd;
+
+  // Dimension shape (ordered by increasing stride magnitude):
+  int64_t* shape;
+
+  // Dimension strides:
+  int64_t* strides;
+
+  // Number of elements:
+  int64_t len;
+
+  // Number of bins:
+  int64_t nbins;
+
+  // Multiplier for mapping a value to a uniform bin (i.e., the reciprocal of
+  // the bin width):
+  double scale;
+
+  // Bin edges (note: `NULL` for counts):
+  double* edges;
+
+  // Number of private bin arrays per thread:
+  int64_t nlanes;
+
+  // Per-thread scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_histogram_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Computes the indices of equal-width bins for a block of values.
+ *
+ * ## Notes
+ *
+ * -   Candidate bins are computed by multiplying by the reciprocal of the bin
+ *     width (i.e., without division) and then corrected by comparing with the
+ *     neighboring bin edges, such that values within rounding error of an
+ *     edge are assigned to the same bin as when searching the bin edges.
+ * -   Comparisons with `NaN` are false, such that `NaN` values are clamped to
+ *     the first bin and then discarded.
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+static void ndarray_histogram_uniform_generic(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+) {
+  const double* x = (const double*)v;
+  const double* e = loop->edges;
+  int64_t nbins;
+  int64_t ok;
+  int64_t b;
+  int64_t i;
+  double mx;
+  double t;
+
+  nbins = loop->nbins;
+  mx    = (double)(nbins - 1);
+  for (i = 0; i < n; i++) {
+    t = (x[i] - e[0]) * loop->scale;
+    t = (t > 0.0) ? t : 0.0;
+    t = (t < mx) ? t : mx;
+    b = (int64_t)t;
+    b -= (b > 0) & (x[i] < e[b]);
+    b += (b < nbins - 1) & (x[i] >= e[b + 1]);
+
+    // Discard values outside of the histogram range:
+    ok     = (x[i] >= e[0]) & (x[i] <= e[nbins]);
+    idx[i] = b + ((nbins - b) * (1 - ok));
+  }
+}
+
+/**
+ * Computes the indices of bins having specified edges for a block of values.
+ *
+ * ## Notes
+ *
+ * -   Bins are found using a binary search whose number of iterations only
+ *     depends on the number of bins (i.e., the search does not branch on the
+ *     values being searched).
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+static void ndarray_histogram_edges_generic(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+) {
+  const double* x = (const double*)v;
+  const double* e = loop->edges;
+  int64_t nbins;
+  int64_t half;
+  int64_t base;
+  int64_t ok;
+  int64_t m;
+  int64_t i;
+
+  nbins = loop->nbins;
+  for (i = 0; i < n; i++) {
+    // Find the last edge which is less than or equal to the value:
+    base = 0;
+    for (m = nbins + 1; m > 1; m -= half) {
+      half = m / 2;
+      base += (e[base + half] <= x[i]) ? half : 0;
+    }
+    // Include the last edge in the last bin:
+    base -= (base == nbins);
+    ok     = (x[i] >= e[0]) & (x[i] <= e[nbins]);
+    idx[i] = base + ((nbins - base) * (1 - ok));
+  }
+}
+
+/**
+ * Computes the indices of count bins for a block of integer values.
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+static void ndarray_histogram_bincount_generic(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+) {
+  const int64_t* x = (const int64_t*)v;
+  uint64_t nbins;
+  uint64_t u;
+  int64_t i;
+
+  nbins = (uint64_t)loop->nbins;
+  for (i = 0; i < n; i++) {
+    // Negative values wrap around to large unsigned values:
+    u      = (uint64_t)x[i];
+    idx[i] = (int64_t)((u < nbins) ? u : nbins);
+  }
+}
+
+#ifdef NDARRAY_HISTOGRAM_X86
+/**
+ * Computes the indices of equal-width bins for a block of values using AVX2
+ * instructions.
+ *
+ * ## Notes
+ *
+ * -   Bin indices are computed for four values at a time, with neighboring bin
+ *     edges loaded using gather instructions. Remaining values are processed
+ *     by `ndarray_histogram_uniform_generic`.
+ * -   As AVX2 lacks conversions from doubles to 64-bit integers, candidate
+ *     bins are converted by adding `2^52`, which places the (integral) bin
+ *     index in the low bits of the mantissa.
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+static NDARRAY_HISTOGRAM_TARGET("avx2") void ndarray_histogram_uniform_avx2(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+) {
+  const double* x = (const double*)v;
+  const double* e = loop->edges;
+  __m256i nbins;
+  __m256i last;
+  __m256i one;
+  __m256i b;
+  __m256d magic;
+  __m256d scale;
+  __m256d zero;
+  __m256d mx;
+  __m256d lo;
+  __m256d hi;
+  __m256d xv;
+  __m256d t;
+  __m256d c;
+  int64_t i;
+
+  nbins = _mm256_set1_epi64x(loop->nbins);
+  last  = _mm256_set1_epi64x(loop->nbins - 1);
+  one   = _mm256_set1_epi64x(1);
+  magic = _mm256_set1_pd(4503599627370496.0);
+  scale = _mm256_set1_pd(loop->scale);
+  zero  = _mm256_setzero_pd();
+  mx    = _mm256_set1_pd((double)(loop->nbins - 1));
+  lo    = _mm256_set1_pd(e[0]);
+  hi    = _mm256_set1_pd(e[loop->nbins]);
+  for (i = 0; i + 4 <= n; i += 4) {
+    xv = _mm256_loadu_pd(x + i);
+
+    // Compute candidate bins (note: if either operand is `NaN`, `max` returns
+    // the second operand):
+    t = _mm256_mul_pd(_mm256_sub_pd(xv, lo), scale);
+    t = _mm256_min_pd(_mm256_max_pd(t, zero), mx);
+    t = _mm256_add_pd(_mm256_floor_pd(t), magic);
+    b = _mm256_sub_epi64(
+        _mm256_castpd_si256(t), _mm256_castpd_si256(magic)
+    );
+
+    // Move to the previous bin if a value is less than the lower edge (note:
+    // comparison masks are all ones, i.e. `-1`, for true lanes):
+    c = _mm256_cmp_pd(xv, _mm256_i64gather_pd(e, b, 8), _CMP_LT_OQ);
+    b = _mm256_add_epi64(
+        b, _mm256_and_si256(
+               _mm256_castpd_si256(c),
+               _mm256_cmpgt_epi64(b, _mm256_setzero_si256())
+           )
+    );
+
+    // Move to the next bin if a value is greater than or equal to the upper
+    // edge:
+    c = _mm256_cmp_pd(
+        xv, _mm256_i64gather_pd(e, _mm256_add_epi64(b, one), 8), _CMP_GE_OQ
+    );
+    b = _mm256_sub_epi64(
+        b, _mm256_and_si256(
+               _mm256_castpd_si256(c), _mm256_cmpgt_epi64(last, b)
+           )
+    );
+
+    // Discard values outside of the histogram range:
+    c = _mm256_and_pd(
+        _mm256_cmp_pd(xv, lo, _CMP_GE_OQ), _mm256_cmp_pd(xv, hi, _CMP_LE_OQ)
+    );
+    b = _mm256_blendv_epi8(nbins, b, _mm256_castpd_si256(c));
+    _mm256_storeu_si256((__m256i*)(idx + i), b);
+  }
+  ndarray_histogram_uniform_generic(loop, x + i, n - i, idx + i);
+}
+
+/**
+ * Computes the indices of bins having specified edges for a block of values
+ * using AVX2 instructions.
+ *
+ * ## Notes
+ *
+ * -   Four binary searches are performed at a time, with bin edges loaded
+ *     using gather instructions. Remaining values are processed by
+ *     `ndarray_histogram_edges_generic`.
+ *
+ * @private
+ * @param loop  histogram computation
+ * @param v     values
+ * @param n     number of values
+ * @param idx   output buffer for bin indices
+ */
+static NDARRAY_HISTOGRAM_TARGET("avx2") void ndarray_histogram_edges_avx2(
+    const struct ndarrayHistogramLoop* loop, const void* v, const int64_t n,
+    int64_t* idx
+) {
+  const double* x = (const double*)v;
+  const double* e = loop->edges;
+  __m256i nbins;
+  __m256i base;
+  __m256i h;
+  __m256d lo;
+  __m256d hi;
+  __m256d xv;
+  __m256d c;
+  int64_t half;
+  int64_t m;
+  int64_t i;
+
+  nbins = _mm256_set1_epi64x(loop->nbins);
+  lo    = _mm256_set1_pd(e[0]);
+  hi    = _mm256_set1_pd(e[loop->nbins]);
+  for (i = 0; i + 4 <= n; i += 4) {
+    xv = _mm256_loadu_pd(x + i);
+
+    // Find the last edge which is less than or equal to each value:
+    base = _mm256_setzero_si256();
+    for (m = loop->nbins + 1; m > 1; m -= half) {
+      half = m / 2;
+      h    = _mm256_set1_epi64x(half);
+      c    = _mm256_cmp_pd(
+          _mm256_i64gather_pd(e, _mm256_add_epi64(base, h), 8), xv, _CMP_LE_OQ
+      );
+      base = _mm256_add_epi64(
+          base, _mm256_and_si256(_mm256_castpd_si256(c), h)
+      );
+    }
+    // Include the last edge in the last bin:
+    base = _mm256_add_epi64(base, _mm256_cmpeq_epi64(base, nbins));
+
+    // Discard values outside of the range of bin edges:
+    c = _mm256_and_pd(
+        _mm256_cmp_pd(xv, lo, _CMP_GE_OQ), _mm256_cmp_pd(xv, hi, _CMP_LE_OQ)
+    );
+    base = _mm256_blendv_epi8(nbins, base, _mm256_castpd_si256(c));
+    _mm256_storeu_si256((__m256i*)(idx + i), base);
+  }
+  ndarray_histogram_edges_generic(loop, x + i, n - i, idx + i);
+}
+#endif
+
+/**
+ * Accumulates a range of elements into the private bin arrays of a thread.
+ *
+ * ## Notes
+ *
+ * -   Per-thread scratch buffers contain the private bin arrays (each having a
+ *     trailing discard bin), followed by a buffer for bin indices, a
+ *     conversion buffer, and dimension subscripts.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  histogram computation
+ */
+static void ndarray_histogram_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayHistogramLoop* loop;
+  const uint8_t* p;
+  const uint8_t* v;
+  int64_t* bins;
+  int64_t* idx;
+  int64_t* sub;
+  uint8_t* buf;
+  int64_t end;
+  int64_t ls;
+  int64_t r;
+  int64_t j;
+  int64_t m;
+  int64_t k;
+
+  loop = (const struct ndarrayHistogramLoop*)ctx;
+  ls   = (loop->nlanes > 1) ? loop->nbins + 1 : 0;
+  bins = (int64_t*)(loop->scratch + (tid * loop->sb));
+  idx  = bins + (loop->nlanes * (loop->nbins + 1));  // pointer arithmetic
+  buf  = (uint8_t*)(idx + NDARRAY_HISTOGRAM_BLOCK);
+  sub  = (int64_t*)(buf + (NDARRAY_HISTOGRAM_BLOCK * 8));
+
+  // Resolve the subscripts of the first element of the range:
+  j   = i * NDARRAY_HISTOGRAM_CHUNK;
+  end = j + NDARRAY_HISTOGRAM_CHUNK;
+  end = (end < loop->len) ? end : loop->len;
+  p   = loop->x;
+  r   = j;
+  for (k = 0; k < loop->nd; k++) {
+    sub[k] = r % loop->shape[k];
+    r /= loop->shape[k];
+    p += sub[k] * loop->strides[k];  // pointer arithmetic
+  }
+  while (j < end) {
+    m = loop->shape[0] - sub[0];
+    m = (m < end - j) ? m : end - j;
+    m = (m < NDARRAY_HISTOGRAM_BLOCK) ? m : NDARRAY_HISTOGRAM_BLOCK;
+
+    // Read elements in place when they are contiguous and suitably aligned:
+    if (loop->direct && loop->strides[0] == 8 && ((uintptr_t)p % 8) == 0) {
+      v = p;
+    } else {
+      loop->icast(p, loop->strides[0], buf, 8, m);
+      v = buf;
+    }
+    loop->bins(loop, v, m, idx);
+    for (k = 0; k < m; k++) {
+      bins[((k & (NDARRAY_HISTOGRAM_LANES - 1)) * ls) + idx[k]] += 1;
+    }
+    j += m;
+    sub[0] += m;
+    p += m * loop->strides[0];  // pointer arithmetic
+    if (sub[0] < loop->shape[0]) {
+      continue;
+    }
+    // Move to the start of the next run...
+    p -= sub[0] * loop->strides[0];  // pointer arithmetic
+    sub[0] = 0;
+    for (k = 1; k < loop->nd; k++) {
+      sub[k] += 1;
+      p += loop->strides[k];  // pointer arithmetic
+      if (sub[k] < loop->shape[k]) {
+        break;
+      }
+      p -= sub[k] * loop->strides[k];  // pointer arithmetic
+      sub[k] = 0;
+    }
+  }
+}
+
+/**
+ * Computes a histogram of ndarray elements.
+ *
+ * ## Notes
+ *
+ * -   Elements are visited in (approximate) memory order, with dimensions
+ *     coalesced where possible, and the elements are split into fixed-size
+ *     ranges which are processed in parallel.
+ * -   Each thread accumulates counts into private bin arrays, which are merged
+ *     once all elements have been processed. As counts are integers, results
+ *     do not depend on the number of threads.
+ *
+ * @private
+ * @param loop      histogram computation (with the kind, input conversion,
+ *                  number of bins, scale, and bin edges resolved)
+ * @param x         input ndarray
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ */
+static int8_t ndarray_histogram_execute(
+    struct ndarrayHistogramLoop* loop, const struct ndarray* x,
+    int32_t nthreads, struct ndarray* out
+) {
+  const int64_t* bins;
+  uint8_t* o;
+  int64_t* meta;
+  int64_t nmeta;
+  int64_t nbytes;
+  int64_t discarded;
+  int64_t ntasks;
+  int64_t sum;
+  int64_t nb;
+  int64_t d;
+  int64_t r;
+  int64_t s;
+  int64_t i;
+  int64_t k;
+  int64_t t;
+
+  loop->x = x->data + x->offset;  // pointer arithmetic
+
+  // Allocate scratch memory for dimension meta data:
+  nmeta = sizeof(int64_t) * ((x->ndims * 2) + 2);
+  meta  = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (meta == NULL) {
+    return -1;
+  }
+  loop->shape   = meta;
+  loop->strides = meta + x->ndims + 1;
+
+  // Resolve the non-singleton dimensions, sorted by increasing stride
+  // magnitude (note: insertion sort is stable and the number of dimensions is
+  // small)...
+  loop->nd  = 0;
+  loop->len = 1;
+  for (i = 0; i < x->ndims; i++) {
+    loop->len *= x->shape[i];
+    if (x->shape[i] == 1) {
+      continue;
+    }
+    r = x->shape[i];
+    s = x->strides[i];
+    for (k = loop->nd; k > 0 && ndarray_histogram_abs(loop->strides[k - 1]) >
+                                    ndarray_histogram_abs(s);
+         k--) {
+      loop->shape[k]   = loop->shape[k - 1];
+      loop->strides[k] = loop->strides[k - 1];
+    }
+    loop->shape[k]   = r;
+    loop->strides[k] = s;
+    loop->nd += 1;
+  }
+  if (loop->nd == 0) {
+    loop->shape[0]   = 1;
+    loop->strides[0] = 0;
+    loop->nd         = 1;
+  }
+  // Coalesce dimensions which can be traversed as a single dimension...
+  d = 0;
+  for (k = 1; k < loop->nd; k++) {
+    if (loop->strides[k] == loop->strides[d] * loop->shape[d]) {
+      loop->shape[d] *= loop->shape[k];
+    } else {
+      d += 1;
+      loop->shape[d]   = loop->shape[k];
+      loop->strides[d] = loop->strides[k];
+    }
+  }
+  loop->nd = d + 1;
+
+  // Partition the elements into tasks:
+  ntasks = (loop->len + NDARRAY_HISTOGRAM_CHUNK - 1) / NDARRAY_HISTOGRAM_CHUNK;
+  if (ntasks < 1) {
+    ntasks = 1;
+  }
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  loop->nlanes = NDARRAY_HISTOGRAM_LANES;
+  if (loop->nbins > NDARRAY_HISTOGRAM_LANES_MAX) {
+    loop->nlanes = 1;
+  }
+  // Resolve the function for computing bin indices...
+  if (loop->kind == NDARRAY_HISTOGRAM_KIND_UNIFORM) {
+    loop->bins = ndarray_histogram_uniform_generic;
+  } else if (loop->kind == NDARRAY_HISTOGRAM_KIND_EDGES) {
+    loop->bins = ndarray_histogram_edges_generic;
+  } else {
+    loop->bins = ndarray_histogram_bincount_generic;
+  }
+#ifdef NDARRAY_HISTOGRAM_X86
+  if (ndarray_cpu_has_features(NDARRAY_CPU_AVX2)) {
+    if (loop->kind == NDARRAY_HISTOGRAM_KIND_UNIFORM) {
+      loop->bins = ndarray_histogram_uniform_avx2;
+    } else if (loop->kind == NDARRAY_HISTOGRAM_KIND_EDGES) {
+      loop->bins = ndarray_histogram_edges_avx2;
+    }
+  }
+#endif
+  // Allocate (zeroed) per-thread scratch memory:
+  nb       = loop->nlanes * (loop->nbins + 1);
+  loop->sb = sizeof(int64_t) * (nb + (2 * NDARRAY_HISTOGRAM_BLOCK) + loop->nd);
+  nbytes        = loop->sb * nthreads;
+  loop->scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop->scratch == NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, meta, nmeta);
+    return -1;
+  }
+  memset(loop->scratch, 0, nbytes);
+  if (loop->len > 0 &&
+      ndarray_parallel_for(ntasks, nthreads, ndarray_histogram_task, loop)) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop->scratch, nbytes);
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, meta, nmeta);
+    return -1;
+  }
+  // Count the elements which were discarded (e.g., out-of-range elements)
+  // before writing any counts, as counts must not discard any elements:
+  discarded = 0;
+  for (t = 0; t < nthreads; t++) {
+    bins = (const int64_t*)(loop->scratch + (t * loop->sb));
+    for (k = 0; k < loop->nlanes; k++) {
+      discarded += bins[(k * (loop->nbins + 1)) + loop->nbins];
+    }
+  }
+  if (loop->kind == NDARRAY_HISTOGRAM_KIND_BINCOUNT && discarded > 0) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop->scratch, nbytes);
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, meta, nmeta);
+    return -1;
+  }
+  // Merge the private bin arrays...
+  o = out->data + out->offset;  // pointer arithmetic
+  for (i = 0; i < loop->nbins; i++) {
+    sum = 0;
+    for (t = 0; t < nthreads; t++) {
+      bins = (const int64_t*)(loop->scratch + (t * loop->sb));
+      for (k = 0; k < loop->nlanes; k++) {
+        sum += bins[(k * (loop->nbins + 1)) + i];
+      }
+    }
+    memcpy(o + (i * out->strides[0]), &sum, sizeof(sum));
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop->scratch, nbytes);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, meta, nmeta);
+  return 0;
+}
+
+/**
+ * Validates an input ndarray and an output ndarray for a histogram.
+ *
+ * @private
+ * @param x      input ndarray
+ * @param nbins  number of bins
+ * @param out    output ndarray
+ * @return       status code
+ */
+static int8_t ndarray_histogram_check(
+    const struct ndarray* x, const int64_t nbins, const struct ndarray* out
+) {
+  if (x == NULL || out == NULL || nbins < 1 || out->ndims != 1 ||
+      out->shape[0] != nbins || out->dtype != NDARRAY_INT64) {
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * Computes the histogram of ndarray elements using equal-width bins spanning a
+ * specified range.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must be a one-dimensional ndarray having `nbins`
+ *     elements and an `int64` data type.
+ * -   The range `[lo, hi]` is divided into `nbins` equal-width bins. All bins
+ *     are half-open (i.e., include their lower edge), except for the last bin,
+ *     which also includes `hi`, thus mirroring NumPy.
+ * -   Elements outside of the range, as well as `NaN` values, are ignored.
+ * -   Bins are computed without division by multiplying by the reciprocal of
+ *     the bin width, with a correction ensuring that values are assigned to
+ *     the same bins as when searching the bin edges `i*((hi-lo)/nbins) + lo`
+ *     (i.e., the bin width is computed first), where the last edge is `hi`.
+ * -   The input ndarray may have any shape, strides, and real-valued data
+ *     type. Elements are converted to double-precision floating-point numbers.
+ * -   Elements are processed in parallel, with each thread accumulating counts
+ *     into private bins which are merged at the end, such that results do not
+ *     depend on the number of threads. If `nthreads` is less than or equal to
+ *     zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1` (e.g., if `lo` is not less than `hi` or either is not finite).
+ *
+ * @param x         input ndarray
+ * @param nbins     number of bins
+ * @param lo        lower edge of the first bin
+ * @param hi        upper edge of the last bin
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/histogram.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * double xbuf[] = {0.5, 1.5, 1.7, 3.0, 4.5};
+ * int64_t xshape[] = {5};
+ * int64_t xstrides[] = {8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)xbuf, 1, xshape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0, 0};
+ * int64_t yshape[] = {3};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute a histogram having three bins spanning [0, 3]:
+ * int8_t status = ndarray_histogram(x, 3, 0.0, 3.0, 1, y);
+ * // ybuf => {1, 2, 1}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_histogram(
+    const struct ndarray* x, const int64_t nbins, const double lo,
+    const double hi, int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayHistogramLoop loop;
+  int64_t nbytes;
+  int64_t i;
+  int8_t status;
+  double step;
+
+  if (ndarray_histogram_check(x, nbins, out) || !(lo < hi) || isinf(lo) ||
+      isinf(hi) || isinf(hi - lo) || x->dtype == NDARRAY_COMPLEX64 ||
+      x->dtype == NDARRAY_COMPLEX128) {
+    return -1;
+  }
+  loop.icast = ndarray_strided_cast_function(x->dtype, NDARRAY_FLOAT64);
+  if (loop.icast == NULL) {
+    return -1;
+  }
+  loop.kind   = NDARRAY_HISTOGRAM_KIND_UNIFORM;
+  loop.direct = (x->dtype == NDARRAY_FLOAT64);
+  loop.nbins  = nbins;
+  loop.scale  = (double)nbins / (hi - lo);
+
+  // Compute the bin edges, which are used to correct bins computed from the
+  // scaled values:
+  nbytes     = sizeof(double) * (nbins + 1);
+  loop.edges = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.edges == NULL) {
+    return -1;
+  }
+  step = (hi - lo) / (double)nbins;
+  for (i = 0; i < nbins; i++) {
+    loop.edges[i] = ((double)i * step) + lo;
+  }
+  loop.edges[nbins] = hi;
+
+  status = ndarray_histogram_execute(&loop, x, nthreads, out);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.edges, nbytes);
+  return status;
+}
+
+/**
+ * Computes the histogram of ndarray elements using specified bin edges.
+ *
+ * ## Notes
+ *
+ * -   The bin edges must be a one-dimensional ndarray having a real-valued
+ *     data type and at least two elements, which must be non-decreasing and
+ *     must not be `NaN`.
+ * -   The output ndarray must be a one-dimensional ndarray having one fewer
+ *     elements than the bin edges and an `int64` data type.
+ * -   All bins are half-open (i.e., include their lower edge), except for the
+ *     last bin, which also includes its upper edge, thus mirroring NumPy.
+ * -   Elements outside of the range of bin edges, as well as `NaN` values, are
+ *     ignored.
+ * -   Bins are found using a binary search which does not branch on element
+ *     values.
+ * -   See `ndarray_histogram` for a description of supported inputs and
+ *     parallelism.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param edges     bin edges
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/histogram.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * int32_t xbuf[] = {1, 2, 5, 10, 50};
+ * int64_t xshape[] = {5};
+ * int64_t xstrides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)xbuf, 1, xshape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an ndarray of bin edges:
+ * double ebuf[] = {0.0, 2.0, 10.0};
+ * int64_t eshape[] = {3};
+ * int64_t estrides[] = {8};
+ *
+ * struct ndarray *e = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ebuf, 1, eshape, estrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0};
+ * int64_t yshape[] = {2};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the histogram:
+ * int8_t status = ndarray_histogram_edges(x, e, 1, y);
+ * // ybuf => {1, 3}
+ *
+ * ndarray_free(x);
+ * ndarray_free(e);
+ * ndarray_free(y);
+ */
+int8_t ndarray_histogram_edges(
+    const struct ndarray* x, const struct ndarray* edges, int32_t nthreads,
+    struct ndarray* out
+) {
+  struct ndarrayHistogramLoop loop;
+  ndarrayStridedCastFcn ecast;
+  int64_t nbytes;
+  int64_t nbins;
+  int64_t i;
+  int8_t status;
+
+  if (edges == NULL || edges->ndims != 1 || edges->shape[0] < 2) {
+    return -1;
+  }
+  nbins = edges->shape[0] - 1;
+  if (ndarray_histogram_check(x, nbins, out) ||
+      x->dtype == NDARRAY_COMPLEX64 || x->dtype == NDARRAY_COMPLEX128 ||
+      edges->dtype == NDARRAY_COMPLEX64 || edges->dtype == NDARRAY_COMPLEX128) {
+    return -1;
+  }
+  loop.icast = ndarray_strided_cast_function(x->dtype, NDARRAY_FLOAT64);
+  ecast      = ndarray_strided_cast_function(edges->dtype, NDARRAY_FLOAT64);
+  if (loop.icast == NULL || ecast == NULL) {
+    return -1;
+  }
+  loop.kind   = NDARRAY_HISTOGRAM_KIND_EDGES;
+  loop.direct = (x->dtype == NDARRAY_FLOAT64);
+  loop.nbins  = nbins;
+  loop.scale  = 0.0;
+
+  // Copy the bin edges to a contiguous buffer:
+  nbytes     = sizeof(double) * (nbins + 1);
+  loop.edges = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.edges == NULL) {
+    return -1;
+  }
+  ecast(
+      edges->data + edges->offset, edges->strides[0], (uint8_t*)loop.edges,
+      sizeof(double), nbins + 1
+  );
+  for (i = 0; i <= nbins; i++) {
+    if (isnan(loop.edges[i]) || (i > 0 && loop.edges[i] < loop.edges[i - 1])) {
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.edges, nbytes);
+      return -1;
+    }
+  }
+  status = ndarray_histogram_execute(&loop, x, nthreads, out);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.edges, nbytes);
+  return status;
+}
+
+/**
+ * Counts the number of occurrences of each non-negative integer value in an
+ * ndarray.
+ *
+ * ## Notes
+ *
+ * -   The input ndarray must have a boolean or integer data type.
+ * -   The output ndarray must be a one-dimensional ndarray having an `int64`
+ *     data type. The number of output elements determines the number of
+ *     counted values (i.e., `out[i]` is the number of elements equal to `i`).
+ * -   If an element is negative or greater than or equal to the number of
+ *     output elements, the function returns `-1` without modifying the output
+ *     ndarray.
+ * -   See `ndarray_histogram` for a description of parallelism.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/histogram.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * uint8_t xbuf[] = {0, 1, 1, 3, 1};
+ * int64_t xshape[] = {5};
+ * int64_t xstrides[] = {1};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_UINT8, xbuf, 1, xshape, xstrides, 0, NDARRAY_ROW_MAJOR,
+ *     NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0, 0, 0};
+ * int64_t yshape[] = {4};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Count the occurrences of each value:
+ * int8_t status = ndarray_bincount(x, 1, y);
+ * // ybuf => {1, 3, 0, 1}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_bincount(
+    const struct ndarray* x, int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayHistogramLoop loop;
+
+  if (out == NULL || out->ndims != 1 ||
+      ndarray_histogram_check(x, out->shape[0], out)) {
+    return -1;
+  }
+  switch (x->dtype) {
+    case NDARRAY_BOOL:
+    case NDARRAY_INT8:
+    case NDARRAY_UINT8:
+    case NDARRAY_UINT8C:
+    case NDARRAY_INT16:
+    case NDARRAY_UINT16:
+    case NDARRAY_INT32:
+    case NDARRAY_UINT32:
+    case NDARRAY_INT64:
+    case NDARRAY_UINT64:
+      break;
+    default:
+      return -1;
+  }
+  loop.icast = ndarray_strided_cast_function(x->dtype, NDARRAY_INT64);
+  if (loop.icast == NULL) {
+    return -1;
+  }
+  loop.kind   = NDARRAY_HISTOGRAM_KIND_BINCOUNT;
+  loop.direct = (x->dtype == NDARRAY_INT64 || x->dtype == NDARRAY_UINT64);
+  loop.nbins  = out->shape[0];
+  loop.scale  = 0.0;
+  loop.edges  = NULL;
+  return ndarray_histogram_execute(&loop, x, nthreads, out);
+}
@@ -0,0 +1,601 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_HPP
+#define NDARRAY_HPP
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+#if !defined(_MSVC_LANG) || _MSVC_LANG < 201703L
+#error "ndarray.hpp requires C++17 or later."
+#endif
+#endif
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "ndarray.h"
+#include "ndarray/base/unary/constants.h"
+#include "ndarray/dtypes.h"
+
+/**
+ * Header-only typed view layer over `struct ndarray`.
+ *
+ * ## Notes
+ *
+ * -   The namespace is `nd` (rather than `ndarray`) in order to avoid colliding
+ *     with the C `struct ndarray` type, which lives in the global namespace.
+ * -   A view fixes the element type and number of dimensions at compile time.
+ *     Hence, multi-dimensional indexing unrolls into a single sum of products,
+ *     and elementwise expressions (e.g., `a * 2.0 + b`) are lazy templates
+ *     which are only evaluated when assigned to a view, in a single fused loop
+ *     nest.
+ * -   Views do **not** own the underlying byte array, and views must not
+ *     outlive the ndarray from which they are created.
+ * -   Constructing a view from an ndarray having a different data type or
+ *     number of dimensions throws `std::invalid_argument`, as does assigning an
+ *     expression whose operands do not have the same shape as the output view.
+ * -   As for `ndarray_assign`, expression operands must **not** share
+ *     overlapping memory with the output view (unless they are the same view).
+ *
+ * @example
+ * #include "ndarray.hpp"
+ *
+ * // Given row-major `x` and `y` and column-major `z`, each having the data
+ * // type `NDARRAY_FLOAT64` and shape `[2, 3]`:
+ * nd::view<double, 2> a(x);
+ * nd::view<const double, 2> b(y);
+ * nd::view<double, 2> c(z);
+ *
+ * c = (a * 2.0) + b;
+ * c(1, 2) += 1.0;
+ */
+namespace nd {
+
+/**
+ * Maps a C++ element type to an ndarray data type.
+ */
+template <typename T>
+struct dtype_of;
+
+template <>
+struct dtype_of<bool> : std::integral_constant<int16_t, NDARRAY_BOOL> {};
+
+template <>
+struct dtype_of<int8_t> : std::integral_constant<int16_t, NDARRAY_INT8> {};
+
+template <>
+struct dtype_of<uint8_t> : std::integral_constant<int16_t, NDARRAY_UINT8> {};
+
+template <>
+struct dtype_of<int16_t> : std::integral_constant<int16_t, NDARRAY_INT16> {};
+
+template <>
+struct dtype_of<uint16_t> : std::integral_constant<int16_t, NDARRAY_UINT16> {};
+
+template <>
+struct dtype_of<int32_t> : std::integral_constant<int16_t, NDARRAY_INT32> {};
+
+template <>
+struct dtype_of<uint32_t> : std::integral_constant<int16_t, NDARRAY_UINT32> {};
+
+template <>
+struct dtype_of<int64_t> : std::integral_constant<int16_t, NDARRAY_INT64> {};
+
+template <>
+struct dtype_of<uint64_t> : std::integral_constant<int16_t, NDARRAY_UINT64> {};
+
+template <>
+struct dtype_of<float> : std::integral_constant<int16_t, NDARRAY_FLOAT32> {};
+
+template <>
+struct dtype_of<double> : std::integral_constant<int16_t, NDARRAY_FLOAT64> {};
+
+template <>
+struct dtype_of<std::complex<float>>
+    : std::integral_constant<int16_t, NDARRAY_COMPLEX64> {};
+
+template <>
+struct dtype_of<std::complex<double>>
+    : std::integral_constant<int16_t, NDARRAY_COMPLEX128> {};
+
+template <typename T>
+inline constexpr int16_t dtype_of_v = dtype_of<std::remove_cv_t<T>>::value;
+
+/**
+ * Base class of all elementwise expressions (CRTP).
+ */
+template <typename E>
+struct expr {
+  const E& self() const { return static_cast<const E&>(*this); }
+};
+
+template <typename T>
+inline constexpr bool is_expr_v = std::is_base_of_v<expr<T>, T>;
+
+namespace detail {
+
+/**
+ * Returns the absolute value of a stride.
+ */
+constexpr int64_t abs(const int64_t x) { return (x < 0) ? -x : x; }
+
+/**
+ * Computes a byte offset from a list of subscripts (unrolled at compile time).
+ */
+template <std::size_t N, std::size_t... K, typename... I>
+constexpr int64_t offset(
+    const std::array<int64_t, N>& strides, std::index_sequence<K...>, I... idx
+) {
+  return (int64_t{0} + ... + (static_cast<int64_t>(idx) * strides[K]));
+}
+
+/**
+ * Returns the common rank of a list of operand ranks (scalars have rank `0`).
+ */
+template <std::size_t... R>
+constexpr std::size_t common_rank() {
+  std::size_t r = 0;
+  ((r = (R > r) ? R : r), ...);
+  return r;
+}
+
+/**
+ * Tests whether a list of operand ranks is conformable.
+ */
+template <std::size_t... R>
+constexpr bool conformable_ranks() {
+  constexpr std::size_t r = common_rank<R...>();
+  return ((R == 0 || R == r) && ...);
+}
+
+}  // namespace detail
+
+/**
+ * Scalar operand which is broadcast to every element of an expression.
+ */
+template <typename T>
+class scalar : public expr<scalar<T>> {
+ public:
+  using value_type                 = T;
+  static constexpr std::size_t rank = 0;
+
+  /**
+   * Cursor over a scalar operand.
+   */
+  class cursor_type {
+   public:
+    explicit cursor_type(const T& v) : v_(v) {}
+    void move(std::size_t, int64_t) {}
+    T load() const { return v_; }
+
+   private:
+    T v_;
+  };
+
+  explicit scalar(const T& v) : v_(v) {}
+
+  template <std::size_t M>
+  bool conforms(const std::array<int64_t, M>&) const {
+    return true;
+  }
+  bool inner_is(std::size_t) const { return true; }
+  cursor_type cursor() const { return cursor_type(v_); }
+
+ private:
+  T v_;
+};
+
+/**
+ * Lazy elementwise application of a function to one or more operands.
+ */
+template <typename F, typename... Es>
+class map_expr : public expr<map_expr<F, Es...>> {
+  static_assert(
+      detail::conformable_ranks<Es::rank...>(),
+      "expression operands must have the same number of dimensions"
+  );
+
+ public:
+  using value_type = std::invoke_result_t<const F&, typename Es::value_type...>;
+  static constexpr std::size_t rank = detail::common_rank<Es::rank...>();
+
+  /**
+   * Cursor which moves the cursors of all operands in lockstep.
+   */
+  class cursor_type {
+   public:
+    cursor_type(const F& f, typename Es::cursor_type... c) : f_(f), c_(c...) {}
+    void move(const std::size_t d, const int64_t k) {
+      std::apply([d, k](auto&... c) { (c.move(d, k), ...); }, c_);
+    }
+    value_type load() const {
+      return std::apply(
+          [this](const auto&... c) { return f_(c.load()...); }, c_
+      );
+    }
+
+   private:
+    F f_;
+    std::tuple<typename Es::cursor_type...> c_;
+  };
+
+  explicit map_expr(const F& f, const Es&... args) : f_(f), args_(args...) {}
+
+  template <std::size_t M>
+  bool conforms(const std::array<int64_t, M>& shape) const {
+    return std::apply(
+        [&shape](const auto&... e) { return (e.conforms(shape) && ...); }, args_
+    );
+  }
+  bool inner_is(const std::size_t d) const {
+    return std::apply(
+        [d](const auto&... e) { return (e.inner_is(d) && ...); }, args_
+    );
+  }
+  cursor_type cursor() const {
+    return std::apply(
+        [this](const auto&... e) { return cursor_type(f_, e.cursor()...); },
+        args_
+    );
+  }
+
+ private:
+  F f_;
+  std::tuple<Es...> args_;
+};
+
+template <typename T, std::size_t N>
+class view;
+
+namespace detail {
+
+/**
+ * Wraps an operand as an expression (scalars are wrapped as `nd::scalar`).
+ */
+template <typename T>
+auto as_expr(const T& x) {
+  if constexpr (is_expr_v<T>) {
+    return x;
+  } else {
+    return scalar<T>(x);
+  }
+}
+
+template <typename T>
+using as_expr_t = decltype(as_expr(std::declval<const T&>()));
+
+template <typename L, typename R>
+inline constexpr bool is_binary_operand_v = is_expr_v<L> || is_expr_v<R>;
+
+/**
+ * Evaluates an expression over a (sub)region of an output view, visiting the
+ * dimensions in the provided loop order (innermost first).
+ */
+template <std::size_t L, std::size_t N, typename D, typename C>
+inline void loop(
+    const std::array<std::size_t, N>& perm, const std::array<int64_t, N>& ext,
+    D dc, C ec
+) {
+  const std::size_t d = perm[L];
+  const int64_t n     = ext[d];
+  int64_t i;
+
+  for (i = 0; i < n; i++) {
+    if constexpr (L == 0) {
+      dc.store(ec.load());
+    } else {
+      loop<L - 1>(perm, ext, dc, ec);
+    }
+    dc.move(d, 1);
+    ec.move(d, 1);
+  }
+}
+
+/**
+ * Evaluates an expression over an output view in blocks, visiting the
+ * dimensions in the provided loop order (innermost first).
+ */
+template <std::size_t L, std::size_t N, typename D, typename C>
+inline void blocks(
+    const std::array<std::size_t, N>& perm, const std::array<int64_t, N>& shape,
+    const int64_t bsize, std::array<int64_t, N>& ext, D dc, C ec
+) {
+  const std::size_t d = perm[L];
+  const int64_t n     = shape[d];
+  int64_t j;
+
+  for (j = 0; j < n; j += bsize) {
+    ext[d] = (n - j < bsize) ? n - j : bsize;
+    if constexpr (L == 0) {
+      loop<N - 1>(perm, ext, dc, ec);
+    } else {
+      blocks<L - 1>(perm, shape, bsize, ext, dc, ec);
+    }
+    dc.move(d, bsize);
+    ec.move(d, bsize);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Typed view of an ndarray having a compile-time element type and number of
+ * dimensions.
+ */
+template <typename T, std::size_t N>
+class view : public expr<view<T, N>> {
+  using byte_pointer =
+      std::conditional_t<std::is_const_v<T>, const uint8_t*, uint8_t*>;
+
+ public:
+  using value_type                 = std::remove_cv_t<T>;
+  static constexpr std::size_t rank = N;
+
+  /**
+   * Cursor over the elements of a view.
+   */
+  class cursor_type {
+   public:
+    cursor_type(byte_pointer p, const std::array<int64_t, N>& strides)
+        : p_(p), strides_(strides) {}
+    void move(const std::size_t d, const int64_t k) {
+      p_ += k * strides_[d];  // pointer arithmetic
+    }
+    value_type load() const { return *reinterpret_cast<T*>(p_); }
+    template <typename V>
+    void store(const V& v) const {
+      *reinterpret_cast<T*>(p_) = static_cast<value_type>(v);
+    }
+
+   private:
+    byte_pointer p_;
+    std::array<int64_t, N> strides_;
+  };
+
+  /**
+   * Creates a view of an ndarray.
+   */
+  explicit view(const struct ndarray* x) {
+    std::size_t i;
+
+    if (x == nullptr) {
+      throw std::invalid_argument("invalid argument. ndarray is null.");
+    }
+    if (x->dtype != dtype_of_v<T>) {
+      throw std::invalid_argument("invalid argument. Data type mismatch.");
+    }
+    if (x->ndims != static_cast<int64_t>(N)) {
+      throw std::invalid_argument("invalid argument. Dimension mismatch.");
+    }
+    base_ = x->data + x->offset;  // pointer arithmetic
+    for (i = 0; i < N; i++) {
+      shape_[i]   = x->shape[i];
+      strides_[i] = x->strides[i];
+    }
+  }
+
+  /**
+   * Creates a view of a buffer, given a pointer to the first indexed element, a
+   * shape, and strides (in bytes).
+   */
+  view(
+      T* data, const std::array<int64_t, N>& shape,
+      const std::array<int64_t, N>& strides
+  )
+      : base_(reinterpret_cast<byte_pointer>(data)),
+        shape_(shape),
+        strides_(strides) {}
+
+  view(const view& other) = default;
+
+  /**
+   * Assigns the elements of another view (i.e., copies elements; does **not**
+   * rebind the view).
+   */
+  view& operator=(const view& other) { return assign(other); }
+
+  template <typename E>
+  view& operator=(const expr<E>& e) {
+    return assign(e.self());
+  }
+  view& operator=(const value_type& v) { return assign(scalar<value_type>(v)); }
+
+  template <typename E>
+  view& operator+=(const E& e) {
+    return assign(*this + e);
+  }
+  template <typename E>
+  view& operator-=(const E& e) {
+    return assign(*this - e);
+  }
+  template <typename E>
+  view& operator*=(const E& e) {
+    return assign(*this * e);
+  }
+  template <typename E>
+  view& operator/=(const E& e) {
+    return assign(*this / e);
+  }
+
+  /**
+   * Returns a reference to the element located at the provided subscripts.
+   */
+  template <typename... I>
+  T& operator()(I... idx) const {
+    static_assert(sizeof...(I) == N, "invalid number of subscripts");
+    return *reinterpret_cast<T*>(
+        base_ +
+        detail::offset(strides_, std::make_index_sequence<N>{}, idx...)
+    );
+  }
+
+  const std::array<int64_t, N>& shape() const { return shape_; }
+  const std::array<int64_t, N>& strides() const { return strides_; }
+  byte_pointer base() const { return base_; }
+
+  /**
+   * Returns the number of elements.
+   */
+  int64_t size() const {
+    int64_t n = 1;
+    for (const int64_t s : shape_) {
+      n *= s;
+    }
+    return n;
+  }
+
+  template <std::size_t M>
+  bool conforms(const std::array<int64_t, M>& shape) const {
+    if constexpr (M != N) {
+      return false;
+    } else {
+      return shape == shape_;
+    }
+  }
+
+  /**
+   * Tests whether a dimension has the smallest stride magnitude among all
+   * non-singleton dimensions (i.e., is the fastest varying dimension).
+   */
+  bool inner_is(const std::size_t d) const {
+    std::size_t i;
+    for (i = 0; i < N; i++) {
+      if (shape_[i] > 1 &&
+          detail::abs(strides_[i]) < detail::abs(strides_[d])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  cursor_type cursor() const { return cursor_type(base_, strides_); }
+
+  /**
+   * Evaluates an expression and assigns the result to the view.
+   *
+   * ## Notes
+   *
+   * -   The loop nest visits dimensions in order of increasing output stride
+   *     magnitude (singleton dimensions last).
+   * -   If every operand shares the output view's fastest varying dimension,
+   *     the expression is evaluated using simple nested loops; otherwise, the
+   *     expression is evaluated in blocks spanning
+   *     `NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES` along each dimension (mirroring the
+   *     blocked unary kernels), such that both reads and writes reuse cache
+   *     lines.
+   */
+  template <typename E>
+  view& assign(const E& e) {
+    static_assert(!std::is_const_v<T>, "cannot assign to a read-only view");
+    static_assert(
+        E::rank == N || E::rank == 0,
+        "expression must have the same number of dimensions as the view"
+    );
+    std::array<std::size_t, N> perm;
+    std::array<int64_t, N> key;
+    std::array<int64_t, N> ext;
+    std::size_t bpe;
+    int64_t bsize;
+    std::size_t i;
+    std::size_t j;
+    std::size_t k;
+
+    if (!e.conforms(shape_)) {
+      throw std::invalid_argument("invalid argument. Shape mismatch.");
+    }
+    if constexpr (N == 0) {
+      cursor().store(e.cursor().load());
+    } else {
+      for (i = 0; i < N; i++) {
+        if (shape_[i] == 0) {
+          return *this;
+        }
+        key[i] = (shape_[i] == 1) ? INT64_MAX : detail::abs(strides_[i]);
+      }
+      // Sort the dimensions by increasing output stride magnitude:
+      for (i = 0; i < N; i++) {
+        k = i;
+        for (j = i; j > 0 && key[perm[j - 1]] > key[k]; j--) {
+          perm[j] = perm[j - 1];
+        }
+        perm[j] = k;
+      }
+      if (N < 2 || e.inner_is(perm[0])) {
+        detail::loop<N - 1>(perm, shape_, cursor(), e.cursor());
+      } else {
+        // Determine the block size based on the largest element size:
+        bpe = sizeof(value_type);
+        if (sizeof(typename E::value_type) > bpe) {
+          bpe = sizeof(typename E::value_type);
+        }
+        bsize = static_cast<int64_t>(NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES / bpe);
+        if (bsize < 1) {
+          bsize = 1;
+        }
+        detail::blocks<N - 1>(perm, shape_, bsize, ext, cursor(), e.cursor());
+      }
+    }
+    return *this;
+  }
+
+ private:
+  byte_pointer base_;
+  std::array<int64_t, N> shape_;
+  std::array<int64_t, N> strides_;
+};
+
+/**
+ * Returns a lazy expression which applies a function to each element of the
+ * provided operands.
+ */
+template <typename F, typename... Ts>
+auto map(const F& f, const Ts&... args) {
+  return map_expr<F, detail::as_expr_t<Ts>...>(f, detail::as_expr(args)...);
+}
+
+template <
+    typename L, typename R,
+    typename = std::enable_if_t<detail::is_binary_operand_v<L, R>>>
+auto operator+(const L& l, const R& r) {
+  return map(std::plus<>(), l, r);
+}
+
+template <
+    typename L, typename R,
+    typename = std::enable_if_t<detail::is_binary_operand_v<L, R>>>
+auto operator-(const L& l, const R& r) {
+  return map(std::minus<>(), l, r);
+}
+
+template <
+    typename L, typename R,
+    typename = std::enable_if_t<detail::is_binary_operand_v<L, R>>>
+auto operator*(const L& l, const R& r) {
+  return map(std::multiplies<>(), l, r);
+}
+
+template <
+    typename L, typename R,
+    typename = std::enable_if_t<detail::is_binary_operand_v<L, R>>>
+auto operator/(const L& l, const R& r) {
+  return map(std::divides<>(), l, r);
+}
+
+template <typename E, typename = std::enable_if_t<is_expr_v<E>>>
+auto operator-(const E& e) {
+  return map(std::negate<>(), e);
+}
+
+}  // namespace nd
+
+#endif  // !NDARRAY_HPP
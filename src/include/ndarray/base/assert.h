@@ -25,7 +25,8 @@ extern "C" {
  * to a specified casting rule.
  */
 int8_t ndarray_is_allowed_data_type_cast(
-    const int8_t from, const int8_t to, const enum NDARRAY_CASTING_MODE casting
+    const int16_t from, const int16_t to,
+    const enum NDARRAY_CASTING_MODE casting
 );
 
 /**
@@ -80,13 +81,15 @@ int8_t ndarray_is_row_major_contiguous(
 /**
  * Determines if an array data type can be safely cast to another data type.
  */
-int8_t ndarray_is_safe_data_type_cast(const int8_t from, const int8_t to);
+int8_t ndarray_is_safe_data_type_cast(const int16_t from, const int16_t to);
 
 /**
  * Determines if an array data type can be safely cast to, or is of the same
  * "kind" as, another data type.
  */
-int8_t ndarray_is_same_kind_data_type_cast(const int8_t from, const int8_t to);
+int8_t ndarray_is_same_kind_data_type_cast(
+    const int16_t from, const int16_t to
+);
 
 /**
  * Determines if an array is compatible with a single memory segment.
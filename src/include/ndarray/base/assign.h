@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_ASSIGN_H
+#define NDARRAY_BASE_ASSIGN_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/casting_modes.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Assigns the elements of an input ndarray to an output ndarray, converting
+ * between data types and memory layouts.
+ */
+int8_t ndarray_assign(
+    struct ndarray* dst, const struct ndarray* src,
+    const enum NDARRAY_CASTING_MODE casting
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_ASSIGN_H
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_BUFFER_H
+#define NDARRAY_BASE_BUFFER_H
+
+#include <stdint.h>
+#include "ndarray/numa_policies.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Minimum buffer size (in bytes) for which buffers are mapped directly from the
+ * operating system (and, thus, for which huge page and NUMA options apply).
+ */
+#define NDARRAY_BUFFER_MAP_THRESHOLD 2097152
+
+/**
+ * Huge page size (in bytes) used when aligning huge page backed buffers.
+ */
+#define NDARRAY_BUFFER_HUGE_PAGE_SIZE 2097152
+
+/**
+ * Structure for specifying how an ndarray data buffer should be allocated.
+ *
+ * @example
+ * #include "ndarray/base/buffer.h"
+ * #include "ndarray/numa_policies.h"
+ *
+ * struct ndarrayBufferOptions opts = {
+ *     1,                        // huge_pages
+ *     NDARRAY_NUMA_INTERLEAVE,  // numa_policy
+ *     0,                        // numa_node
+ *     1                         // first_touch
+ * };
+ */
+struct ndarrayBufferOptions {
+  // Boolean indicating whether to request transparent huge pages:
+  int8_t huge_pages;
+
+  // NUMA memory placement policy (see `enum NDARRAY_NUMA_POLICY`):
+  int8_t numa_policy;
+
+  // NUMA node on which to place pages when using `NDARRAY_NUMA_BIND`:
+  int32_t numa_node;
+
+  // Boolean indicating whether to eagerly zero-fill the buffer using one thread
+  // per NUMA node, such that pages are faulted in near the threads which will
+  // subsequently use them:
+  int8_t first_touch;
+};
+
+/**
+ * Returns the number of NUMA nodes available to the current process.
+ */
+int32_t ndarray_buffer_numa_nodes(void);
+
+/**
+ * Returns a pointer to a dynamically allocated, zero-initialized ndarray data
+ * buffer.
+ */
+uint8_t* ndarray_buffer_allocate(
+    int64_t nbytes, const struct ndarrayBufferOptions* opts
+);
+
+/**
+ * Frees an ndarray data buffer.
+ */
+void ndarray_buffer_free(uint8_t* buf, int64_t nbytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_BUFFER_H
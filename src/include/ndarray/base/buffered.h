@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_BUFFERED_H
+#define NDARRAY_BASE_BUFFERED_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/casting_modes.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Function pointer type for a function applied to buffered chunks.
+ *
+ * @param arrays  array containing pointers to one-dimensional input and output
+ *                ndarray chunks
+ * @param ctx     function context
+ * @return        status code
+ */
+typedef int8_t (*ndarrayBufferedFcn)(struct ndarray* arrays[], void* ctx);
+
+/**
+ * Applies a function to chunks of ndarrays, converting operands to specified
+ * data types via small scratch buffers.
+ */
+int8_t ndarray_buffered_apply(
+    const int32_t nin, const int32_t narrays, struct ndarray* arrays[],
+    const int32_t* types, const enum NDARRAY_CASTING_MODE casting,
+    ndarrayBufferedFcn fcn, void* ctx
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_BUFFERED_H
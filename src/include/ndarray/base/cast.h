@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_CAST_H
+#define NDARRAY_BASE_CAST_H
+
+#include <stdint.h>
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Function pointer type for a strided cast function.
+ *
+ * @param in    pointer to the first input element
+ * @param sin   input stride (in bytes)
+ * @param out   pointer to the first output element
+ * @param sout  output stride (in bytes)
+ * @param n     number of elements
+ */
+typedef void (*ndarrayStridedCastFcn)(
+    const uint8_t* in, const int64_t sin, uint8_t* out, const int64_t sout,
+    const int64_t n
+);
+
+/**
+ * Returns a function for converting strided elements from one data type to
+ * another data type.
+ *
+ * ## Notes
+ *
+ * -   Conversion from a floating-point or complex number to an integer type
+ *     truncates toward zero and clamps to the range of the integer type, and
+ *     `NaN` converts to `0`.
+ */
+ndarrayStridedCastFcn ndarray_strided_cast_function(
+    const int16_t from, const int16_t to
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_CAST_H
@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_COMPLEX_MATH_H
+#define NDARRAY_BASE_COMPLEX_MATH_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Adds the elements of two ndarrays as complex numbers.
+ */
+int8_t ndarray_complex_add(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+);
+
+/**
+ * Subtracts the elements of one ndarray from the elements of another ndarray
+ * as complex numbers.
+ */
+int8_t ndarray_complex_sub(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+);
+
+/**
+ * Multiplies the elements of two ndarrays as complex numbers.
+ */
+int8_t ndarray_complex_mul(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+);
+
+/**
+ * Divides the elements of one ndarray by the elements of another ndarray as
+ * complex numbers.
+ */
+int8_t ndarray_complex_div(
+    const struct ndarray* x, const struct ndarray* y, struct ndarray* out
+);
+
+/**
+ * Computes the complex conjugate of each ndarray element.
+ */
+int8_t ndarray_complex_conj(const struct ndarray* x, struct ndarray* out);
+
+/**
+ * Computes the complex exponential of each ndarray element.
+ */
+int8_t ndarray_complex_exp(const struct ndarray* x, struct ndarray* out);
+
+/**
+ * Computes the absolute value (modulus) of each ndarray element as a complex
+ * number.
+ */
+int8_t ndarray_complex_abs(const struct ndarray* x, struct ndarray* out);
+
+/**
+ * Computes the argument (phase angle) of each ndarray element as a complex
+ * number.
+ */
+int8_t ndarray_complex_arg(const struct ndarray* x, struct ndarray* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_COMPLEX_MATH_H
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_CONVOLVE_H
+#define NDARRAY_BASE_CONVOLVE_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Convolves ndarray elements with a one-dimensional kernel along a specified
+ * dimension.
+ */
+int8_t ndarray_convolve(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis,
+    const int8_t mode, int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Correlates ndarray elements with a one-dimensional kernel along a specified
+ * dimension.
+ */
+int8_t ndarray_correlate(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis,
+    const int8_t mode, int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Convolves ndarray elements with a two-dimensional kernel along two specified
+ * dimensions.
+ */
+int8_t ndarray_convolve2d(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis0,
+    const int64_t axis1, const int8_t mode, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Correlates ndarray elements with a two-dimensional kernel along two specified
+ * dimensions.
+ */
+int8_t ndarray_correlate2d(
+    const struct ndarray* x, const struct ndarray* kernel, const int64_t axis0,
+    const int64_t axis1, const int8_t mode, int32_t nthreads,
+    struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_CONVOLVE_H
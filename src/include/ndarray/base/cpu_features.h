@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_CPU_FEATURES_H
+#define NDARRAY_BASE_CPU_FEATURES_H
+
+#include <stdint.h>
+#include "ndarray/cpu_features.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns a bit mask of CPU features supported by the running CPU.
+ */
+int64_t ndarray_cpu_features(void);
+
+/**
+ * Tests whether the running CPU supports a set of CPU features.
+ */
+int8_t ndarray_cpu_has_features(const int64_t features);
+
+/**
+ * Parses a list of CPU feature names.
+ */
+int64_t ndarray_cpu_parse_features(const char* str);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_CPU_FEATURES_H
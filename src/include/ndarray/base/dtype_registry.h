@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_DTYPE_REGISTRY_H
+#define NDARRAY_BASE_DTYPE_REGISTRY_H
+
+#include <stdint.h>
+#include "ndarray/base/cast.h"
+#include "ndarray/casting_modes.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Registers a user-defined data type.
+ */
+int16_t ndarray_dtype_register(
+    const char* name, const int64_t nbytes, const int64_t alignment,
+    ndarrayStridedCastFcn copy
+);
+
+/**
+ * Registers a conversion between data types, at least one of which is a
+ * user-defined data type.
+ */
+int8_t ndarray_dtype_register_cast(
+    const int16_t from, const int16_t to, ndarrayStridedCastFcn fcn,
+    const enum NDARRAY_CASTING_MODE casting
+);
+
+/**
+ * Returns the data type number of a registered user-defined data type.
+ */
+int16_t ndarray_dtype_lookup(const char* name);
+
+/**
+ * Returns the name of a user-defined data type.
+ */
+const char* ndarray_dtype_name(const int16_t dtype);
+
+/**
+ * Returns the number of bytes per element of a user-defined data type.
+ */
+int64_t ndarray_dtype_bytes_per_element(const int16_t dtype);
+
+/**
+ * Returns the alignment (in bytes) of a data type.
+ */
+int64_t ndarray_dtype_alignment(const int16_t dtype);
+
+/**
+ * Returns a registered function for converting strided elements between data
+ * types, at least one of which is a user-defined data type.
+ */
+ndarrayStridedCastFcn ndarray_dtype_cast_function(
+    const int16_t from, const int16_t to
+);
+
+/**
+ * Determines if a registered conversion between data types is allowed
+ * according to a specified casting mode.
+ */
+int8_t ndarray_dtype_is_allowed_cast(
+    const int16_t from, const int16_t to,
+    const enum NDARRAY_CASTING_MODE casting
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_DTYPE_REGISTRY_H
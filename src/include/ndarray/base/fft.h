@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_FFT_H
+#define NDARRAY_BASE_FFT_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Computes the discrete Fourier transform of ndarray elements along a
+ * specified dimension.
+ */
+int8_t ndarray_fft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Computes the inverse discrete Fourier transform of ndarray elements along a
+ * specified dimension.
+ */
+int8_t ndarray_ifft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Computes the discrete Fourier transform of real-valued ndarray elements
+ * along a specified dimension, returning the non-negative frequency terms.
+ */
+int8_t ndarray_rfft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Computes the inverse of a real-input discrete Fourier transform along a
+ * specified dimension.
+ */
+int8_t ndarray_irfft(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Releases cached transform plans.
+ */
+void ndarray_fft_clear_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_FFT_H
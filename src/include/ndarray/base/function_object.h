@@ -10,6 +10,8 @@
 
 #include <stdint.h>
 #include "ndarray.h"
+#include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/casting_modes.h"
 
 /*
  * If C++, prevent name mangling so that the compiler emits a binary file having
@@ -28,6 +30,11 @@ extern "C" {
  */
 typedef int8_t (*ndarrayFcn)(struct ndarray* arrays[], void* data);
 
+/**
+ * Opaque structure for caching resolved ndarray functions.
+ */
+struct ndarrayFunctionCache;
+
 /**
  * Structure for grouping ndarray function information.
  *
@@ -103,6 +110,19 @@ typedef int8_t (*ndarrayFcn)(struct ndarray* arrays[], void* data);
  * };
  * obj->data = data;
  *
+ * // Without a type signature lookup table, dispatch uses a linear search:
+ * obj->lookup = NULL;
+ * obj->nlookup = 0;
+ *
+ * // Apply functions directly (i.e., without dimension-specialized kernels) and
+ * // without caching resolved functions:
+ * obj->dispatch = NULL;
+ * obj->cache = NULL;
+ *
+ * // Without alternative implementations for specific CPU features:
+ * obj->variants = NULL;
+ * obj->features = NULL;
+ *
  * // Free allocated memory:
  * free(obj);
  */
@@ -135,6 +155,34 @@ struct ndarrayFunctionObject {
   // should be passed to a respective ndarray function (note: the number of
   // pointers should match the number of ndarray functions):
   void** data;
+
+  // Open-addressing hash table mapping type signatures to function indices,
+  // where empty slots are `-1` (note: if `NULL`, dispatch falls back to a
+  // linear search over `types`):
+  int32_t* lookup;
+
+  // Number of hash table slots (a power of two):
+  int32_t nlookup;
+
+  // Array of unary dispatch objects (one per ndarray function) for selecting
+  // kernels specialized for the dimensionality and memory layout of ndarray
+  // arguments (note: if `NULL`, or if an element is `NULL`, the corresponding
+  // ndarray function is applied directly):
+  const struct ndarrayUnaryDispatchObject** dispatch;
+
+  // Inline cache of resolved kernels (note: if `NULL`, kernels are resolved on
+  // every call to `ndarray_function_apply`):
+  struct ndarrayFunctionCache* cache;
+
+  // Array of ndarray function implementations selected for the running CPU
+  // (one per ndarray function; note: if `NULL`, no alternative implementations
+  // have been registered):
+  ndarrayFcn* variants;
+
+  // Array of CPU features (bit masks) required by the selected ndarray function
+  // implementations, where `0` indicates that the corresponding ndarray
+  // function in `functions` is selected:
+  int64_t* features;
 };
 
 /**
@@ -158,6 +206,41 @@ int64_t ndarray_function_dispatch_index_of(
     const struct ndarrayFunctionObject* obj, const int32_t* types
 );
 
+/**
+ * Applies an ndarray function to provided ndarrays, resolving a kernel based on
+ * the ndarray data types, dimensionality, and memory layout.
+ */
+int8_t ndarray_function_apply(
+    struct ndarrayFunctionObject* obj, struct ndarray* arrays[]
+);
+
+/**
+ * Registers an alternative ndarray function implementation requiring specific
+ * CPU features.
+ */
+int8_t ndarray_function_register_variant(
+    struct ndarrayFunctionObject* obj, const int64_t idx,
+    const int64_t features, ndarrayFcn fcn
+);
+
+/**
+ * Returns the index of the least costly function whose signature can be
+ * satisfied by a provided list of array types when casting is allowed.
+ */
+int64_t ndarray_function_resolve_index_of(
+    const struct ndarrayFunctionObject* obj, const int32_t* types,
+    const enum NDARRAY_CASTING_MODE casting
+);
+
+/**
+ * Applies an ndarray function to provided ndarrays, converting ndarrays whose
+ * data types do not match any function signature.
+ */
+int8_t ndarray_function_apply_casting(
+    struct ndarrayFunctionObject* obj, struct ndarray* arrays[],
+    const enum NDARRAY_CASTING_MODE casting
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_GEMM_H
+#define NDARRAY_BASE_GEMM_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Computes the matrix-matrix product `C = alpha*A*B + beta*C` for
+ * two-dimensional floating-point ndarrays.
+ */
+int8_t ndarray_gemm(
+    const double alpha, const struct ndarray* a, const struct ndarray* b,
+    const double beta, int32_t nthreads, struct ndarray* c
+);
+
+/**
+ * Computes the matrix product of two ndarrays, treating the last two
+ * dimensions of each ndarray as matrices and broadcasting the remaining
+ * (leading) dimensions.
+ */
+int8_t ndarray_matmul(
+    const struct ndarray* a, const struct ndarray* b, int32_t nthreads,
+    struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_GEMM_H
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_HISTOGRAM_H
+#define NDARRAY_BASE_HISTOGRAM_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Computes the histogram of ndarray elements using equal-width bins spanning a
+ * specified range.
+ */
+int8_t ndarray_histogram(
+    const struct ndarray* x, const int64_t nbins, const double lo,
+    const double hi, int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Computes the histogram of ndarray elements using specified bin edges.
+ */
+int8_t ndarray_histogram_edges(
+    const struct ndarray* x, const struct ndarray* edges, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Counts the number of occurrences of each non-negative integer value in an
+ * ndarray.
+ */
+int8_t ndarray_bincount(
+    const struct ndarray* x, int32_t nthreads, struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_HISTOGRAM_H
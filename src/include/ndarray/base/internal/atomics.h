@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+/**
+ * Header file containing minimal atomic helpers shared by library internals.
+ *
+ * ## Notes
+ *
+ * -   The helpers wrap compiler intrinsics rather than `<stdatomic.h>`, as the
+ *     latter is not available on all of the toolchains used to build the
+ *     library (e.g., MSVC).
+ */
+#ifndef NDARRAY_BASE_INTERNAL_ATOMICS_H
+#define NDARRAY_BASE_INTERNAL_ATOMICS_H
+
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Atomically adds a value to a 64-bit integer and returns the previous value.
+ */
+static inline int64_t ndarray_internal_atomic_fetch_add(
+    volatile int64_t* ptr, const int64_t v
+) {
+#if defined(_MSC_VER)
+  return _InterlockedExchangeAdd64((volatile long long*)ptr, v);
+#else
+  return __atomic_fetch_add(ptr, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * Atomically loads a 64-bit integer.
+ */
+static inline int64_t ndarray_internal_atomic_load(volatile int64_t* ptr) {
+#if defined(_MSC_VER)
+  return _InterlockedOr64((volatile long long*)ptr, 0);
+#else
+  return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * Atomically stores a 64-bit integer.
+ */
+static inline void ndarray_internal_atomic_store(
+    volatile int64_t* ptr, const int64_t v
+) {
+#if defined(_MSC_VER)
+  _InterlockedExchange64((volatile long long*)ptr, v);
+#else
+  __atomic_store_n(ptr, v, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ * Atomically replaces a 64-bit integer with a desired value if the integer
+ * equals an expected value, returning `1` if the exchange succeeded and `0`
+ * otherwise.
+ */
+static inline int8_t ndarray_internal_atomic_compare_exchange(
+    volatile int64_t* ptr, int64_t expected, const int64_t desired
+) {
+#if defined(_MSC_VER)
+  return (int8_t)(
+      _InterlockedCompareExchange64(
+          (volatile long long*)ptr, desired, expected
+      ) == expected
+  );
+#else
+  return (int8_t)__atomic_compare_exchange_n(
+      ptr, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST
+  );
+#endif
+}
+
+/**
+ * Issues an acquire fence, such that memory reads preceding the fence are
+ * ordered before reads and writes following the fence.
+ *
+ * ## Notes
+ *
+ * -   For MSVC, interlocked intrinsics act as full memory barriers, so the
+ *     fence is implemented as an interlocked operation on a local variable.
+ */
+static inline void ndarray_internal_atomic_fence_acquire(void) {
+#if defined(_MSC_VER)
+  volatile long long barrier = 0;
+  _InterlockedOr64(&barrier, 0);
+#else
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * Issues a release fence, such that memory reads and writes preceding the
+ * fence are ordered before writes following the fence.
+ */
+static inline void ndarray_internal_atomic_fence_release(void) {
+#if defined(_MSC_VER)
+  volatile long long barrier = 0;
+  _InterlockedOr64(&barrier, 0);
+#else
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+}
+
+#endif  // !NDARRAY_BASE_INTERNAL_ATOMICS_H
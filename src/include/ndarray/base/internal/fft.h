@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+/**
+ * Header file exposing cached transform plans to library internals (e.g., for
+ * computing convolutions using transforms of contiguous buffers).
+ */
+#ifndef NDARRAY_BASE_INTERNAL_FFT_H
+#define NDARRAY_BASE_INTERNAL_FFT_H
+
+#include <stdint.h>
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Opaque structure describing a transform plan.
+ */
+struct ndarrayFFTPlan;
+
+/**
+ * Acquires a reference to a plan for real-input transforms of a specified
+ * length.
+ */
+struct ndarrayFFTPlan* ndarray_internal_fft_real_plan(
+    const int64_t n, const int8_t single
+);
+
+/**
+ * Releases a reference to a plan.
+ */
+void ndarray_internal_fft_release(struct ndarrayFFTPlan* plan);
+
+/**
+ * Returns the number of complex numbers of workspace required to execute a
+ * plan.
+ */
+int64_t ndarray_internal_fft_workspace(const struct ndarrayFFTPlan* plan);
+
+/**
+ * Computes a real-input transform (or its inverse) of a line stored in a
+ * contiguous buffer.
+ */
+void ndarray_internal_fft_real(
+    const struct ndarrayFFTPlan* plan, const int8_t inverse, uint8_t* buf,
+    uint8_t* work
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_INTERNAL_FFT_H
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_MEMORY_H
+#define NDARRAY_BASE_MEMORY_H
+
+#include <stdint.h>
+#include "ndarray/memory_categories.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Function pointer type for a callback invoked when the total number of bytes
+ * allocated by the library exceeds a threshold.
+ *
+ * @param bytes      total number of bytes currently allocated
+ * @param threshold  threshold which was exceeded
+ * @param ctx        user-provided context
+ */
+typedef void (*ndarrayMemoryHook)(
+    const int64_t bytes, const int64_t threshold, void* ctx
+);
+
+/**
+ * Structure containing memory accounting statistics for a single category.
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * struct ndarrayMemoryStats stats;
+ *
+ * int8_t status = ndarray_memory_stats(NDARRAY_MEMORY_TOTAL, &stats);
+ */
+struct ndarrayMemoryStats {
+  // Number of bytes currently allocated:
+  int64_t bytes;
+
+  // Maximum number of bytes allocated at any one time (since the last reset):
+  int64_t peak;
+
+  // Number of allocations:
+  int64_t allocations;
+
+  // Number of deallocations:
+  int64_t deallocations;
+};
+
+/**
+ * Returns memory accounting statistics for a specified category.
+ */
+int8_t ndarray_memory_stats(
+    const int8_t category, struct ndarrayMemoryStats* out
+);
+
+/**
+ * Returns the number of bytes currently allocated for a specified category.
+ */
+int64_t ndarray_memory_bytes(const int8_t category);
+
+/**
+ * Returns the peak number of bytes allocated for a specified category.
+ */
+int64_t ndarray_memory_peak_bytes(const int8_t category);
+
+/**
+ * Returns the number of allocations for a specified category.
+ */
+int64_t ndarray_memory_allocations(const int8_t category);
+
+/**
+ * Resets peak byte counts to the number of bytes currently allocated.
+ */
+void ndarray_memory_reset_peak(void);
+
+/**
+ * Sets a callback to invoke when the total number of bytes allocated by the
+ * library exceeds a threshold.
+ */
+void ndarray_memory_set_hook(
+    const int64_t threshold, ndarrayMemoryHook hook, void* ctx
+);
+
+/**
+ * Records an allocation in the memory accounting statistics.
+ */
+void ndarray_memory_record_allocation(
+    const int8_t category, const int64_t nbytes
+);
+
+/**
+ * Records a deallocation in the memory accounting statistics.
+ */
+void ndarray_memory_record_free(const int8_t category, const int64_t nbytes);
+
+/**
+ * Allocates memory and records the allocation.
+ */
+void* ndarray_memory_malloc(const int8_t category, const int64_t nbytes);
+
+/**
+ * Allocates zero-initialized memory and records the allocation.
+ */
+void* ndarray_memory_calloc(const int8_t category, const int64_t nbytes);
+
+/**
+ * Frees memory and records the deallocation.
+ */
+void ndarray_memory_free(
+    const int8_t category, void* ptr, const int64_t nbytes
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_MEMORY_H
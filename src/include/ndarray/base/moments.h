@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_MOMENTS_H
+#define NDARRAY_BASE_MOMENTS_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/moment_stats.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Structure containing accumulated moments of a sequence of values.
+ *
+ * ## Notes
+ *
+ * -   Moments are stored as sums of powers of deviations from the mean, such
+ *     that states computed for disjoint parts of a sequence (e.g., by separate
+ *     threads or for separate chunks of streamed data) can be merged without
+ *     loss of precision.
+ *
+ * @example
+ * #include "ndarray/base/moments.h"
+ *
+ * struct ndarrayMoments state;
+ *
+ * ndarray_moments_init(&state, 1);
+ */
+struct ndarrayMoments {
+  // Number of values:
+  int64_t count;
+
+  // Arithmetic mean:
+  double mean;
+
+  // Sum of squared deviations from the mean:
+  double m2;
+
+  // Sum of cubed deviations from the mean:
+  double m3;
+};
+
+/**
+ * Initializes accumulated moments.
+ */
+void ndarray_moments_init(struct ndarrayMoments* states, const int64_t n);
+
+/**
+ * Merges accumulated moments into another set of accumulated moments.
+ */
+void ndarray_moments_merge(
+    struct ndarrayMoments* state, const struct ndarrayMoments* other
+);
+
+/**
+ * Accumulates the moments of ndarray elements along one or more dimensions.
+ */
+int8_t ndarray_moments_update(
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    int32_t nthreads, struct ndarrayMoments* states
+);
+
+/**
+ * Computes a statistic from accumulated moments.
+ */
+double ndarray_moments_stat(
+    const struct ndarrayMoments* state, const enum NDARRAY_MOMENT_STAT stat,
+    const int64_t ddof
+);
+
+/**
+ * Assigns statistics computed from accumulated moments to an output ndarray.
+ */
+int8_t ndarray_moments_assign(
+    const struct ndarrayMoments* states, const enum NDARRAY_MOMENT_STAT stat,
+    const int64_t ddof, struct ndarray* out
+);
+
+/**
+ * Computes a statistic of ndarray elements along one or more dimensions.
+ */
+int8_t ndarray_moments(
+    const enum NDARRAY_MOMENT_STAT stat, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int64_t ddof,
+    int32_t nthreads, struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_MOMENTS_H
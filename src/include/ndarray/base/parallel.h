@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_PARALLEL_H
+#define NDARRAY_BASE_PARALLEL_H
+
+#include <stdint.h>
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Function pointer type for a parallel task.
+ *
+ * @param i    task index
+ * @param tid  index of the thread executing the task (`0 <= tid < nthreads`)
+ * @param ctx  task context
+ */
+typedef void (*ndarrayParallelFcn)(int64_t i, int32_t tid, void* ctx);
+
+/**
+ * Returns the default number of threads used by parallel ndarray functions.
+ */
+int32_t ndarray_parallel_num_threads(void);
+
+/**
+ * Executes a number of independent tasks using a specified number of threads.
+ */
+int8_t ndarray_parallel_for(
+    int64_t n, int32_t nthreads, ndarrayParallelFcn fcn, void* ctx
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_PARALLEL_H
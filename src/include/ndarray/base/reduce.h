@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_REDUCE_H
+#define NDARRAY_BASE_REDUCE_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/reduce_ops.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the default accumulator data type for reducing ndarray elements.
+ */
+int16_t ndarray_reduce_dtype(
+    const enum NDARRAY_REDUCE_OP op, const int16_t dtype
+);
+
+/**
+ * Resolves the shape of an ndarray reduced along one or more dimensions.
+ */
+int64_t ndarray_reduce_shape(
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    const int8_t keepdims, int64_t* out
+);
+
+/**
+ * Reduces the elements of an input ndarray along one or more dimensions.
+ */
+int8_t ndarray_reduce(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int8_t keepdims,
+    const int16_t acc, struct ndarray* out
+);
+
+/**
+ * Reduces the elements of an input ndarray along one or more dimensions using
+ * multiple threads, such that results do not depend on the number of threads.
+ */
+int8_t ndarray_reduce_parallel(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int8_t keepdims,
+    const int16_t acc, int32_t nthreads, struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_REDUCE_H
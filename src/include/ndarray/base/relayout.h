@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_RELAYOUT_H
+#define NDARRAY_BASE_RELAYOUT_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/orders.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Converts a contiguous ndarray to a specified memory layout in-place.
+ */
+int8_t ndarray_relayout(struct ndarray* arr, const enum NDARRAY_ORDER order);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_RELAYOUT_H
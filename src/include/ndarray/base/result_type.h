@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_RESULT_TYPE_H
+#define NDARRAY_BASE_RESULT_TYPE_H
+
+#include <stdint.h>
+
+/**
+ * If C++, prevent name mangling so that the compiler emits a binary file
+ * having undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the smallest data type to which a list of data types can be safely
+ * cast.
+ */
+int32_t ndarray_result_type(const int32_t N, const int32_t* types);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_RESULT_TYPE_H
@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_SCAN_H
+#define NDARRAY_BASE_SCAN_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/reduce_ops.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Computes the cumulative sum, product, minimum, or maximum of ndarray elements
+ * along a specified dimension.
+ */
+int8_t ndarray_scan(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t axis, int32_t nthreads, struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_SCAN_H
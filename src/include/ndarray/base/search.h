@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_SEARCH_H
+#define NDARRAY_BASE_SEARCH_H
+
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/nan_policies.h"
+#include "ndarray/predicates.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the linear view index of the first minimum value of an ndarray.
+ */
+int8_t ndarray_argmin(
+    const struct ndarray* x, const enum NDARRAY_NAN_POLICY policy, int64_t* out
+);
+
+/**
+ * Returns the linear view index of the first maximum value of an ndarray.
+ */
+int8_t ndarray_argmax(
+    const struct ndarray* x, const enum NDARRAY_NAN_POLICY policy, int64_t* out
+);
+
+/**
+ * Tests whether at least one ndarray element satisfies a predicate.
+ */
+int8_t ndarray_any(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int8_t* out
+);
+
+/**
+ * Tests whether all ndarray elements satisfy a predicate.
+ */
+int8_t ndarray_all(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int8_t* out
+);
+
+/**
+ * Counts the number of ndarray elements which satisfy a predicate.
+ */
+int8_t ndarray_count(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int64_t* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_SEARCH_H
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_SORT_H
+#define NDARRAY_BASE_SORT_H
+
+#include <stdint.h>
+#include "ndarray.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sorts ndarray elements along a specified dimension.
+ */
+int8_t ndarray_sort(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Computes the indices which would sort ndarray elements along a specified
+ * dimension.
+ */
+int8_t ndarray_argsort(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+);
+
+/**
+ * Partially sorts ndarray elements along a specified dimension, such that the
+ * element at a specified position is in its sorted position.
+ */
+int8_t ndarray_partition(
+    const struct ndarray* x, const int64_t kth, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Computes the indices which would partially sort ndarray elements along a
+ * specified dimension.
+ */
+int8_t ndarray_argpartition(
+    const struct ndarray* x, const int64_t kth, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Selects the `k` smallest (or largest) ndarray elements along a specified
+ * dimension.
+ */
+int8_t ndarray_topk(
+    const struct ndarray* x, const int64_t k, const int64_t axis,
+    const int8_t largest, int32_t nthreads, struct ndarray* values,
+    struct ndarray* indices
+);
+
+/**
+ * Computes the quantile of ndarray elements along a specified dimension.
+ */
+int8_t ndarray_quantile(
+    const struct ndarray* x, const double q, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+);
+
+/**
+ * Computes the percentile of ndarray elements along a specified dimension.
+ */
+int8_t ndarray_percentile(
+    const struct ndarray* x, const double p, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_SORT_H
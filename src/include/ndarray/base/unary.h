@@ -12,9 +12,10 @@
 #ifndef NDARRAY_BASE_UNARY_H
 #define NDARRAY_BASE_UNARY_H
 
+#include "unary/constants.h"
 #include "unary/dispatch.h"
 #include "unary/dispatch_object.h"
-#include "unary/macros.h"
+#include "unary/loops.h"
 #include "unary/typedefs.h"
 
 /*
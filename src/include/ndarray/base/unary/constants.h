@@ -5,8 +5,8 @@
  * that can be found in the LICENSE file.
  */
 
-#ifndef NDARRAY_BASE_UNARY_MACROS_CONSTANTS_H
-#define NDARRAY_BASE_UNARY_MACROS_CONSTANTS_H
+#ifndef NDARRAY_BASE_UNARY_CONSTANTS_H
+#define NDARRAY_BASE_UNARY_CONSTANTS_H
 
 // Define a default block size in units of bytes (Note: 64b is a common cache
 // line size. How applicable the common cache line size is here is debatable,
@@ -25,4 +25,4 @@
 // per element; i.e., default element size is same as a double):
 #define NDARRAY_UNARY_BLOCK_SIZE_IN_ELEMENTS 8
 
-#endif  // !NDARRAY_BASE_UNARY_MACROS_CONSTANTS_H
+#endif  // !NDARRAY_BASE_UNARY_CONSTANTS_H
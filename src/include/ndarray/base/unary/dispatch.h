@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include "ndarray.h"
 #include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/base/unary/typedefs.h"
 
 /*
  * If C++, prevent name mangling so that the compiler emits a binary file having
@@ -20,6 +21,23 @@
 extern "C" {
 #endif
 
+/**
+ * Selects a unary ndarray function according to the dimensionality and memory
+ * layout of provided ndarray arguments.
+ */
+ndarrayUnaryFcn ndarray_unary_dispatch_select(
+    const struct ndarrayUnaryDispatchObject* obj, struct ndarray* arrays[],
+    int8_t* linear
+);
+
+/**
+ * Applies a one-dimensional unary ndarray function to one-dimensional views of
+ * contiguous ndarrays having the same memory layout.
+ */
+int8_t ndarray_unary_dispatch_linear(
+    ndarrayUnaryFcn f, struct ndarray* arrays[], void* fcn
+);
+
 /**
  * Dispatches to a unary ndarray function according to the dimensionality of
  * provided ndarray arguments.
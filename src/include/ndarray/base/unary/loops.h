@@ -0,0 +1,34 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_UNARY_LOOPS_H
+#define NDARRAY_BASE_UNARY_LOOPS_H
+
+#include <stdint.h>
+#include "ndarray/base/unary/dispatch_object.h"
+
+/*
+ * If C++, prevent name mangling so that the compiler emits a binary file having
+ * undecorated names, thus mirroring the behavior of a C compiler.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns a unary dispatch object for applying a callback to ndarrays having a
+ * specified data type.
+ */
+const struct ndarrayUnaryDispatchObject* ndarray_unary_clbk_dispatch_object(
+    const int16_t dtype
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // !NDARRAY_BASE_UNARY_LOOPS_H
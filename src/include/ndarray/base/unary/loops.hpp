@@ -0,0 +1,553 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_BASE_UNARY_LOOPS_HPP
+#define NDARRAY_BASE_UNARY_LOOPS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "ndarray.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/unary/constants.h"
+#include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/base/unary/typedefs.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/orders.h"
+
+/**
+ * Compile-time generator for unary ndarray loops.
+ *
+ * ## Notes
+ *
+ * -   Loop nests are generated by template recursion on the loop level, such
+ *     that each rank is a separate instantiation having a fixed number of
+ *     fully unrolled loops, and each element operation is a separate
+ *     instantiation having a known element type for each ndarray argument.
+ * -   An element operation `Op` must provide:
+ *
+ *     -   `Op::types`: a `std::tuple` of ndarray element types (one input type
+ *         followed by either one or two output types).
+ *     -   `Op(void* data)`: a constructor accepting the `data` argument of an
+ *         `ndarrayUnaryFcn` (e.g., a callback).
+ *     -   `TOut operator()(const TIn& x) const` for one output, or
+ *         `void operator()(const TIn& x, TOut1& y1, TOut2& y2) const` for two
+ *         outputs.
+ *
+ * -   Every loop nest funnels through `nd::unary::inner_loop<Op>`, which
+ *     operations may specialize in order to provide vectorized innermost
+ *     loops. Simple loops resolve whether all ndarrays are contiguous along
+ *     the innermost dimension once per call, such that each nest is
+ *     instantiated with either the contiguous or the strided innermost loop.
+ *     Blocked loops always use the strided innermost loop, as blocking only
+ *     applies when ndarray layouts differ.
+ * -   Simple loops iterate in the memory order of the input ndarray, and
+ *     blocked loops sort dimensions by increasing input stride magnitude and
+ *     iterate over blocks spanning `NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES` along
+ *     each dimension.
+ *
+ * @example
+ * #include "ndarray/base/unary/loops.hpp"
+ * #include <tuple>
+ *
+ * struct square {
+ *   using types = std::tuple<double, double>;
+ *   explicit square(void*) {}
+ *   double operator()(const double x) const { return x * x; }
+ * };
+ *
+ * const struct ndarrayUnaryDispatchObject* obj =
+ *     &nd::unary::dispatch<square>::object;
+ */
+namespace nd {
+namespace unary {
+
+// Define the maximum number of dimensions for which to generate loop nests:
+inline constexpr std::size_t max_rank = 10;
+
+/**
+ * Element operation which invokes a callback and casts arguments and return
+ * values.
+ */
+template <
+    typename TIn, typename TOut, typename FIn = TIn, typename FOut = TOut>
+struct clbk {
+  using types    = std::tuple<TIn, TOut>;
+  using fcn_type = FOut (*)(FIn);
+
+  explicit clbk(void* data) : f(reinterpret_cast<fcn_type>(data)) {}
+  TOut operator()(const TIn& x) const {
+    return static_cast<TOut>(f(static_cast<FIn>(x)));
+  }
+
+  fcn_type f;
+};
+
+namespace detail {
+
+template <typename Op>
+inline constexpr std::size_t narrays = std::tuple_size_v<typename Op::types>;
+
+template <std::size_t K, typename Op>
+using element_t = std::tuple_element_t<K, typename Op::types>;
+
+template <typename Op>
+using pointers = std::array<uint8_t*, narrays<Op>>;
+
+template <typename Op>
+using increments = std::array<int64_t, narrays<Op>>;
+
+template <typename Op>
+using indices = std::make_index_sequence<narrays<Op>>;
+
+/**
+ * Applies an element operation to the `i`th elements of typed arrays.
+ */
+template <typename Op>
+inline void apply(const Op& op, const pointers<Op>& p, const int64_t i) {
+  static_assert(
+      narrays<Op> == 2 || narrays<Op> == 3,
+      "element operations must have one input and one or two outputs"
+  );
+  using TIn = element_t<0, Op>;
+
+  const TIn& x = reinterpret_cast<const TIn*>(p[0])[i];
+  if constexpr (narrays<Op> == 2) {
+    reinterpret_cast<element_t<1, Op>*>(p[1])[i] = op(x);
+  } else {
+    op(x, reinterpret_cast<element_t<1, Op>*>(p[1])[i],
+       reinterpret_cast<element_t<2, Op>*>(p[2])[i]);
+  }
+}
+
+/**
+ * Tests whether pointer increments correspond to contiguous elements.
+ */
+template <typename Op, std::size_t... K>
+inline bool is_contiguous(const increments<Op>& d, std::index_sequence<K...>) {
+  return ((d[K] == static_cast<int64_t>(sizeof(element_t<K, Op>))) && ...);
+}
+
+/**
+ * Returns the size (in bytes) of the largest element type.
+ */
+template <typename Op, std::size_t... K>
+constexpr std::size_t max_bytes(std::index_sequence<K...>) {
+  std::size_t n = 0;
+  ((n = (sizeof(element_t<K, Op>) > n) ? sizeof(element_t<K, Op>) : n), ...);
+  return n;
+}
+
+}  // namespace detail
+
+/**
+ * Default innermost loops.
+ *
+ * ## Notes
+ *
+ * -   The contiguous loop indexes typed pointers, such that the compiler may
+ *     vectorize inlined element operations. The strided loop increments byte
+ *     pointers.
+ * -   Specializations of `inner_loop` may derive from this type in order to
+ *     only override one of the loops.
+ */
+template <typename Op>
+struct default_inner_loop {
+  /**
+   * Applies an element operation to `n` contiguous elements.
+   */
+  static void contiguous(
+      const Op& op, const detail::pointers<Op>& p, const int64_t n
+  ) {
+    using TIn  = detail::element_t<0, Op>;
+    using TOut = detail::element_t<1, Op>;
+
+    int64_t i;
+
+    if constexpr (detail::narrays<Op> == 2) {
+      const TIn* x = reinterpret_cast<const TIn*>(p[0]);
+      TOut* y      = reinterpret_cast<TOut*>(p[1]);
+      for (i = 0; i < n; i++) {
+        y[i] = op(x[i]);
+      }
+    } else {
+      for (i = 0; i < n; i++) {
+        detail::apply(op, p, i);
+      }
+    }
+  }
+
+  /**
+   * Applies an element operation to `n` strided elements, advancing the
+   * pointers past the last visited elements.
+   */
+  static void strided(
+      const Op& op, detail::pointers<Op>& p, const detail::increments<Op>& d,
+      const int64_t n
+  ) {
+    using TIn  = detail::element_t<0, Op>;
+    using TOut = detail::element_t<1, Op>;
+
+    std::size_t k;
+    int64_t i;
+
+    if constexpr (detail::narrays<Op> == 2) {
+      uint8_t* px1       = p[0];
+      uint8_t* px2       = p[1];
+      const int64_t d0x1 = d[0];
+      const int64_t d0x2 = d[1];
+      for (i = 0; i < n; i++, px1 += d0x1, px2 += d0x2) {
+        *reinterpret_cast<TOut*>(px2) = op(*reinterpret_cast<const TIn*>(px1));
+      }
+      p[0] = px1;
+      p[1] = px2;
+    } else {
+      for (i = 0; i < n; i++) {
+        detail::apply(op, p, 0);
+        for (k = 0; k < detail::narrays<Op>; k++) {
+          p[k] += d[k];  // pointer arithmetic
+        }
+      }
+    }
+  }
+};
+
+/**
+ * Innermost loops (specialize for an element operation to provide vectorized
+ * implementations).
+ */
+template <typename Op, typename = void>
+struct inner_loop : default_inner_loop<Op> {};
+
+namespace detail {
+
+/**
+ * Generates a loop nest over levels `L, L-1, ..., 0` (level `0` being the
+ * innermost loop), where `C` indicates whether the innermost loop visits
+ * contiguous elements.
+ *
+ * ## Notes
+ *
+ * -   Pointers are advanced in place, such that, upon return, each pointer has
+ *     moved `shape[L]` steps along level `L`. Each level only adds the
+ *     difference between its stride and the extent of the level beneath it,
+ *     which keeps a single pointer per ndarray live across the nest.
+ */
+template <std::size_t L, bool C, typename Op, std::size_t N>
+inline void nest(
+    const Op& op, pointers<Op>& p, const std::array<int64_t, N>& shape,
+    const std::array<increments<Op>, N>& s
+) {
+  increments<Op> d;
+  std::size_t k;
+  int64_t i;
+
+  if constexpr (L == 0) {
+    if constexpr (C) {
+      inner_loop<Op>::contiguous(op, p, shape[0]);
+      for (k = 0; k < narrays<Op>; k++) {
+        p[k] += shape[0] * s[0][k];  // pointer arithmetic
+      }
+    } else {
+      inner_loop<Op>::strided(op, p, s[0], shape[0]);
+    }
+  } else {
+    for (k = 0; k < narrays<Op>; k++) {
+      d[k] = s[L][k] - (shape[L - 1] * s[L - 1][k]);
+    }
+    for (i = 0; i < shape[L]; i++) {
+      nest<L - 1, C>(op, p, shape, s);
+      for (k = 0; k < narrays<Op>; k++) {
+        p[k] += d[k];  // pointer arithmetic
+      }
+    }
+  }
+}
+
+/**
+ * Generates a loop nest over blocks along levels `L, L-1, ..., 0`, storing the
+ * first index and the extent of the current block along each level in
+ * `start` and `ext` before generating the loop nest within that block.
+ *
+ * ## Notes
+ *
+ * -   Blocks are visited in reverse order, such that the remaining extent
+ *     along a level doubles as the loop counter.
+ * -   Pointers to the first elements of a block are computed from the base
+ *     pointers rather than carried across levels, which keeps the innermost
+ *     loop free of register spills.
+ */
+template <std::size_t L, typename Op, std::size_t N>
+inline void blocks(
+    const Op& op, const pointers<Op>& p, const std::array<int64_t, N>& shape,
+    const std::array<increments<Op>, N>& s, const int64_t bsize,
+    std::array<int64_t, N>& start, std::array<int64_t, N>& ext
+) {
+  pointers<Op> q;
+  std::size_t k;
+  std::size_t l;
+  int64_t j;
+
+  for (j = shape[L]; j > 0;) {
+    if (j < bsize) {
+      ext[L] = j;
+      j      = 0;
+    } else {
+      ext[L] = bsize;
+      j -= bsize;
+    }
+    start[L] = j;
+    if constexpr (L == 0) {
+      for (k = 0; k < narrays<Op>; k++) {
+        q[k] = p[k];
+        for (l = 0; l < N; l++) {
+          q[k] += start[l] * s[l][k];  // pointer arithmetic
+        }
+      }
+      nest<N - 1, false>(op, q, ext, s);
+    } else {
+      blocks<L - 1>(op, p, shape, s, bsize, start, ext);
+    }
+  }
+}
+
+/**
+ * Resolves pointers to the first indexed elements, permutes the shape and
+ * strides according to a loop order (innermost loop first), and returns a
+ * boolean indicating whether the innermost loop visits contiguous elements.
+ *
+ * ## Notes
+ *
+ * -   Outer levels which continue the innermost level in every ndarray are
+ *     merged into the innermost level (leaving singleton levels behind), such
+ *     that, e.g., contiguous ndarrays are traversed using a single loop.
+ */
+template <typename Op, std::size_t N>
+inline bool setup(
+    struct ndarray* arrays[], const std::array<std::size_t, N>& perm,
+    pointers<Op>& p, std::array<int64_t, N>& shape,
+    std::array<increments<Op>, N>& s
+) {
+  std::size_t k;
+  std::size_t l;
+
+  for (k = 0; k < narrays<Op>; k++) {
+    p[k] = arrays[k]->data + arrays[k]->offset;  // pointer arithmetic
+  }
+  for (l = 0; l < N; l++) {
+    shape[l] = arrays[0]->shape[perm[l]];
+    for (k = 0; k < narrays<Op>; k++) {
+      s[l][k] = arrays[k]->strides[perm[l]];
+    }
+  }
+  for (l = 1; l < N; l++) {
+    for (k = 0; k < narrays<Op>; k++) {
+      if (s[l][k] != shape[0] * s[0][k]) {
+        break;
+      }
+    }
+    if (k < narrays<Op>) {
+      break;
+    }
+    shape[0] *= shape[l];
+    shape[l] = 1;
+  }
+  if constexpr (N == 0) {
+    return false;
+  } else {
+    return is_contiguous<Op>(s[0], indices<Op>());
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Applies an element operation to `N`-dimensional ndarrays using simple nested
+ * loops.
+ */
+template <std::size_t N, typename Op>
+int8_t loop(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  std::array<detail::increments<Op>, N> s;
+  std::array<std::size_t, N> perm;
+  std::array<int64_t, N> shape;
+  detail::pointers<Op> p;
+  std::size_t l;
+
+  for (l = 0; l < N; l++) {
+    // For row-major ndarrays, the last dimensions have the fastest changing
+    // indices...
+    perm[l] = (arrays[0]->order == NDARRAY_ROW_MAJOR) ? N - 1 - l : l;
+  }
+  if constexpr (N == 0) {
+    detail::setup<Op>(arrays, perm, p, shape, s);
+    detail::apply(op, p, 0);
+  } else if (detail::setup<Op>(arrays, perm, p, shape, s)) {
+    detail::nest<N - 1, true>(op, p, shape, s);
+  } else {
+    detail::nest<N - 1, false>(op, p, shape, s);
+  }
+  return 0;
+}
+
+/**
+ * Applies an element operation to `N`-dimensional ndarrays using loop
+ * blocking.
+ */
+template <std::size_t N, typename Op>
+int8_t blocked(struct ndarray* arrays[], void* data) {
+  static_assert(N >= 2, "blocked loops require at least two dimensions");
+  constexpr int64_t bsize = static_cast<int64_t>(
+      NDARRAY_UNARY_BLOCK_SIZE_IN_BYTES /
+      detail::max_bytes<Op>(detail::indices<Op>())
+  );
+  const Op op(data);
+  std::array<detail::increments<Op>, N> s;
+  std::array<std::size_t, N> perm;
+  std::array<int64_t, N> shape;
+  std::array<int64_t, N> start;
+  std::array<int64_t, N> ext;
+  std::array<int64_t, N> key;
+  detail::pointers<Op> p;
+  std::size_t i;
+  std::size_t j;
+
+  // Sort the dimensions by increasing input stride magnitude:
+  for (i = 0; i < N; i++) {
+    key[i] = arrays[0]->strides[i];
+    key[i] = (key[i] < 0) ? -key[i] : key[i];
+    for (j = i; j > 0 && key[perm[j - 1]] > key[i]; j--) {
+      perm[j] = perm[j - 1];
+    }
+    perm[j] = i;
+  }
+  detail::setup<Op>(arrays, perm, p, shape, s);
+  detail::blocks<N - 1>(
+      op, p, shape, s, (bsize > 1) ? bsize : 1, start, ext
+  );
+  return 0;
+}
+
+/**
+ * Applies an element operation to ndarrays having an arbitrary number of
+ * dimensions.
+ */
+template <typename Op>
+int8_t loop_nd(struct ndarray* arrays[], void* data) {
+  const Op op(data);
+  const int64_t ndims = arrays[0]->ndims;
+  const int64_t* shape = arrays[0]->shape;
+  detail::increments<Op> d;
+  detail::pointers<Op> p;
+  detail::pointers<Op> q;
+  std::size_t nbytes;
+  bool contiguous;
+  std::size_t k;
+  int64_t* sub;
+  int64_t inner;
+  int64_t i;
+  int64_t j;
+
+  for (k = 0; k < detail::narrays<Op>; k++) {
+    p[k] = arrays[k]->data + arrays[k]->offset;  // pointer arithmetic
+  }
+  if (ndims == 0) {
+    detail::apply(op, p, 0);
+    return 0;
+  }
+  for (i = 0; i < ndims; i++) {
+    if (shape[i] == 0) {
+      return 0;
+    }
+  }
+  nbytes = sizeof(int64_t) * static_cast<std::size_t>(ndims);
+  sub    = static_cast<int64_t*>(
+      ndarray_memory_calloc(NDARRAY_MEMORY_SCRATCH, nbytes)
+  );
+  if (sub == nullptr) {
+    return -1;
+  }
+  inner = (arrays[0]->order == NDARRAY_ROW_MAJOR) ? ndims - 1 : 0;
+  for (k = 0; k < detail::narrays<Op>; k++) {
+    d[k] = arrays[k]->strides[inner];
+  }
+  contiguous = detail::is_contiguous<Op>(d, detail::indices<Op>());
+  do {
+    if (contiguous) {
+      inner_loop<Op>::contiguous(op, p, shape[inner]);
+    } else {
+      q = p;
+      inner_loop<Op>::strided(op, q, d, shape[inner]);
+    }
+
+    // Advance the subscripts of the outer dimensions in memory order...
+    for (j = 1; j < ndims; j++) {
+      i = (inner == 0) ? j : ndims - 1 - j;
+      sub[i] += 1;
+      for (k = 0; k < detail::narrays<Op>; k++) {
+        p[k] += arrays[k]->strides[i];  // pointer arithmetic
+      }
+      if (sub[i] < shape[i]) {
+        break;
+      }
+      for (k = 0; k < detail::narrays<Op>; k++) {
+        p[k] -= arrays[k]->strides[i] * shape[i];  // pointer arithmetic
+      }
+      sub[i] = 0;
+    }
+  } while (j < ndims);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, sub, nbytes);
+  return 0;
+}
+
+namespace detail {
+
+template <typename Op, std::size_t... N>
+constexpr std::array<ndarrayUnaryFcn, sizeof...(N) + 1> functions(
+    std::index_sequence<N...>
+) {
+  return {{&loop<N, Op>..., &loop_nd<Op>}};
+}
+
+template <typename Op, std::size_t... N>
+constexpr std::array<ndarrayUnaryFcn, sizeof...(N)> blocked_functions(
+    std::index_sequence<N...>
+) {
+  return {{&blocked<N + 2, Op>...}};
+}
+
+}  // namespace detail
+
+/**
+ * Dispatch tables for an element operation (i.e., the loops for ranks `0`
+ * through `max_rank`, an n-dimensional loop, and blocked loops for ranks `2`
+ * through `max_rank`).
+ */
+template <typename Op>
+struct dispatch {
+  inline static std::array<ndarrayUnaryFcn, max_rank + 2> functions =
+      detail::functions<Op>(std::make_index_sequence<max_rank + 1>());
+
+  inline static std::array<ndarrayUnaryFcn, max_rank - 1> blocked_functions =
+      detail::blocked_functions<Op>(std::make_index_sequence<max_rank - 1>());
+
+  inline static const struct ndarrayUnaryDispatchObject object = {
+      functions.data(),
+      static_cast<int32_t>(functions.size()),
+      blocked_functions.data(),
+      static_cast<int32_t>(blocked_functions.size()),
+  };
+};
+
+}  // namespace unary
+}  // namespace nd
+
+#endif  // !NDARRAY_BASE_UNARY_LOOPS_HPP
@@ -1,33 +0,0 @@
-/**
- * Copyright (c) 2023, the ndarray project authors. Please see
- * the CONTRIBUTORS file for details. All rights reserved. Use
- * of this source code is governed by a MIT-style license
- * that can be found in the LICENSE file.
- */
-
-#ifndef NDARRAY_BASE_UNARY_MACROS_H
-#define NDARRAY_BASE_UNARY_MACROS_H
-
-#include "ndarray/base/unary/macros/10d.h"
-#include "ndarray/base/unary/macros/10d_blocked.h"
-#include "ndarray/base/unary/macros/1d.h"
-#include "ndarray/base/unary/macros/2d.h"
-#include "ndarray/base/unary/macros/2d_blocked.h"
-#include "ndarray/base/unary/macros/3d.h"
-#include "ndarray/base/unary/macros/3d_blocked.h"
-#include "ndarray/base/unary/macros/4d.h"
-#include "ndarray/base/unary/macros/4d_blocked.h"
-#include "ndarray/base/unary/macros/5d.h"
-#include "ndarray/base/unary/macros/5d_blocked.h"
-#include "ndarray/base/unary/macros/6d.h"
-#include "ndarray/base/unary/macros/6d_blocked.h"
-#include "ndarray/base/unary/macros/7d.h"
-#include "ndarray/base/unary/macros/7d_blocked.h"
-#include "ndarray/base/unary/macros/8d.h"
-#include "ndarray/base/unary/macros/8d_blocked.h"
-#include "ndarray/base/unary/macros/9d.h"
-#include "ndarray/base/unary/macros/9d_blocked.h"
-#include "ndarray/base/unary/macros/constants.h"
-#include "ndarray/base/unary/macros/nd.h"
-
-#endif  // !NDARRAY_BASE_UNARY_MACROS_H
\ No newline at end of file
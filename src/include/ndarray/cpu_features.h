@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_CPU_FEATURES_H
+#define NDARRAY_CPU_FEATURES_H
+
+/**
+ * Enumeration of CPU features used when selecting ndarray function
+ * implementations (note: features are bit flags, which are ordered such that
+ * newer instruction set extensions have larger values).
+ */
+enum NDARRAY_CPU_FEATURE {
+  // x86 instruction set extensions:
+  NDARRAY_CPU_SSE2     = 1 << 0,
+  NDARRAY_CPU_SSE41    = 1 << 1,
+  NDARRAY_CPU_SSE42    = 1 << 2,
+  NDARRAY_CPU_AVX      = 1 << 3,
+  NDARRAY_CPU_AVX2     = 1 << 4,
+  NDARRAY_CPU_FMA      = 1 << 5,
+  NDARRAY_CPU_AVX512F  = 1 << 6,
+  NDARRAY_CPU_AVX512DQ = 1 << 7,
+  NDARRAY_CPU_AVX512BW = 1 << 8,
+  NDARRAY_CPU_AVX512VL = 1 << 9,
+
+  // ARM instruction set extensions:
+  NDARRAY_CPU_NEON     = 1 << 16
+};
+
+#endif  // !NDARRAY_CPU_FEATURES_H
@@ -0,0 +1,29 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_MEMORY_CATEGORIES_H
+#define NDARRAY_MEMORY_CATEGORIES_H
+
+/**
+ * Enumeration of categories used when accounting for memory allocated by the
+ * library.
+ */
+enum NDARRAY_MEMORY_CATEGORY {
+  // ndarray and ndarray function object structures (i.e., meta data):
+  NDARRAY_MEMORY_HEADER  = 0,
+
+  // ndarray data buffers:
+  NDARRAY_MEMORY_DATA    = 1,
+
+  // Temporary workspace used internally by ndarray functions:
+  NDARRAY_MEMORY_SCRATCH = 2,
+
+  // Sum over all categories (note: this must always be the last member):
+  NDARRAY_MEMORY_TOTAL   = 3
+};
+
+#endif  // !NDARRAY_MEMORY_CATEGORIES_H
@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_MOMENT_STATS_H
+#define NDARRAY_MOMENT_STATS_H
+
+/**
+ * Enumeration of statistics computed from accumulated moments.
+ */
+enum NDARRAY_MOMENT_STAT {
+  // Arithmetic mean:
+  NDARRAY_MOMENT_MEAN = 0,
+
+  // Variance (note: the denominator is the number of elements minus a
+  // specified delta degrees of freedom):
+  NDARRAY_MOMENT_VARIANCE = 1,
+
+  // Standard deviation (i.e., the square root of the variance):
+  NDARRAY_MOMENT_STDEV = 2,
+
+  // Sample skewness (i.e., the Fisher-Pearson coefficient of skewness, which
+  // is not corrected for statistical bias):
+  NDARRAY_MOMENT_SKEWNESS = 3
+};
+
+#endif  // !NDARRAY_MOMENT_STATS_H
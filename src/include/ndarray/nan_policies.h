@@ -0,0 +1,23 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_NAN_POLICIES_H
+#define NDARRAY_NAN_POLICIES_H
+
+/**
+ * Enumeration of policies for handling `NaN` values when searching ndarray
+ * elements.
+ */
+enum NDARRAY_NAN_POLICY {
+  // Treat `NaN` as the result (i.e., return the first `NaN`):
+  NDARRAY_NAN_PROPAGATE = 0,
+
+  // Ignore `NaN` values:
+  NDARRAY_NAN_OMIT = 1
+};
+
+#endif  // !NDARRAY_NAN_POLICIES_H
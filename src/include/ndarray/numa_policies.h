@@ -0,0 +1,26 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_NUMA_POLICIES_H
+#define NDARRAY_NUMA_POLICIES_H
+
+/**
+ * Enumeration of NUMA memory placement policies for ndarray data buffers.
+ */
+enum NDARRAY_NUMA_POLICY {
+  // Use the operating system's default placement (i.e., pages are placed on the
+  // node of the thread which first touches them):
+  NDARRAY_NUMA_DEFAULT    = 0,
+
+  // Place all pages on a single specified node:
+  NDARRAY_NUMA_BIND       = 1,
+
+  // Interleave pages across all nodes in a round-robin fashion:
+  NDARRAY_NUMA_INTERLEAVE = 2
+};
+
+#endif  // !NDARRAY_NUMA_POLICIES_H
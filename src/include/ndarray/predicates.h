@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_PREDICATES_H
+#define NDARRAY_PREDICATES_H
+
+/**
+ * Enumeration of element-wise predicates for testing ndarray elements.
+ */
+enum NDARRAY_PREDICATE {
+  // Element is not equal to zero (note: `NaN` is nonzero):
+  NDARRAY_PREDICATE_NONZERO = 0,
+
+  // Element is `NaN` (note: a complex number is `NaN` if either component is
+  // `NaN`):
+  NDARRAY_PREDICATE_NAN = 1,
+
+  // Element is positive or negative infinity (note: a complex number is
+  // infinite if either component is infinite):
+  NDARRAY_PREDICATE_INFINITE = 2,
+
+  // Element is neither infinite nor `NaN`:
+  NDARRAY_PREDICATE_FINITE = 3,
+
+  // Element is greater than zero:
+  NDARRAY_PREDICATE_POSITIVE = 4,
+
+  // Element is less than zero:
+  NDARRAY_PREDICATE_NEGATIVE = 5,
+
+  // Element is greater than or equal to zero:
+  NDARRAY_PREDICATE_NONNEGATIVE = 6
+};
+
+#endif  // !NDARRAY_PREDICATES_H
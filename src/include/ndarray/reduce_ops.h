@@ -0,0 +1,31 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef NDARRAY_REDUCE_OPS_H
+#define NDARRAY_REDUCE_OPS_H
+
+/**
+ * Enumeration of ndarray reduction operations.
+ */
+enum NDARRAY_REDUCE_OP {
+  // Sum of elements:
+  NDARRAY_REDUCE_SUM = 0,
+
+  // Product of elements:
+  NDARRAY_REDUCE_PROD = 1,
+
+  // Minimum value (note: propagates `NaN`):
+  NDARRAY_REDUCE_MIN = 2,
+
+  // Maximum value (note: propagates `NaN`):
+  NDARRAY_REDUCE_MAX = 3,
+
+  // Arithmetic mean:
+  NDARRAY_REDUCE_MEAN = 4
+};
+
+#endif  // !NDARRAY_REDUCE_OPS_H
@@ -0,0 +1,444 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/memory.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include "ndarray/base/internal/atomics.h"
+#include "ndarray/memory_categories.h"
+
+// Number of bytes currently allocated per category (note: the last element
+// corresponds to the total over all categories):
+static volatile int64_t NDARRAY_MEMORY_BYTES[NDARRAY_MEMORY_TOTAL + 1];
+
+// Peak number of bytes allocated per category:
+static volatile int64_t NDARRAY_MEMORY_PEAK[NDARRAY_MEMORY_TOTAL + 1];
+
+// Number of allocations per category:
+static volatile int64_t NDARRAY_MEMORY_ALLOCATIONS[NDARRAY_MEMORY_TOTAL + 1];
+
+// Number of deallocations per category:
+static volatile int64_t NDARRAY_MEMORY_DEALLOCATIONS[NDARRAY_MEMORY_TOTAL + 1];
+
+// Threshold (in bytes) above which to invoke the memory hook (note: a
+// nonpositive value disables the hook):
+static volatile int64_t NDARRAY_MEMORY_THRESHOLD = 0;
+
+// Callback to invoke when the total number of allocated bytes exceeds the
+// threshold:
+static ndarrayMemoryHook NDARRAY_MEMORY_HOOK = NULL;
+
+// User-provided context passed to the memory hook:
+static void* NDARRAY_MEMORY_HOOK_CONTEXT = NULL;
+
+/**
+ * Tests whether a value is a valid memory category.
+ *
+ * @private
+ * @param category  memory category
+ * @param total     boolean indicating whether to allow `NDARRAY_MEMORY_TOTAL`
+ * @return          boolean indicating whether a category is valid
+ */
+static inline int8_t ndarray_memory_is_category(
+    const int8_t category, const int8_t total
+) {
+  if (category < 0) {
+    return 0;
+  }
+  if (total) {
+    return (category <= NDARRAY_MEMORY_TOTAL) ? 1 : 0;
+  }
+  return (category < NDARRAY_MEMORY_TOTAL) ? 1 : 0;
+}
+
+/**
+ * Atomically raises a peak counter to a specified value if the value exceeds
+ * the current peak.
+ *
+ * @private
+ * @param peak   peak counter
+ * @param value  candidate peak value
+ */
+static inline void ndarray_memory_update_peak(
+    volatile int64_t* peak, const int64_t value
+) {
+  int64_t v;
+
+  v = ndarray_internal_atomic_load(peak);
+  while (value > v) {
+    if (ndarray_internal_atomic_compare_exchange(peak, v, value)) {
+      return;
+    }
+    v = ndarray_internal_atomic_load(peak);
+  }
+}
+
+/**
+ * Returns memory accounting statistics for a specified category.
+ *
+ * ## Notes
+ *
+ * -   Providing `NDARRAY_MEMORY_TOTAL` returns statistics aggregated over all
+ *     categories. The aggregated peak is the peak of the total, which may be
+ *     less than the sum of the peaks of the individual categories.
+ * -   Statistics are updated atomically, but are not read as a single atomic
+ *     snapshot. Hence, when other threads are concurrently allocating memory,
+ *     the returned fields may be slightly inconsistent with one another.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param category  memory category
+ * @param out       output statistics
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * struct ndarrayMemoryStats stats;
+ *
+ * int8_t status = ndarray_memory_stats(NDARRAY_MEMORY_DATA, &stats);
+ */
+int8_t ndarray_memory_stats(
+    const int8_t category, struct ndarrayMemoryStats* out
+) {
+  if (out == NULL || !ndarray_memory_is_category(category, 1)) {
+    return -1;
+  }
+  out->bytes = ndarray_internal_atomic_load(&NDARRAY_MEMORY_BYTES[category]);
+  out->peak  = ndarray_internal_atomic_load(&NDARRAY_MEMORY_PEAK[category]);
+  out->allocations =
+      ndarray_internal_atomic_load(&NDARRAY_MEMORY_ALLOCATIONS[category]);
+  out->deallocations =
+      ndarray_internal_atomic_load(&NDARRAY_MEMORY_DEALLOCATIONS[category]);
+  return 0;
+}
+
+/**
+ * Returns the number of bytes currently allocated for a specified category.
+ *
+ * ## Notes
+ *
+ * -   If provided an invalid category, the function returns `-1`.
+ *
+ * @param category  memory category
+ * @return          number of bytes
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * int64_t nbytes = ndarray_memory_bytes(NDARRAY_MEMORY_TOTAL);
+ */
+int64_t ndarray_memory_bytes(const int8_t category) {
+  if (!ndarray_memory_is_category(category, 1)) {
+    return -1;
+  }
+  return ndarray_internal_atomic_load(&NDARRAY_MEMORY_BYTES[category]);
+}
+
+/**
+ * Returns the peak number of bytes allocated for a specified category.
+ *
+ * ## Notes
+ *
+ * -   If provided an invalid category, the function returns `-1`.
+ *
+ * @param category  memory category
+ * @return          number of bytes
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * int64_t nbytes = ndarray_memory_peak_bytes(NDARRAY_MEMORY_TOTAL);
+ */
+int64_t ndarray_memory_peak_bytes(const int8_t category) {
+  if (!ndarray_memory_is_category(category, 1)) {
+    return -1;
+  }
+  return ndarray_internal_atomic_load(&NDARRAY_MEMORY_PEAK[category]);
+}
+
+/**
+ * Returns the number of allocations for a specified category.
+ *
+ * ## Notes
+ *
+ * -   If provided an invalid category, the function returns `-1`.
+ *
+ * @param category  memory category
+ * @return          number of allocations
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * int64_t n = ndarray_memory_allocations(NDARRAY_MEMORY_HEADER);
+ */
+int64_t ndarray_memory_allocations(const int8_t category) {
+  if (!ndarray_memory_is_category(category, 1)) {
+    return -1;
+  }
+  return ndarray_internal_atomic_load(&NDARRAY_MEMORY_ALLOCATIONS[category]);
+}
+
+/**
+ * Resets peak byte counts to the number of bytes currently allocated.
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ *
+ * ndarray_memory_reset_peak();
+ */
+void ndarray_memory_reset_peak(void) {
+  int64_t i;
+  for (i = 0; i <= NDARRAY_MEMORY_TOTAL; i++) {
+    ndarray_internal_atomic_store(
+        &NDARRAY_MEMORY_PEAK[i],
+        ndarray_internal_atomic_load(&NDARRAY_MEMORY_BYTES[i])
+    );
+  }
+}
+
+/**
+ * Sets a callback to invoke when the total number of bytes allocated by the
+ * library exceeds a threshold.
+ *
+ * ## Notes
+ *
+ * -   The callback is invoked each time the total number of allocated bytes
+ *     crosses the threshold from below (i.e., once per excursion above the
+ *     threshold, rather than on every allocation while above the threshold).
+ * -   The callback is invoked synchronously on the allocating thread, which may
+ *     be a worker thread used by a parallel ndarray function. The callback
+ *     must not allocate or free memory using the library.
+ * -   Providing a `NULL` callback or a nonpositive threshold disables the hook.
+ * -   The function is **not** thread-safe with respect to concurrent
+ *     allocations and should be called before allocating memory from multiple
+ *     threads.
+ *
+ * @param threshold  threshold (in bytes)
+ * @param hook       callback
+ * @param ctx        context passed to the callback
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include <stdint.h>
+ * #include <stdio.h>
+ *
+ * void on_threshold(const int64_t bytes, const int64_t threshold, void *ctx) {
+ *     fprintf(stderr, "ndarray memory: %lld bytes\n", (long long)bytes);
+ * }
+ *
+ * // Invoke the callback whenever more than 1GiB is allocated:
+ * ndarray_memory_set_hook(1073741824, on_threshold, NULL);
+ */
+void ndarray_memory_set_hook(
+    const int64_t threshold, ndarrayMemoryHook hook, void* ctx
+) {
+  // Disable the hook while updating it...
+  ndarray_internal_atomic_store(&NDARRAY_MEMORY_THRESHOLD, 0);
+  NDARRAY_MEMORY_HOOK         = hook;
+  NDARRAY_MEMORY_HOOK_CONTEXT = ctx;
+  if (hook != NULL && threshold > 0) {
+    ndarray_internal_atomic_store(&NDARRAY_MEMORY_THRESHOLD, threshold);
+  }
+}
+
+/**
+ * Records an allocation in the memory accounting statistics.
+ *
+ * ## Notes
+ *
+ * -   This function is intended for allocations which are not made using
+ *     `ndarray_memory_malloc` or `ndarray_memory_calloc` (e.g., memory mapped
+ *     buffers or buffers allocated by the embedding application), but which
+ *     should nevertheless be attributed to the library.
+ * -   Every recorded allocation should be matched by a call to
+ *     `ndarray_memory_record_free` having the same category and size.
+ * -   `NDARRAY_MEMORY_TOTAL` is not a valid category for recording and is
+ *     ignored.
+ *
+ * @param category  memory category
+ * @param nbytes    number of bytes
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * ndarray_memory_record_allocation(NDARRAY_MEMORY_DATA, 1024);
+ */
+void ndarray_memory_record_allocation(
+    const int8_t category, const int64_t nbytes
+) {
+  ndarrayMemoryHook hook;
+  int64_t threshold;
+  int64_t total;
+  int64_t bytes;
+
+  if (!ndarray_memory_is_category(category, 0)) {
+    return;
+  }
+  bytes = ndarray_internal_atomic_fetch_add(
+              &NDARRAY_MEMORY_BYTES[category], nbytes
+          ) +
+          nbytes;
+  total = ndarray_internal_atomic_fetch_add(
+              &NDARRAY_MEMORY_BYTES[NDARRAY_MEMORY_TOTAL], nbytes
+          ) +
+          nbytes;
+  ndarray_internal_atomic_fetch_add(&NDARRAY_MEMORY_ALLOCATIONS[category], 1);
+  ndarray_internal_atomic_fetch_add(
+      &NDARRAY_MEMORY_ALLOCATIONS[NDARRAY_MEMORY_TOTAL], 1
+  );
+  ndarray_memory_update_peak(&NDARRAY_MEMORY_PEAK[category], bytes);
+  ndarray_memory_update_peak(&NDARRAY_MEMORY_PEAK[NDARRAY_MEMORY_TOTAL], total);
+
+  // Only invoke the hook when crossing the threshold from below:
+  threshold = ndarray_internal_atomic_load(&NDARRAY_MEMORY_THRESHOLD);
+  if (threshold > 0 && total > threshold && (total - nbytes) <= threshold) {
+    hook = NDARRAY_MEMORY_HOOK;
+    if (hook != NULL) {
+      hook(total, threshold, NDARRAY_MEMORY_HOOK_CONTEXT);
+    }
+  }
+}
+
+/**
+ * Records a deallocation in the memory accounting statistics.
+ *
+ * @param category  memory category
+ * @param nbytes    number of bytes
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * ndarray_memory_record_allocation(NDARRAY_MEMORY_DATA, 1024);
+ *
+ * // ...
+ *
+ * ndarray_memory_record_free(NDARRAY_MEMORY_DATA, 1024);
+ */
+void ndarray_memory_record_free(const int8_t category, const int64_t nbytes) {
+  if (!ndarray_memory_is_category(category, 0)) {
+    return;
+  }
+  ndarray_internal_atomic_fetch_add(&NDARRAY_MEMORY_BYTES[category], -nbytes);
+  ndarray_internal_atomic_fetch_add(
+      &NDARRAY_MEMORY_BYTES[NDARRAY_MEMORY_TOTAL], -nbytes
+  );
+  ndarray_internal_atomic_fetch_add(&NDARRAY_MEMORY_DEALLOCATIONS[category], 1);
+  ndarray_internal_atomic_fetch_add(
+      &NDARRAY_MEMORY_DEALLOCATIONS[NDARRAY_MEMORY_TOTAL], 1
+  );
+}
+
+/**
+ * Allocates memory and records the allocation.
+ *
+ * ## Notes
+ *
+ * -   Memory **must** be freed using `ndarray_memory_free` with the same
+ *     category and size.
+ * -   If unable to allocate memory, the function returns a null pointer.
+ *
+ * @param category  memory category
+ * @param nbytes    number of bytes
+ * @return          pointer to allocated memory
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * double *x = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, 8 * 10);
+ *
+ * // ...
+ *
+ * ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, x, 8 * 10);
+ */
+void* ndarray_memory_malloc(const int8_t category, const int64_t nbytes) {
+  void* ptr;
+
+  if (nbytes < 0) {
+    return NULL;
+  }
+  ptr = malloc((nbytes > 0) ? (size_t)nbytes : 1);
+  if (ptr != NULL) {
+    ndarray_memory_record_allocation(category, nbytes);
+  }
+  return ptr;
+}
+
+/**
+ * Allocates zero-initialized memory and records the allocation.
+ *
+ * ## Notes
+ *
+ * -   Memory **must** be freed using `ndarray_memory_free` with the same
+ *     category and size.
+ * -   If unable to allocate memory, the function returns a null pointer.
+ *
+ * @param category  memory category
+ * @param nbytes    number of bytes
+ * @return          pointer to allocated memory
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * double *x = ndarray_memory_calloc(NDARRAY_MEMORY_SCRATCH, 8 * 10);
+ *
+ * // ...
+ *
+ * ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, x, 8 * 10);
+ */
+void* ndarray_memory_calloc(const int8_t category, const int64_t nbytes) {
+  void* ptr;
+
+  if (nbytes < 0) {
+    return NULL;
+  }
+  ptr = calloc((nbytes > 0) ? (size_t)nbytes : 1, 1);
+  if (ptr != NULL) {
+    ndarray_memory_record_allocation(category, nbytes);
+  }
+  return ptr;
+}
+
+/**
+ * Frees memory and records the deallocation.
+ *
+ * ## Notes
+ *
+ * -   If provided a null pointer, the function does nothing.
+ *
+ * @param category  memory category
+ * @param ptr       pointer to memory allocated by `ndarray_memory_malloc` or
+ *                  `ndarray_memory_calloc`
+ * @param nbytes    number of bytes requested when allocating memory
+ *
+ * @example
+ * #include "ndarray/base/memory.h"
+ * #include "ndarray/memory_categories.h"
+ *
+ * double *x = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, 8 * 10);
+ *
+ * // ...
+ *
+ * ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, x, 8 * 10);
+ */
+void ndarray_memory_free(
+    const int8_t category, void* ptr, const int64_t nbytes
+) {
+  if (ptr == NULL) {
+    return;
+  }
+  free(ptr);
+  ndarray_memory_record_free(category, nbytes);
+}
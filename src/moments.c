@@ -0,0 +1,1028 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/moments.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/moment_stats.h"
+
+// Define the maximum number of elements per block (note: the moments of each
+// block are computed using two passes over the block, which is small enough to
+// remain in cache, and subsequently merged into the accumulated moments):
+#define NDARRAY_MOMENTS_BLOCK 1024
+
+// Define the number of reduced elements per segment when splitting the
+// elements reduced into a single state across tasks (note: this must not depend
+// on the number of threads, as it determines the order of floating-point
+// operations):
+#define NDARRAY_MOMENTS_SEGMENT 65536
+
+// Define the maximum number of lanes processed at a time when the fastest
+// varying dimension is not reduced:
+#define NDARRAY_MOMENTS_LANES 128
+
+// Define the maximum number of rows per block when processing lanes:
+#define NDARRAY_MOMENTS_ROWS 64
+
+// Define the minimum number of lanes for processing lanes rather than
+// gathering reduced elements:
+#define NDARRAY_MOMENTS_MIN_LANES 8
+
+/**
+ * Structure describing a moments computation.
+ *
+ * @private
+ */
+struct ndarrayMomentsLoop {
+  // Function for converting input elements to double-precision floating-point
+  // numbers:
+  ndarrayStridedCastFcn icast;
+
+  // Boolean indicating whether input elements are double-precision
+  // floating-point numbers (and, thus, may be read in place):
+  int8_t direct;
+
+  // Pointer to the first indexed input element:
+  const uint8_t* x;
+
+  // Accumulated moments:
+  struct ndarrayMoments* states;
+
+  // Number of reduced dimensions:
+  int64_t nr;
+
+  // Reduced dimension shape (ordered by increasing stride magnitude):
+  int64_t* rshape;
+
+  // Reduced dimension input strides:
+  int64_t* rxs;
+
+  // Number of reduced elements per state:
+  int64_t nred;
+
+  // Number of outer (non-reduced) dimensions:
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension state strides:
+  int64_t* oss;
+
+  // Number of outer indices:
+  int64_t nouter;
+
+  // Number of lanes (or `0` if reduced elements are gathered):
+  int64_t nl;
+
+  // Input stride of the lane dimension:
+  int64_t lxs;
+
+  // State stride of the lane dimension:
+  int64_t lss;
+
+  // Number of lane tiles per outer index:
+  int64_t nlt;
+
+  // Number of segments per state:
+  int64_t nseg;
+
+  // Number of states per task (when states are not split into segments):
+  int64_t group;
+
+  // Partial moments (indexed by task) when states are split into segments:
+  struct ndarrayMoments* partials;
+
+  // Per-thread scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+/**
+ * Initializes accumulated moments.
+ *
+ * @param states  accumulated moments
+ * @param n       number of states
+ *
+ * @example
+ * #include "ndarray/base/moments.h"
+ *
+ * struct ndarrayMoments states[4];
+ *
+ * ndarray_moments_init(states, 4);
+ */
+void ndarray_moments_init(struct ndarrayMoments* states, const int64_t n) {
+  int64_t i;
+  for (i = 0; i < n; i++) {
+    states[i].count = 0;
+    states[i].mean  = 0.0;
+    states[i].m2    = 0.0;
+    states[i].m3    = 0.0;
+  }
+}
+
+/**
+ * Merges accumulated moments into another set of accumulated moments.
+ *
+ * ## Notes
+ *
+ * -   The function uses the pairwise update formulas of Chan et al., such that
+ *     the result equals the moments of the concatenation of both sequences of
+ *     values.
+ *
+ * @param state  accumulated moments to update
+ * @param other  accumulated moments to merge
+ *
+ * @example
+ * #include "ndarray/base/moments.h"
+ *
+ * // Given states `a` and `b` accumulated by separate threads...
+ * ndarray_moments_merge(&a, &b);
+ */
+void ndarray_moments_merge(
+    struct ndarrayMoments* state, const struct ndarrayMoments* other
+) {
+  double na;
+  double nb;
+  double d;
+  double e;
+
+  if (other->count == 0) {
+    return;
+  }
+  if (state->count == 0) {
+    *state = *other;
+    return;
+  }
+  na = (double)state->count;
+  nb = (double)other->count;
+  d  = other->mean - state->mean;
+  e  = d / (na + nb);
+
+  state->m3 += other->m3 + (d * e * e * na * nb * (na - nb)) +
+               (3.0 * e * ((na * other->m2) - (nb * state->m2)));
+  state->m2 += other->m2 + (d * e * na * nb);
+  state->mean += e * nb;
+  state->count += other->count;
+}
+
+/**
+ * Computes the moments of a contiguous block of values.
+ *
+ * ## Notes
+ *
+ * -   Sums are split across independent accumulators, such that the compiler
+ *     can vectorize the loops without reassociating floating-point operations.
+ * -   The moments include a correction for the rounding error of the block
+ *     mean (i.e., the sum of deviations from the computed mean).
+ *
+ * @private
+ * @param v    values
+ * @param n    number of values
+ * @param out  output moments
+ */
+static void ndarray_moments_block(
+    const double* v, const int64_t n, struct ndarrayMoments* out
+) {
+  double s[4];
+  double q[4];
+  double c[4];
+  double mean;
+  double d2;
+  double d;
+  double e;
+  int64_t i;
+  int64_t j;
+
+  for (j = 0; j < 4; j++) {
+    s[j] = 0.0;
+    q[j] = 0.0;
+    c[j] = 0.0;
+  }
+  for (i = 0; i + 4 <= n; i += 4) {
+    for (j = 0; j < 4; j++) {
+      s[j] += v[i + j];
+    }
+  }
+  for (; i < n; i++) {
+    s[0] += v[i];
+  }
+  mean = ((s[0] + s[1]) + (s[2] + s[3])) / (double)n;
+  for (j = 0; j < 4; j++) {
+    s[j] = 0.0;
+  }
+  for (i = 0; i + 4 <= n; i += 4) {
+    for (j = 0; j < 4; j++) {
+      d  = v[i + j] - mean;
+      d2 = d * d;
+      s[j] += d;
+      q[j] += d2;
+      c[j] += d2 * d;
+    }
+  }
+  for (; i < n; i++) {
+    d  = v[i] - mean;
+    d2 = d * d;
+    s[0] += d;
+    q[0] += d2;
+    c[0] += d2 * d;
+  }
+  // Correct the moments for the rounding error `e` of the block mean:
+  e  = ((s[0] + s[1]) + (s[2] + s[3])) / (double)n;
+  d2 = (q[0] + q[1]) + (q[2] + q[3]);
+
+  out->count = n;
+  out->mean  = mean + e;
+  out->m2    = d2 - (e * e * (double)n);
+  out->m3    = ((c[0] + c[1]) + (c[2] + c[3])) - (3.0 * e * d2) +
+               (2.0 * e * e * e * (double)n);
+}
+
+/**
+ * Resolves a block of reduced elements as contiguous double-precision
+ * floating-point numbers.
+ *
+ * @private
+ * @param loop   moments computation
+ * @param x      pointer to the first reduced element of a state
+ * @param start  index of the first element of the block among reduced elements
+ * @param n      number of elements
+ * @param buf    conversion buffer
+ * @param sub    reduced dimension subscripts
+ * @return       pointer to the elements
+ */
+static const double* ndarray_moments_gather(
+    const struct ndarrayMomentsLoop* loop, const uint8_t* x, int64_t start,
+    const int64_t n, double* buf, int64_t* sub
+) {
+  int64_t m;
+  int64_t i;
+  int64_t k;
+
+  for (k = 0; k < loop->nr; k++) {
+    sub[k] = start % loop->rshape[k];
+    start /= loop->rshape[k];
+    x += sub[k] * loop->rxs[k];  // pointer arithmetic
+  }
+  // Read elements in place when they are contiguous and suitably aligned:
+  if (loop->direct && loop->rxs[0] == (int64_t)sizeof(double) &&
+      sub[0] + n <= loop->rshape[0] &&
+      ((uintptr_t)x % sizeof(double)) == 0) {
+    return (const double*)x;
+  }
+  i = 0;
+  while (1) {
+    m = loop->rshape[0] - sub[0];
+    m = (m < n - i) ? m : n - i;
+    loop->icast(x, loop->rxs[0], (uint8_t*)(buf + i), sizeof(double), m);
+    i += m;
+    if (i >= n) {
+      break;
+    }
+    // Move to the start of the next run...
+    x -= sub[0] * loop->rxs[0];  // pointer arithmetic
+    sub[0] = 0;
+    for (k = 1; k < loop->nr; k++) {
+      sub[k] += 1;
+      x += loop->rxs[k];  // pointer arithmetic
+      if (sub[k] < loop->rshape[k]) {
+        break;
+      }
+      x -= sub[k] * loop->rxs[k];  // pointer arithmetic
+      sub[k] = 0;
+    }
+  }
+  return buf;
+}
+
+/**
+ * Accumulates the moments of a range of reduced elements.
+ *
+ * @private
+ * @param loop   moments computation
+ * @param x      pointer to the first reduced element of a state
+ * @param start  index of the first element in the range
+ * @param end    index of the last element in the range (exclusive)
+ * @param buf    conversion buffer
+ * @param sub    reduced dimension subscripts
+ * @param state  accumulated moments
+ */
+static void ndarray_moments_range(
+    const struct ndarrayMomentsLoop* loop, const uint8_t* x,
+    const int64_t start, const int64_t end, double* buf, int64_t* sub,
+    struct ndarrayMoments* state
+) {
+  struct ndarrayMoments b;
+  const double* v;
+  int64_t m;
+  int64_t i;
+
+  for (i = start; i < end; i += NDARRAY_MOMENTS_BLOCK) {
+    m = end - i;
+    m = (m < NDARRAY_MOMENTS_BLOCK) ? m : NDARRAY_MOMENTS_BLOCK;
+    v = ndarray_moments_gather(loop, x, i, m, buf, sub);
+    ndarray_moments_block(v, m, &b);
+    ndarray_moments_merge(state, &b);
+  }
+}
+
+/**
+ * Resolves the input pointer and state index for an outer index.
+ *
+ * @private
+ * @param loop  moments computation
+ * @param r     outer index
+ * @param x     output argument for the pointer to the first input element
+ * @return      state index
+ */
+static int64_t ndarray_moments_outer(
+    const struct ndarrayMomentsLoop* loop, int64_t r, const uint8_t** x
+) {
+  int64_t idx;
+  int64_t s;
+  int64_t k;
+
+  *x  = loop->x;
+  idx = 0;
+  for (k = loop->no - 1; k >= 0; k--) {
+    s = r % loop->oshape[k];
+    r /= loop->oshape[k];
+    *x += s * loop->oxs[k];  // pointer arithmetic
+    idx += s * loop->oss[k];
+  }
+  return idx;
+}
+
+/**
+ * Accumulates the moments of a group of states or of a single segment of a
+ * state by gathering reduced elements.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  moments computation
+ */
+static void ndarray_moments_gather_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayMomentsLoop* loop;
+  const uint8_t* x;
+  int64_t* sub;
+  double* buf;
+  int64_t end;
+  int64_t idx;
+  int64_t s;
+  int64_t r;
+
+  loop = (const struct ndarrayMomentsLoop*)ctx;
+  buf  = (double*)(loop->scratch + (tid * loop->sb));
+  sub  = (int64_t*)(buf + NDARRAY_MOMENTS_BLOCK);
+  if (loop->nseg == 1) {
+    end = (i + 1) * loop->group;
+    end = (end < loop->nouter) ? end : loop->nouter;
+    for (r = i * loop->group; r < end; r++) {
+      idx = ndarray_moments_outer(loop, r, &x);
+      ndarray_moments_range(
+          loop, x, 0, loop->nred, buf, sub, loop->states + idx
+      );
+    }
+    return;
+  }
+  ndarray_moments_outer(loop, i / loop->nseg, &x);
+  s   = (i % loop->nseg) * NDARRAY_MOMENTS_SEGMENT;
+  end = s + NDARRAY_MOMENTS_SEGMENT;
+  end = (end < loop->nred) ? end : loop->nred;
+  ndarray_moments_init(loop->partials + i, 1);
+  ndarray_moments_range(loop, x, s, end, buf, sub, loop->partials + i);
+}
+
+/**
+ * Accumulates the moments of a tile of lanes along the fastest varying
+ * dimension.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  moments computation
+ */
+static void ndarray_moments_lanes_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayMomentsLoop* loop;
+  struct ndarrayMoments b;
+  const uint8_t* x;
+  int64_t* sub;
+  double* mean;
+  double* buf;
+  double* m2;
+  double* m3;
+  double d2;
+  double d;
+  int64_t rows;
+  int64_t idx;
+  int64_t j0;
+  int64_t w;
+  int64_t r;
+  int64_t q;
+  int64_t j;
+  int64_t k;
+
+  loop = (const struct ndarrayMomentsLoop*)ctx;
+  buf  = (double*)(loop->scratch + (tid * loop->sb));
+  mean = buf + (NDARRAY_MOMENTS_ROWS * NDARRAY_MOMENTS_LANES);
+  m2   = mean + NDARRAY_MOMENTS_LANES;
+  m3   = m2 + NDARRAY_MOMENTS_LANES;
+  sub  = (int64_t*)(m3 + NDARRAY_MOMENTS_LANES);
+
+  idx = ndarray_moments_outer(loop, i / loop->nlt, &x);
+  j0  = (i % loop->nlt) * NDARRAY_MOMENTS_LANES;
+  w   = loop->nl - j0;
+  w   = (w < NDARRAY_MOMENTS_LANES) ? w : NDARRAY_MOMENTS_LANES;
+  x += j0 * loop->lxs;  // pointer arithmetic
+  idx += j0 * loop->lss;
+
+  for (k = 0; k < loop->nr; k++) {
+    sub[k] = 0;
+  }
+  for (r = 0; r < loop->nred; r += rows) {
+    rows = loop->nred - r;
+    rows = (rows < NDARRAY_MOMENTS_ROWS) ? rows : NDARRAY_MOMENTS_ROWS;
+
+    // Convert a block of rows, advancing the reduced dimension subscripts
+    // after each row...
+    for (q = 0; q < rows; q++) {
+      loop->icast(x, loop->lxs, (uint8_t*)(buf + (q * w)), sizeof(double), w);
+      for (k = 0; k < loop->nr; k++) {
+        sub[k] += 1;
+        x += loop->rxs[k];  // pointer arithmetic
+        if (sub[k] < loop->rshape[k]) {
+          break;
+        }
+        x -= sub[k] * loop->rxs[k];  // pointer arithmetic
+        sub[k] = 0;
+      }
+    }
+    // Compute the moments of each lane within the block (note: lanes are
+    // independent, such that the loops over lanes vectorize)...
+    for (j = 0; j < w; j++) {
+      mean[j] = 0.0;
+      m2[j]   = 0.0;
+      m3[j]   = 0.0;
+    }
+    for (q = 0; q < rows; q++) {
+      for (j = 0; j < w; j++) {
+        mean[j] += buf[(q * w) + j];
+      }
+    }
+    for (j = 0; j < w; j++) {
+      mean[j] /= (double)rows;
+    }
+    for (q = 0; q < rows; q++) {
+      for (j = 0; j < w; j++) {
+        d  = buf[(q * w) + j] - mean[j];
+        d2 = d * d;
+        m2[j] += d2;
+        m3[j] += d2 * d;
+      }
+    }
+    for (j = 0; j < w; j++) {
+      b.count = rows;
+      b.mean  = mean[j];
+      b.m2    = m2[j];
+      b.m3    = m3[j];
+      ndarray_moments_merge(loop->states + idx + (j * loop->lss), &b);
+    }
+  }
+}
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_moments_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Accumulates the moments of ndarray elements along one or more dimensions.
+ *
+ * ## Notes
+ *
+ * -   If `axes` is `NULL`, the function reduces along all dimensions, and
+ *     `states` must contain a single state. Otherwise, negative axes are
+ *     resolved relative to the last dimension, and `states` must contain a
+ *     state for each element of the reduced shape (see `ndarray_reduce_shape`)
+ *     in row-major order.
+ * -   The function merges the moments of the input ndarray into the provided
+ *     states, such that calling the function for successive chunks of a data
+ *     stream accumulates the moments of the entire stream. States must be
+ *     initialized using `ndarray_moments_init` before the first update.
+ * -   Input elements are converted to double-precision floating-point numbers.
+ *     Complex numbers are not supported.
+ * -   Elements are read in a single pass over memory. The moments of small
+ *     blocks of elements are computed in cache using two passes over each
+ *     block and subsequently merged into the accumulated moments, which is
+ *     both faster and more accurate than updating moments for each element.
+ * -   The way in which elements are split into blocks does not depend on the
+ *     number of threads, and, hence, results are bit-identical for any number
+ *     of threads.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param nthreads  number of threads
+ * @param states    accumulated moments
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/moments.h"
+ * #include "ndarray/moment_stats.h"
+ * #include <stdint.h>
+ *
+ * struct ndarrayMoments state;
+ *
+ * ndarray_moments_init(&state, 1);
+ *
+ * // For each chunk `x` of a data stream...
+ * int8_t status = ndarray_moments_update(x, 0, NULL, 0, &state);
+ *
+ * // Compute the sample standard deviation of the stream:
+ * double sd = ndarray_moments_stat(&state, NDARRAY_MOMENT_STDEV, 1);
+ */
+int8_t ndarray_moments_update(
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    int32_t nthreads, struct ndarrayMoments* states
+) {
+  struct ndarrayMomentsLoop loop;
+  const uint8_t* p;
+  int64_t* reduced;
+  int64_t* ss;
+  int64_t nmeta;
+  int64_t nbytes;
+  int64_t ntasks;
+  int64_t len;
+  int64_t d;
+  int64_t r;
+  int64_t s;
+  int64_t i;
+  int64_t k;
+  int8_t status;
+
+  if (x == NULL || states == NULL || x->dtype == NDARRAY_COMPLEX64 ||
+      x->dtype == NDARRAY_COMPLEX128) {
+    return -1;
+  }
+  loop.icast = ndarray_strided_cast_function(x->dtype, NDARRAY_FLOAT64);
+  if (loop.icast == NULL) {
+    return -1;
+  }
+  loop.direct = (x->dtype == NDARRAY_FLOAT64);
+  loop.x      = x->data + x->offset;
+  loop.states = states;
+
+  // Allocate scratch memory for dimension meta data:
+  nmeta   = sizeof(int64_t) * ((x->ndims * 7) + 2);
+  reduced = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (reduced == NULL) {
+    return -1;
+  }
+  ss          = reduced + x->ndims;
+  loop.rshape = ss + x->ndims;
+  loop.rxs    = loop.rshape + x->ndims + 1;
+  loop.oshape = loop.rxs + x->ndims + 1;
+  loop.oxs    = loop.oshape + x->ndims;
+  loop.oss    = loop.oxs + x->ndims;
+
+  // Resolve the reduced dimensions:
+  if (axes == NULL) {
+    for (i = 0; i < x->ndims; i++) {
+      reduced[i] = 1;
+    }
+  } else {
+    for (i = 0; i < x->ndims; i++) {
+      reduced[i] = 0;
+    }
+    for (i = 0; i < naxes; i++) {
+      d = (axes[i] < 0) ? axes[i] + x->ndims : axes[i];
+      if (d < 0 || d >= x->ndims || reduced[d]) {
+        ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, reduced, nmeta);
+        return -1;
+      }
+      reduced[d] = 1;
+    }
+  }
+  // Compute the state strides (i.e., row-major strides of the reduced shape):
+  len = 1;
+  s   = 1;
+  for (i = x->ndims - 1; i >= 0; i--) {
+    len *= x->shape[i];
+    ss[i] = s;
+    if (!reduced[i]) {
+      s *= x->shape[i];
+    }
+  }
+  if (len == 0) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, reduced, nmeta);
+    return 0;
+  }
+  // Find the fastest varying (non-singleton) dimension:
+  d = -1;
+  for (i = 0; i < x->ndims; i++) {
+    if (x->shape[i] != 1 && (d < 0 || ndarray_moments_abs(x->strides[i]) <
+                                          ndarray_moments_abs(x->strides[d]))) {
+      d = i;
+    }
+  }
+  // Process lanes when the fastest varying dimension is not reduced and is
+  // sufficiently long; otherwise, gather reduced elements:
+  if (d >= 0 && !reduced[d] && x->shape[d] >= NDARRAY_MOMENTS_MIN_LANES) {
+    loop.nl  = x->shape[d];
+    loop.lxs = x->strides[d];
+    loop.lss = ss[d];
+    loop.nlt = (loop.nl + NDARRAY_MOMENTS_LANES - 1) / NDARRAY_MOMENTS_LANES;
+  } else {
+    loop.nl = 0;
+    d       = -1;
+  }
+  // Resolve the reduced and outer dimensions (note: reduced dimensions are
+  // sorted by increasing stride magnitude using insertion sort, which is
+  // stable, and subsequently coalesced where possible):
+  loop.nr     = 0;
+  loop.no     = 0;
+  loop.nred   = 1;
+  loop.nouter = 1;
+  for (i = 0; i < x->ndims; i++) {
+    if (x->shape[i] == 1 || i == d) {
+      continue;
+    }
+    if (!reduced[i]) {
+      loop.oshape[loop.no] = x->shape[i];
+      loop.oxs[loop.no]    = x->strides[i];
+      loop.oss[loop.no]    = ss[i];
+      loop.nouter *= x->shape[i];
+      loop.no += 1;
+      continue;
+    }
+    r = x->shape[i];
+    s = x->strides[i];
+    for (k = loop.nr; k > 0 && ndarray_moments_abs(loop.rxs[k - 1]) >
+                                   ndarray_moments_abs(s);
+         k--) {
+      loop.rshape[k] = loop.rshape[k - 1];
+      loop.rxs[k]    = loop.rxs[k - 1];
+    }
+    loop.rshape[k] = r;
+    loop.rxs[k]    = s;
+    loop.nred *= r;
+    loop.nr += 1;
+  }
+  if (loop.nr == 0) {
+    loop.rshape[0] = 1;
+    loop.rxs[0]    = 0;
+    loop.nr        = 1;
+  }
+  k = 0;
+  for (i = 1; i < loop.nr; i++) {
+    if (loop.rxs[i] == loop.rxs[k] * loop.rshape[k]) {
+      loop.rshape[k] *= loop.rshape[i];
+    } else {
+      k += 1;
+      loop.rshape[k] = loop.rshape[i];
+      loop.rxs[k]    = loop.rxs[i];
+    }
+  }
+  loop.nr = k + 1;
+
+  // Partition the computation into tasks:
+  loop.nseg  = 1;
+  loop.group = 1;
+  if (loop.nl > 0) {
+    ntasks  = loop.nouter * loop.nlt;
+    loop.sb = sizeof(double) *
+              ((NDARRAY_MOMENTS_ROWS + 3) * NDARRAY_MOMENTS_LANES);
+  } else {
+    loop.nseg = (loop.nred + NDARRAY_MOMENTS_SEGMENT - 1) /
+                NDARRAY_MOMENTS_SEGMENT;
+    if (loop.nseg == 1) {
+      // Group states, such that each task processes roughly a segment:
+      loop.group = NDARRAY_MOMENTS_SEGMENT / loop.nred;
+      ntasks     = (loop.nouter + loop.group - 1) / loop.group;
+    } else {
+      ntasks = loop.nouter * loop.nseg;
+    }
+    loop.sb = sizeof(double) * NDARRAY_MOMENTS_BLOCK;
+  }
+  loop.sb += sizeof(int64_t) * loop.nr;
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory and memory for partial moments:
+  nbytes = loop.sb * nthreads;
+  if (loop.nseg > 1) {
+    nbytes += sizeof(struct ndarrayMoments) * ntasks;
+  }
+  loop.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.scratch == NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, reduced, nmeta);
+    return -1;
+  }
+  loop.partials = (struct ndarrayMoments*)(loop.scratch + (loop.sb * nthreads)
+  );
+  if (loop.nl > 0) {
+    status = ndarray_parallel_for(
+        ntasks, nthreads, ndarray_moments_lanes_task, &loop
+    );
+  } else {
+    status = ndarray_parallel_for(
+        ntasks, nthreads, ndarray_moments_gather_task, &loop
+    );
+    // Merge the partial moments of each state in segment order:
+    if (status == 0 && loop.nseg > 1) {
+      for (r = 0; r < loop.nouter; r++) {
+        i = ndarray_moments_outer(&loop, r, &p);
+        for (k = 0; k < loop.nseg; k++) {
+          ndarray_moments_merge(
+              states + i, loop.partials + ((r * loop.nseg) + k)
+          );
+        }
+      }
+    }
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.scratch, nbytes);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, reduced, nmeta);
+  return status;
+}
+
+/**
+ * Computes a statistic from accumulated moments.
+ *
+ * ## Notes
+ *
+ * -   The delta degrees of freedom `ddof` only applies to the variance and
+ *     standard deviation (e.g., `0` for the population variance and `1` for
+ *     the unbiased sample variance).
+ * -   The function returns `NaN` if the number of values is zero, if the
+ *     number of values does not exceed `ddof` (variance and standard
+ *     deviation), if all values are equal (skewness), or if the statistic is
+ *     not supported.
+ *
+ * @param state  accumulated moments
+ * @param stat   statistic
+ * @param ddof   delta degrees of freedom
+ * @return       statistic
+ *
+ * @example
+ * #include "ndarray/base/moments.h"
+ * #include "ndarray/moment_stats.h"
+ *
+ * // Given accumulated moments `state`...
+ * double v = ndarray_moments_stat(&state, NDARRAY_MOMENT_VARIANCE, 1);
+ */
+double ndarray_moments_stat(
+    const struct ndarrayMoments* state, const enum NDARRAY_MOMENT_STAT stat,
+    const int64_t ddof
+) {
+  double n;
+
+  if (state->count == 0) {
+    return NAN;
+  }
+  n = (double)state->count;
+  switch (stat) {
+    case NDARRAY_MOMENT_MEAN:
+      return state->mean;
+    case NDARRAY_MOMENT_VARIANCE:
+      if (state->count <= ddof) {
+        return NAN;
+      }
+      return state->m2 / (n - (double)ddof);
+    case NDARRAY_MOMENT_STDEV:
+      if (state->count <= ddof) {
+        return NAN;
+      }
+      return sqrt(state->m2 / (n - (double)ddof));
+    case NDARRAY_MOMENT_SKEWNESS:
+      if (state->m2 == 0.0) {
+        return NAN;
+      }
+      return sqrt(n) * state->m3 / (state->m2 * sqrt(state->m2));
+    default:
+      return NAN;
+  }
+}
+
+/**
+ * Assigns statistics computed from accumulated moments to an output ndarray.
+ *
+ * ## Notes
+ *
+ * -   States are assigned to output elements in row-major order, and the
+ *     number of output elements must equal the number of states (e.g., the
+ *     output ndarray may have the reduced shape with or without singleton
+ *     dimensions in place of reduced dimensions).
+ * -   Statistics are converted from double-precision floating-point numbers
+ *     to the output ndarray data type.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param states  accumulated moments
+ * @param stat    statistic
+ * @param ddof    delta degrees of freedom
+ * @param out     output ndarray
+ * @return        status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/moments.h"
+ * #include "ndarray/moment_stats.h"
+ *
+ * // Given accumulated moments `states` and an output ndarray `out`...
+ * int8_t status = ndarray_moments_assign(states, NDARRAY_MOMENT_MEAN, 0, out);
+ */
+int8_t ndarray_moments_assign(
+    const struct ndarrayMoments* states, const enum NDARRAY_MOMENT_STAT stat,
+    const int64_t ddof, struct ndarray* out
+) {
+  ndarrayStridedCastFcn ocast;
+  int64_t* sub;
+  uint8_t* p;
+  int64_t nbytes;
+  int64_t len;
+  int64_t i;
+  int64_t k;
+  double v;
+
+  if (states == NULL || out == NULL || stat < NDARRAY_MOMENT_MEAN ||
+      stat > NDARRAY_MOMENT_SKEWNESS) {
+    return -1;
+  }
+  ocast = ndarray_strided_cast_function(NDARRAY_FLOAT64, out->dtype);
+  if (ocast == NULL) {
+    return -1;
+  }
+  nbytes = sizeof(int64_t) * (out->ndims + 1);
+  sub    = ndarray_memory_calloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (sub == NULL) {
+    return -1;
+  }
+  len = 1;
+  for (k = 0; k < out->ndims; k++) {
+    len *= out->shape[k];
+  }
+  p = out->data + out->offset;
+  for (i = 0; i < len; i++) {
+    v = ndarray_moments_stat(states + i, stat, ddof);
+    ocast((const uint8_t*)&v, sizeof(double), p, 0, 1);
+
+    // Advance the output subscripts in row-major order...
+    for (k = out->ndims - 1; k >= 0; k--) {
+      sub[k] += 1;
+      p += out->strides[k];  // pointer arithmetic
+      if (sub[k] < out->shape[k]) {
+        break;
+      }
+      p -= sub[k] * out->strides[k];  // pointer arithmetic
+      sub[k] = 0;
+    }
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, sub, nbytes);
+  return 0;
+}
+
+/**
+ * Computes a statistic of ndarray elements along one or more dimensions.
+ *
+ * ## Notes
+ *
+ * -   If `axes` is `NULL`, the function reduces along all dimensions.
+ *     Otherwise, negative axes are resolved relative to the last dimension.
+ * -   The number of output elements must equal the number of elements of the
+ *     reduced shape (see `ndarray_reduce_shape`).
+ * -   See `ndarray_moments_update` and `ndarray_moments_stat` for details
+ *     regarding supported data types, threading, and statistics.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param stat      statistic
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param ddof      delta degrees of freedom
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/moments.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/moment_stats.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major input ndarray:
+ * double xbuf[] = {1.0, 2.0, 3.0, 4.0, 6.0, 8.0};
+ * int64_t shape[] = {2, 3};
+ * int64_t strides[] = {24, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)xbuf, 2, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * double ybuf[] = {0.0, 0.0};
+ * int64_t yshape[] = {2};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the sample variance of each row:
+ * int64_t axes[] = {1};
+ * int8_t status = ndarray_moments(
+ *     NDARRAY_MOMENT_VARIANCE, x, 1, axes, 1, 0, y
+ * );
+ * // ybuf => {1.0, 4.0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_moments(
+    const enum NDARRAY_MOMENT_STAT stat, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int64_t ddof,
+    int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayMoments* states;
+  int64_t nbytes;
+  int64_t nout;
+  int64_t len;
+  int64_t a;
+  int64_t i;
+  int64_t k;
+  int8_t status;
+
+  if (x == NULL || out == NULL) {
+    return -1;
+  }
+  // Compute the number of elements of the reduced shape (note: invalid axes
+  // are subsequently reported when accumulating moments):
+  nout = 1;
+  for (i = 0; i < x->ndims && axes != NULL; i++) {
+    for (k = 0; k < naxes; k++) {
+      a = (axes[k] < 0) ? axes[k] + x->ndims : axes[k];
+      if (a == i) {
+        break;
+      }
+    }
+    if (k == naxes) {
+      nout *= x->shape[i];
+    }
+  }
+  len = 1;
+  for (i = 0; i < out->ndims; i++) {
+    len *= out->shape[i];
+  }
+  if (len != nout) {
+    return -1;
+  }
+  nbytes = sizeof(struct ndarrayMoments) * (len + 1);
+  states = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (states == NULL) {
+    return -1;
+  }
+  ndarray_moments_init(states, len);
+  status = ndarray_moments_update(x, naxes, axes, nthreads, states);
+  if (status == 0) {
+    status = ndarray_moments_assign(states, stat, ddof, out);
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, states, nbytes);
+  return status;
+}
@@ -12,6 +12,7 @@
 #include "ndarray/base/bytes_per_element.h"
 #include "ndarray/base/ind.h"
 #include "ndarray/base/iteration_order.h"
+#include "ndarray/base/memory.h"
 #include "ndarray/base/minmax_view_buffer_index.h"
 #include "ndarray/base/numel.h"
 #include "ndarray/base/strides2order.h"
@@ -19,6 +20,7 @@
 #include "ndarray/complex/float64.h"
 #include "ndarray/dtypes.h"
 #include "ndarray/index_modes.h"
+#include "ndarray/memory_categories.h"
 #include "ndarray/orders.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -129,7 +131,8 @@ struct ndarray* ndarray_allocate(
 ) {
   int64_t len;
 
-  struct ndarray* arr = malloc(sizeof(struct ndarray));
+  struct ndarray* arr =
+      ndarray_memory_malloc(NDARRAY_MEMORY_HEADER, sizeof(struct ndarray));
   if (arr == NULL) {
     return NULL;
   }
@@ -299,7 +302,7 @@ int64_t ndarray_flags(const struct ndarray* arr) {
  * @param arr  input ndarray
  */
 void ndarray_free(struct ndarray* arr) {
-  free(arr);
+  ndarray_memory_free(NDARRAY_MEMORY_HEADER, arr, sizeof(struct ndarray));
 }
 
 /**
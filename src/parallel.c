@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/parallel.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include "ndarray/base/internal/atomics.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// Define the maximum number of threads which may be used by a parallel ndarray
+// function (note: this guards against pathological environment settings):
+#define NDARRAY_PARALLEL_MAX_THREADS 256
+
+/**
+ * Structure shared by all threads participating in a parallel loop.
+ *
+ * @private
+ */
+struct ndarrayParallelLoop {
+  // Task function:
+  ndarrayParallelFcn fcn;
+
+  // Task context:
+  void* ctx;
+
+  // Total number of tasks:
+  int64_t n;
+
+  // Index of the next task to be claimed:
+  volatile int64_t next;
+};
+
+/**
+ * Structure describing a worker thread.
+ *
+ * @private
+ */
+struct ndarrayParallelWorker {
+  // Shared loop state:
+  struct ndarrayParallelLoop* loop;
+
+  // Thread index:
+  int32_t tid;
+};
+
+/**
+ * Claims and executes tasks until no tasks remain.
+ *
+ * @private
+ * @param loop  shared loop state
+ * @param tid   thread index
+ */
+static void ndarray_parallel_run(
+    struct ndarrayParallelLoop* loop, int32_t tid
+) {
+  int64_t i;
+  for (;;) {
+    i = ndarray_internal_atomic_fetch_add(&(loop->next), 1);
+    if (i >= loop->n) {
+      return;
+    }
+    loop->fcn(i, tid, loop->ctx);
+  }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI ndarray_parallel_worker(LPVOID arg) {
+  struct ndarrayParallelWorker* w = (struct ndarrayParallelWorker*)arg;
+  ndarray_parallel_run(w->loop, w->tid);
+  return 0;
+}
+#else
+static void* ndarray_parallel_worker(void* arg) {
+  struct ndarrayParallelWorker* w = (struct ndarrayParallelWorker*)arg;
+  ndarray_parallel_run(w->loop, w->tid);
+  return NULL;
+}
+#endif
+
+/**
+ * Returns the default number of threads used by parallel ndarray functions.
+ *
+ * ## Notes
+ *
+ * -   If the `NDARRAY_NUM_THREADS` environment variable is set to a positive
+ *     integer, the function returns that value; otherwise, the function
+ *     returns the number of online processors.
+ *
+ * @return  number of threads
+ *
+ * @example
+ * #include "ndarray/base/parallel.h"
+ *
+ * int32_t n = ndarray_parallel_num_threads();
+ */
+int32_t ndarray_parallel_num_threads(void) {
+  const char* env;
+  long n;
+
+  env = getenv("NDARRAY_NUM_THREADS");
+  if (env != NULL) {
+    n = strtol(env, NULL, 10);
+    if (n > 0) {
+      return (n > NDARRAY_PARALLEL_MAX_THREADS) ? NDARRAY_PARALLEL_MAX_THREADS
+                                                : (int32_t)n;
+    }
+  }
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  n = (long)info.dwNumberOfProcessors;
+#else
+  n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  if (n < 1) {
+    return 1;
+  }
+  return (n > NDARRAY_PARALLEL_MAX_THREADS) ? NDARRAY_PARALLEL_MAX_THREADS
+                                            : (int32_t)n;
+}
+
+/**
+ * Executes a number of independent tasks using a specified number of threads.
+ *
+ * ## Notes
+ *
+ * -   Tasks are claimed dynamically, so the thread executing a given task is
+ *     unspecified. Callers which require reproducible results must ensure that
+ *     the result of each task does not depend on which thread executes it
+ *     (e.g., by writing to task-indexed, rather than thread-indexed, outputs).
+ * -   The calling thread participates in the computation as thread `0`.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   If the function is unable to spawn a thread, the remaining threads
+ *     (including the calling thread) complete all tasks, so every task is
+ *     always executed exactly once.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param n         number of tasks
+ * @param nthreads  number of threads
+ * @param fcn       task function
+ * @param ctx       task context
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray/base/parallel.h"
+ * #include <stdint.h>
+ *
+ * void task(int64_t i, int32_t tid, void *ctx) {
+ *     double *x = (double *)ctx;
+ *     x[i] *= 2.0;
+ * }
+ *
+ * double x[] = {1.0, 2.0, 3.0, 4.0};
+ *
+ * int8_t status = ndarray_parallel_for(4, 2, task, (void *)x);
+ */
+int8_t ndarray_parallel_for(
+    int64_t n, int32_t nthreads, ndarrayParallelFcn fcn, void* ctx
+) {
+  struct ndarrayParallelWorker* workers;
+  struct ndarrayParallelLoop loop;
+  int32_t nspawned;
+  int32_t i;
+#if defined(_WIN32)
+  HANDLE* threads;
+#else
+  pthread_t* threads;
+#endif
+
+  if (fcn == NULL || n < 0) {
+    return -1;
+  }
+  if (n == 0) {
+    return 0;
+  }
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if (nthreads > NDARRAY_PARALLEL_MAX_THREADS) {
+    nthreads = NDARRAY_PARALLEL_MAX_THREADS;
+  }
+  if ((int64_t)nthreads > n) {
+    nthreads = (int32_t)n;
+  }
+  loop.fcn  = fcn;
+  loop.ctx  = ctx;
+  loop.n    = n;
+  loop.next = 0;
+
+  // If we only have a single thread, avoid the overhead of spawning threads...
+  if (nthreads <= 1) {
+    ndarray_parallel_run(&loop, 0);
+    return 0;
+  }
+  workers = malloc(sizeof(struct ndarrayParallelWorker) * (nthreads - 1));
+  threads = malloc(sizeof(*threads) * (nthreads - 1));
+  if (workers == NULL || threads == NULL) {
+    free(workers);
+    free(threads);
+    ndarray_parallel_run(&loop, 0);
+    return 0;
+  }
+  // Spawn worker threads (the calling thread is thread `0`)...
+  nspawned = 0;
+  for (i = 0; i < nthreads - 1; i++) {
+    workers[nspawned].loop = &loop;
+    workers[nspawned].tid  = nspawned + 1;
+#if defined(_WIN32)
+    threads[nspawned] = CreateThread(
+        NULL, 0, ndarray_parallel_worker, &workers[nspawned], 0, NULL
+    );
+    if (threads[nspawned] == NULL) {
+      break;
+    }
+#else
+    if (pthread_create(
+            &threads[nspawned], NULL, ndarray_parallel_worker,
+            &workers[nspawned]
+        ) != 0) {
+      break;
+    }
+#endif
+    nspawned += 1;
+  }
+  ndarray_parallel_run(&loop, 0);
+
+  // Wait for all worker threads to finish...
+  for (i = 0; i < nspawned; i++) {
+#if defined(_WIN32)
+    WaitForSingleObject(threads[i], INFINITE);
+    CloseHandle(threads[i]);
+#else
+    pthread_join(threads[i], NULL);
+#endif
+  }
+  free(workers);
+  free(threads);
+  return 0;
+}
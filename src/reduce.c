@@ -0,0 +1,1542 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/reduce.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/reduce_ops.h"
+
+// Define the number of elements below which pairwise summation falls back to
+// (unrolled) naive summation:
+#define NDARRAY_REDUCE_PAIRWISE_BLOCK 128
+
+// Define the maximum number of elements converted to the accumulator data type
+// at a time when reducing a row which cannot be reduced in place:
+#define NDARRAY_REDUCE_CHUNK 1024
+
+// Define the maximum number of bytes of output elements (lanes) accumulated at
+// a time when the fastest varying dimension is not reduced (note: this should
+// fit in cache alongside an input row, such that, when all lanes fit, input
+// rows are streamed whole rather than in strips):
+#define NDARRAY_REDUCE_LANE_BYTES 65536
+
+// Define the number of rows naively accumulated into a block of lanes before
+// the block is merged pairwise with previously accumulated blocks:
+#define NDARRAY_REDUCE_BLOCK 128
+
+// Define the minimum length of a reduced fastest varying dimension for which
+// rows are reduced one output element at a time:
+#define NDARRAY_REDUCE_MIN_ROW 16
+
+// Define the target number of tasks when splitting reductions across threads
+// (note: this must not depend on the number of threads, as it determines how
+// partial results are combined):
+#define NDARRAY_REDUCE_PARALLEL_TASKS 64
+
+// Define the minimum number of elements per chunk when splitting a reduction
+// into chunks:
+#define NDARRAY_REDUCE_PARALLEL_MIN_ELEMENTS 32768
+
+// Define the number of supported reduction kernels (note: the mean is computed
+// as a sum which is subsequently scaled):
+#define NDARRAY_REDUCE_NKERNELS 4
+
+// Define a list of supported accumulator data types (dtype, abbreviation, C
+// type, lowest value, highest value, kind):
+#define NDARRAY_REDUCE_ACC_DTYPES(X)                      \
+  X(NDARRAY_INT64, l, int64_t, INT64_MIN, INT64_MAX, I)   \
+  X(NDARRAY_UINT64, v, uint64_t, 0, UINT64_MAX, I)        \
+  X(NDARRAY_FLOAT32, f, float, -INFINITY, INFINITY, F)    \
+  X(NDARRAY_FLOAT64, d, double, -INFINITY, INFINITY, F)
+
+// Define macros for testing whether a value is `NaN` for each kind of
+// accumulator data type:
+#define NDARRAY_REDUCE_ISNAN_I(v) 0
+#define NDARRAY_REDUCE_ISNAN_F(v) isnan(v)
+
+/**
+ * Function pointer type for reducing a contiguous row of accumulator values to
+ * a single value.
+ *
+ * @private
+ * @param x    input row
+ * @param n    number of elements
+ * @param out  output value
+ */
+typedef void (*ndarrayReduceRowFcn)(
+    const uint8_t* x, const int64_t n, uint8_t* out
+);
+
+/**
+ * Function pointer type for combining strided accumulator values with a
+ * contiguous array of accumulated values.
+ *
+ * @private
+ * @param acc  accumulated values
+ * @param x    input values
+ * @param sx   input stride (in bytes)
+ * @param n    number of elements
+ */
+typedef void (*ndarrayReduceCombineFcn)(
+    uint8_t* acc, const uint8_t* x, const int64_t sx, const int64_t n
+);
+
+/**
+ * Structure containing the kernels for a single accumulator data type.
+ *
+ * @private
+ */
+struct ndarrayReduceKernels {
+  // Accumulator data type:
+  int16_t dtype;
+
+  // Row reduction kernels (indexed by reduction operation):
+  ndarrayReduceRowFcn row[NDARRAY_REDUCE_NKERNELS];
+
+  // Combination kernels (indexed by reduction operation):
+  ndarrayReduceCombineFcn combine[NDARRAY_REDUCE_NKERNELS];
+
+  // Kernel for filling accumulated values with a reduction identity:
+  void (*fill)(uint8_t* acc, const int64_t n, const int8_t op);
+
+  // Kernel for dividing accumulated values by an element count:
+  void (*scale)(uint8_t* acc, const int64_t n, const int64_t count);
+};
+
+/**
+ * Structure describing a reduction loop.
+ *
+ * @private
+ */
+struct ndarrayReduceLoop {
+  // Accumulator kernels:
+  const struct ndarrayReduceKernels* kernels;
+
+  // Function for converting input elements to the accumulator data type (or
+  // `NULL` if the input data type is the accumulator data type):
+  ndarrayStridedCastFcn icast;
+
+  // Function for copying strided accumulator values:
+  ndarrayStridedCastFcn gather;
+
+  // Function for converting accumulated values to the output data type:
+  ndarrayStridedCastFcn ocast;
+
+  // Kernel reduction operation:
+  int8_t op;
+
+  // Boolean indicating whether to divide accumulated values by the number of
+  // reduced elements:
+  int8_t mean;
+
+  // Boolean indicating whether the fastest varying dimension is reduced:
+  int8_t inner;
+
+  // Number of bytes per accumulator element:
+  int64_t bpe;
+
+  // Number of reduced elements per output element:
+  int64_t count;
+
+  // Number of output elements:
+  int64_t nout;
+
+  // Pointer to the first indexed input element:
+  const uint8_t* x;
+
+  // Pointer to the first indexed output element:
+  uint8_t* out;
+
+  // Length of the fastest varying dimension (a reduced row or output lanes):
+  int64_t n0;
+
+  // Input stride of the fastest varying dimension:
+  int64_t xs0;
+
+  // Length of a row segment (note: when the fastest varying dimension is
+  // reduced, each row is split into `nseg` segments, each of which is reduced
+  // as a separate step):
+  int64_t seg;
+
+  // Number of segments per row:
+  int64_t nseg;
+
+  // Number of output lanes along the fastest varying non-reduced dimension:
+  int64_t nl;
+
+  // Maximum number of lanes accumulated at a time (i.e., the lane tile width):
+  int64_t lanes;
+
+  // Input stride of the lane dimension:
+  int64_t lxs;
+
+  // Output stride of the lane dimension:
+  int64_t los;
+
+  // Number of (remaining) reduced dimensions traversed as a stream of steps:
+  int64_t ns;
+
+  // Reduced dimension shape:
+  int64_t* sshape;
+
+  // Reduced dimension input strides:
+  int64_t* sstrides;
+
+  // Number of rows (i.e., the product of the reduced dimension shape):
+  int64_t nrows;
+
+  // Total number of steps (i.e., the number of rows times `nseg`):
+  int64_t nsteps;
+
+  // Number of pairwise accumulation levels:
+  int64_t nlevels;
+
+  // Number of outer (non-reduced) dimensions:
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension output strides:
+  int64_t* oos;
+
+  // Outer dimension subscripts:
+  int64_t* osub;
+
+  // Dimension meta data:
+  int64_t* meta;
+
+  // Number of bytes allocated for dimension meta data:
+  int64_t nmeta;
+};
+
+// Define a macro for defining the kernels for a single accumulator data type:
+#define NDARRAY_REDUCE_DEFINE(dtype, c, type, lo, hi, kind)                    \
+  static type ndarray_reduce_pairwise_##c(const type* x, const int64_t n) {    \
+    type r[8];                                                                 \
+    type s;                                                                    \
+    int64_t i;                                                                 \
+    int64_t m;                                                                 \
+    if (n < 8) {                                                               \
+      s = (type)0;                                                             \
+      for (i = 0; i < n; i++) {                                                \
+        s += x[i];                                                             \
+      }                                                                        \
+      return s;                                                                \
+    }                                                                          \
+    if (n <= NDARRAY_REDUCE_PAIRWISE_BLOCK) {                                  \
+      for (i = 0; i < 8; i++) {                                                \
+        r[i] = x[i];                                                           \
+      }                                                                        \
+      for (i = 8; i < n - (n % 8); i += 8) {                                   \
+        r[0] += x[i];                                                          \
+        r[1] += x[i + 1];                                                      \
+        r[2] += x[i + 2];                                                      \
+        r[3] += x[i + 3];                                                      \
+        r[4] += x[i + 4];                                                      \
+        r[5] += x[i + 5];                                                      \
+        r[6] += x[i + 6];                                                      \
+        r[7] += x[i + 7];                                                      \
+      }                                                                        \
+      s = ((r[0] + r[1]) + (r[2] + r[3])) + ((r[4] + r[5]) + (r[6] + r[7]));   \
+      for (; i < n; i++) {                                                     \
+        s += x[i];                                                             \
+      }                                                                        \
+      return s;                                                                \
+    }                                                                          \
+    m = n / 2;                                                                 \
+    m -= m % 8;                                                                \
+    return ndarray_reduce_pairwise_##c(x, m) +                                 \
+           ndarray_reduce_pairwise_##c(x + m, n - m);                          \
+  }                                                                            \
+  static void ndarray_reduce_sum_row_##c(                                      \
+      const uint8_t* x, const int64_t n, uint8_t* out                          \
+  ) {                                                                          \
+    *(type*)out = ndarray_reduce_pairwise_##c((const type*)x, n);              \
+  }                                                                            \
+  static void ndarray_reduce_prod_row_##c(                                     \
+      const uint8_t* x, const int64_t n, uint8_t* out                          \
+  ) {                                                                          \
+    const type* p = (const type*)x;                                            \
+    type r[4]     = {(type)1, (type)1, (type)1, (type)1};                      \
+    int64_t i;                                                                 \
+    for (i = 0; i < n - (n % 4); i += 4) {                                     \
+      r[0] *= p[i];                                                            \
+      r[1] *= p[i + 1];                                                        \
+      r[2] *= p[i + 2];                                                        \
+      r[3] *= p[i + 3];                                                        \
+    }                                                                          \
+    for (; i < n; i++) {                                                       \
+      r[0] *= p[i];                                                            \
+    }                                                                          \
+    *(type*)out = (r[0] * r[1]) * (r[2] * r[3]);                               \
+  }                                                                            \
+  static void ndarray_reduce_min_row_##c(                                      \
+      const uint8_t* x, const int64_t n, uint8_t* out                          \
+  ) {                                                                          \
+    const type* p = (const type*)x;                                            \
+    type m        = (type)(hi);                                                \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++) {                                                  \
+      if (p[i] < m || NDARRAY_REDUCE_ISNAN_##kind(p[i])) {                     \
+        m = p[i];                                                              \
+        if (NDARRAY_REDUCE_ISNAN_##kind(m)) {                                  \
+          break;                                                               \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    *(type*)out = m;                                                           \
+  }                                                                            \
+  static void ndarray_reduce_max_row_##c(                                      \
+      const uint8_t* x, const int64_t n, uint8_t* out                          \
+  ) {                                                                          \
+    const type* p = (const type*)x;                                            \
+    type m        = (type)(lo);                                                \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++) {                                                  \
+      if (p[i] > m || NDARRAY_REDUCE_ISNAN_##kind(p[i])) {                     \
+        m = p[i];                                                              \
+        if (NDARRAY_REDUCE_ISNAN_##kind(m)) {                                  \
+          break;                                                               \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    *(type*)out = m;                                                           \
+  }                                                                            \
+  static void ndarray_reduce_sum_combine_##c(                                  \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, const int64_t n        \
+  ) {                                                                          \
+    const type* p = (const type*)x;                                            \
+    type* a       = (type*)acc;                                                \
+    type v[4];                                                                 \
+    int64_t j;                                                                 \
+    if (sx == (int64_t)sizeof(type)) {                                         \
+      for (j = 0; j < n - (n % 4); j += 4) {                                   \
+        v[0] = p[j];                                                           \
+        v[1] = p[j + 1];                                                       \
+        v[2] = p[j + 2];                                                       \
+        v[3] = p[j + 3];                                                       \
+        a[j] += v[0];                                                          \
+        a[j + 1] += v[1];                                                      \
+        a[j + 2] += v[2];                                                      \
+        a[j + 3] += v[3];                                                      \
+      }                                                                        \
+      for (; j < n; j++) {                                                     \
+        a[j] += p[j];                                                          \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    for (j = 0; j < n; j++, x += sx) {                                         \
+      a[j] += *(const type*)x;                                                 \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_reduce_prod_combine_##c(                                 \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, const int64_t n        \
+  ) {                                                                          \
+    const type* p = (const type*)x;                                            \
+    type* a       = (type*)acc;                                                \
+    type v[4];                                                                 \
+    int64_t j;                                                                 \
+    if (sx == (int64_t)sizeof(type)) {                                         \
+      for (j = 0; j < n - (n % 4); j += 4) {                                   \
+        v[0] = p[j];                                                           \
+        v[1] = p[j + 1];                                                       \
+        v[2] = p[j + 2];                                                       \
+        v[3] = p[j + 3];                                                       \
+        a[j] *= v[0];                                                          \
+        a[j + 1] *= v[1];                                                      \
+        a[j + 2] *= v[2];                                                      \
+        a[j + 3] *= v[3];                                                      \
+      }                                                                        \
+      for (; j < n; j++) {                                                     \
+        a[j] *= p[j];                                                          \
+      }                                                                        \
+      return;                                                                  \
+    }                                                                          \
+    for (j = 0; j < n; j++, x += sx) {                                         \
+      a[j] *= *(const type*)x;                                                 \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_reduce_min_combine_##c(                                  \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, const int64_t n        \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    type v;                                                                    \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++, x += sx) {                                         \
+      v = *(const type*)x;                                                     \
+      a[j] = (v < a[j] || NDARRAY_REDUCE_ISNAN_##kind(v)) ? v : a[j];          \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_reduce_max_combine_##c(                                  \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, const int64_t n        \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    type v;                                                                    \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++, x += sx) {                                         \
+      v = *(const type*)x;                                                     \
+      a[j] = (v > a[j] || NDARRAY_REDUCE_ISNAN_##kind(v)) ? v : a[j];          \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_reduce_fill_##c(                                         \
+      uint8_t* acc, const int64_t n, const int8_t op                           \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    type v;                                                                    \
+    int64_t j;                                                                 \
+    switch (op) {                                                              \
+      case NDARRAY_REDUCE_PROD:                                                \
+        v = (type)1;                                                           \
+        break;                                                                 \
+      case NDARRAY_REDUCE_MIN:                                                 \
+        v = (type)(hi);                                                        \
+        break;                                                                 \
+      case NDARRAY_REDUCE_MAX:                                                 \
+        v = (type)(lo);                                                        \
+        break;                                                                 \
+      default:                                                                 \
+        v = (type)0;                                                           \
+    }                                                                          \
+    for (j = 0; j < n; j++) {                                                  \
+      a[j] = v;                                                                \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_reduce_scale_##c(                                        \
+      uint8_t* acc, const int64_t n, const int64_t count                       \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++) {                                                  \
+      a[j] = a[j] / (type)count;                                               \
+    }                                                                          \
+  }
+
+// Define kernels for all supported accumulator data types:
+NDARRAY_REDUCE_ACC_DTYPES(NDARRAY_REDUCE_DEFINE)
+
+// Define a macro for generating a kernel table entry:
+#define NDARRAY_REDUCE_TABLE_ENTRY(dtype, c, type, lo, hi, kind)               \
+  {dtype,                                                                      \
+   {ndarray_reduce_sum_row_##c, ndarray_reduce_prod_row_##c,                   \
+    ndarray_reduce_min_row_##c, ndarray_reduce_max_row_##c},                   \
+   {ndarray_reduce_sum_combine_##c, ndarray_reduce_prod_combine_##c,           \
+    ndarray_reduce_min_combine_##c, ndarray_reduce_max_combine_##c},           \
+   ndarray_reduce_fill_##c, ndarray_reduce_scale_##c},
+
+// Define a table of kernels for all supported accumulator data types:
+static const struct ndarrayReduceKernels NDARRAY_REDUCE_KERNELS[] = {
+    NDARRAY_REDUCE_ACC_DTYPES(NDARRAY_REDUCE_TABLE_ENTRY)};
+
+/**
+ * Returns the kernels for a specified accumulator data type.
+ *
+ * @private
+ * @param dtype  accumulator data type
+ * @return       kernels (or `NULL` if the data type is not supported)
+ */
+static const struct ndarrayReduceKernels* ndarray_reduce_kernels(
+    const int16_t dtype
+) {
+  size_t i;
+  for (i = 0; i < sizeof(NDARRAY_REDUCE_KERNELS) /
+                      sizeof(NDARRAY_REDUCE_KERNELS[0]);
+       i++) {
+    if (NDARRAY_REDUCE_KERNELS[i].dtype == dtype) {
+      return &(NDARRAY_REDUCE_KERNELS[i]);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_reduce_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Resolves which dimensions of an input ndarray are reduced.
+ *
+ * @private
+ * @param x      input ndarray
+ * @param naxes  number of axes
+ * @param axes   axes along which to reduce (or `NULL` to reduce all axes)
+ * @param out    output array for storing a boolean for each dimension
+ * @return       number of reduced dimensions (or `-1` if an axis is invalid)
+ */
+static int64_t ndarray_reduce_resolve_axes(
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    int64_t* out
+) {
+  int64_t nr;
+  int64_t a;
+  int64_t i;
+
+  if (axes == NULL) {
+    for (i = 0; i < x->ndims; i++) {
+      out[i] = 1;
+    }
+    return x->ndims;
+  }
+  for (i = 0; i < x->ndims; i++) {
+    out[i] = 0;
+  }
+  nr = 0;
+  for (i = 0; i < naxes; i++) {
+    a = (axes[i] < 0) ? axes[i] + x->ndims : axes[i];
+    if (a < 0 || a >= x->ndims || out[a]) {
+      return -1;
+    }
+    out[a] = 1;
+    nr += 1;
+  }
+  return nr;
+}
+
+/**
+ * Returns the default accumulator data type for reducing ndarray elements.
+ *
+ * ## Notes
+ *
+ * -   Sums and products of booleans and signed integers accumulate as signed
+ *     64-bit integers, and sums and products of unsigned integers accumulate
+ *     as unsigned 64-bit integers (thus avoiding overflow for small integer
+ *     data types).
+ * -   Minimum and maximum values accumulate as 64-bit integers for integer
+ *     data types.
+ * -   Means of booleans and integers accumulate as double-precision
+ *     floating-point numbers.
+ * -   Single- and double-precision floating-point numbers accumulate in their
+ *     own data type (note: pairwise summation keeps the rounding error of the
+ *     former small without widening).
+ * -   If a data type is not supported, the function returns `NDARRAY_NOTYPE`.
+ *
+ * @param op     reduction operation
+ * @param dtype  input ndarray data type
+ * @return       accumulator data type
+ *
+ * @example
+ * #include "ndarray/base/reduce.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/reduce_ops.h"
+ * #include <stdint.h>
+ *
+ * int16_t dt = ndarray_reduce_dtype(NDARRAY_REDUCE_SUM, NDARRAY_UINT8);
+ * // returns NDARRAY_UINT64
+ */
+int16_t ndarray_reduce_dtype(
+    const enum NDARRAY_REDUCE_OP op, const int16_t dtype
+) {
+  switch (dtype) {
+    case NDARRAY_FLOAT32:
+      return NDARRAY_FLOAT32;
+    case NDARRAY_FLOAT64:
+      return NDARRAY_FLOAT64;
+    case NDARRAY_BOOL:
+    case NDARRAY_INT8:
+    case NDARRAY_INT16:
+    case NDARRAY_INT32:
+    case NDARRAY_INT64:
+      return (op == NDARRAY_REDUCE_MEAN) ? NDARRAY_FLOAT64 : NDARRAY_INT64;
+    case NDARRAY_UINT8:
+    case NDARRAY_UINT8C:
+    case NDARRAY_UINT16:
+    case NDARRAY_UINT32:
+    case NDARRAY_UINT64:
+      return (op == NDARRAY_REDUCE_MEAN) ? NDARRAY_FLOAT64 : NDARRAY_UINT64;
+    default:
+      return NDARRAY_NOTYPE;
+  }
+}
+
+/**
+ * Resolves the shape of an ndarray reduced along one or more dimensions.
+ *
+ * ## Notes
+ *
+ * -   Negative axes are resolved relative to the last dimension. If `axes` is
+ *     `NULL`, the function reduces along all dimensions.
+ * -   If `keepdims` is nonzero, reduced dimensions are retained as singleton
+ *     dimensions; otherwise, reduced dimensions are removed.
+ * -   The output array should have at least `x->ndims` elements.
+ * -   If successful, the function returns the number of output dimensions;
+ *     otherwise (e.g., if an axis is out-of-bounds or repeated), the function
+ *     returns `-1`.
+ *
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param keepdims  boolean indicating whether to retain reduced dimensions
+ * @param out       output shape
+ * @return          number of output dimensions
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/reduce.h"
+ * #include <stdint.h>
+ *
+ * // Given an ndarray `x` having shape [2,3,4]...
+ * int64_t axes[] = {-1};
+ * int64_t out[3];
+ *
+ * int64_t ndims = ndarray_reduce_shape(x, 1, axes, 1, out);
+ * // returns 3
+ *
+ * // out => [2,3,1]
+ */
+int64_t ndarray_reduce_shape(
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    const int8_t keepdims, int64_t* out
+) {
+  int64_t* reduced;
+  int64_t nbytes;
+  int64_t n;
+  int64_t i;
+
+  if (x == NULL) {
+    return -1;
+  }
+  nbytes  = sizeof(int64_t) * (x->ndims + 1);
+  reduced = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (reduced == NULL) {
+    return -1;
+  }
+  n = -1;
+  if (ndarray_reduce_resolve_axes(x, naxes, axes, reduced) >= 0) {
+    n = 0;
+    for (i = 0; i < x->ndims; i++) {
+      if (!reduced[i]) {
+        out[n] = x->shape[i];
+        n += 1;
+      } else if (keepdims) {
+        out[n] = 1;
+        n += 1;
+      }
+    }
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, reduced, nbytes);
+  return n;
+}
+
+/**
+ * Merges an item (i.e., a block of accumulated values) with previously
+ * accumulated items, such that items are combined pairwise.
+ *
+ * ## Notes
+ *
+ * -   Level `l` holds the combination of `2^l` items, and the bits of `count`
+ *     indicate which levels are occupied (as in a binary counter). Hence, the
+ *     accumulation tree is balanced, and the rounding error grows as
+ *     `O(log(n))` rather than `O(n)`.
+ * -   The function overwrites the item.
+ *
+ * @private
+ * @param loop    reduction loop
+ * @param levels  accumulation levels
+ * @param count   number of previously accumulated items
+ * @param item    item
+ * @param n       number of lanes
+ */
+static void ndarray_reduce_push(
+    const struct ndarrayReduceLoop* loop, uint8_t* levels, uint64_t* count,
+    uint8_t* item, const int64_t n
+) {
+  int64_t stride;
+  uint64_t c;
+  int64_t l;
+
+  stride = loop->lanes * loop->bpe;
+  c      = *count;
+  l      = 0;
+  while (c & 1) {
+    loop->kernels->combine[loop->op](item, levels + (l * stride), loop->bpe, n);
+    c >>= 1;
+    l += 1;
+  }
+  memcpy(levels + (l * stride), item, (size_t)(n * loop->bpe));
+  *count += 1;
+}
+
+/**
+ * Reduces a range of steps for a set of lanes.
+ *
+ * ## Notes
+ *
+ * -   When the fastest varying dimension is reduced, each step reduces a row
+ *     segment along that dimension (a single lane). Contiguous segments having
+ *     the accumulator data type are reduced in place; otherwise, segments are
+ *     converted to the accumulator data type in chunks.
+ * -   Otherwise, each step combines one element per lane along the fastest
+ *     varying dimension, accumulating blocks of rows before merging blocks
+ *     pairwise. Hence, the per-row work is a single pass over the lanes, and
+ *     the pairwise merge only runs once per block.
+ * -   The accumulated values only depend on the range of steps (and not on how
+ *     other ranges are processed), which is what allows reducing disjoint
+ *     ranges in parallel and combining the results reproducibly.
+ * -   The scratch buffer should be allocated according to
+ *     `ndarray_reduce_scratch_bytes`.
+ *
+ * @private
+ * @param loop     reduction loop
+ * @param x        pointer to the first indexed input element
+ * @param n        number of lanes
+ * @param s0       index of the first step
+ * @param s1       index one past the last step
+ * @param scratch  scratch buffer
+ * @param out      output buffer for storing accumulated lane values
+ */
+static void ndarray_reduce_range(
+    const struct ndarrayReduceLoop* loop, const uint8_t* x, const int64_t n,
+    const int64_t s0, const int64_t s1, uint8_t* scratch, uint8_t* out
+) {
+  const struct ndarrayReduceKernels* k;
+  ndarrayReduceCombineFcn combine;
+  ndarrayStridedCastFcn fcn;
+  ndarrayReduceRowFcn row;
+  const uint8_t* xp;
+  uint8_t* levels;
+  uint64_t count;
+  int64_t stride;
+  uint8_t* blk;
+  uint8_t* tmp;
+  int64_t* sub;
+  int64_t bpe;
+  int64_t len;
+  int64_t nb;
+  int64_t r;
+  int64_t q;
+  int64_t s;
+  int64_t c;
+  int64_t m;
+  int64_t j;
+
+  k       = loop->kernels;
+  bpe     = loop->bpe;
+  row     = k->row[loop->op];
+  combine = k->combine[loop->op];
+  fcn     = (loop->icast == NULL) ? loop->gather : loop->icast;
+  stride  = loop->lanes * bpe;
+  sub     = (int64_t*)scratch;
+  levels  = scratch + (sizeof(int64_t) * loop->ns);
+  blk     = levels + (loop->nlevels * stride);
+  tmp     = blk + stride;
+
+  // Resolve the subscripts of the first step...
+  r = s0 / loop->nseg;
+  q = s0 % loop->nseg;
+  for (j = 0; j < loop->ns && r > 0; j++) {
+    sub[j] = r % loop->sshape[j];
+    r /= loop->sshape[j];
+    x += sub[j] * loop->sstrides[j];  // pointer arithmetic
+  }
+  for (; j < loop->ns; j++) {
+    sub[j] = 0;
+  }
+  count = 0;
+  nb    = 0;
+  k->fill(blk, n, loop->op);
+  for (s = s0; s < s1; s++) {
+    if (loop->inner) {
+      len = loop->n0 - (q * loop->seg);
+      len = (len < loop->seg) ? len : loop->seg;
+      xp  = x + (q * loop->seg * loop->xs0);
+      if (loop->icast == NULL && loop->xs0 == bpe) {
+        row(xp, len, blk);
+        ndarray_reduce_push(loop, levels, &count, blk, 1);
+      } else {
+        for (c = 0; c < len; c += NDARRAY_REDUCE_CHUNK) {
+          m = len - c;
+          m = (m < NDARRAY_REDUCE_CHUNK) ? m : NDARRAY_REDUCE_CHUNK;
+          fcn(xp + (c * loop->xs0), loop->xs0, tmp, bpe, m);
+          row(tmp, m, blk);
+          ndarray_reduce_push(loop, levels, &count, blk, 1);
+        }
+      }
+      // Move to the next segment of the current row, if one remains...
+      q += 1;
+      if (q < loop->nseg) {
+        continue;
+      }
+      q = 0;
+    } else {
+      if (loop->icast == NULL) {
+        combine(blk, x, loop->xs0, n);
+      } else {
+        loop->icast(x, loop->xs0, tmp, bpe, n);
+        combine(blk, tmp, bpe, n);
+      }
+      nb += 1;
+      if (nb == NDARRAY_REDUCE_BLOCK) {
+        ndarray_reduce_push(loop, levels, &count, blk, n);
+        k->fill(blk, n, loop->op);
+        nb = 0;
+      }
+    }
+    // Advance the step subscripts...
+    for (j = 0; j < loop->ns; j++) {
+      sub[j] += 1;
+      x += loop->sstrides[j];  // pointer arithmetic
+      if (sub[j] < loop->sshape[j]) {
+        break;
+      }
+      x -= loop->sstrides[j] * loop->sshape[j];  // pointer arithmetic
+      sub[j] = 0;
+    }
+  }
+  if (nb > 0) {
+    ndarray_reduce_push(loop, levels, &count, blk, n);
+  }
+  // Combine the occupied levels, starting with the level holding the earliest
+  // items:
+  k->fill(out, n, loop->op);
+  for (j = loop->nlevels - 1; j >= 0; j--) {
+    if ((count >> j) & 1) {
+      combine(out, levels + (j * stride), bpe, n);
+    }
+  }
+}
+
+/**
+ * Returns the number of bytes required for the scratch buffer used by
+ * `ndarray_reduce_range`.
+ *
+ * @private
+ * @param loop  reduction loop
+ * @return      number of bytes
+ */
+static int64_t ndarray_reduce_scratch_bytes(
+    const struct ndarrayReduceLoop* loop
+) {
+  return ((loop->nlevels + 1) * loop->lanes * loop->bpe) +
+         (NDARRAY_REDUCE_CHUNK * loop->bpe) + (sizeof(int64_t) * loop->ns);
+}
+
+/**
+ * Splits reduced rows into a specified number of segments and resolves the
+ * number of pairwise accumulation levels.
+ *
+ * @private
+ * @param loop  reduction loop
+ * @param nseg  number of segments per reduced row
+ */
+static void ndarray_reduce_segment(
+    struct ndarrayReduceLoop* loop, const int64_t nseg
+) {
+  uint64_t nitems;
+
+  loop->seg  = loop->n0;
+  loop->nseg = 1;
+  if (loop->inner && nseg > 1) {
+    // Keep segments a multiple of the conversion chunk size, so that the
+    // number of items is the same as for unsegmented rows:
+    loop->seg = (loop->n0 + nseg - 1) / nseg;
+    loop->seg = ((loop->seg + NDARRAY_REDUCE_CHUNK - 1) /
+                 NDARRAY_REDUCE_CHUNK) *
+                NDARRAY_REDUCE_CHUNK;
+    loop->nseg = (loop->n0 + loop->seg - 1) / loop->seg;
+  }
+  loop->nsteps = loop->nrows * loop->nseg;
+
+  // Determine the maximum number of items accumulated pairwise...
+  if (loop->inner) {
+    nitems = (uint64_t)loop->nsteps;
+    if (loop->icast != NULL || loop->xs0 != loop->bpe) {
+      nitems *= (uint64_t)((loop->seg + NDARRAY_REDUCE_CHUNK - 1) /
+                           NDARRAY_REDUCE_CHUNK);
+    }
+  } else {
+    nitems = (uint64_t)((loop->nsteps + NDARRAY_REDUCE_BLOCK - 1) /
+                        NDARRAY_REDUCE_BLOCK);
+  }
+  loop->nlevels = 1;
+  while (nitems >> loop->nlevels) {
+    loop->nlevels += 1;
+  }
+}
+
+/**
+ * Frees dimension meta data allocated by `ndarray_reduce_init`.
+ *
+ * @private
+ * @param loop  reduction loop
+ */
+static void ndarray_reduce_loop_free(struct ndarrayReduceLoop* loop) {
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop->meta, loop->nmeta);
+}
+
+/**
+ * Validates reduction arguments and initializes a reduction loop.
+ *
+ * ## Notes
+ *
+ * -   If successful, the function returns `0`, and the caller must free the
+ *     loop using `ndarray_reduce_loop_free`; otherwise, the function returns
+ *     `-1`.
+ * -   If the output ndarray is empty, the function sets `loop->nout` to `0`.
+ *
+ * @private
+ * @param loop      reduction loop
+ * @param op        reduction operation
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param keepdims  boolean indicating whether to retain reduced dimensions
+ * @param acc       accumulator data type
+ * @param out       output ndarray
+ * @return          status code
+ */
+static int8_t ndarray_reduce_init(
+    struct ndarrayReduceLoop* loop, const enum NDARRAY_REDUCE_OP op,
+    const struct ndarray* x, const int64_t naxes, const int64_t* axes,
+    const int8_t keepdims, const int16_t acc, struct ndarray* out
+) {
+  int64_t* shape;
+  int64_t* xs;
+  int64_t* os;
+  int64_t* red;
+  int64_t ndims;
+  int64_t nr;
+  int64_t nd;
+  int64_t d;
+  int64_t i;
+  int64_t j;
+  int64_t r;
+  int64_t s;
+
+  if (x == NULL || out == NULL || op < NDARRAY_REDUCE_SUM ||
+      op > NDARRAY_REDUCE_MEAN) {
+    return -1;
+  }
+  if (ndarray_reduce_dtype(NDARRAY_REDUCE_SUM, x->dtype) == NDARRAY_NOTYPE) {
+    return -1;
+  }
+  loop->kernels = ndarray_reduce_kernels(acc);
+  if (loop->kernels == NULL) {
+    return -1;
+  }
+  loop->op     = (op == NDARRAY_REDUCE_MEAN) ? NDARRAY_REDUCE_SUM : (int8_t)op;
+  loop->mean   = (op == NDARRAY_REDUCE_MEAN);
+  loop->bpe    = ndarray_bytes_per_element(acc);
+  loop->gather = ndarray_strided_cast_function(acc, acc);
+  loop->ocast  = ndarray_strided_cast_function(acc, out->dtype);
+  loop->icast  = NULL;
+  if (x->dtype != acc) {
+    loop->icast = ndarray_strided_cast_function(x->dtype, acc);
+  }
+  if (loop->gather == NULL || loop->ocast == NULL ||
+      (x->dtype != acc && loop->icast == NULL)) {
+    return -1;
+  }
+  ndims = x->ndims;
+
+  // Allocate scratch memory for dimension meta data:
+  loop->nmeta = sizeof(int64_t) * ((ndims * 10) + 1);
+  loop->meta  = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, loop->nmeta);
+  if (loop->meta == NULL) {
+    return -1;
+  }
+  shape          = loop->meta;
+  xs             = shape + ndims;
+  os             = xs + ndims;
+  red            = os + ndims;
+  loop->oshape   = red + ndims;
+  loop->oxs      = loop->oshape + ndims;
+  loop->oos      = loop->oxs + ndims;
+  loop->osub     = loop->oos + ndims;
+  loop->sshape   = loop->osub + ndims;
+  loop->sstrides = loop->sshape + ndims;
+
+  // Resolve the reduced dimensions and validate the output shape...
+  nr = ndarray_reduce_resolve_axes(x, naxes, axes, red);
+  if (nr < 0 || out->ndims != (keepdims ? ndims : ndims - nr)) {
+    ndarray_reduce_loop_free(loop);
+    return -1;
+  }
+  loop->count = 1;
+  loop->nout  = 1;
+  for (i = 0, j = 0; i < ndims; i++) {
+    if (red[i]) {
+      loop->count *= x->shape[i];
+      if (keepdims) {
+        if (out->shape[j] != 1) {
+          break;
+        }
+        j += 1;
+      }
+      os[i] = 0;
+    } else {
+      if (out->shape[j] != x->shape[i]) {
+        break;
+      }
+      loop->nout *= x->shape[i];
+      os[i] = out->strides[j];
+      j += 1;
+    }
+    shape[i] = x->shape[i];
+    xs[i]    = x->strides[i];
+  }
+  if (i < ndims ||
+      (loop->count == 0 &&
+       (loop->op == NDARRAY_REDUCE_MIN || loop->op == NDARRAY_REDUCE_MAX ||
+        (loop->mean && acc != NDARRAY_FLOAT32 && acc != NDARRAY_FLOAT64)))) {
+    ndarray_reduce_loop_free(loop);
+    return -1;
+  }
+  // Drop singleton dimensions and sort the remaining dimensions by increasing
+  // input stride, such that inner loops visit input elements in memory order:
+  nd = 0;
+  for (i = 0; i < ndims; i++) {
+    if (x->shape[i] == 1) {
+      continue;
+    }
+    r = red[i];
+    s = os[i];
+    for (j = nd; j > 0 && ndarray_reduce_abs(xs[j - 1]) >
+                              ndarray_reduce_abs(x->strides[i]);
+         j--) {
+      shape[j] = shape[j - 1];
+      xs[j]    = xs[j - 1];
+      os[j]    = os[j - 1];
+      red[j]   = red[j - 1];
+    }
+    shape[j] = x->shape[i];
+    xs[j]    = x->strides[i];
+    os[j]    = s;
+    red[j]   = r;
+    nd += 1;
+  }
+  // Coalesce adjacent dimensions which can be traversed as a single dimension:
+  for (i = 1, j = 0; i < nd; i++) {
+    if (red[i] == red[j] && xs[i] == xs[j] * shape[j] &&
+        os[i] == os[j] * shape[j]) {
+      shape[j] *= shape[i];
+      continue;
+    }
+    j += 1;
+    shape[j] = shape[i];
+    xs[j]    = xs[i];
+    os[j]    = os[i];
+    red[j]   = red[i];
+  }
+  nd = (nd > 0) ? j + 1 : 0;
+
+  // Determine whether to reduce rows along the fastest varying dimension or
+  // to accumulate lanes along the fastest varying dimension...
+  loop->inner = 0;
+  if (nd > 0 && red[0]) {
+    loop->inner = 1;
+    if (shape[0] < NDARRAY_REDUCE_MIN_ROW) {
+      for (i = 1; i < nd; i++) {
+        if (!red[i]) {
+          loop->inner = 0;
+          break;
+        }
+      }
+    }
+  }
+  loop->nl  = 1;
+  loop->lxs = 0;
+  loop->los = 0;
+  d         = -1;
+  if (loop->inner) {
+    d = 0;
+  } else {
+    for (i = 0; i < nd; i++) {
+      if (!red[i]) {
+        d         = i;
+        loop->nl  = shape[i];
+        loop->lxs = xs[i];
+        loop->los = os[i];
+        break;
+      }
+    }
+  }
+  // Accumulate all lanes at once when they fit in cache; otherwise, split
+  // lanes into tiles:
+  loop->lanes = NDARRAY_REDUCE_LANE_BYTES / loop->bpe;
+  loop->lanes = (loop->nl < loop->lanes) ? loop->nl : loop->lanes;
+  loop->n0    = (d >= 0) ? shape[d] : 1;
+  loop->xs0   = (d >= 0) ? xs[d] : 0;
+  loop->ns    = 0;
+  loop->no    = 0;
+  loop->nrows = 1;
+  for (i = 0; i < nd; i++) {
+    if (i == d) {
+      continue;
+    }
+    if (red[i]) {
+      loop->sshape[loop->ns]   = shape[i];
+      loop->sstrides[loop->ns] = xs[i];
+      loop->nrows *= shape[i];
+      loop->ns += 1;
+    } else {
+      loop->oshape[loop->no] = shape[i];
+      loop->oxs[loop->no]    = xs[i];
+      loop->oos[loop->no]    = os[i];
+      loop->osub[loop->no]   = 0;
+      loop->no += 1;
+    }
+  }
+  if (loop->count == 0) {
+    loop->nrows = 0;
+  }
+  loop->x   = x->data + x->offset;
+  loop->out = out->data + out->offset;
+  ndarray_reduce_segment(loop, 1);
+  return 0;
+}
+
+/**
+ * Writes accumulated lane values to an output ndarray.
+ *
+ * @private
+ * @param loop  reduction loop
+ * @param acc   accumulated values
+ * @param n     number of lanes
+ * @param out   pointer to the first output element
+ */
+static void ndarray_reduce_finish(
+    const struct ndarrayReduceLoop* loop, uint8_t* acc, const int64_t n,
+    uint8_t* out
+) {
+  if (loop->mean) {
+    loop->kernels->scale(acc, n, loop->count);
+  }
+  loop->ocast(acc, loop->bpe, out, loop->los, n);
+}
+
+/**
+ * Reduces the elements of an input ndarray along one or more dimensions.
+ *
+ * ## Notes
+ *
+ * -   Negative axes are resolved relative to the last dimension. If `axes` is
+ *     `NULL`, the function reduces along all dimensions.
+ * -   The output ndarray must have the shape returned by
+ *     `ndarray_reduce_shape` for the same axes and `keepdims` option.
+ * -   Elements are accumulated using the specified accumulator data type (see
+ *     `ndarray_reduce_dtype` for defaults). Supported accumulator data types
+ *     are signed and unsigned 64-bit integers and single- and double-precision
+ *     floating-point numbers. Accumulated values are converted to the output
+ *     ndarray data type following C conversion semantics.
+ * -   Sums are computed using pairwise summation, such that the rounding error
+ *     grows as `O(log(n))` rather than `O(n)`, regardless of memory layout:
+ *
+ *     -   If the fastest varying dimension is reduced, the function reduces
+ *         each row along that dimension using unrolled pairwise summation,
+ *         converting non-contiguous rows in cache-sized chunks.
+ *     -   Otherwise, the function accumulates blocks of output lanes along the
+ *         fastest varying dimension, such that input elements are read in
+ *         memory order, and merges blocks pairwise.
+ *
+ * -   Minimum and maximum values propagate `NaN`.
+ * -   The sum of an empty reduction is `0`, the product is `1`, and the mean
+ *     is `NaN`. Minimum and maximum values of an empty reduction are
+ *     undefined, and the function returns an error.
+ * -   The input and output ndarrays must **not** share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param op        reduction operation
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param keepdims  boolean indicating whether to retain reduced dimensions
+ * @param acc       accumulator data type
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/reduce.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include "ndarray/reduce_ops.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major input ndarray:
+ * float xbuf[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+ * int64_t shape[] = {2, 3};
+ * int64_t xstrides[] = {12, 4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT32, (uint8_t *)xbuf, 2, shape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * double ybuf[] = {0.0, 0.0, 0.0};
+ * int64_t yshape[] = {3};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Sum over the first dimension:
+ * int64_t axes[] = {0};
+ * int8_t status = ndarray_reduce(
+ *     NDARRAY_REDUCE_SUM, x, 1, axes, 0, NDARRAY_FLOAT64, y
+ * );
+ * // ybuf => {5.0, 7.0, 9.0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_reduce(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int8_t keepdims,
+    const int16_t acc, struct ndarray* out
+) {
+  struct ndarrayReduceLoop loop;
+  const uint8_t* ip;
+  uint8_t* scratch;
+  uint8_t* res;
+  uint8_t* op0;
+  int64_t sb;
+  int64_t w;
+  int64_t i;
+  int64_t k;
+
+  if (ndarray_reduce_init(&loop, op, x, naxes, axes, keepdims, acc, out)) {
+    return -1;
+  }
+  if (loop.nout == 0) {
+    ndarray_reduce_loop_free(&loop);
+    return 0;
+  }
+  // Allocate scratch memory for accumulating lanes:
+  sb      = ndarray_reduce_scratch_bytes(&loop);
+  scratch = ndarray_memory_malloc(
+      NDARRAY_MEMORY_SCRATCH, sb + (loop.lanes * loop.bpe)
+  );
+  if (scratch == NULL) {
+    ndarray_reduce_loop_free(&loop);
+    return -1;
+  }
+  res = scratch + sb;
+
+  ip  = loop.x;
+  op0 = loop.out;
+  do {
+    for (i = 0; i < loop.nl; i += loop.lanes) {
+      w = loop.nl - i;
+      w = (w < loop.lanes) ? w : loop.lanes;
+      ndarray_reduce_range(
+          &loop, ip + (i * loop.lxs), w, 0, loop.nsteps, scratch, res
+      );
+      ndarray_reduce_finish(&loop, res, w, op0 + (i * loop.los));
+    }
+    // Advance the outer loop subscripts...
+    for (k = 0; k < loop.no; k++) {
+      loop.osub[k] += 1;
+      ip += loop.oxs[k];   // pointer arithmetic
+      op0 += loop.oos[k];  // pointer arithmetic
+      if (loop.osub[k] < loop.oshape[k]) {
+        break;
+      }
+      ip -= loop.oxs[k] * loop.oshape[k];   // pointer arithmetic
+      op0 -= loop.oos[k] * loop.oshape[k];  // pointer arithmetic
+      loop.osub[k] = 0;
+    }
+  } while (k < loop.no);
+
+  ndarray_memory_free(
+      NDARRAY_MEMORY_SCRATCH, scratch, sb + (loop.lanes * loop.bpe)
+  );
+  ndarray_reduce_loop_free(&loop);
+  return 0;
+}
+
+/**
+ * Structure describing a parallel reduction.
+ *
+ * @private
+ */
+struct ndarrayReduceTasks {
+  // Reduction loop:
+  const struct ndarrayReduceLoop* loop;
+
+  // Number of lane tiles per outer index:
+  int64_t nlt;
+
+  // Number of chunks per tile:
+  int64_t nchunks;
+
+  // Per-thread scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+
+  // Partial results (indexed by task):
+  uint8_t* partials;
+};
+
+/**
+ * Resolves the input and output pointers of a tile of output lanes.
+ *
+ * @private
+ * @param tasks  parallel reduction
+ * @param t      tile index
+ * @param x      output argument for the pointer to the first input element
+ * @param out    output argument for the pointer to the first output element
+ * @return       number of lanes
+ */
+static int64_t ndarray_reduce_tile(
+    const struct ndarrayReduceTasks* tasks, const int64_t t,
+    const uint8_t** x, uint8_t** out
+) {
+  const struct ndarrayReduceLoop* loop;
+  int64_t r;
+  int64_t s;
+  int64_t i;
+  int64_t k;
+
+  loop = tasks->loop;
+  i    = (t % tasks->nlt) * loop->lanes;
+  r    = t / tasks->nlt;
+  *x   = loop->x + (i * loop->lxs);
+  *out = loop->out + (i * loop->los);
+  for (k = 0; k < loop->no; k++) {
+    s = r % loop->oshape[k];
+    r /= loop->oshape[k];
+    *x += s * loop->oxs[k];     // pointer arithmetic
+    *out += s * loop->oos[k];  // pointer arithmetic
+  }
+  i = loop->nl - i;
+  return (i < loop->lanes) ? i : loop->lanes;
+}
+
+/**
+ * Reduces a single chunk of steps for a tile of output lanes.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  parallel reduction
+ */
+static void ndarray_reduce_chunk_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayReduceTasks* tasks;
+  const struct ndarrayReduceLoop* loop;
+  const uint8_t* ip;
+  uint8_t* scratch;
+  uint8_t* res;
+  uint8_t* op;
+  int64_t s0;
+  int64_t s1;
+  int64_t c;
+  int64_t w;
+
+  tasks   = (const struct ndarrayReduceTasks*)ctx;
+  loop    = tasks->loop;
+  c       = i % tasks->nchunks;
+  w       = ndarray_reduce_tile(tasks, i / tasks->nchunks, &ip, &op);
+  s0      = (loop->nsteps * c) / tasks->nchunks;
+  s1      = (loop->nsteps * (c + 1)) / tasks->nchunks;
+  scratch = tasks->scratch + (tid * tasks->sb);
+  if (tasks->nchunks == 1) {
+    res = scratch + ndarray_reduce_scratch_bytes(loop);
+    ndarray_reduce_range(loop, ip, w, s0, s1, scratch, res);
+    ndarray_reduce_finish(loop, res, w, op);
+    return;
+  }
+  res = tasks->partials + (i * loop->lanes * loop->bpe);
+  ndarray_reduce_range(loop, ip, w, s0, s1, scratch, res);
+}
+
+/**
+ * Combines the partial results of a tile of output lanes in a fixed pairwise
+ * order and writes the results to the output ndarray.
+ *
+ * @private
+ * @param t    tile index
+ * @param tid  thread index
+ * @param ctx  parallel reduction
+ */
+static void ndarray_reduce_merge_task(int64_t t, int32_t tid, void* ctx) {
+  const struct ndarrayReduceTasks* tasks;
+  const struct ndarrayReduceLoop* loop;
+  ndarrayReduceCombineFcn combine;
+  const uint8_t* ip;
+  int64_t stride;
+  uint8_t* p;
+  uint8_t* op;
+  int64_t h;
+  int64_t c;
+  int64_t w;
+
+  (void)tid;
+  tasks   = (const struct ndarrayReduceTasks*)ctx;
+  loop    = tasks->loop;
+  combine = loop->kernels->combine[loop->op];
+  stride  = loop->lanes * loop->bpe;
+  w       = ndarray_reduce_tile(tasks, t, &ip, &op);
+  p       = tasks->partials + (t * tasks->nchunks * stride);
+  for (h = 1; h < tasks->nchunks; h *= 2) {
+    for (c = 0; c + h < tasks->nchunks; c += 2 * h) {
+      combine(p + (c * stride), p + ((c + h) * stride), loop->bpe, w);
+    }
+  }
+  ndarray_reduce_finish(loop, p, w, op);
+}
+
+/**
+ * Reduces the elements of an input ndarray along one or more dimensions using
+ * multiple threads, such that results do not depend on the number of threads.
+ *
+ * ## Notes
+ *
+ * -   The function accepts the same arguments as `ndarray_reduce` (see
+ *     `ndarray_reduce` for details), along with the number of threads to use.
+ *     If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   The reduction is split into tasks as follows:
+ *
+ *     -   Output elements are grouped into tiles of lanes, each of which is
+ *         reduced independently.
+ *     -   When there are too few tiles to occupy many threads, the reduced
+ *         elements of each tile are split into a fixed number of contiguous
+ *         chunks (long rows are split into segments). The number of chunks
+ *         is determined solely by the shape and memory layout of the input
+ *         and output ndarrays.
+ *     -   Each chunk is reduced using pairwise summation, and the partial
+ *         results of a tile are combined in a fixed pairwise tree order
+ *         (i.e., chunk `0` with chunk `1`, chunk `2` with chunk `3`, and so
+ *         on, followed by combining the results of each pair).
+ *
+ *     Hence, floating-point results are bit-identical across runs and for any
+ *     number of threads (including a single thread). Results may differ in
+ *     the last bits from `ndarray_reduce`, which does not split reductions
+ *     into chunks.
+ *
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param op        reduction operation
+ * @param x         input ndarray
+ * @param naxes     number of axes
+ * @param axes      axes along which to reduce
+ * @param keepdims  boolean indicating whether to retain reduced dimensions
+ * @param acc       accumulator data type
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/reduce.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/reduce_ops.h"
+ * #include <stdint.h>
+ *
+ * // Given a float64 ndarray `x` having shape [1000000] and a zero-dimensional
+ * // float64 ndarray `y`...
+ * int8_t status = ndarray_reduce_parallel(
+ *     NDARRAY_REDUCE_SUM, x, 0, NULL, 0, NDARRAY_FLOAT64, 0, y
+ * );
+ */
+int8_t ndarray_reduce_parallel(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t naxes, const int64_t* axes, const int8_t keepdims,
+    const int16_t acc, int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayReduceTasks tasks;
+  struct ndarrayReduceLoop loop;
+  int64_t nbytes;
+  int64_t ntiles;
+  int64_t ntasks;
+  int64_t work;
+  int64_t n;
+  int8_t status;
+
+  if (ndarray_reduce_init(&loop, op, x, naxes, axes, keepdims, acc, out)) {
+    return -1;
+  }
+  if (loop.nout == 0) {
+    ndarray_reduce_loop_free(&loop);
+    return 0;
+  }
+  tasks.loop    = &loop;
+  tasks.nlt     = (loop.nl + loop.lanes - 1) / loop.lanes;
+  tasks.nchunks = 1;
+  ntiles        = (loop.nout / loop.nl) * tasks.nlt;
+
+  // Split the reduced elements of each tile into chunks when there are too few
+  // tiles (note: this must only depend on the ndarray shapes and layouts)...
+  if (ntiles < NDARRAY_REDUCE_PARALLEL_TASKS) {
+    work = loop.count;
+    if (!loop.inner) {
+      work *= loop.lanes;
+    }
+    n = (NDARRAY_REDUCE_PARALLEL_TASKS + ntiles - 1) / ntiles;
+    if (n > work / NDARRAY_REDUCE_PARALLEL_MIN_ELEMENTS) {
+      n = work / NDARRAY_REDUCE_PARALLEL_MIN_ELEMENTS;
+    }
+    if (n > 1) {
+      if (loop.inner && loop.nrows < n) {
+        ndarray_reduce_segment(&loop, (n + loop.nrows - 1) / loop.nrows);
+      }
+      tasks.nchunks = (n < loop.nsteps) ? n : loop.nsteps;
+      tasks.nchunks = (tasks.nchunks > 1) ? tasks.nchunks : 1;
+    }
+  }
+  ntasks = ntiles * tasks.nchunks;
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory and memory for partial results (note:
+  // per-thread buffers are rounded up to a multiple of eight bytes, as each
+  // buffer begins with step subscripts)...
+  tasks.sb = ndarray_reduce_scratch_bytes(&loop) + (loop.lanes * loop.bpe);
+  tasks.sb = ((tasks.sb + 7) / 8) * 8;
+  nbytes   = tasks.sb * nthreads;
+  if (tasks.nchunks > 1) {
+    nbytes += ntasks * loop.lanes * loop.bpe;
+  }
+  tasks.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (tasks.scratch == NULL) {
+    ndarray_reduce_loop_free(&loop);
+    return -1;
+  }
+  tasks.partials = tasks.scratch + (tasks.sb * nthreads);
+
+  status = ndarray_parallel_for(
+      ntasks, nthreads, ndarray_reduce_chunk_task, &tasks
+  );
+  if (status == 0 && tasks.nchunks > 1) {
+    status = ndarray_parallel_for(
+        ntiles, nthreads, ndarray_reduce_merge_task, &tasks
+    );
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, tasks.scratch, nbytes);
+  ndarray_reduce_loop_free(&loop);
+  return status;
+}
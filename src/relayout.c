@@ -0,0 +1,379 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/relayout.h"
+#include <stdint.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/numel.h"
+#include "ndarray/base/shape2strides.h"
+#include "ndarray/macros.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/orders.h"
+
+// Define the maximum number of bytes occupied by a pair of tiles which are
+// swapped when transposing a square matrix (note: this should comfortably fit
+// within L1 cache):
+#define NDARRAY_RELAYOUT_TILE_BYTES 16384
+
+// Define the maximum tile size (in elements along each tiled dimension):
+#define NDARRAY_RELAYOUT_MAX_TILE_SIZE 64
+
+/**
+ * Copies a single element.
+ *
+ * ## Notes
+ *
+ * -   Common element sizes are specialized so that the compiler can replace
+ *     calls to `memcpy` with register moves.
+ *
+ * @private
+ * @param dst     destination
+ * @param src     source
+ * @param nbytes  number of bytes per element
+ */
+static inline void ndarray_relayout_move(
+    uint8_t* dst, const uint8_t* src, const int64_t nbytes
+) {
+  switch (nbytes) {
+    case 1:
+      *dst = *src;
+      break;
+    case 2:
+      memcpy(dst, src, 2);
+      break;
+    case 4:
+      memcpy(dst, src, 4);
+      break;
+    case 8:
+      memcpy(dst, src, 8);
+      break;
+    case 16:
+      memcpy(dst, src, 16);
+      break;
+    default:
+      memcpy(dst, src, (size_t)nbytes);
+  }
+}
+
+/**
+ * Swaps two elements.
+ *
+ * @private
+ * @param a       first element
+ * @param b       second element
+ * @param nbytes  number of bytes per element
+ * @param tmp     scratch space for a single element
+ */
+static inline void ndarray_relayout_swap(
+    uint8_t* a, uint8_t* b, const int64_t nbytes, uint8_t* tmp
+) {
+  ndarray_relayout_move(tmp, a, nbytes);
+  ndarray_relayout_move(a, b, nbytes);
+  ndarray_relayout_move(b, tmp, nbytes);
+}
+
+/**
+ * Transposes a square matrix in-place by swapping pairs of tiles mirrored
+ * across the main diagonal.
+ *
+ * @private
+ * @param x       pointer to the first matrix element
+ * @param n       number of rows (and columns)
+ * @param nbytes  number of bytes per element
+ * @param tmp     scratch space for a single element
+ */
+static void ndarray_relayout_square(
+    uint8_t* x, const int64_t n, const int64_t nbytes, uint8_t* tmp
+) {
+  int64_t ib;
+  int64_t jb;
+  int64_t ie;
+  int64_t je;
+  int64_t i;
+  int64_t j;
+  int64_t T;
+
+  T = NDARRAY_RELAYOUT_MAX_TILE_SIZE;
+  while (T > 1 && 2 * T * T * nbytes > NDARRAY_RELAYOUT_TILE_BYTES) {
+    T /= 2;
+  }
+  for (ib = 0; ib < n; ib += T) {
+    ie = (ib + T < n) ? ib + T : n;
+    for (jb = ib; jb < n; jb += T) {
+      je = (jb + T < n) ? jb + T : n;
+      for (i = ib; i < ie; i++) {
+        // For tiles on the diagonal, only swap elements above the diagonal:
+        j = (jb == ib) ? i + 1 : jb;
+        for (; j < je; j++) {
+          ndarray_relayout_swap(
+              x + (((i * n) + j) * nbytes), x + (((j * n) + i) * nbytes),
+              nbytes, tmp
+          );
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Returns the linear index of the element which should be moved to a specified
+ * linear index in the new memory layout.
+ *
+ * @private
+ * @param idx    linear index in the new memory layout
+ * @param ndims  number of dimensions
+ * @param shape  array shape
+ * @param to     strides (in units of elements) of the new memory layout
+ * @param from   strides (in units of elements) of the current memory layout
+ * @return       linear index in the current memory layout
+ */
+static inline int64_t ndarray_relayout_source(
+    const int64_t idx, const int64_t ndims, const int64_t* shape,
+    const int64_t* to, const int64_t* from
+) {
+  int64_t out;
+  int64_t i;
+
+  out = 0;
+  for (i = 0; i < ndims; i++) {
+    out += ((idx / to[i]) % shape[i]) * from[i];
+  }
+  return out;
+}
+
+/**
+ * Permutes contiguous ndarray elements in-place by following the cycles of the
+ * permutation mapping the current memory layout to a new memory layout.
+ *
+ * ## Notes
+ *
+ * -   If provided a bitset for tracking visited elements, the function moves
+ *     each element exactly once. Otherwise, the function only starts a cycle
+ *     at its smallest linear index (i.e., its "leader"), which requires walking
+ *     each cycle once per member before it is moved, but requires no
+ *     additional memory.
+ *
+ * @private
+ * @param x        pointer to the first element
+ * @param len      number of elements
+ * @param nbytes   number of bytes per element
+ * @param tmp      scratch space for a single element
+ * @param ndims    number of (non-singleton) dimensions
+ * @param shape    array shape
+ * @param to       strides (in units of elements) of the new memory layout
+ * @param from     strides (in units of elements) of the current memory layout
+ * @param visited  zero-initialized bitset having at least `len` bits or `NULL`
+ */
+static void ndarray_relayout_cycles(
+    uint8_t* x, const int64_t len, const int64_t nbytes, uint8_t* tmp,
+    const int64_t ndims, const int64_t* shape, const int64_t* to,
+    const int64_t* from, uint8_t* visited
+) {
+  int64_t cur;
+  int64_t p;
+  int64_t q;
+
+  for (p = 0; p < len; p++) {
+    if (visited != NULL) {
+      if (visited[p >> 3] & (1 << (p & 7))) {
+        continue;
+      }
+    } else {
+      // Only start a cycle at its leader...
+      q = ndarray_relayout_source(p, ndims, shape, to, from);
+      while (q > p) {
+        q = ndarray_relayout_source(q, ndims, shape, to, from);
+      }
+      if (q < p) {
+        continue;
+      }
+    }
+    q = ndarray_relayout_source(p, ndims, shape, to, from);
+    if (q == p) {
+      continue;
+    }
+    ndarray_relayout_move(tmp, x + (p * nbytes), nbytes);
+    cur = p;
+    while (q != p) {
+      ndarray_relayout_move(x + (cur * nbytes), x + (q * nbytes), nbytes);
+      if (visited != NULL) {
+        visited[q >> 3] |= (uint8_t)(1 << (q & 7));
+      }
+      cur = q;
+      q   = ndarray_relayout_source(cur, ndims, shape, to, from);
+    }
+    ndarray_relayout_move(x + (cur * nbytes), tmp, nbytes);
+  }
+}
+
+/**
+ * Converts a contiguous ndarray to a specified memory layout in-place.
+ *
+ * ## Notes
+ *
+ * -   The ndarray must be row-major or column-major contiguous and have
+ *     non-negative strides.
+ * -   The function moves ndarray elements within the ndarray's underlying byte
+ *     array, such that no second data buffer is required:
+ *
+ *     -   Square matrices are transposed by swapping cache-sized tiles.
+ *     -   Rectangular matrices and higher dimensional arrays are permuted by
+ *         following permutation cycles, using a bitset having one bit per
+ *         element to track moved elements. If unable to allocate the bitset,
+ *         the function falls back to an algorithm requiring no additional
+ *         memory, but which is slower.
+ *
+ * -   Upon moving elements, the function updates the ndarray strides (in-place;
+ *     i.e., writing to the ndarray's `strides` array), order, and contiguity
+ *     flags.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param arr    input ndarray
+ * @param order  memory layout
+ * @return       status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/relayout.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * double buf[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+ * int64_t shape[] = {2, 3};
+ * int64_t strides[] = {24, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)buf, 2, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int8_t status = ndarray_relayout(x, NDARRAY_COLUMN_MAJOR);
+ * // buf => {1.0, 4.0, 2.0, 5.0, 3.0, 6.0}
+ * // strides => {8, 16}
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_relayout(struct ndarray* arr, const enum NDARRAY_ORDER order) {
+  uint8_t* visited;
+  int64_t* strides;
+  int64_t* shape;
+  int64_t* from;
+  int64_t* shp;
+  int64_t* to;
+  int64_t* rs;
+  int64_t* cs;
+  int64_t nscratch;
+  int64_t nvisited;
+  int64_t nbytes;
+  int64_t ndims;
+  uint8_t* tmp;
+  int8_t isrow;
+  int8_t iscol;
+  int64_t len;
+  int64_t nd;
+  int64_t i;
+
+  if (arr == NULL ||
+      (order != NDARRAY_ROW_MAJOR && order != NDARRAY_COLUMN_MAJOR)) {
+    return -1;
+  }
+  ndims   = arr->ndims;
+  shape   = arr->shape;
+  strides = arr->strides;
+  nbytes  = arr->BYTES_PER_ELEMENT;
+
+  // Allocate scratch memory for row-major and column-major strides and for the
+  // compressed (i.e., non-singleton) shape and strides:
+  nscratch = sizeof(int64_t) * ((ndims * 5) + 1);
+  rs       = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nscratch);
+  if (rs == NULL) {
+    return -1;
+  }
+  cs   = rs + ndims;
+  shp  = cs + ndims;
+  from = shp + ndims;
+  to   = from + ndims;
+
+  ndarray_shape2strides(ndims, shape, NDARRAY_ROW_MAJOR, rs);
+  ndarray_shape2strides(ndims, shape, NDARRAY_COLUMN_MAJOR, cs);
+
+  // Determine the current memory layout...
+  isrow = 1;
+  iscol = 1;
+  for (i = 0; i < ndims; i++) {
+    if (shape[i] == 1) {
+      continue;
+    }
+    if (strides[i] != rs[i] * nbytes) {
+      isrow = 0;
+    }
+    if (strides[i] != cs[i] * nbytes) {
+      iscol = 0;
+    }
+  }
+  if (!isrow && !iscol) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, rs, nscratch);
+    return -1;
+  }
+  len = ndarray_numel(ndims, shape);
+
+  // Only move elements if the current memory layout differs from the desired
+  // memory layout:
+  if (len > 1 && ((order == NDARRAY_ROW_MAJOR && !isrow) ||
+                  (order == NDARRAY_COLUMN_MAJOR && !iscol))) {
+    tmp = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+    if (tmp == NULL) {
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, rs, nscratch);
+      return -1;
+    }
+    nd = 0;
+    for (i = 0; i < ndims; i++) {
+      if (shape[i] == 1) {
+        continue;
+      }
+      shp[nd] = shape[i];
+      if (order == NDARRAY_ROW_MAJOR) {
+        to[nd]   = rs[i];
+        from[nd] = cs[i];
+      } else {
+        to[nd]   = cs[i];
+        from[nd] = rs[i];
+      }
+      nd += 1;
+    }
+    if (nd == 2 && shp[0] == shp[1]) {
+      ndarray_relayout_square(arr->data + arr->offset, shp[0], nbytes, tmp);
+    } else {
+      // Note: if unable to allocate a bitset, we fall back to following cycle
+      // leaders...
+      nvisited = (len + 7) / 8;
+      visited  = ndarray_memory_calloc(NDARRAY_MEMORY_SCRATCH, nvisited);
+      ndarray_relayout_cycles(
+          arr->data + arr->offset, len, nbytes, tmp, nd, shp, to, from, visited
+      );
+      ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, visited, nvisited);
+    }
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, tmp, nbytes);
+  }
+  // Update the ndarray meta data:
+  for (i = 0; i < ndims; i++) {
+    strides[i] = ((order == NDARRAY_ROW_MAJOR) ? rs[i] : cs[i]) * nbytes;
+  }
+  arr->order = (int8_t)order;
+  arr->flags &= ~(NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG |
+                  NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG);
+  arr->flags |= ndarray_flags(arr);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, rs, nscratch);
+  return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/result_type.h"
+#include <stdint.h>
+#include "ndarray/base/assert.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/dtypes.h"
+
+/**
+ * Returns the smallest data type to which a list of data types can be safely
+ * cast.
+ *
+ * ## Notes
+ *
+ * -   The function considers every supported data type to which all provided
+ *     data types can be safely cast (see `ndarray_is_safe_data_type_cast`) and
+ *     returns the data type having the fewest bytes per element. Ties are
+ *     broken according to data type enumeration order, such that signed
+ *     integers are preferred over unsigned integers and real-valued floating
+ *     point numbers are preferred over complex numbers.
+ * -   If all provided data types are the same, the function returns that data
+ *     type (even if the data type is not otherwise supported).
+ * -   If no such data type exists (e.g., when promoting `int64` and `uint64`),
+ *     the function returns `NDARRAY_NOTYPE`.
+ *
+ * @param N      number of data types
+ * @param types  list of data types
+ * @return       promoted data type
+ *
+ * @example
+ * #include "ndarray/base/result_type.h"
+ * #include "ndarray/dtypes.h"
+ * #include <stdint.h>
+ *
+ * int32_t types[] = {NDARRAY_INT8, NDARRAY_UINT8};
+ *
+ * int32_t dt = ndarray_result_type(2, types);
+ * // returns NDARRAY_INT16
+ */
+int32_t ndarray_result_type(const int32_t N, const int32_t* types) {
+  int64_t nbytes;
+  int64_t best;
+  int32_t dt;
+  int32_t t;
+  int32_t i;
+
+  if (N < 1) {
+    return NDARRAY_NOTYPE;
+  }
+  // Check whether we can avoid promotion altogether...
+  for (i = 1; i < N; i++) {
+    if (types[i] != types[0]) {
+      break;
+    }
+  }
+  if (i == N) {
+    return types[0];
+  }
+  // Only promote among supported data types...
+  for (i = 0; i < N; i++) {
+    if (types[i] < 0 || types[i] >= NDARRAY_NDTYPES ||
+        ndarray_bytes_per_element(types[i]) == 0) {
+      return NDARRAY_NOTYPE;
+    }
+  }
+  dt   = NDARRAY_NOTYPE;
+  best = 0;
+  for (t = 0; t < NDARRAY_NDTYPES; t++) {
+    nbytes = ndarray_bytes_per_element(t);
+    if (nbytes == 0 || (dt != NDARRAY_NOTYPE && nbytes >= best)) {
+      continue;
+    }
+    for (i = 0; i < N; i++) {
+      if (!ndarray_is_safe_data_type_cast((int16_t)types[i], (int16_t)t)) {
+        break;
+      }
+    }
+    if (i == N) {
+      dt   = t;
+      best = nbytes;
+    }
+  }
+  return dt;
+}
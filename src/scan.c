@@ -0,0 +1,868 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/scan.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/cast.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/reduce_ops.h"
+
+// Define the number of elements per chunk when splitting a long dimension into
+// chunks which are scanned independently and subsequently offset (note: this
+// must not depend on the number of threads, as it determines the order of
+// floating-point operations):
+#define NDARRAY_SCAN_CHUNK 16384
+
+// Define the maximum number of elements converted to the output data type at a
+// time:
+#define NDARRAY_SCAN_BLOCK 1024
+
+// Define the maximum number of lanes scanned at a time when the scanned
+// dimension is not the fastest varying dimension:
+#define NDARRAY_SCAN_LANES 1024
+
+// Define the number of supported scan operations:
+#define NDARRAY_SCAN_NOPS 4
+
+// Define a list of supported real-valued data types (dtype, abbreviation, C
+// type, lowest value, highest value, kind):
+#define NDARRAY_SCAN_REAL_DTYPES(X)                       \
+  X(NDARRAY_INT8, s, int8_t, INT8_MIN, INT8_MAX, I)       \
+  X(NDARRAY_UINT8, b, uint8_t, 0, UINT8_MAX, I)           \
+  X(NDARRAY_INT16, k, int16_t, INT16_MIN, INT16_MAX, I)   \
+  X(NDARRAY_UINT16, t, uint16_t, 0, UINT16_MAX, I)        \
+  X(NDARRAY_INT32, i, int32_t, INT32_MIN, INT32_MAX, I)   \
+  X(NDARRAY_UINT32, u, uint32_t, 0, UINT32_MAX, I)        \
+  X(NDARRAY_INT64, l, int64_t, INT64_MIN, INT64_MAX, I)   \
+  X(NDARRAY_UINT64, v, uint64_t, 0, UINT64_MAX, I)        \
+  X(NDARRAY_FLOAT32, f, float, -INFINITY, INFINITY, F)    \
+  X(NDARRAY_FLOAT64, d, double, -INFINITY, INFINITY, F)
+
+// Define a list of supported complex-valued data types (dtype, abbreviation,
+// component C type):
+#define NDARRAY_SCAN_COMPLEX_DTYPES(X) \
+  X(NDARRAY_COMPLEX64, c, float)       \
+  X(NDARRAY_COMPLEX128, z, double)
+
+// Define macros for testing whether a value is `NaN` for each kind of data
+// type:
+#define NDARRAY_SCAN_ISNAN_I(v) 0
+#define NDARRAY_SCAN_ISNAN_F(v) isnan(v)
+
+// Define macros for combining an accumulated value `a` with a subsequent value
+// `b` using a data type's `NaN` test `ISNAN` (note: minimum and maximum values
+// propagate `NaN`):
+#define NDARRAY_SCAN_OP_SUM(a, b, ISNAN) ((a) + (b))
+#define NDARRAY_SCAN_OP_PROD(a, b, ISNAN) ((a) * (b))
+#define NDARRAY_SCAN_OP_MIN(a, b, ISNAN) \
+  ((((b) < (a)) || ISNAN(b)) ? (b) : (a))
+#define NDARRAY_SCAN_OP_MAX(a, b, ISNAN) \
+  ((((b) > (a)) || ISNAN(b)) ? (b) : (a))
+
+// Define macros for combining complex numbers `(ar,ai)` and `(br,bi)`:
+#define NDARRAY_SCAN_COP_SUM(ar, ai, br, bi, cr, ci) \
+  cr = (ar) + (br);                                  \
+  ci = (ai) + (bi)
+#define NDARRAY_SCAN_COP_PROD(ar, ai, br, bi, cr, ci) \
+  cr = ((ar) * (br)) - ((ai) * (bi));                 \
+  ci = ((ar) * (bi)) + ((ai) * (br))
+
+/**
+ * Function pointer type for scanning strided elements.
+ *
+ * ## Notes
+ *
+ * -   For "line" kernels, `acc` points to a single accumulated value, which is
+ *     combined with each input element in turn.
+ * -   For "lanes" kernels, `acc` points to a contiguous array of `n`
+ *     accumulated values, each of which is combined with a single input
+ *     element.
+ *
+ * @private
+ * @param acc  accumulated value(s)
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param y    output elements
+ * @param sy   output stride (in bytes)
+ * @param n    number of elements
+ */
+typedef void (*ndarrayScanFcn)(
+    uint8_t* acc, const uint8_t* x, const int64_t sx, uint8_t* y,
+    const int64_t sy, const int64_t n
+);
+
+/**
+ * Function pointer type for combining a value with strided elements, such that
+ * the value precedes each element (i.e., `y[i] = op(c, y[i])`).
+ *
+ * @private
+ * @param c   value
+ * @param y   elements
+ * @param sy  stride (in bytes)
+ * @param n   number of elements
+ */
+typedef void (*ndarrayScanOffsetFcn)(
+    const uint8_t* c, uint8_t* y, const int64_t sy, const int64_t n
+);
+
+/**
+ * Structure containing the scan kernels for a single data type.
+ *
+ * @private
+ */
+struct ndarrayScanKernels {
+  // Data type:
+  int16_t dtype;
+
+  // Line kernels (indexed by scan operation):
+  ndarrayScanFcn line[NDARRAY_SCAN_NOPS];
+
+  // Lanes kernels (indexed by scan operation):
+  ndarrayScanFcn lanes[NDARRAY_SCAN_NOPS];
+
+  // Offset kernels (indexed by scan operation):
+  ndarrayScanOffsetFcn offset[NDARRAY_SCAN_NOPS];
+
+  // Kernel for filling accumulated values with an operation's identity:
+  void (*fill)(uint8_t* acc, const int64_t n, const int8_t op);
+};
+
+// Define a macro for defining real-valued kernels for a single operation:
+#define NDARRAY_SCAN_DEFINE_REAL_OP(c, type, ISNAN, name, OP)                  \
+  static void ndarray_scan_##name##_line_##c(                                  \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, uint8_t* y,            \
+      const int64_t sy, const int64_t n                                        \
+  ) {                                                                          \
+    type a = *(type*)acc;                                                      \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, x += sx, y += sy) {                                \
+      a         = OP(a, *(const type*)x, ISNAN);                               \
+      *(type*)y = a;                                                           \
+    }                                                                          \
+    *(type*)acc = a;                                                           \
+  }                                                                            \
+  static void ndarray_scan_##name##_lanes_##c(                                 \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, uint8_t* y,            \
+      const int64_t sy, const int64_t n                                        \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++, x += sx, y += sy) {                                \
+      a[j]      = OP(a[j], *(const type*)x, ISNAN);                            \
+      *(type*)y = a[j];                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_scan_##name##_offset_##c(                                \
+      const uint8_t* p, uint8_t* y, const int64_t sy, const int64_t n          \
+  ) {                                                                          \
+    type v = *(const type*)p;                                                  \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, y += sy) {                                         \
+      *(type*)y = OP(v, *(type*)y, ISNAN);                                     \
+    }                                                                          \
+  }
+
+// Define a macro for defining complex-valued kernels for a single operation:
+#define NDARRAY_SCAN_DEFINE_COMPLEX_OP(c, type, name, COP)                     \
+  static void ndarray_scan_##name##_line_##c(                                  \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, uint8_t* y,            \
+      const int64_t sy, const int64_t n                                        \
+  ) {                                                                          \
+    type ar = ((type*)acc)[0];                                                 \
+    type ai = ((type*)acc)[1];                                                 \
+    type tr;                                                                   \
+    type ti;                                                                   \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, x += sx, y += sy) {                                \
+      COP(ar, ai, ((const type*)x)[0], ((const type*)x)[1], tr, ti);           \
+      ar            = tr;                                                      \
+      ai            = ti;                                                      \
+      ((type*)y)[0] = ar;                                                      \
+      ((type*)y)[1] = ai;                                                      \
+    }                                                                          \
+    ((type*)acc)[0] = ar;                                                      \
+    ((type*)acc)[1] = ai;                                                      \
+  }                                                                            \
+  static void ndarray_scan_##name##_lanes_##c(                                 \
+      uint8_t* acc, const uint8_t* x, const int64_t sx, uint8_t* y,            \
+      const int64_t sy, const int64_t n                                        \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    type tr;                                                                   \
+    type ti;                                                                   \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++, x += sx, y += sy) {                                \
+      COP(a[2 * j], a[(2 * j) + 1], ((const type*)x)[0],                       \
+          ((const type*)x)[1], tr, ti);                                        \
+      a[2 * j]       = tr;                                                     \
+      a[(2 * j) + 1] = ti;                                                     \
+      ((type*)y)[0]  = tr;                                                     \
+      ((type*)y)[1]  = ti;                                                     \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_scan_##name##_offset_##c(                                \
+      const uint8_t* p, uint8_t* y, const int64_t sy, const int64_t n          \
+  ) {                                                                          \
+    type vr = ((const type*)p)[0];                                             \
+    type vi = ((const type*)p)[1];                                             \
+    type tr;                                                                   \
+    type ti;                                                                   \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++, y += sy) {                                         \
+      COP(vr, vi, ((type*)y)[0], ((type*)y)[1], tr, ti);                       \
+      ((type*)y)[0] = tr;                                                      \
+      ((type*)y)[1] = ti;                                                      \
+    }                                                                          \
+  }
+
+// Define a macro for defining all kernels for a real-valued data type:
+#define NDARRAY_SCAN_DEFINE_REAL(dtype, c, type, lo, hi, kind)                 \
+  NDARRAY_SCAN_DEFINE_REAL_OP(                                                 \
+      c, type, NDARRAY_SCAN_ISNAN_##kind, sum, NDARRAY_SCAN_OP_SUM             \
+  )                                                                            \
+  NDARRAY_SCAN_DEFINE_REAL_OP(                                                 \
+      c, type, NDARRAY_SCAN_ISNAN_##kind, prod, NDARRAY_SCAN_OP_PROD           \
+  )                                                                            \
+  NDARRAY_SCAN_DEFINE_REAL_OP(                                                 \
+      c, type, NDARRAY_SCAN_ISNAN_##kind, min, NDARRAY_SCAN_OP_MIN             \
+  )                                                                            \
+  NDARRAY_SCAN_DEFINE_REAL_OP(                                                 \
+      c, type, NDARRAY_SCAN_ISNAN_##kind, max, NDARRAY_SCAN_OP_MAX             \
+  )                                                                            \
+  static void ndarray_scan_fill_##c(                                           \
+      uint8_t* acc, const int64_t n, const int8_t op                           \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    type v;                                                                    \
+    int64_t j;                                                                 \
+    switch (op) {                                                              \
+      case NDARRAY_REDUCE_PROD:                                                \
+        v = (type)1;                                                           \
+        break;                                                                 \
+      case NDARRAY_REDUCE_MIN:                                                 \
+        v = (type)(hi);                                                        \
+        break;                                                                 \
+      case NDARRAY_REDUCE_MAX:                                                 \
+        v = (type)(lo);                                                        \
+        break;                                                                 \
+      default:                                                                 \
+        v = (type)0;                                                           \
+    }                                                                          \
+    for (j = 0; j < n; j++) {                                                  \
+      a[j] = v;                                                                \
+    }                                                                          \
+  }
+
+// Define a macro for defining all kernels for a complex-valued data type:
+#define NDARRAY_SCAN_DEFINE_COMPLEX(dtype, c, type)                            \
+  NDARRAY_SCAN_DEFINE_COMPLEX_OP(c, type, sum, NDARRAY_SCAN_COP_SUM)           \
+  NDARRAY_SCAN_DEFINE_COMPLEX_OP(c, type, prod, NDARRAY_SCAN_COP_PROD)         \
+  static void ndarray_scan_fill_##c(                                           \
+      uint8_t* acc, const int64_t n, const int8_t op                           \
+  ) {                                                                          \
+    type* a = (type*)acc;                                                      \
+    int64_t j;                                                                 \
+    for (j = 0; j < n; j++) {                                                  \
+      a[2 * j]       = (op == NDARRAY_REDUCE_PROD) ? (type)1 : (type)0;        \
+      a[(2 * j) + 1] = (type)0;                                                \
+    }                                                                          \
+  }
+
+// Define kernels for all supported data types:
+NDARRAY_SCAN_REAL_DTYPES(NDARRAY_SCAN_DEFINE_REAL)
+NDARRAY_SCAN_COMPLEX_DTYPES(NDARRAY_SCAN_DEFINE_COMPLEX)
+
+// Define macros for generating kernel table entries:
+#define NDARRAY_SCAN_REAL_ENTRY(dtype, c, type, lo, hi, kind)                  \
+  {dtype,                                                                      \
+   {ndarray_scan_sum_line_##c, ndarray_scan_prod_line_##c,                     \
+    ndarray_scan_min_line_##c, ndarray_scan_max_line_##c},                     \
+   {ndarray_scan_sum_lanes_##c, ndarray_scan_prod_lanes_##c,                   \
+    ndarray_scan_min_lanes_##c, ndarray_scan_max_lanes_##c},                   \
+   {ndarray_scan_sum_offset_##c, ndarray_scan_prod_offset_##c,                 \
+    ndarray_scan_min_offset_##c, ndarray_scan_max_offset_##c},                 \
+   ndarray_scan_fill_##c},
+
+#define NDARRAY_SCAN_COMPLEX_ENTRY(dtype, c, type)                             \
+  {dtype,                                                                      \
+   {ndarray_scan_sum_line_##c, ndarray_scan_prod_line_##c, NULL, NULL},        \
+   {ndarray_scan_sum_lanes_##c, ndarray_scan_prod_lanes_##c, NULL, NULL},      \
+   {ndarray_scan_sum_offset_##c, ndarray_scan_prod_offset_##c, NULL, NULL},    \
+   ndarray_scan_fill_##c},
+
+// Define a table of kernels for all supported data types (note: minimum and
+// maximum values are not defined for complex numbers):
+static const struct ndarrayScanKernels NDARRAY_SCAN_KERNELS[] = {
+    NDARRAY_SCAN_REAL_DTYPES(NDARRAY_SCAN_REAL_ENTRY)
+        NDARRAY_SCAN_COMPLEX_DTYPES(NDARRAY_SCAN_COMPLEX_ENTRY)};
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_scan_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Structure describing a scan.
+ *
+ * @private
+ */
+struct ndarrayScanLoop {
+  // Kernels for the output data type:
+  const struct ndarrayScanKernels* kernels;
+
+  // Scan kernel:
+  ndarrayScanFcn fcn;
+
+  // Offset kernel:
+  ndarrayScanOffsetFcn offset;
+
+  // Function for converting input elements to the output data type (or
+  // `NULL` if the input and output data types are the same):
+  ndarrayStridedCastFcn icast;
+
+  // Scan operation:
+  int8_t op;
+
+  // Number of bytes per output element:
+  int64_t bpe;
+
+  // Pointer to the first indexed input element:
+  const uint8_t* x;
+
+  // Pointer to the first indexed output element:
+  uint8_t* out;
+
+  // Length of the scanned dimension:
+  int64_t n;
+
+  // Input stride of the scanned dimension:
+  int64_t xsa;
+
+  // Output stride of the scanned dimension:
+  int64_t ysa;
+
+  // Number of lanes (or `0` if the scanned dimension is traversed as lines):
+  int64_t nl;
+
+  // Input stride of the lane dimension:
+  int64_t lxs;
+
+  // Output stride of the lane dimension:
+  int64_t los;
+
+  // Number of lane tiles per outer index:
+  int64_t nlt;
+
+  // Number of outer dimensions:
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension output strides:
+  int64_t* oos;
+
+  // Number of lines (i.e., outer indices):
+  int64_t nlines;
+
+  // Number of chunks per line:
+  int64_t nchunks;
+
+  // Number of lines per task (when lines are not split into chunks):
+  int64_t group;
+
+  // Per-thread scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+
+  // Chunk totals (indexed by line and chunk):
+  uint8_t* totals;
+};
+
+/**
+ * Resolves the input and output pointers for an outer index.
+ *
+ * @private
+ * @param loop  scan
+ * @param r     outer index
+ * @param x     output argument for the pointer to the first input element
+ * @param out   output argument for the pointer to the first output element
+ */
+static void ndarray_scan_outer(
+    const struct ndarrayScanLoop* loop, int64_t r, const uint8_t** x,
+    uint8_t** out
+) {
+  int64_t s;
+  int64_t k;
+
+  *x   = loop->x;
+  *out = loop->out;
+  for (k = 0; k < loop->no; k++) {
+    s = r % loop->oshape[k];
+    r /= loop->oshape[k];
+    *x += s * loop->oxs[k];     // pointer arithmetic
+    *out += s * loop->oos[k];  // pointer arithmetic
+  }
+}
+
+/**
+ * Scans a segment of a line, converting input elements in blocks when the
+ * input and output data types differ.
+ *
+ * @private
+ * @param loop  scan
+ * @param x     pointer to the first input element
+ * @param y     pointer to the first output element
+ * @param n     number of elements
+ * @param acc   accumulated value
+ * @param tmp   conversion buffer
+ */
+static void ndarray_scan_segment(
+    const struct ndarrayScanLoop* loop, const uint8_t* x, uint8_t* y,
+    const int64_t n, uint8_t* acc, uint8_t* tmp
+) {
+  int64_t m;
+  int64_t i;
+
+  if (loop->icast == NULL) {
+    loop->fcn(acc, x, loop->xsa, y, loop->ysa, n);
+    return;
+  }
+  for (i = 0; i < n; i += NDARRAY_SCAN_BLOCK) {
+    m = n - i;
+    m = (m < NDARRAY_SCAN_BLOCK) ? m : NDARRAY_SCAN_BLOCK;
+    loop->icast(x + (i * loop->xsa), loop->xsa, tmp, loop->bpe, m);
+    loop->fcn(acc, tmp, loop->bpe, y + (i * loop->ysa), loop->ysa, m);
+  }
+}
+
+/**
+ * Scans a tile of lanes along the scanned dimension.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  scan
+ */
+static void ndarray_scan_lanes_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayScanLoop* loop;
+  const uint8_t* ip;
+  uint8_t* acc;
+  uint8_t* tmp;
+  uint8_t* op;
+  int64_t j;
+  int64_t w;
+  int64_t k;
+
+  loop = (const struct ndarrayScanLoop*)ctx;
+  acc  = loop->scratch + (tid * loop->sb);
+  tmp  = acc + (NDARRAY_SCAN_LANES * loop->bpe);
+  ndarray_scan_outer(loop, i / loop->nlt, &ip, &op);
+  j = (i % loop->nlt) * NDARRAY_SCAN_LANES;
+  w = loop->nl - j;
+  w = (w < NDARRAY_SCAN_LANES) ? w : NDARRAY_SCAN_LANES;
+  ip += j * loop->lxs;  // pointer arithmetic
+  op += j * loop->los;  // pointer arithmetic
+
+  loop->kernels->fill(acc, w, loop->op);
+  for (k = 0; k < loop->n; k++) {
+    if (loop->icast == NULL) {
+      loop->fcn(acc, ip, loop->lxs, op, loop->los, w);
+    } else {
+      loop->icast(ip, loop->lxs, tmp, loop->bpe, w);
+      loop->fcn(acc, tmp, loop->bpe, op, loop->los, w);
+    }
+    ip += loop->xsa;  // pointer arithmetic
+    op += loop->ysa;  // pointer arithmetic
+  }
+}
+
+/**
+ * Scans a group of lines or a single chunk of a line.
+ *
+ * ## Notes
+ *
+ * -   When lines are split into chunks, each chunk is scanned starting from
+ *     the operation's identity, and the chunk total is stored for subsequently
+ *     offsetting the elements of later chunks.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  scan
+ */
+static void ndarray_scan_line_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayScanLoop* loop;
+  const uint8_t* ip;
+  uint8_t* acc;
+  uint8_t* tmp;
+  uint8_t* op;
+  int64_t end;
+  int64_t s;
+  int64_t m;
+  int64_t l;
+
+  loop = (const struct ndarrayScanLoop*)ctx;
+  tmp  = loop->scratch + (tid * loop->sb);
+  if (loop->nchunks == 1) {
+    acc = tmp + (NDARRAY_SCAN_BLOCK * loop->bpe);
+    end = (i + 1) * loop->group;
+    end = (end < loop->nlines) ? end : loop->nlines;
+    for (l = i * loop->group; l < end; l++) {
+      ndarray_scan_outer(loop, l, &ip, &op);
+      loop->kernels->fill(acc, 1, loop->op);
+      ndarray_scan_segment(loop, ip, op, loop->n, acc, tmp);
+    }
+    return;
+  }
+  ndarray_scan_outer(loop, i / loop->nchunks, &ip, &op);
+  s   = (i % loop->nchunks) * NDARRAY_SCAN_CHUNK;
+  m   = loop->n - s;
+  m   = (m < NDARRAY_SCAN_CHUNK) ? m : NDARRAY_SCAN_CHUNK;
+  acc = loop->totals + (i * loop->bpe);
+  loop->kernels->fill(acc, 1, loop->op);
+  ndarray_scan_segment(
+      loop, ip + (s * loop->xsa), op + (s * loop->ysa), m, acc, tmp
+  );
+}
+
+/**
+ * Combines the elements of a chunk with the total of all preceding chunks.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  scan
+ */
+static void ndarray_scan_offset_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarrayScanLoop* loop;
+  const uint8_t* ip;
+  uint8_t* op;
+  int64_t c;
+  int64_t l;
+  int64_t s;
+  int64_t m;
+
+  (void)tid;
+  loop = (const struct ndarrayScanLoop*)ctx;
+  l    = i / (loop->nchunks - 1);
+  c    = (i % (loop->nchunks - 1)) + 1;
+  ndarray_scan_outer(loop, l, &ip, &op);
+  s = c * NDARRAY_SCAN_CHUNK;
+  m = loop->n - s;
+  m = (m < NDARRAY_SCAN_CHUNK) ? m : NDARRAY_SCAN_CHUNK;
+  loop->offset(
+      loop->totals + (((l * loop->nchunks) + c - 1) * loop->bpe),
+      op + (s * loop->ysa), loop->ysa, m
+  );
+}
+
+/**
+ * Computes the cumulative sum, product, minimum, or maximum of ndarray elements
+ * along a specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same shape. Elements are
+ *     accumulated in the output ndarray data type, and input elements are
+ *     converted to the output ndarray data type following C conversion
+ *     semantics.
+ * -   Supported output data types are signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, single- and double-precision floating-point numbers,
+ *     and single- and double-precision complex floating-point numbers.
+ *     Cumulative minimum and maximum values are not supported for complex
+ *     numbers, and complex input ndarrays require a complex output ndarray.
+ *     `NDARRAY_REDUCE_MEAN` is not a supported operation.
+ * -   Cumulative minimum and maximum values propagate `NaN`.
+ * -   A negative `axis` is resolved relative to the last dimension.
+ * -   The function chooses among the following strategies:
+ *
+ *     -   If the scanned dimension is the fastest varying input dimension,
+ *         the function scans each line sequentially. Lines longer than a
+ *         fixed chunk size are split into chunks which are scanned in
+ *         parallel, followed by combining each chunk with the total of all
+ *         preceding chunks (i.e., a two-pass parallel prefix scan).
+ *     -   Otherwise, the function scans blocks of lanes along the fastest
+ *         varying dimension, such that each step along the scanned dimension
+ *         reads a block of input elements in memory order.
+ *
+ *     The chunk size does not depend on the number of threads, and, hence,
+ *     floating-point results are bit-identical for any number of threads.
+ *
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   The output ndarray may be the input ndarray (i.e., the scan may be
+ *     computed in-place); otherwise, the input and output ndarrays must
+ *     **not** share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param op        scan operation
+ * @param x         input ndarray
+ * @param axis      dimension along which to scan
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/scan.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include "ndarray/reduce_ops.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major input ndarray:
+ * int32_t xbuf[] = {1, 2, 3, 4, 5, 6};
+ * int64_t shape[] = {2, 3};
+ * int64_t xstrides[] = {12, 4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)xbuf, 2, shape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0, 0, 0, 0, 0};
+ * int64_t ystrides[] = {24, 8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 2, shape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the cumulative sum along the last dimension:
+ * int8_t status = ndarray_scan(NDARRAY_REDUCE_SUM, x, -1, 1, y);
+ * // ybuf => {1, 3, 6, 4, 9, 15}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_scan(
+    const enum NDARRAY_REDUCE_OP op, const struct ndarray* x,
+    const int64_t axis, int32_t nthreads, struct ndarray* out
+) {
+  struct ndarrayScanLoop loop;
+  int64_t nmeta;
+  int64_t nbytes;
+  int64_t ntasks;
+  int64_t ndims;
+  int64_t len;
+  int64_t a;
+  int64_t d;
+  int64_t i;
+  int64_t l;
+  int64_t c;
+  int8_t status;
+  size_t j;
+
+  if (x == NULL || out == NULL || op < NDARRAY_REDUCE_SUM ||
+      op >= NDARRAY_REDUCE_MEAN || x->ndims != out->ndims) {
+    return -1;
+  }
+  ndims = x->ndims;
+  a     = (axis < 0) ? axis + ndims : axis;
+  if (a < 0 || a >= ndims) {
+    return -1;
+  }
+  len = 1;
+  for (i = 0; i < ndims; i++) {
+    if (x->shape[i] != out->shape[i]) {
+      return -1;
+    }
+    len *= x->shape[i];
+  }
+  // Resolve the kernels for the output data type...
+  loop.kernels = NULL;
+  for (j = 0; j < sizeof(NDARRAY_SCAN_KERNELS) /
+                      sizeof(NDARRAY_SCAN_KERNELS[0]);
+       j++) {
+    if (NDARRAY_SCAN_KERNELS[j].dtype == out->dtype) {
+      loop.kernels = &(NDARRAY_SCAN_KERNELS[j]);
+      break;
+    }
+  }
+  if (loop.kernels == NULL || loop.kernels->line[op] == NULL) {
+    return -1;
+  }
+  if ((x->dtype == NDARRAY_COMPLEX64 || x->dtype == NDARRAY_COMPLEX128) &&
+      out->dtype != NDARRAY_COMPLEX64 && out->dtype != NDARRAY_COMPLEX128) {
+    return -1;
+  }
+  loop.icast = NULL;
+  if (x->dtype != out->dtype) {
+    loop.icast = ndarray_strided_cast_function(x->dtype, out->dtype);
+    if (loop.icast == NULL) {
+      return -1;
+    }
+  }
+  if (len == 0) {
+    return 0;
+  }
+  loop.op     = (int8_t)op;
+  loop.offset = loop.kernels->offset[op];
+  loop.bpe    = ndarray_bytes_per_element(out->dtype);
+  loop.x      = x->data + x->offset;
+  loop.out    = out->data + out->offset;
+  loop.n      = x->shape[a];
+  loop.xsa    = x->strides[a];
+  loop.ysa    = out->strides[a];
+
+  // Allocate scratch memory for outer dimension meta data:
+  nmeta = sizeof(int64_t) * ((ndims * 3) + 1);
+  loop.oshape = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (loop.oshape == NULL) {
+    return -1;
+  }
+  loop.oxs = loop.oshape + ndims;
+  loop.oos = loop.oxs + ndims;
+
+  // Find the fastest varying (non-singleton) dimension other than the scanned
+  // dimension...
+  d = -1;
+  for (i = 0; i < ndims; i++) {
+    if (i == a || x->shape[i] == 1) {
+      continue;
+    }
+    if (d < 0 || ndarray_scan_abs(x->strides[i]) <
+                     ndarray_scan_abs(x->strides[d])) {
+      d = i;
+    }
+  }
+  // Scan lines when the scanned dimension is the fastest varying dimension;
+  // otherwise, scan lanes along the fastest varying dimension:
+  if (loop.n > 1 && d >= 0 &&
+      ndarray_scan_abs(x->strides[d]) < ndarray_scan_abs(loop.xsa)) {
+    loop.nl  = x->shape[d];
+    loop.lxs = x->strides[d];
+    loop.los = out->strides[d];
+    loop.nlt = (loop.nl + NDARRAY_SCAN_LANES - 1) / NDARRAY_SCAN_LANES;
+  } else {
+    loop.nl  = 0;
+    loop.nlt = 1;
+    d        = -1;
+  }
+  loop.no     = 0;
+  loop.nlines = 1;
+  for (i = 0; i < ndims; i++) {
+    if (i == a || i == d || x->shape[i] == 1) {
+      continue;
+    }
+    loop.oshape[loop.no] = x->shape[i];
+    loop.oxs[loop.no]    = x->strides[i];
+    loop.oos[loop.no]    = out->strides[i];
+    loop.nlines *= x->shape[i];
+    loop.no += 1;
+  }
+  if (loop.nl > 0) {
+    loop.fcn     = loop.kernels->lanes[op];
+    loop.nchunks = 1;
+    ntasks       = loop.nlines * loop.nlt;
+    loop.sb      = (NDARRAY_SCAN_LANES * 2) * loop.bpe;
+  } else {
+    loop.fcn     = loop.kernels->line[op];
+    loop.nchunks = (loop.n + NDARRAY_SCAN_CHUNK - 1) / NDARRAY_SCAN_CHUNK;
+    loop.group   = 1;
+    if (loop.nchunks == 1) {
+      // Group short lines, such that each task scans roughly a chunk:
+      loop.group = NDARRAY_SCAN_CHUNK / loop.n;
+      ntasks     = (loop.nlines + loop.group - 1) / loop.group;
+    } else {
+      ntasks = loop.nlines * loop.nchunks;
+    }
+    loop.sb = (NDARRAY_SCAN_BLOCK + 1) * loop.bpe;
+  }
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory and memory for chunk totals:
+  nbytes = loop.sb * nthreads;
+  if (loop.nchunks > 1) {
+    nbytes += loop.nlines * loop.nchunks * loop.bpe;
+  }
+  loop.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.scratch == NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+    return -1;
+  }
+  loop.totals = loop.scratch + (loop.sb * nthreads);
+
+  status = 0;
+  if (loop.nl > 0) {
+    status = ndarray_parallel_for(
+        ntasks, nthreads, ndarray_scan_lanes_task, &loop
+    );
+  } else if (loop.nchunks == 1) {
+    status = ndarray_parallel_for(
+        ntasks, nthreads, ndarray_scan_line_task, &loop
+    );
+  } else if (nthreads == 1) {
+    // Perform the same operations as the multithreaded scan, while offsetting
+    // each chunk as soon as it has been scanned (i.e., while the chunk is
+    // still in cache):
+    for (l = 0; l < loop.nlines; l++) {
+      for (c = 0; c < loop.nchunks; c++) {
+        i = (l * loop.nchunks) + c;
+        ndarray_scan_line_task(i, 0, &loop);
+        if (c > 0) {
+          ndarray_scan_offset_task(i - l - 1, 0, &loop);
+          loop.offset(
+              loop.totals + ((i - 1) * loop.bpe), loop.totals + (i * loop.bpe),
+              loop.bpe, 1
+          );
+        }
+      }
+    }
+  } else {
+    // Scan all chunks, compute the running totals of preceding chunks, and
+    // offset all chunks after the first chunk of each line:
+    status = ndarray_parallel_for(
+        ntasks, nthreads, ndarray_scan_line_task, &loop
+    );
+    for (l = 0; l < loop.nlines; l++) {
+      for (c = 1; c < loop.nchunks; c++) {
+        i = (l * loop.nchunks) + c;
+        loop.offset(
+            loop.totals + ((i - 1) * loop.bpe), loop.totals + (i * loop.bpe),
+            loop.bpe, 1
+        );
+      }
+    }
+    if (status == 0) {
+      status = ndarray_parallel_for(
+          loop.nlines * (loop.nchunks - 1), nthreads, ndarray_scan_offset_task,
+          &loop
+      );
+    }
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.scratch, nbytes);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+  return status;
+}
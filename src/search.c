@@ -0,0 +1,968 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/search.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+#include "ndarray/nan_policies.h"
+#include "ndarray/orders.h"
+#include "ndarray/predicates.h"
+
+// Define the maximum number of elements tested at a time (note: elements within
+// a block are tested without branching, such that the compiler can vectorize
+// tests of contiguous elements, while searches may terminate early between
+// blocks):
+#define NDARRAY_SEARCH_BLOCK 1024
+
+// Define the number of supported predicates:
+#define NDARRAY_SEARCH_NPREDICATES 7
+
+// Define a list of supported real-valued data types (dtype, abbreviation, C
+// type, lowest value, highest value, kind):
+#define NDARRAY_SEARCH_REAL_DTYPES(X)                     \
+  X(NDARRAY_BOOL, x, bool, false, true, U)                \
+  X(NDARRAY_INT8, s, int8_t, INT8_MIN, INT8_MAX, S)       \
+  X(NDARRAY_UINT8, b, uint8_t, 0, UINT8_MAX, U)           \
+  X(NDARRAY_UINT8C, a, uint8_t, 0, UINT8_MAX, U)          \
+  X(NDARRAY_INT16, k, int16_t, INT16_MIN, INT16_MAX, S)   \
+  X(NDARRAY_UINT16, t, uint16_t, 0, UINT16_MAX, U)        \
+  X(NDARRAY_INT32, i, int32_t, INT32_MIN, INT32_MAX, S)   \
+  X(NDARRAY_UINT32, u, uint32_t, 0, UINT32_MAX, U)        \
+  X(NDARRAY_INT64, l, int64_t, INT64_MIN, INT64_MAX, S)   \
+  X(NDARRAY_UINT64, v, uint64_t, 0, UINT64_MAX, U)        \
+  X(NDARRAY_FLOAT32, f, float, -INFINITY, INFINITY, F)    \
+  X(NDARRAY_FLOAT64, d, double, -INFINITY, INFINITY, F)
+
+// Define a list of supported complex-valued data types (dtype, abbreviation,
+// component C type):
+#define NDARRAY_SEARCH_COMPLEX_DTYPES(X) \
+  X(NDARRAY_COMPLEX64, c, float)         \
+  X(NDARRAY_COMPLEX128, z, double)
+
+// Define predicates for signed integers:
+#define NDARRAY_SEARCH_NONZERO_S(v) ((v) != 0)
+#define NDARRAY_SEARCH_NAN_S(v) ((void)(v), 0)
+#define NDARRAY_SEARCH_INFINITE_S(v) ((void)(v), 0)
+#define NDARRAY_SEARCH_FINITE_S(v) ((void)(v), 1)
+#define NDARRAY_SEARCH_POSITIVE_S(v) ((v) > 0)
+#define NDARRAY_SEARCH_NEGATIVE_S(v) ((v) < 0)
+#define NDARRAY_SEARCH_NONNEGATIVE_S(v) ((v) >= 0)
+
+// Define predicates for unsigned integers and booleans:
+#define NDARRAY_SEARCH_NONZERO_U(v) ((v) != 0)
+#define NDARRAY_SEARCH_NAN_U(v) ((void)(v), 0)
+#define NDARRAY_SEARCH_INFINITE_U(v) ((void)(v), 0)
+#define NDARRAY_SEARCH_FINITE_U(v) ((void)(v), 1)
+#define NDARRAY_SEARCH_POSITIVE_U(v) ((v) != 0)
+#define NDARRAY_SEARCH_NEGATIVE_U(v) ((void)(v), 0)
+#define NDARRAY_SEARCH_NONNEGATIVE_U(v) ((void)(v), 1)
+
+// Define predicates for floating-point numbers (note: predicates are written
+// using comparisons, rather than `isnan` et al, in order to facilitate
+// vectorization; a value is finite if and only if subtracting the value from
+// itself yields zero):
+#define NDARRAY_SEARCH_NONZERO_F(v) ((v) != 0)
+#define NDARRAY_SEARCH_NAN_F(v) ((v) != (v))
+#define NDARRAY_SEARCH_INFINITE_F(v) (((v) == INFINITY) | ((v) == -INFINITY))
+#define NDARRAY_SEARCH_FINITE_F(v) (((v) - (v)) == 0)
+#define NDARRAY_SEARCH_POSITIVE_F(v) ((v) > 0)
+#define NDARRAY_SEARCH_NEGATIVE_F(v) ((v) < 0)
+#define NDARRAY_SEARCH_NONNEGATIVE_F(v) ((v) >= 0)
+
+// Define predicates for complex numbers having real component `re` and
+// imaginary component `im`:
+#define NDARRAY_SEARCH_NONZERO_C(re, im) (((re) != 0) | ((im) != 0))
+#define NDARRAY_SEARCH_NAN_C(re, im) (((re) != (re)) | ((im) != (im)))
+#define NDARRAY_SEARCH_INFINITE_C(re, im) \
+  (NDARRAY_SEARCH_INFINITE_F(re) | NDARRAY_SEARCH_INFINITE_F(im))
+#define NDARRAY_SEARCH_FINITE_C(re, im) \
+  (NDARRAY_SEARCH_FINITE_F(re) & NDARRAY_SEARCH_FINITE_F(im))
+
+// Define comparisons for finding minimum and maximum values:
+#define NDARRAY_SEARCH_LT(a, b) ((a) < (b))
+#define NDARRAY_SEARCH_GT(a, b) ((a) > (b))
+
+/**
+ * Function pointer type for counting strided elements which satisfy a
+ * predicate.
+ *
+ * @private
+ * @param x   input elements
+ * @param sx  input stride (in bytes)
+ * @param n   number of elements
+ * @return    number of elements satisfying the predicate
+ */
+typedef int64_t (*ndarraySearchCountFcn)(
+    const uint8_t* x, const int64_t sx, const int64_t n
+);
+
+/**
+ * Structure describing the state of a search for a minimum or maximum value.
+ *
+ * @private
+ */
+struct ndarraySearchState {
+  // Policy for handling `NaN` values:
+  int8_t policy;
+
+  // Pointer to the current result element (or `NULL` if no element has been
+  // found):
+  const uint8_t* ptr;
+
+  // Linear view index of the current result element:
+  int64_t index;
+};
+
+/**
+ * Function pointer type for searching strided elements for a minimum or
+ * maximum value.
+ *
+ * @private
+ * @param state  search state
+ * @param x      input elements
+ * @param sx     input stride (in bytes)
+ * @param n      number of elements
+ * @param idx    linear view index of the first element
+ * @return       boolean indicating whether the search is complete
+ */
+typedef int8_t (*ndarraySearchArgFcn)(
+    struct ndarraySearchState* state, const uint8_t* x, const int64_t sx,
+    const int64_t n, const int64_t idx
+);
+
+/**
+ * Structure containing the search kernels for a single data type.
+ *
+ * @private
+ */
+struct ndarraySearchKernels {
+  // Data type:
+  int16_t dtype;
+
+  // Kernels for counting elements (indexed by predicate):
+  ndarraySearchCountFcn count[NDARRAY_SEARCH_NPREDICATES];
+
+  // Kernel for finding the first minimum value:
+  ndarraySearchArgFcn argmin;
+
+  // Kernel for finding the first maximum value:
+  ndarraySearchArgFcn argmax;
+};
+
+// Define a macro for defining a kernel which counts real-valued elements
+// satisfying a predicate:
+#define NDARRAY_SEARCH_DEFINE_COUNT(c, type, name, PRED)                       \
+  static int64_t ndarray_search_count_##name##_##c(                            \
+      const uint8_t* x, const int64_t sx, const int64_t n                      \
+  ) {                                                                          \
+    const type* p;                                                             \
+    int64_t cnt;                                                               \
+    int64_t i;                                                                 \
+    cnt = 0;                                                                   \
+    if (sx == (int64_t)sizeof(type)) {                                         \
+      p = (const type*)x;                                                      \
+      for (i = 0; i < n; i++) {                                                \
+        cnt += PRED(p[i]);                                                     \
+      }                                                                        \
+      return cnt;                                                              \
+    }                                                                          \
+    for (i = 0; i < n; i++, x += sx) {                                         \
+      cnt += PRED(*(const type*)x);                                            \
+    }                                                                          \
+    return cnt;                                                                \
+  }
+
+// Define a macro for defining a kernel which counts complex-valued elements
+// satisfying a predicate:
+#define NDARRAY_SEARCH_DEFINE_COMPLEX_COUNT(c, type, name, PRED)               \
+  static int64_t ndarray_search_count_##name##_##c(                            \
+      const uint8_t* x, const int64_t sx, const int64_t n                      \
+  ) {                                                                          \
+    const type* p;                                                             \
+    int64_t cnt;                                                               \
+    int64_t i;                                                                 \
+    cnt = 0;                                                                   \
+    if (sx == (int64_t)(2 * sizeof(type))) {                                   \
+      p = (const type*)x;                                                      \
+      for (i = 0; i < n; i++) {                                                \
+        cnt += PRED(p[2 * i], p[(2 * i) + 1]);                                 \
+      }                                                                        \
+      return cnt;                                                              \
+    }                                                                          \
+    for (i = 0; i < n; i++, x += sx) {                                         \
+      cnt += PRED(((const type*)x)[0], ((const type*)x)[1]);                   \
+    }                                                                          \
+    return cnt;                                                                \
+  }
+
+// Define a macro for defining a kernel which searches for the first minimum or
+// maximum value (note: each block is first reduced without branching, and the
+// block is only scanned for the position of its extremum, or of its first
+// `NaN`, if the block changes the search result):
+#define NDARRAY_SEARCH_DEFINE_ARG(c, type, name, CMP, init, ISNAN)             \
+  static int8_t ndarray_search_##name##_##c(                                   \
+      struct ndarraySearchState* state, const uint8_t* x, const int64_t sx,    \
+      const int64_t n, const int64_t idx                                       \
+  ) {                                                                          \
+    const uint8_t* q;                                                          \
+    const type* p;                                                             \
+    type b;                                                                    \
+    type v;                                                                    \
+    int64_t m;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    int nan;                                                                   \
+    for (i = 0; i < n; i += NDARRAY_SEARCH_BLOCK) {                            \
+      m   = n - i;                                                             \
+      m   = (m < NDARRAY_SEARCH_BLOCK) ? m : NDARRAY_SEARCH_BLOCK;             \
+      b   = (type)(init);                                                      \
+      nan = 0;                                                                 \
+      if (sx == (int64_t)sizeof(type)) {                                       \
+        p = (const type*)x;                                                    \
+        for (j = 0; j < m; j++) {                                              \
+          v = p[j];                                                            \
+          b = CMP(v, b) ? v : b;                                               \
+          nan |= ISNAN(v);                                                     \
+        }                                                                      \
+      } else {                                                                 \
+        for (j = 0, q = x; j < m; j++, q += sx) {                              \
+          v = *(const type*)q;                                                 \
+          b = CMP(v, b) ? v : b;                                               \
+          nan |= ISNAN(v);                                                     \
+        }                                                                      \
+      }                                                                        \
+      if (nan && state->policy == NDARRAY_NAN_PROPAGATE) {                     \
+        for (j = 0, q = x; !ISNAN(*(const type*)q); j++, q += sx) {            \
+        }                                                                      \
+        state->ptr   = q;                                                      \
+        state->index = idx + i + j;                                            \
+        return 1;                                                              \
+      }                                                                        \
+      if (state->ptr == NULL || CMP(b, *(const type*)(state->ptr))) {          \
+        for (j = 0, q = x; j < m; j++, q += sx) {                              \
+          if (*(const type*)q == b) {                                          \
+            state->ptr   = q;                                                  \
+            state->index = idx + i + j;                                        \
+            break;                                                             \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+      x += NDARRAY_SEARCH_BLOCK * sx;                                          \
+    }                                                                          \
+    return 0;                                                                  \
+  }
+
+// Define a macro for defining all kernels for a real-valued data type:
+#define NDARRAY_SEARCH_DEFINE_REAL(dtype, c, type, lo, hi, kind)               \
+  NDARRAY_SEARCH_DEFINE_COUNT(c, type, nonzero, NDARRAY_SEARCH_NONZERO_##kind) \
+  NDARRAY_SEARCH_DEFINE_COUNT(c, type, nan, NDARRAY_SEARCH_NAN_##kind)         \
+  NDARRAY_SEARCH_DEFINE_COUNT(                                                 \
+      c, type, infinite, NDARRAY_SEARCH_INFINITE_##kind                        \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_COUNT(c, type, finite, NDARRAY_SEARCH_FINITE_##kind)   \
+  NDARRAY_SEARCH_DEFINE_COUNT(                                                 \
+      c, type, positive, NDARRAY_SEARCH_POSITIVE_##kind                        \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_COUNT(                                                 \
+      c, type, negative, NDARRAY_SEARCH_NEGATIVE_##kind                        \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_COUNT(                                                 \
+      c, type, nonnegative, NDARRAY_SEARCH_NONNEGATIVE_##kind                  \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_ARG(                                                   \
+      c, type, argmin, NDARRAY_SEARCH_LT, hi, NDARRAY_SEARCH_NAN_##kind        \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_ARG(                                                   \
+      c, type, argmax, NDARRAY_SEARCH_GT, lo, NDARRAY_SEARCH_NAN_##kind        \
+  )
+
+// Define a macro for defining all kernels for a complex-valued data type:
+#define NDARRAY_SEARCH_DEFINE_COMPLEX(dtype, c, type)                          \
+  NDARRAY_SEARCH_DEFINE_COMPLEX_COUNT(                                         \
+      c, type, nonzero, NDARRAY_SEARCH_NONZERO_C                               \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_COMPLEX_COUNT(c, type, nan, NDARRAY_SEARCH_NAN_C)      \
+  NDARRAY_SEARCH_DEFINE_COMPLEX_COUNT(                                         \
+      c, type, infinite, NDARRAY_SEARCH_INFINITE_C                             \
+  )                                                                            \
+  NDARRAY_SEARCH_DEFINE_COMPLEX_COUNT(c, type, finite, NDARRAY_SEARCH_FINITE_C)
+
+// Define kernels for all supported data types:
+NDARRAY_SEARCH_REAL_DTYPES(NDARRAY_SEARCH_DEFINE_REAL)
+NDARRAY_SEARCH_COMPLEX_DTYPES(NDARRAY_SEARCH_DEFINE_COMPLEX)
+
+// Define macros for generating kernel table entries:
+#define NDARRAY_SEARCH_REAL_ENTRY(dtype, c, type, lo, hi, kind)                \
+  {dtype,                                                                      \
+   {ndarray_search_count_nonzero_##c, ndarray_search_count_nan_##c,            \
+    ndarray_search_count_infinite_##c, ndarray_search_count_finite_##c,        \
+    ndarray_search_count_positive_##c, ndarray_search_count_negative_##c,      \
+    ndarray_search_count_nonnegative_##c},                                     \
+   ndarray_search_argmin_##c,                                                  \
+   ndarray_search_argmax_##c},
+
+#define NDARRAY_SEARCH_COMPLEX_ENTRY(dtype, c, type)                           \
+  {dtype,                                                                      \
+   {ndarray_search_count_nonzero_##c, ndarray_search_count_nan_##c,            \
+    ndarray_search_count_infinite_##c, ndarray_search_count_finite_##c, NULL,  \
+    NULL, NULL},                                                               \
+   NULL,                                                                       \
+   NULL},
+
+// Define a table of kernels for all supported data types (note: complex numbers
+// are not ordered, and, thus, do not support sign predicates or searching for
+// minimum and maximum values):
+static const struct ndarraySearchKernels NDARRAY_SEARCH_KERNELS[] = {
+    NDARRAY_SEARCH_REAL_DTYPES(NDARRAY_SEARCH_REAL_ENTRY)
+        NDARRAY_SEARCH_COMPLEX_DTYPES(NDARRAY_SEARCH_COMPLEX_ENTRY)};
+
+/**
+ * Function pointer type for processing a run of strided elements.
+ *
+ * @private
+ * @param ctx  context
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param n    number of elements
+ * @param idx  linear index of the first element in traversal order
+ * @return     boolean indicating whether to stop iterating
+ */
+typedef int8_t (*ndarraySearchRunFcn)(
+    void* ctx, const uint8_t* x, const int64_t sx, const int64_t n,
+    const int64_t idx
+);
+
+/**
+ * Returns the kernels for a data type.
+ *
+ * @private
+ * @param dtype  data type
+ * @return       kernels (or `NULL` if the data type is not supported)
+ */
+static const struct ndarraySearchKernels* ndarray_search_kernels(
+    const int16_t dtype
+) {
+  size_t i;
+  for (i = 0; i < sizeof(NDARRAY_SEARCH_KERNELS) /
+                      sizeof(NDARRAY_SEARCH_KERNELS[0]);
+       i++) {
+    if (NDARRAY_SEARCH_KERNELS[i].dtype == dtype) {
+      return &(NDARRAY_SEARCH_KERNELS[i]);
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Returns the absolute value of a stride.
+ *
+ * @private
+ * @param x  stride
+ * @return   absolute value
+ */
+static inline int64_t ndarray_search_abs(const int64_t x) {
+  return (x < 0) ? -x : x;
+}
+
+/**
+ * Iterates over the elements of a non-empty ndarray as a sequence of strided
+ * runs.
+ *
+ * ## Notes
+ *
+ * -   If `memory` is `0`, elements are visited in view order (i.e., the order
+ *     of linear view indices for the ndarray's order), and `idx` is the linear
+ *     view index of each run's first element. Otherwise, elements are visited
+ *     in (approximate) memory order, and `idx` has no meaning beyond being a
+ *     running count of visited elements.
+ * -   Adjacent dimensions which can be traversed as a single dimension are
+ *     coalesced, such that, for contiguous ndarrays, all elements are visited
+ *     as a single run.
+ *
+ * @private
+ * @param x       input ndarray
+ * @param memory  boolean indicating whether to visit elements in memory order
+ * @param fcn     callback invoked for each run
+ * @param ctx     callback context
+ * @return        status code
+ */
+static int8_t ndarray_search_iterate(
+    const struct ndarray* x, const int8_t memory, ndarraySearchRunFcn fcn,
+    void* ctx
+) {
+  const uint8_t* p;
+  int64_t* meta;
+  int64_t* sub;
+  int64_t* sh;
+  int64_t* st;
+  int64_t nmeta;
+  int64_t idx;
+  int64_t nd;
+  int64_t d;
+  int64_t r;
+  int64_t s;
+  int64_t i;
+  int64_t k;
+
+  nmeta = sizeof(int64_t) * ((x->ndims * 3) + 3);
+  meta  = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (meta == NULL) {
+    return -1;
+  }
+  sh  = meta;
+  st  = sh + x->ndims + 1;
+  sub = st + x->ndims + 1;
+
+  // Resolve non-singleton dimensions from the fastest to the slowest varying
+  // dimension in view order...
+  nd = 0;
+  for (k = 0; k < x->ndims; k++) {
+    d = (x->order == NDARRAY_COLUMN_MAJOR) ? k : x->ndims - 1 - k;
+    if (x->shape[d] == 1) {
+      continue;
+    }
+    sh[nd] = x->shape[d];
+    st[nd] = x->strides[d];
+    nd += 1;
+  }
+  if (nd == 0) {
+    sh[0] = 1;
+    st[0] = 0;
+    nd    = 1;
+  }
+  // Sort dimensions by stride magnitude when visiting elements in memory
+  // order (note: insertion sort is stable and the number of dimensions is
+  // small)...
+  if (memory) {
+    for (i = 1; i < nd; i++) {
+      r = sh[i];
+      s = st[i];
+      for (k = i; k > 0 && ndarray_search_abs(st[k - 1]) >
+                               ndarray_search_abs(s);
+           k--) {
+        sh[k] = sh[k - 1];
+        st[k] = st[k - 1];
+      }
+      sh[k] = r;
+      st[k] = s;
+    }
+  }
+  // Coalesce dimensions which can be traversed as a single dimension...
+  d = 0;
+  for (k = 1; k < nd; k++) {
+    if (st[k] == st[d] * sh[d]) {
+      sh[d] *= sh[k];
+    } else {
+      d += 1;
+      sh[d] = sh[k];
+      st[d] = st[k];
+    }
+  }
+  nd = d + 1;
+  for (k = 0; k < nd; k++) {
+    sub[k] = 0;
+  }
+  p   = x->data + x->offset;
+  idx = 0;
+  while (1) {
+    if (fcn(ctx, p, st[0], sh[0], idx)) {
+      break;
+    }
+    idx += sh[0];
+
+    // Advance the subscripts of the remaining dimensions...
+    for (k = 1; k < nd; k++) {
+      sub[k] += 1;
+      p += st[k];  // pointer arithmetic
+      if (sub[k] < sh[k]) {
+        break;
+      }
+      p -= sub[k] * st[k];  // pointer arithmetic
+      sub[k] = 0;
+    }
+    if (k >= nd) {
+      break;
+    }
+  }
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, meta, nmeta);
+  return 0;
+}
+
+/**
+ * Structure describing a predicate test.
+ *
+ * @private
+ */
+struct ndarraySearchTest {
+  // Counting kernel:
+  ndarraySearchCountFcn fcn;
+
+  // Stopping criterion (`1`: stop at the first element satisfying the
+  // predicate; `-1`: stop at the first element not satisfying the predicate;
+  // `0`: count all elements):
+  int8_t stop;
+
+  // Boolean indicating whether the stopping criterion was met:
+  int8_t stopped;
+
+  // Number of elements satisfying the predicate:
+  int64_t count;
+};
+
+/**
+ * Tests a run of elements against a predicate.
+ *
+ * @private
+ * @param ctx  predicate test
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param n    number of elements
+ * @param idx  linear index of the first element in traversal order
+ * @return     boolean indicating whether to stop iterating
+ */
+static int8_t ndarray_search_test_run(
+    void* ctx, const uint8_t* x, const int64_t sx, const int64_t n,
+    const int64_t idx
+) {
+  struct ndarraySearchTest* test;
+  int64_t cnt;
+  int64_t m;
+  int64_t i;
+
+  (void)idx;
+  test = (struct ndarraySearchTest*)ctx;
+  if (test->stop == 0) {
+    test->count += test->fcn(x, sx, n);
+    return 0;
+  }
+  for (i = 0; i < n; i += NDARRAY_SEARCH_BLOCK) {
+    m   = n - i;
+    m   = (m < NDARRAY_SEARCH_BLOCK) ? m : NDARRAY_SEARCH_BLOCK;
+    cnt = test->fcn(x + (i * sx), sx, m);
+    test->count += cnt;
+    if ((test->stop > 0 && cnt > 0) || (test->stop < 0 && cnt < m)) {
+      test->stopped = 1;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Tests ndarray elements against a predicate.
+ *
+ * @private
+ * @param x          input ndarray
+ * @param predicate  predicate
+ * @param stop       stopping criterion
+ * @param test       output predicate test
+ * @return           status code
+ */
+static int8_t ndarray_search_test(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    const int8_t stop, struct ndarraySearchTest* test
+) {
+  const struct ndarraySearchKernels* kernels;
+  int64_t len;
+  int64_t i;
+
+  if (x == NULL || predicate < 0 ||
+      predicate >= NDARRAY_SEARCH_NPREDICATES) {
+    return -1;
+  }
+  kernels = ndarray_search_kernels(x->dtype);
+  if (kernels == NULL || kernels->count[predicate] == NULL) {
+    return -1;
+  }
+  test->fcn     = kernels->count[predicate];
+  test->stop    = stop;
+  test->stopped = 0;
+  test->count   = 0;
+
+  len = 1;
+  for (i = 0; i < x->ndims; i++) {
+    len *= x->shape[i];
+  }
+  if (len == 0) {
+    return 0;
+  }
+  return ndarray_search_iterate(x, 1, ndarray_search_test_run, test);
+}
+
+/**
+ * Structure describing a search for a minimum or maximum value.
+ *
+ * @private
+ */
+struct ndarraySearchArg {
+  // Search kernel:
+  ndarraySearchArgFcn fcn;
+
+  // Search state:
+  struct ndarraySearchState state;
+};
+
+/**
+ * Searches a run of elements for a minimum or maximum value.
+ *
+ * @private
+ * @param ctx  search
+ * @param x    input elements
+ * @param sx   input stride (in bytes)
+ * @param n    number of elements
+ * @param idx  linear view index of the first element
+ * @return     boolean indicating whether to stop iterating
+ */
+static int8_t ndarray_search_arg_run(
+    void* ctx, const uint8_t* x, const int64_t sx, const int64_t n,
+    const int64_t idx
+) {
+  struct ndarraySearchArg* arg = (struct ndarraySearchArg*)ctx;
+  return arg->fcn(&(arg->state), x, sx, n, idx);
+}
+
+/**
+ * Searches ndarray elements for the first minimum or maximum value.
+ *
+ * @private
+ * @param x       input ndarray
+ * @param max     boolean indicating whether to search for a maximum value
+ * @param policy  policy for handling `NaN` values
+ * @param out     output argument for the linear view index
+ * @return        status code
+ */
+static int8_t ndarray_search_arg(
+    const struct ndarray* x, const int8_t max,
+    const enum NDARRAY_NAN_POLICY policy, int64_t* out
+) {
+  const struct ndarraySearchKernels* kernels;
+  struct ndarraySearchArg arg;
+  int64_t len;
+  int64_t i;
+
+  if (x == NULL || out == NULL ||
+      (policy != NDARRAY_NAN_PROPAGATE && policy != NDARRAY_NAN_OMIT)) {
+    return -1;
+  }
+  kernels = ndarray_search_kernels(x->dtype);
+  if (kernels == NULL || kernels->argmin == NULL) {
+    return -1;
+  }
+  len = 1;
+  for (i = 0; i < x->ndims; i++) {
+    len *= x->shape[i];
+  }
+  if (len == 0) {
+    return -1;
+  }
+  arg.fcn          = (max) ? kernels->argmax : kernels->argmin;
+  arg.state.policy = (int8_t)policy;
+  arg.state.ptr    = NULL;
+  arg.state.index  = -1;
+  if (ndarray_search_iterate(x, 0, ndarray_search_arg_run, &arg) != 0) {
+    return -1;
+  }
+  if (arg.state.ptr == NULL) {
+    return -1;
+  }
+  *out = arg.state.index;
+  return 0;
+}
+
+/**
+ * Returns the linear view index of the first minimum value of an ndarray.
+ *
+ * ## Notes
+ *
+ * -   The returned index is a linear index in the array view for the ndarray's
+ *     order (i.e., the index which `ndarray_vind2bind` resolves to the
+ *     element's location in the underlying data buffer). If multiple elements
+ *     have the minimum value, the function returns the smallest index.
+ * -   If `policy` is `NDARRAY_NAN_PROPAGATE`, `NaN` is considered the minimum
+ *     value, and the function returns the index of the first `NaN`. If
+ *     `policy` is `NDARRAY_NAN_OMIT`, the function ignores `NaN` values.
+ * -   Signed zeros compare equal.
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, and single- and double-precision floating-point
+ *     numbers.
+ * -   If successful, the function returns `0`. If the ndarray is empty, all
+ *     elements are ignored `NaN` values, or the data type is not supported,
+ *     the function returns `-1`.
+ *
+ * @param x       input ndarray
+ * @param policy  policy for handling `NaN` values
+ * @param out     output argument for the linear view index
+ * @return        status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/search.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/nan_policies.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * double buf[] = {3.0, 1.0, 2.0, 1.0};
+ * int64_t shape[] = {2, 2};
+ * int64_t strides[] = {16, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)buf, 2, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int64_t idx;
+ * int8_t status = ndarray_argmin(x, NDARRAY_NAN_PROPAGATE, &idx);
+ * // idx => 1
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_argmin(
+    const struct ndarray* x, const enum NDARRAY_NAN_POLICY policy, int64_t* out
+) {
+  return ndarray_search_arg(x, 0, policy, out);
+}
+
+/**
+ * Returns the linear view index of the first maximum value of an ndarray.
+ *
+ * ## Notes
+ *
+ * -   The returned index is a linear index in the array view for the ndarray's
+ *     order (i.e., the index which `ndarray_vind2bind` resolves to the
+ *     element's location in the underlying data buffer). If multiple elements
+ *     have the maximum value, the function returns the smallest index.
+ * -   If `policy` is `NDARRAY_NAN_PROPAGATE`, `NaN` is considered the maximum
+ *     value, and the function returns the index of the first `NaN`. If
+ *     `policy` is `NDARRAY_NAN_OMIT`, the function ignores `NaN` values.
+ * -   Signed zeros compare equal.
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, and single- and double-precision floating-point
+ *     numbers.
+ * -   If successful, the function returns `0`. If the ndarray is empty, all
+ *     elements are ignored `NaN` values, or the data type is not supported,
+ *     the function returns `-1`.
+ *
+ * @param x       input ndarray
+ * @param policy  policy for handling `NaN` values
+ * @param out     output argument for the linear view index
+ * @return        status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/search.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/nan_policies.h"
+ * #include "ndarray/orders.h"
+ * #include <math.h>
+ * #include <stdint.h>
+ *
+ * double buf[] = {3.0, NAN, 5.0, 1.0};
+ * int64_t shape[] = {4};
+ * int64_t strides[] = {8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int64_t idx;
+ * int8_t status = ndarray_argmax(x, NDARRAY_NAN_OMIT, &idx);
+ * // idx => 2
+ *
+ * status = ndarray_argmax(x, NDARRAY_NAN_PROPAGATE, &idx);
+ * // idx => 1
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_argmax(
+    const struct ndarray* x, const enum NDARRAY_NAN_POLICY policy, int64_t* out
+) {
+  return ndarray_search_arg(x, 1, policy, out);
+}
+
+/**
+ * Tests whether at least one ndarray element satisfies a predicate.
+ *
+ * ## Notes
+ *
+ * -   The function stops testing elements as soon as an element satisfies the
+ *     predicate.
+ * -   If the ndarray is empty, the result is `0`.
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, and single- and double-precision floating-point and
+ *     complex floating-point numbers. Complex numbers only support the
+ *     `NONZERO`, `NAN`, `INFINITE`, and `FINITE` predicates.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x          input ndarray
+ * @param predicate  predicate
+ * @param out        output argument for the result
+ * @return           status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/search.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include "ndarray/predicates.h"
+ * #include <math.h>
+ * #include <stdint.h>
+ *
+ * float buf[] = {1.0f, 2.0f, NAN, 4.0f};
+ * int64_t shape[] = {4};
+ * int64_t strides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT32, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int8_t result;
+ * int8_t status = ndarray_any(x, NDARRAY_PREDICATE_NAN, &result);
+ * // result => 1
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_any(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int8_t* out
+) {
+  struct ndarraySearchTest test;
+
+  if (out == NULL || ndarray_search_test(x, predicate, 1, &test) != 0) {
+    return -1;
+  }
+  *out = (test.count > 0);
+  return 0;
+}
+
+/**
+ * Tests whether all ndarray elements satisfy a predicate.
+ *
+ * ## Notes
+ *
+ * -   The function stops testing elements as soon as an element does not
+ *     satisfy the predicate.
+ * -   If the ndarray is empty, the result is `1`.
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, and single- and double-precision floating-point and
+ *     complex floating-point numbers. Complex numbers only support the
+ *     `NONZERO`, `NAN`, `INFINITE`, and `FINITE` predicates.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x          input ndarray
+ * @param predicate  predicate
+ * @param out        output argument for the result
+ * @return           status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/search.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include "ndarray/predicates.h"
+ * #include <stdint.h>
+ *
+ * int32_t buf[] = {1, 2, 0, 4};
+ * int64_t shape[] = {4};
+ * int64_t strides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int8_t result;
+ * int8_t status = ndarray_all(x, NDARRAY_PREDICATE_POSITIVE, &result);
+ * // result => 0
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_all(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int8_t* out
+) {
+  struct ndarraySearchTest test;
+
+  if (out == NULL || ndarray_search_test(x, predicate, -1, &test) != 0) {
+    return -1;
+  }
+  *out = !test.stopped;
+  return 0;
+}
+
+/**
+ * Counts the number of ndarray elements which satisfy a predicate.
+ *
+ * ## Notes
+ *
+ * -   Supported data types are booleans, signed and unsigned 8-, 16-, 32-, and
+ *     64-bit integers, and single- and double-precision floating-point and
+ *     complex floating-point numbers. Complex numbers only support the
+ *     `NONZERO`, `NAN`, `INFINITE`, and `FINITE` predicates.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x          input ndarray
+ * @param predicate  predicate
+ * @param out        output argument for the number of elements
+ * @return           status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/search.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include "ndarray/predicates.h"
+ * #include <stdint.h>
+ *
+ * int32_t buf[] = {1, 0, 0, 4};
+ * int64_t shape[] = {4};
+ * int64_t strides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * int64_t count;
+ * int8_t status = ndarray_count(x, NDARRAY_PREDICATE_NONZERO, &count);
+ * // count => 2
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_count(
+    const struct ndarray* x, const enum NDARRAY_PREDICATE predicate,
+    int64_t* out
+) {
+  struct ndarraySearchTest test;
+
+  if (out == NULL || ndarray_search_test(x, predicate, 0, &test) != 0) {
+    return -1;
+  }
+  *out = test.count;
+  return 0;
+}
@@ -0,0 +1,1852 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/sort.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ndarray.h"
+#include "ndarray/base/bytes_per_element.h"
+#include "ndarray/base/memory.h"
+#include "ndarray/base/parallel.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/memory_categories.h"
+
+// Define the minimum line length for which to use radix sort (note: shorter
+// lines are sorted using merge sort, as the cost of computing and scanning
+// digit histograms dominates for short lines):
+#define NDARRAY_SORT_RADIX_MIN 256
+
+// Define the length of the runs which are sorted using insertion sort before
+// being merged:
+#define NDARRAY_SORT_RUN 16
+
+// Define the minimum number of elements sorted per task when grouping short
+// lines:
+#define NDARRAY_SORT_GROUP 16384
+
+// Define the number of radix sort buckets (i.e., radix sort digits are bytes):
+#define NDARRAY_SORT_BUCKETS 256
+
+// Define the maximum number of elements for which to select the smallest
+// elements of a line using a heap (note: more elements are selected using
+// introselect):
+#define NDARRAY_SORT_HEAP_MAX 128
+
+// Define the supported operations:
+#define NDARRAY_SORT_OP_SORT 0
+#define NDARRAY_SORT_OP_ARGSORT 1
+#define NDARRAY_SORT_OP_PARTITION 2
+#define NDARRAY_SORT_OP_ARGPARTITION 3
+#define NDARRAY_SORT_OP_TOPK 4
+#define NDARRAY_SORT_OP_QUANTILE 5
+
+// Define a list of supported real-valued data types (dtype, key width in bits,
+// key kind):
+#define NDARRAY_SORT_REAL_DTYPES(X) \
+  X(NDARRAY_BOOL, 8, U)             \
+  X(NDARRAY_INT8, 8, S)             \
+  X(NDARRAY_UINT8, 8, U)            \
+  X(NDARRAY_UINT8C, 8, U)           \
+  X(NDARRAY_INT16, 16, S)           \
+  X(NDARRAY_UINT16, 16, U)          \
+  X(NDARRAY_INT32, 32, S)           \
+  X(NDARRAY_UINT32, 32, U)          \
+  X(NDARRAY_INT64, 64, S)           \
+  X(NDARRAY_UINT64, 64, U)          \
+  X(NDARRAY_FLOAT32, 32, F)         \
+  X(NDARRAY_FLOAT64, 64, F)
+
+// Define a list of supported complex-valued data types (dtype, component key
+// width in bits):
+#define NDARRAY_SORT_COMPLEX_DTYPES(X) \
+  X(NDARRAY_COMPLEX64, 32)             \
+  X(NDARRAY_COMPLEX128, 64)
+
+// Define a macro for resolving the sign bit of a key having a specified width:
+#define NDARRAY_SORT_SIGN(W) ((uint##W##_t)1 << ((W) - 1))
+
+// Define the bit patterns of positive infinity for each floating-point key
+// width (note: larger magnitudes are `NaN`):
+#define NDARRAY_SORT_INF_32 UINT32_C(0x7F800000)
+#define NDARRAY_SORT_INF_64 UINT64_C(0x7FF0000000000000)
+
+// Define macros for mapping the bits `u` of an element to an unsigned key
+// whose order matches the element order, and back again, for each kind of key
+// (unsigned integers, signed integers, and floating-point numbers):
+#define NDARRAY_SORT_KEY_U(u, W, canonical) (u)
+#define NDARRAY_SORT_KEY_S(u, W, canonical) ((u) ^ NDARRAY_SORT_SIGN(W))
+#define NDARRAY_SORT_KEY_F(u, W, canonical) ndarray_sort_fkey_##W(u, canonical)
+#define NDARRAY_SORT_UNKEY_U(k, W) (k)
+#define NDARRAY_SORT_UNKEY_S(k, W) ((k) ^ NDARRAY_SORT_SIGN(W))
+#define NDARRAY_SORT_UNKEY_F(k, W) \
+  (((k) & NDARRAY_SORT_SIGN(W)) ? ((k) ^ NDARRAY_SORT_SIGN(W)) : ~(k))
+
+// Define macros for converting the bits `u` of an element to a double-precision
+// floating-point number for each kind of key:
+#define NDARRAY_SORT_DOUBLE_U(u, W) ((double)(u))
+#define NDARRAY_SORT_DOUBLE_S(u, W) ((double)(int##W##_t)(u))
+#define NDARRAY_SORT_DOUBLE_F(u, W) ndarray_sort_fdouble_##W(u)
+
+/**
+ * Function pointer type for loading strided elements as sort keys.
+ *
+ * @private
+ * @param x          input elements
+ * @param sx         input stride (in bytes)
+ * @param n          number of elements
+ * @param canonical  boolean indicating whether to map equal elements having
+ *                   distinct bit patterns (i.e., signed zeros and `NaN`
+ *                   values) to equal keys
+ * @param keys       output keys
+ */
+typedef void (*ndarraySortLoadFcn)(
+    const uint8_t* x, const int64_t sx, const int64_t n, const int8_t canonical,
+    void* keys
+);
+
+/**
+ * Function pointer type for storing sort keys as strided elements.
+ *
+ * @private
+ * @param keys  input keys
+ * @param n     number of elements
+ * @param y     output elements
+ * @param sy    output stride (in bytes)
+ */
+typedef void (*ndarraySortStoreFcn)(
+    const void* keys, const int64_t n, uint8_t* y, const int64_t sy
+);
+
+/**
+ * Function pointer type for converting a key to a double-precision
+ * floating-point number.
+ *
+ * @private
+ * @param keys  input keys
+ * @param i     key index
+ * @return      element value
+ */
+typedef double (*ndarraySortValueFcn)(const void* keys, const int64_t i);
+
+/**
+ * Function pointer type for partially sorting keys, such that the key at a
+ * specified position is the key which would be at that position were the keys
+ * sorted, preceding keys are less than or equal to that key, and following
+ * keys are greater than or equal to that key.
+ *
+ * @private
+ * @param keys   keys
+ * @param ix     indices (or `NULL`)
+ * @param tkeys  temporary buffer for keys
+ * @param tix    temporary buffer for indices
+ * @param n      number of keys
+ * @param kth    position of the selected key
+ * @param hist   buffer for digit histograms
+ */
+typedef void (*ndarraySortSelectFcn)(
+    void* keys, int64_t* ix, void* tkeys, int64_t* tix, const int64_t n,
+    const int64_t kth, int64_t* hist
+);
+
+/**
+ * Function pointer type for resolving the positions of the minimum and maximum
+ * keys in a range.
+ *
+ * @private
+ * @param keys  keys
+ * @param s     index of the first key
+ * @param e     index after the last key
+ * @param imin  output position of the minimum key
+ * @param imax  output position of the maximum key
+ */
+typedef void (*ndarraySortExtremaFcn)(
+    const void* keys, const int64_t s, const int64_t e, int64_t* imin,
+    int64_t* imax
+);
+
+/**
+ * Function pointer type for sorting the smallest (or largest) keys of a
+ * strided line.
+ *
+ * @private
+ * @param load     function for loading elements as keys
+ * @param x        input elements
+ * @param sx       input stride (in bytes)
+ * @param n        number of elements
+ * @param m        number of keys to select
+ * @param largest  boolean indicating whether to select the largest keys
+ * @param keys     output keys
+ * @param ix       output indices
+ * @param tkeys    temporary buffer for keys
+ * @param tix      temporary buffer for indices
+ * @param hist     buffer for digit histograms
+ * @return         boolean indicating whether the selected keys (and indices)
+ *                 are stored in the temporary buffers
+ */
+typedef int8_t (*ndarraySortSmallestFcn)(
+    const ndarraySortLoadFcn load, const uint8_t* x, const int64_t sx,
+    const int64_t n, const int64_t m, const int8_t largest, void* keys,
+    int64_t* ix, void* tkeys, int64_t* tix, int64_t* hist
+);
+
+/**
+ * Structure containing the sort kernels for a single data type.
+ *
+ * @private
+ */
+struct ndarraySortKernels {
+  // Data type:
+  int16_t dtype;
+
+  // Key width in bits (note: for complex numbers, the width of a component
+  // key):
+  int64_t width;
+
+  // Boolean indicating whether the data type is complex-valued:
+  int8_t iscomplex;
+
+  // Function for loading elements as keys (note: `NULL` for complex numbers):
+  ndarraySortLoadFcn load;
+
+  // Function for storing keys as elements (note: `NULL` for complex numbers):
+  ndarraySortStoreFcn store;
+
+  // Function for converting keys to numbers (note: `NULL` for complex
+  // numbers):
+  ndarraySortValueFcn value;
+
+  // Function for partially sorting keys (note: `NULL` for complex numbers):
+  ndarraySortSelectFcn select;
+
+  // Function for resolving the positions of extreme keys (note: `NULL` for
+  // complex numbers):
+  ndarraySortExtremaFcn extrema;
+
+  // Function for sorting the smallest keys of a line (note: `NULL` for
+  // complex numbers):
+  ndarraySortSmallestFcn smallest;
+};
+
+/**
+ * Structure containing the state of a sort along a dimension.
+ *
+ * @private
+ */
+struct ndarraySortLoop {
+  // Kernels:
+  const struct ndarraySortKernels* kernels;
+
+  // Operation:
+  int8_t op;
+
+  // Selected position (partitions) or number of selected elements (top-k
+  // selections):
+  int64_t k;
+
+  // Boolean indicating whether to select the largest elements (top-k
+  // selections):
+  int8_t largest;
+
+  // Quantile:
+  double q;
+
+  // Number of bytes per input element:
+  int64_t bpe;
+
+  // Output data type:
+  int16_t dtype;
+
+  // Pointer to the first input element:
+  const uint8_t* x;
+
+  // Pointer to the first output element (or `NULL`):
+  uint8_t* out;
+
+  // Pointer to the first output index (or `NULL`):
+  uint8_t* ind;
+
+  // Number of elements along the sorted dimension:
+  int64_t n;
+
+  // Input stride (in bytes) along the sorted dimension:
+  int64_t xsa;
+
+  // Output stride (in bytes) along the sorted dimension:
+  int64_t osa;
+
+  // Output index stride (in bytes) along the sorted dimension:
+  int64_t isa;
+
+  // Number of outer dimensions:
+  int64_t no;
+
+  // Outer dimension shape:
+  int64_t* oshape;
+
+  // Outer dimension input strides:
+  int64_t* oxs;
+
+  // Outer dimension output strides:
+  int64_t* oos;
+
+  // Outer dimension output index strides:
+  int64_t* ois;
+
+  // Number of lines (i.e., outer indices):
+  int64_t nlines;
+
+  // Number of lines per task:
+  int64_t group;
+
+  // Per-thread scratch buffers:
+  uint8_t* scratch;
+
+  // Number of bytes per thread scratch buffer:
+  int64_t sb;
+};
+
+// Define a macro for defining a function which maps the bits of a
+// floating-point number to a key (note: negative numbers have all bits
+// flipped, while positive numbers only have the sign bit flipped, such that
+// keys compare as unsigned integers in the same order as numbers; `NaN` values
+// sort after positive infinity):
+#define NDARRAY_SORT_DEFINE_FKEY(W)                                        \
+  static inline uint##W##_t ndarray_sort_fkey_##W(                         \
+      const uint##W##_t u, const int8_t canonical                          \
+  ) {                                                                      \
+    if ((u & ~NDARRAY_SORT_SIGN(W)) > NDARRAY_SORT_INF_##W) {              \
+      return (canonical) ? ~(uint##W##_t)0 : (u | NDARRAY_SORT_SIGN(W));   \
+    }                                                                      \
+    if (canonical && u == NDARRAY_SORT_SIGN(W)) {                          \
+      return NDARRAY_SORT_SIGN(W);                                         \
+    }                                                                      \
+    return (u & NDARRAY_SORT_SIGN(W)) ? ~u : (u | NDARRAY_SORT_SIGN(W));   \
+  }
+
+NDARRAY_SORT_DEFINE_FKEY(32)
+NDARRAY_SORT_DEFINE_FKEY(64)
+
+// Define a macro for defining a function which converts the bits of a
+// floating-point number to a double-precision floating-point number:
+#define NDARRAY_SORT_DEFINE_FDOUBLE(W, T)                                    \
+  static inline double ndarray_sort_fdouble_##W(const uint##W##_t u) {      \
+    T v;                                                                    \
+    memcpy(&v, &u, sizeof(v));                                              \
+    return (double)v;                                                       \
+  }
+
+NDARRAY_SORT_DEFINE_FDOUBLE(32, float)
+NDARRAY_SORT_DEFINE_FDOUBLE(64, double)
+
+// Define a macro for defining stable sorts of keys having a specified width,
+// which optionally permute an array of indices alongside the keys:
+#define NDARRAY_SORT_DEFINE_KEYS(W)                                            \
+  static int8_t ndarray_sort_radix_##W(                                        \
+      uint##W##_t* k, int64_t* ix, uint##W##_t* tk, int64_t* tix,              \
+      const int64_t n, int64_t* hist                                           \
+  ) {                                                                          \
+    uint##W##_t* sk = k;                                                       \
+    uint##W##_t* dk = tk;                                                      \
+    uint##W##_t* uk;                                                           \
+    int64_t* si = ix;                                                          \
+    int64_t* di = (ix == NULL) ? NULL : tix;                                   \
+    int64_t* ui;                                                               \
+    int8_t swapped;                                                            \
+    uint##W##_t v;                                                             \
+    int64_t* h;                                                                \
+    int64_t sum;                                                               \
+    int64_t c;                                                                 \
+    int64_t i;                                                                 \
+    int64_t d;                                                                 \
+    int b;                                                                     \
+    memset(                                                                    \
+        hist, 0, sizeof(int64_t) * ((W) / 8) * NDARRAY_SORT_BUCKETS            \
+    );                                                                         \
+    for (i = 0; i < n; i++) {                                                  \
+      v = k[i];                                                                \
+      for (b = 0; b < (W) / 8; b++) {                                          \
+        hist[(b * NDARRAY_SORT_BUCKETS) + ((v >> (8 * b)) & 0xFF)] += 1;       \
+      }                                                                        \
+    }                                                                          \
+    swapped = 0;                                                               \
+    for (b = 0; b < (W) / 8; b++) {                                            \
+      h = hist + (b * NDARRAY_SORT_BUCKETS);                                   \
+      if (h[(sk[0] >> (8 * b)) & 0xFF] == n) {                                 \
+        /* All keys share the same digit... */                                 \
+        continue;                                                              \
+      }                                                                        \
+      sum = 0;                                                                 \
+      for (d = 0; d < NDARRAY_SORT_BUCKETS; d++) {                             \
+        c    = h[d];                                                           \
+        h[d] = sum;                                                            \
+        sum += c;                                                              \
+      }                                                                        \
+      if (si == NULL) {                                                        \
+        for (i = 0; i < n; i++) {                                              \
+          d        = (sk[i] >> (8 * b)) & 0xFF;                                \
+          dk[h[d]] = sk[i];                                                    \
+          h[d] += 1;                                                           \
+        }                                                                      \
+      } else {                                                                 \
+        for (i = 0; i < n; i++) {                                              \
+          d     = (sk[i] >> (8 * b)) & 0xFF;                                   \
+          c     = h[d];                                                        \
+          dk[c] = sk[i];                                                       \
+          di[c] = si[i];                                                       \
+          h[d]  = c + 1;                                                       \
+        }                                                                      \
+      }                                                                        \
+      uk = sk;                                                                 \
+      sk = dk;                                                                 \
+      dk = uk;                                                                 \
+      ui = si;                                                                 \
+      si = di;                                                                 \
+      di = ui;                                                                 \
+      swapped ^= 1;                                                            \
+    }                                                                          \
+    return swapped;                                                            \
+  }                                                                            \
+  static int8_t ndarray_sort_merge_##W(                                        \
+      uint##W##_t* k, int64_t* ix, uint##W##_t* tk, int64_t* tix,              \
+      const int64_t n                                                          \
+  ) {                                                                          \
+    uint##W##_t* sk = k;                                                       \
+    uint##W##_t* dk = tk;                                                      \
+    uint##W##_t* uk;                                                           \
+    int64_t* si = ix;                                                          \
+    int64_t* di = (ix == NULL) ? NULL : tix;                                   \
+    int64_t* ui;                                                               \
+    int8_t swapped;                                                            \
+    uint##W##_t v;                                                             \
+    int64_t t;                                                                 \
+    int64_t w;                                                                 \
+    int64_t s;                                                                 \
+    int64_t m;                                                                 \
+    int64_t e;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    int64_t o;                                                                 \
+    for (s = 0; s < n; s += NDARRAY_SORT_RUN) {                                \
+      e = (n - s < NDARRAY_SORT_RUN) ? n : s + NDARRAY_SORT_RUN;               \
+      for (i = s + 1; i < e; i++) {                                            \
+        v = k[i];                                                              \
+        t = (ix == NULL) ? 0 : ix[i];                                          \
+        for (j = i; j > s && k[j - 1] > v; j--) {                              \
+          k[j] = k[j - 1];                                                     \
+          if (ix != NULL) {                                                    \
+            ix[j] = ix[j - 1];                                                 \
+          }                                                                    \
+        }                                                                      \
+        k[j] = v;                                                              \
+        if (ix != NULL) {                                                      \
+          ix[j] = t;                                                           \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    swapped = 0;                                                               \
+    for (w = NDARRAY_SORT_RUN; w < n; w *= 2) {                                \
+      for (s = 0; s < n; s += 2 * w) {                                         \
+        m = (n - s < w) ? n : s + w;                                           \
+        e = (n - m < w) ? n : m + w;                                           \
+        i = s;                                                                 \
+        j = m;                                                                 \
+        o = s;                                                                 \
+        /* Take from the left run when keys are equal (i.e., be stable)... */  \
+        while (i < m && j < e) {                                               \
+          if (sk[j] < sk[i]) {                                                 \
+            dk[o] = sk[j];                                                     \
+            if (si != NULL) {                                                  \
+              di[o] = si[j];                                                   \
+            }                                                                  \
+            j += 1;                                                            \
+          } else {                                                             \
+            dk[o] = sk[i];                                                     \
+            if (si != NULL) {                                                  \
+              di[o] = si[i];                                                   \
+            }                                                                  \
+            i += 1;                                                            \
+          }                                                                    \
+          o += 1;                                                              \
+        }                                                                      \
+        for (; i < m; i++, o++) {                                              \
+          dk[o] = sk[i];                                                       \
+          if (si != NULL) {                                                    \
+            di[o] = si[i];                                                     \
+          }                                                                    \
+        }                                                                      \
+        for (; j < e; j++, o++) {                                              \
+          dk[o] = sk[j];                                                       \
+          if (si != NULL) {                                                    \
+            di[o] = si[j];                                                     \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+      uk = sk;                                                                 \
+      sk = dk;                                                                 \
+      dk = uk;                                                                 \
+      ui = si;                                                                 \
+      si = di;                                                                 \
+      di = ui;                                                                 \
+      swapped ^= 1;                                                            \
+    }                                                                          \
+    return swapped;                                                            \
+  }
+
+NDARRAY_SORT_DEFINE_KEYS(8)
+NDARRAY_SORT_DEFINE_KEYS(16)
+NDARRAY_SORT_DEFINE_KEYS(32)
+NDARRAY_SORT_DEFINE_KEYS(64)
+
+// Define a macro for defining the functions for loading and storing keys of a
+// specified kind and width:
+#define NDARRAY_SORT_DEFINE_KIND(kind, W)                                      \
+  static void ndarray_sort_load_##kind##W(                                     \
+      const uint8_t* x, const int64_t sx, const int64_t n,                     \
+      const int8_t canonical, void* keys                                       \
+  ) {                                                                          \
+    uint##W##_t* k = (uint##W##_t*)keys;                                       \
+    uint##W##_t u;                                                             \
+    int64_t i;                                                                 \
+    (void)canonical;                                                           \
+    for (i = 0; i < n; i++) {                                                  \
+      memcpy(&u, x, sizeof(u));                                                \
+      k[i] = NDARRAY_SORT_KEY_##kind(u, W, canonical);                         \
+      x += sx;                                                                 \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_sort_store_##kind##W(                                    \
+      const void* keys, const int64_t n, uint8_t* y, const int64_t sy          \
+  ) {                                                                          \
+    const uint##W##_t* k = (const uint##W##_t*)keys;                           \
+    uint##W##_t u;                                                             \
+    int64_t i;                                                                 \
+    for (i = 0; i < n; i++) {                                                  \
+      u = (uint##W##_t)NDARRAY_SORT_UNKEY_##kind(k[i], W);                     \
+      memcpy(y, &u, sizeof(u));                                                \
+      y += sy;                                                                 \
+    }                                                                          \
+  }                                                                            \
+  static double ndarray_sort_value_##kind##W(                                  \
+      const void* keys, const int64_t i                                        \
+  ) {                                                                          \
+    const uint##W##_t* k = (const uint##W##_t*)keys;                           \
+    uint##W##_t u;                                                             \
+    u = (uint##W##_t)NDARRAY_SORT_UNKEY_##kind(k[i], W);                       \
+    return NDARRAY_SORT_DOUBLE_##kind(u, W);                                   \
+  }
+
+NDARRAY_SORT_DEFINE_KIND(U, 8)
+NDARRAY_SORT_DEFINE_KIND(S, 8)
+NDARRAY_SORT_DEFINE_KIND(U, 16)
+NDARRAY_SORT_DEFINE_KIND(S, 16)
+NDARRAY_SORT_DEFINE_KIND(U, 32)
+NDARRAY_SORT_DEFINE_KIND(S, 32)
+NDARRAY_SORT_DEFINE_KIND(F, 32)
+NDARRAY_SORT_DEFINE_KIND(U, 64)
+NDARRAY_SORT_DEFINE_KIND(S, 64)
+NDARRAY_SORT_DEFINE_KIND(F, 64)
+
+// Define a macro for defining the functions for loading the keys of complex
+// numbers having a specified component width (note: complex numbers are
+// ordered lexicographically by real and imaginary components, with numbers
+// having `NaN` components sorted last, thus mirroring NumPy):
+#define NDARRAY_SORT_DEFINE_COMPLEX(W)                                        \
+  static void ndarray_sort_ckey_##W(                                          \
+      const uint8_t* vals, const int64_t* ix, const int64_t n,                \
+      const int64_t part, void* keys                                          \
+  ) {                                                                         \
+    uint##W##_t* k = (uint##W##_t*)keys;                                      \
+    uint##W##_t u;                                                            \
+    int64_t i;                                                                \
+    for (i = 0; i < n; i++) {                                                 \
+      memcpy(                                                                 \
+          &u, vals + (((ix[i] * 2) + part) * sizeof(u)), sizeof(u)            \
+      ); /* pointer arithmetic */                                             \
+      k[i] = ndarray_sort_fkey_##W(u, 1);                                     \
+    }                                                                         \
+  }                                                                           \
+  static void ndarray_sort_cclass_##W(                                        \
+      const uint8_t* vals, const int64_t* ix, const int64_t n, uint8_t* keys  \
+  ) {                                                                         \
+    uint##W##_t re;                                                           \
+    uint##W##_t im;                                                           \
+    int64_t i;                                                                \
+    for (i = 0; i < n; i++) {                                                 \
+      memcpy(&re, vals + (ix[i] * 2 * sizeof(re)), sizeof(re));               \
+      memcpy(&im, vals + (((ix[i] * 2) + 1) * sizeof(im)), sizeof(im));       \
+      keys[i] = (uint8_t)(                                                    \
+          (((re & ~NDARRAY_SORT_SIGN(W)) > NDARRAY_SORT_INF_##W) ? 2 : 0) +   \
+          (((im & ~NDARRAY_SORT_SIGN(W)) > NDARRAY_SORT_INF_##W) ? 1 : 0)     \
+      );                                                                      \
+    }                                                                         \
+  }
+
+NDARRAY_SORT_DEFINE_COMPLEX(32)
+NDARRAY_SORT_DEFINE_COMPLEX(64)
+
+/**
+ * Stably sorts keys having a specified width, optionally permuting an array of
+ * indices alongside the keys.
+ *
+ * ## Notes
+ *
+ * -   Long arrays are sorted using a least significant digit (LSD) radix sort,
+ *     which skips digits shared by all keys. Short arrays are sorted using a
+ *     merge sort.
+ * -   The sorted keys (and indices) are stored in either the input buffers or
+ *     the temporary buffers, as indicated by the return value.
+ *
+ * @private
+ * @param width  key width in bits
+ * @param k      keys
+ * @param ix     indices (or `NULL`)
+ * @param tk     temporary buffer for keys
+ * @param tix    temporary buffer for indices
+ * @param n      number of keys
+ * @param hist   buffer for digit histograms
+ * @return       boolean indicating whether the sorted keys are stored in the
+ *               temporary buffers
+ */
+static int8_t ndarray_sort_keys(
+    const int64_t width, void* k, int64_t* ix, void* tk, int64_t* tix,
+    const int64_t n, int64_t* hist
+) {
+  if (n < NDARRAY_SORT_RADIX_MIN) {
+    switch (width) {
+      case 8:
+        return ndarray_sort_merge_8(k, ix, tk, tix, n);
+      case 16:
+        return ndarray_sort_merge_16(k, ix, tk, tix, n);
+      case 32:
+        return ndarray_sort_merge_32(k, ix, tk, tix, n);
+      default:
+        return ndarray_sort_merge_64(k, ix, tk, tix, n);
+    }
+  }
+  switch (width) {
+    case 8:
+      return ndarray_sort_radix_8(k, ix, tk, tix, n, hist);
+    case 16:
+      return ndarray_sort_radix_16(k, ix, tk, tix, n, hist);
+    case 32:
+      return ndarray_sort_radix_32(k, ix, tk, tix, n, hist);
+    default:
+      return ndarray_sort_radix_64(k, ix, tk, tix, n, hist);
+  }
+}
+
+// Define a macro for defining selection functions for keys having a specified
+// width, which optionally permute an array of indices alongside the keys:
+#define NDARRAY_SORT_DEFINE_SELECT(W)                                          \
+  static inline void ndarray_sort_swap_##W(                                    \
+      uint##W##_t* k, int64_t* ix, const int64_t i, const int64_t j            \
+  ) {                                                                          \
+    uint##W##_t v;                                                             \
+    int64_t t;                                                                 \
+    v    = k[i];                                                               \
+    k[i] = k[j];                                                               \
+    k[j] = v;                                                                  \
+    if (ix != NULL) {                                                          \
+      t     = ix[i];                                                           \
+      ix[i] = ix[j];                                                           \
+      ix[j] = t;                                                               \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_sort_select_##W(                                         \
+      void* keys, int64_t* ix, void* tkeys, int64_t* tix, const int64_t n,     \
+      const int64_t kth, int64_t* hist                                         \
+  ) {                                                                          \
+    uint##W##_t* k = (uint##W##_t*)keys;                                       \
+    uint##W##_t p;                                                             \
+    uint##W##_t v;                                                             \
+    int64_t depth;                                                             \
+    int64_t mid;                                                               \
+    int64_t lo;                                                                \
+    int64_t hi;                                                                \
+    int64_t t;                                                                 \
+    int64_t m;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    int64_t l;                                                                 \
+    int64_t h;                                                                 \
+    depth = 0;                                                                 \
+    for (m = n; m > 1; m >>= 1) {                                              \
+      depth += 2;                                                              \
+    }                                                                          \
+    lo = 0;                                                                    \
+    hi = n - 1;                                                                \
+    while (hi - lo >= NDARRAY_SORT_RUN) {                                      \
+      if (depth == 0) {                                                        \
+        /* Too many unbalanced partitions, so sort the remaining range... */   \
+        m = hi - lo + 1;                                                       \
+        if (ndarray_sort_keys(                                                 \
+                W, k + lo, (ix == NULL) ? NULL : ix + lo, tkeys, tix, m, hist  \
+            )) {                                                               \
+          memcpy(k + lo, tkeys, m * sizeof(*k));                               \
+          if (ix != NULL) {                                                    \
+            memcpy(ix + lo, tix, m * sizeof(*ix));                             \
+          }                                                                    \
+        }                                                                      \
+        return;                                                                \
+      }                                                                        \
+      depth -= 1;                                                              \
+      /* Move the median of three keys to the front, as the pivot, and the */  \
+      /* minimum and maximum keys to either end, as sentinels... */            \
+      mid = lo + ((hi - lo) / 2);                                              \
+      if (k[hi] < k[mid]) {                                                    \
+        ndarray_sort_swap_##W(k, ix, hi, mid);                                 \
+      }                                                                        \
+      if (k[hi] < k[lo]) {                                                     \
+        ndarray_sort_swap_##W(k, ix, hi, lo);                                  \
+      }                                                                        \
+      if (k[lo] < k[mid]) {                                                    \
+        ndarray_sort_swap_##W(k, ix, lo, mid);                                 \
+      }                                                                        \
+      ndarray_sort_swap_##W(k, ix, mid, lo + 1);                               \
+      p = k[lo];                                                               \
+      l = lo + 1;                                                              \
+      h = hi;                                                                  \
+      for (;;) {                                                               \
+        do {                                                                   \
+          l += 1;                                                              \
+        } while (k[l] < p);                                                    \
+        do {                                                                   \
+          h -= 1;                                                              \
+        } while (p < k[h]);                                                    \
+        if (h < l) {                                                           \
+          break;                                                               \
+        }                                                                      \
+        ndarray_sort_swap_##W(k, ix, l, h);                                    \
+      }                                                                        \
+      ndarray_sort_swap_##W(k, ix, lo, h);                                     \
+      /* Keys between `h` and `l` equal the pivot... */                        \
+      if (kth < h) {                                                           \
+        hi = h - 1;                                                            \
+      } else if (kth < l) {                                                    \
+        return;                                                                \
+      } else {                                                                 \
+        lo = l;                                                                \
+      }                                                                        \
+    }                                                                          \
+    for (i = lo + 1; i <= hi; i++) {                                           \
+      v = k[i];                                                                \
+      t = (ix == NULL) ? 0 : ix[i];                                            \
+      for (j = i; j > lo && k[j - 1] > v; j--) {                               \
+        k[j] = k[j - 1];                                                       \
+        if (ix != NULL) {                                                      \
+          ix[j] = ix[j - 1];                                                   \
+        }                                                                      \
+      }                                                                        \
+      k[j] = v;                                                                \
+      if (ix != NULL) {                                                        \
+        ix[j] = t;                                                             \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static void ndarray_sort_extrema_##W(                                        \
+      const void* keys, const int64_t s, const int64_t e, int64_t* imin,       \
+      int64_t* imax                                                            \
+  ) {                                                                          \
+    const uint##W##_t* k = (const uint##W##_t*)keys;                           \
+    int64_t i;                                                                 \
+    *imin = s;                                                                 \
+    *imax = s;                                                                 \
+    for (i = s + 1; i < e; i++) {                                              \
+      if (k[i] < k[*imin]) {                                                   \
+        *imin = i;                                                             \
+      }                                                                        \
+      if (k[i] > k[*imax]) {                                                   \
+        *imax = i;                                                             \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+  static inline int8_t ndarray_sort_gt_##W(                                    \
+      const uint##W##_t* k, const int64_t* ix, const int64_t i,                \
+      const int64_t j                                                          \
+  ) {                                                                          \
+    return (k[i] > k[j]) || (k[i] == k[j] && ix[i] > ix[j]);                   \
+  }                                                                            \
+  static void ndarray_sort_sift_##W(                                           \
+      uint##W##_t* k, int64_t* ix, int64_t i, const int64_t m                  \
+  ) {                                                                          \
+    int64_t c;                                                                 \
+    for (;;) {                                                                 \
+      c = (2 * i) + 1;                                                         \
+      if (c >= m) {                                                            \
+        return;                                                                \
+      }                                                                        \
+      if (c + 1 < m && ndarray_sort_gt_##W(k, ix, c + 1, c)) {                 \
+        c += 1;                                                                \
+      }                                                                        \
+      if (!ndarray_sort_gt_##W(k, ix, c, i)) {                                 \
+        return;                                                                \
+      }                                                                        \
+      ndarray_sort_swap_##W(k, ix, i, c);                                      \
+      i = c;                                                                   \
+    }                                                                          \
+  }                                                                            \
+  static int8_t ndarray_sort_smallest_##W(                                     \
+      const ndarraySortLoadFcn load, const uint8_t* x, const int64_t sx,       \
+      const int64_t n, const int64_t m, const int8_t largest, void* keys,      \
+      int64_t* ix, void* tkeys, int64_t* tix, int64_t* hist                    \
+  ) {                                                                          \
+    uint##W##_t* k  = (uint##W##_t*)keys;                                      \
+    uint##W##_t* hk = (uint##W##_t*)tkeys;                                     \
+    uint##W##_t v;                                                             \
+    int64_t c;                                                                 \
+    int64_t i;                                                                 \
+    int64_t j;                                                                 \
+    load(x, sx, n, 1, k);                                                      \
+    if (largest) {                                                             \
+      for (i = 0; i < n; i++) {                                                \
+        k[i] = (uint##W##_t)~k[i];                                             \
+      }                                                                        \
+    }                                                                          \
+    if (m <= NDARRAY_SORT_HEAP_MAX && m < n) {                                 \
+      /* Maintain a max-heap of the smallest keys (ordered by key and */       \
+      /* then index), which, for most lines, requires one comparison */        \
+      /* per key, and then sort the heap in-place... */                        \
+      for (i = 0; i < m; i++) {                                                \
+        hk[i]  = k[i];                                                         \
+        tix[i] = i;                                                            \
+      }                                                                        \
+      for (i = (m / 2) - 1; i >= 0; i--) {                                     \
+        ndarray_sort_sift_##W(hk, tix, i, m);                                  \
+      }                                                                        \
+      for (i = m; i < n; i++) {                                                \
+        if (k[i] < hk[0]) {                                                    \
+          hk[0]  = k[i];                                                       \
+          tix[0] = i;                                                          \
+          ndarray_sort_sift_##W(hk, tix, 0, m);                                \
+        }                                                                      \
+      }                                                                        \
+      for (i = m - 1; i > 0; i--) {                                            \
+        ndarray_sort_swap_##W(hk, tix, 0, i);                                  \
+        ndarray_sort_sift_##W(hk, tix, 0, i);                                  \
+      }                                                                        \
+      return 1;                                                                \
+    }                                                                          \
+    v = (uint##W##_t)~(uint##W##_t)0;                                          \
+    if (m < n) {                                                               \
+      /* Find the m-th smallest key and then reload the line, such that */     \
+      /* the selected keys can be gathered in index order... */                \
+      ndarray_sort_select_##W(k, NULL, tkeys, tix, n, m - 1, hist);            \
+      v = k[m - 1];                                                            \
+      load(x, sx, n, 1, k);                                                    \
+      if (largest) {                                                           \
+        for (i = 0; i < n; i++) {                                              \
+          k[i] = (uint##W##_t)~k[i];                                           \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    /* Resolve the number of keys equal to the m-th smallest key to gather */  \
+    /* (note: ties are resolved in favor of lower indices)... */               \
+    c = m;                                                                     \
+    for (i = 0; i < n; i++) {                                                  \
+      if (k[i] < v) {                                                          \
+        c -= 1;                                                                \
+      }                                                                        \
+    }                                                                          \
+    j = 0;                                                                     \
+    for (i = 0; i < n && j < m; i++) {                                         \
+      if (k[i] < v || (k[i] == v && c > 0)) {                                  \
+        if (k[i] == v) {                                                       \
+          c -= 1;                                                              \
+        }                                                                      \
+        k[j]  = k[i];                                                          \
+        ix[j] = i;                                                             \
+        j += 1;                                                                \
+      }                                                                        \
+    }                                                                          \
+    return ndarray_sort_keys(W, k, ix, tkeys, tix, m, hist);                   \
+  }
+
+NDARRAY_SORT_DEFINE_SELECT(8)
+NDARRAY_SORT_DEFINE_SELECT(16)
+NDARRAY_SORT_DEFINE_SELECT(32)
+NDARRAY_SORT_DEFINE_SELECT(64)
+
+// Define a macro for defining a kernel table entry for a real-valued data
+// type:
+#define NDARRAY_SORT_REAL_ENTRY(dtype, W, kind)                          \
+  {dtype,                                                                \
+   W,                                                                    \
+   0,                                                                    \
+   ndarray_sort_load_##kind##W,                                          \
+   ndarray_sort_store_##kind##W,                                         \
+   ndarray_sort_value_##kind##W,                                         \
+   ndarray_sort_select_##W,                                              \
+   ndarray_sort_extrema_##W,                                             \
+   ndarray_sort_smallest_##W},
+
+// Define a macro for defining a kernel table entry for a complex-valued data
+// type:
+#define NDARRAY_SORT_COMPLEX_ENTRY(dtype, W) \
+  {dtype, W, 1, NULL, NULL, NULL, NULL, NULL, NULL},
+
+// Define a table of sort kernels:
+static const struct ndarraySortKernels NDARRAY_SORT_KERNELS[] = {
+    NDARRAY_SORT_REAL_DTYPES(NDARRAY_SORT_REAL_ENTRY)
+        NDARRAY_SORT_COMPLEX_DTYPES(NDARRAY_SORT_COMPLEX_ENTRY)};
+
+/**
+ * Sorts a line of complex numbers, computing the sorting permutation.
+ *
+ * ## Notes
+ *
+ * -   The line is sorted by imaginary component, then by real component, and,
+ *     finally, by `NaN` class, such that, as each sort is stable, the result is
+ *     ordered lexicographically.
+ *
+ * @private
+ * @param width  component key width in bits
+ * @param vals   contiguous complex numbers
+ * @param n      number of elements
+ * @param ix     index buffer
+ * @param tix    temporary index buffer
+ * @param k      key buffer
+ * @param tk     temporary key buffer
+ * @param hist   buffer for digit histograms
+ * @return       pointer to the sorting permutation (either `ix` or `tix`)
+ */
+static int64_t* ndarray_sort_complex(
+    const int64_t width, const uint8_t* vals, const int64_t n, int64_t* ix,
+    int64_t* tix, uint8_t* k, uint8_t* tk, int64_t* hist
+) {
+  int64_t* ci = ix;
+  int64_t* ti = tix;
+  int64_t* ui;
+  int64_t part;
+  int64_t i;
+
+  for (i = 0; i < n; i++) {
+    ix[i] = i;
+  }
+  for (part = 1; part >= 0; part--) {
+    if (width == 32) {
+      ndarray_sort_ckey_32(vals, ci, n, part, k);
+    } else {
+      ndarray_sort_ckey_64(vals, ci, n, part, k);
+    }
+    if (ndarray_sort_keys(width, k, ci, tk, ti, n, hist)) {
+      ui = ci;
+      ci = ti;
+      ti = ui;
+    }
+  }
+  if (width == 32) {
+    ndarray_sort_cclass_32(vals, ci, n, k);
+  } else {
+    ndarray_sort_cclass_64(vals, ci, n, k);
+  }
+  if (ndarray_sort_keys(8, k, ci, tk, ti, n, hist)) {
+    ci = ti;
+  }
+  return ci;
+}
+
+/**
+ * Writes indices to a strided output buffer.
+ *
+ * @private
+ * @param ix  indices
+ * @param n   number of indices
+ * @param y   output buffer
+ * @param sy  output stride (in bytes)
+ */
+static void ndarray_sort_store_indices(
+    const int64_t* ix, const int64_t n, uint8_t* y, const int64_t sy
+) {
+  int64_t i;
+  for (i = 0; i < n; i++) {
+    memcpy(y + (i * sy), ix + i, sizeof(int64_t));
+  }
+}
+
+/**
+ * Computes the quantile of a line of keys using linear interpolation.
+ *
+ * ## Notes
+ *
+ * -   The quantile is computed by selecting the two order statistics which
+ *     bracket the virtual index `q*(n-1)`, rather than by sorting the line.
+ * -   Interpolation mirrors NumPy's default (`linear`) method.
+ * -   If a line contains `NaN` values, the function returns `NaN`. If a line is
+ *     empty, the function returns `NaN`.
+ *
+ * @private
+ * @param kernels  kernels
+ * @param k        keys
+ * @param tk       temporary buffer for keys
+ * @param tix      temporary buffer for indices
+ * @param n        number of keys
+ * @param q        quantile
+ * @param hist     buffer for digit histograms
+ * @return         quantile
+ */
+static double ndarray_sort_quantile(
+    const struct ndarraySortKernels* kernels, void* k, void* tk, int64_t* tix,
+    const int64_t n, const double q, int64_t* hist
+) {
+  int64_t imin;
+  int64_t imax;
+  int64_t j;
+  double v0;
+  double v1;
+  double h;
+  double g;
+  double d;
+
+  if (n == 0) {
+    return NAN;
+  }
+  h = q * (double)(n - 1);
+  j = (int64_t)floor(h);
+  if (j > n - 1) {
+    j = n - 1;
+  }
+  g = h - (double)j;
+  kernels->select(k, NULL, tk, tix, n, j, hist);
+  v0 = kernels->value(k, j);
+  if (j == n - 1) {
+    return v0;
+  }
+  // Following keys are greater than or equal to the selected key, such that
+  // the next order statistic is their minimum and `NaN` values (which have the
+  // largest keys) are detected by their maximum:
+  kernels->extrema(k, j + 1, n, &imin, &imax);
+  d = kernels->value(k, imax);
+  if (isnan(d)) {
+    return d;
+  }
+  if (g == 0.0) {
+    return v0;
+  }
+  v1 = kernels->value(k, imin);
+  d  = v1 - v0;
+  if (g >= 0.5) {
+    return v1 - (d * (1.0 - g));
+  }
+  return v0 + (d * g);
+}
+
+/**
+ * Processes a single line.
+ *
+ * @private
+ * @param loop     sort
+ * @param x        pointer to the first input element
+ * @param y        pointer to the first output element (or `NULL`)
+ * @param yi       pointer to the first output index (or `NULL`)
+ * @param scratch  scratch buffer
+ */
+static void ndarray_sort_line(
+    const struct ndarraySortLoop* loop, const uint8_t* x, uint8_t* y,
+    uint8_t* yi, uint8_t* scratch
+) {
+  const struct ndarraySortKernels* kernels = loop->kernels;
+  int64_t* hist;
+  int64_t* tix;
+  int64_t* ix;
+  uint8_t* vals;
+  uint8_t* tk;
+  uint8_t* k;
+  int64_t kb;
+  int64_t n;
+  int64_t i;
+  double v;
+  float f;
+
+  // Resolve the scratch buffers (note: buffers are ordered by decreasing
+  // alignment requirements):
+  n    = loop->n;
+  kb   = kernels->width / 8;
+  ix   = (int64_t*)scratch;
+  tix  = ix + n;                                 // pointer arithmetic
+  hist = tix + n;                                // pointer arithmetic
+  k    = (uint8_t*)(hist + (8 * NDARRAY_SORT_BUCKETS));  // pointer arithmetic
+  tk   = k + (n * kb);                           // pointer arithmetic
+  vals = tk + (n * kb);                          // pointer arithmetic
+
+  if (kernels->iscomplex) {
+    // Copy the line to a contiguous buffer, as complex numbers are sorted
+    // indirectly:
+    for (i = 0; i < n; i++) {
+      memcpy(vals + (i * loop->bpe), x + (i * loop->xsa), loop->bpe);
+    }
+    ix = ndarray_sort_complex(kernels->width, vals, n, ix, tix, k, tk, hist);
+    if (loop->op == NDARRAY_SORT_OP_ARGSORT) {
+      ndarray_sort_store_indices(ix, n, yi, loop->isa);
+    } else {
+      for (i = 0; i < n; i++) {
+        memcpy(y + (i * loop->osa), vals + (ix[i] * loop->bpe), loop->bpe);
+      }
+    }
+    return;
+  }
+  switch (loop->op) {
+    case NDARRAY_SORT_OP_SORT:
+      kernels->load(x, loop->xsa, n, 0, k);
+      if (ndarray_sort_keys(kernels->width, k, NULL, tk, tix, n, hist)) {
+        k = tk;
+      }
+      kernels->store(k, n, y, loop->osa);
+      return;
+    case NDARRAY_SORT_OP_ARGSORT:
+      // Load the line as keys, where floating-point keys are canonicalized when
+      // computing indices, such that equal elements retain their relative
+      // order:
+      kernels->load(x, loop->xsa, n, 1, k);
+      for (i = 0; i < n; i++) {
+        ix[i] = i;
+      }
+      if (ndarray_sort_keys(kernels->width, k, ix, tk, tix, n, hist)) {
+        ix = tix;
+      }
+      ndarray_sort_store_indices(ix, n, yi, loop->isa);
+      return;
+    case NDARRAY_SORT_OP_PARTITION:
+      kernels->load(x, loop->xsa, n, 0, k);
+      kernels->select(k, NULL, tk, tix, n, loop->k, hist);
+      kernels->store(k, n, y, loop->osa);
+      return;
+    case NDARRAY_SORT_OP_ARGPARTITION:
+      kernels->load(x, loop->xsa, n, 1, k);
+      for (i = 0; i < n; i++) {
+        ix[i] = i;
+      }
+      kernels->select(k, ix, tk, tix, n, loop->k, hist);
+      ndarray_sort_store_indices(ix, n, yi, loop->isa);
+      return;
+    case NDARRAY_SORT_OP_TOPK:
+      if (kernels->smallest(
+              kernels->load, x, loop->xsa, n, loop->k, loop->largest, k, ix,
+              tk, tix, hist
+          )) {
+        ix = tix;
+      }
+      if (yi != NULL) {
+        ndarray_sort_store_indices(ix, loop->k, yi, loop->isa);
+      }
+      // Gather selected values from the input line, such that values are
+      // returned exactly (e.g., including the sign of zero):
+      if (y != NULL) {
+        for (i = 0; i < loop->k; i++) {
+          memcpy(y + (i * loop->osa), x + (ix[i] * loop->xsa), loop->bpe);
+        }
+      }
+      return;
+    default:
+      kernels->load(x, loop->xsa, n, 0, k);
+      v = ndarray_sort_quantile(kernels, k, tk, tix, n, loop->q, hist);
+      if (loop->dtype == NDARRAY_FLOAT32) {
+        f = (float)v;
+        memcpy(y, &f, sizeof(f));
+      } else {
+        memcpy(y, &v, sizeof(v));
+      }
+      return;
+  }
+}
+
+/**
+ * Processes a group of lines.
+ *
+ * @private
+ * @param i    task index
+ * @param tid  thread index
+ * @param ctx  sort
+ */
+static void ndarray_sort_task(int64_t i, int32_t tid, void* ctx) {
+  const struct ndarraySortLoop* loop = (const struct ndarraySortLoop*)ctx;
+  const uint8_t* x;
+  uint8_t* yi;
+  uint8_t* y;
+  int64_t end;
+  int64_t r;
+  int64_t s;
+  int64_t l;
+  int64_t d;
+
+  l   = i * loop->group;
+  end = l + loop->group;
+  if (end > loop->nlines) {
+    end = loop->nlines;
+  }
+  for (; l < end; l++) {
+    x  = loop->x;
+    y  = loop->out;
+    yi = loop->ind;
+    r  = l;
+    for (d = 0; d < loop->no; d++) {
+      s = r % loop->oshape[d];
+      r /= loop->oshape[d];
+      x += s * loop->oxs[d];  // pointer arithmetic
+      if (y != NULL) {
+        y += s * loop->oos[d];  // pointer arithmetic
+      }
+      if (yi != NULL) {
+        yi += s * loop->ois[d];  // pointer arithmetic
+      }
+    }
+    ndarray_sort_line(loop, x, y, yi, loop->scratch + (tid * loop->sb));
+  }
+}
+
+/**
+ * Validates the shape of an output ndarray.
+ *
+ * @private
+ * @param x  input ndarray
+ * @param a  dimension along which to operate
+ * @param m  expected output length along the dimension
+ * @param y  output ndarray (or `NULL`)
+ * @return   status code
+ */
+static int8_t ndarray_sort_check(
+    const struct ndarray* x, const int64_t a, const int64_t m,
+    const struct ndarray* y
+) {
+  int64_t i;
+  if (y == NULL) {
+    return 0;
+  }
+  if (y->ndims != x->ndims) {
+    return -1;
+  }
+  for (i = 0; i < x->ndims; i++) {
+    if (y->shape[i] != ((i == a) ? m : x->shape[i])) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Sorts ndarray elements (or selects elements or computes indices or
+ * quantiles) along a specified dimension.
+ *
+ * ## Notes
+ *
+ * -   For partitions, `k` is the selected position. For top-k selections, `k`
+ *     is the number of selected elements.
+ *
+ * @private
+ * @param x         input ndarray
+ * @param axis      dimension along which to operate
+ * @param op        operation
+ * @param k         selected position or number of selected elements
+ * @param largest   boolean indicating whether to select the largest elements
+ * @param q         quantile
+ * @param nthreads  number of threads
+ * @param out       output ndarray (or `NULL`)
+ * @param ind       output index ndarray (or `NULL`)
+ * @return          status code
+ */
+static int8_t ndarray_sort_execute(
+    const struct ndarray* x, const int64_t axis, const int8_t op,
+    const int64_t k, const int8_t largest, const double q, int32_t nthreads,
+    struct ndarray* out, struct ndarray* ind
+) {
+  struct ndarraySortLoop loop;
+  int64_t nmeta;
+  int64_t nbytes;
+  int64_t ntasks;
+  int64_t ndims;
+  int64_t a;
+  int64_t m;
+  int64_t n;
+  int64_t i;
+  int8_t status;
+  size_t j;
+
+  if (x == NULL || (out == NULL && ind == NULL)) {
+    return -1;
+  }
+  ndims = x->ndims;
+  a     = (axis < 0) ? axis + ndims : axis;
+  if (a < 0 || a >= ndims) {
+    return -1;
+  }
+  n      = x->shape[a];
+  loop.k = k;
+  m      = n;
+  if (op == NDARRAY_SORT_OP_PARTITION || op == NDARRAY_SORT_OP_ARGPARTITION) {
+    loop.k = (k < 0) ? k + n : k;
+    if (loop.k < 0 || loop.k >= n) {
+      return -1;
+    }
+  } else if (op == NDARRAY_SORT_OP_TOPK) {
+    if (k < 0 || k > n) {
+      return -1;
+    }
+    m = k;
+  } else if (op == NDARRAY_SORT_OP_QUANTILE) {
+    m = 1;
+  }
+  if (ndarray_sort_check(x, a, m, out) || ndarray_sort_check(x, a, m, ind)) {
+    return -1;
+  }
+  if (ind != NULL && ind->dtype != NDARRAY_INT64) {
+    return -1;
+  }
+  if (out != NULL) {
+    if (op == NDARRAY_SORT_OP_QUANTILE) {
+      if (out->dtype != NDARRAY_FLOAT32 && out->dtype != NDARRAY_FLOAT64) {
+        return -1;
+      }
+    } else if (out->dtype != x->dtype) {
+      return -1;
+    }
+  }
+  // Resolve the kernels for the input data type (note: complex numbers only
+  // support full sorts)...
+  loop.kernels = NULL;
+  for (j = 0; j < sizeof(NDARRAY_SORT_KERNELS) /
+                      sizeof(NDARRAY_SORT_KERNELS[0]);
+       j++) {
+    if (NDARRAY_SORT_KERNELS[j].dtype == x->dtype) {
+      loop.kernels = &(NDARRAY_SORT_KERNELS[j]);
+      break;
+    }
+  }
+  if (loop.kernels == NULL ||
+      (loop.kernels->iscomplex && op > NDARRAY_SORT_OP_ARGSORT)) {
+    return -1;
+  }
+  loop.op      = op;
+  loop.largest = largest;
+  loop.q       = q;
+  loop.bpe     = ndarray_bytes_per_element(x->dtype);
+  loop.dtype   = (out == NULL) ? x->dtype : out->dtype;
+  loop.x       = x->data + x->offset;  // pointer arithmetic
+  loop.out     = (out == NULL) ? NULL : out->data + out->offset;
+  loop.ind     = (ind == NULL) ? NULL : ind->data + ind->offset;
+  loop.n       = n;
+  loop.xsa     = x->strides[a];
+  loop.osa     = (out == NULL) ? 0 : out->strides[a];
+  loop.isa     = (ind == NULL) ? 0 : ind->strides[a];
+
+  // Allocate scratch memory for outer dimension meta data:
+  nmeta = sizeof(int64_t) * ((ndims * 4) + 1);
+  loop.oshape = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nmeta);
+  if (loop.oshape == NULL) {
+    return -1;
+  }
+  loop.oxs    = loop.oshape + ndims;
+  loop.oos    = loop.oxs + ndims;
+  loop.ois    = loop.oos + ndims;
+  loop.no     = 0;
+  loop.nlines = 1;
+  for (i = 0; i < ndims; i++) {
+    if (i == a || x->shape[i] == 1) {
+      continue;
+    }
+    loop.oshape[loop.no] = x->shape[i];
+    loop.oxs[loop.no]    = x->strides[i];
+    loop.oos[loop.no]    = (out == NULL) ? 0 : out->strides[i];
+    loop.ois[loop.no]    = (ind == NULL) ? 0 : ind->strides[i];
+    loop.nlines *= x->shape[i];
+    loop.no += 1;
+  }
+  if (loop.nlines == 0 || m == 0) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+    return 0;
+  }
+  // Group short lines, such that each task processes a minimum number of
+  // elements:
+  loop.group = NDARRAY_SORT_GROUP / ((n > 0) ? n : 1);
+  if (loop.group < 1) {
+    loop.group = 1;
+  }
+  ntasks = (loop.nlines + loop.group - 1) / loop.group;
+  if (nthreads <= 0) {
+    nthreads = ndarray_parallel_num_threads();
+  }
+  if ((int64_t)nthreads > ntasks) {
+    nthreads = (int32_t)ntasks;
+  }
+  // Allocate per-thread scratch memory for (temporary) indices, digit
+  // histograms, (temporary) keys, and, for complex numbers, a contiguous copy
+  // of a line:
+  loop.sb = (sizeof(int64_t) * ((2 * n) + (8 * NDARRAY_SORT_BUCKETS))) +
+            (2 * n * (loop.kernels->width / 8));
+  if (loop.kernels->iscomplex) {
+    loop.sb += n * loop.bpe;
+  }
+  loop.sb      = ((loop.sb + 7) / 8) * 8;
+  nbytes       = loop.sb * nthreads;
+  loop.scratch = ndarray_memory_malloc(NDARRAY_MEMORY_SCRATCH, nbytes);
+  if (loop.scratch == NULL) {
+    ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+    return -1;
+  }
+  status = ndarray_parallel_for(ntasks, nthreads, ndarray_sort_task, &loop);
+
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.scratch, nbytes);
+  ndarray_memory_free(NDARRAY_MEMORY_SCRATCH, loop.oshape, nmeta);
+  return status;
+}
+
+/**
+ * Sorts ndarray elements along a specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same shape and data type.
+ * -   Each line along the sorted dimension is copied into a contiguous buffer
+ *     of keys before being sorted, and, thus, the sorted dimension may have an
+ *     arbitrary stride.
+ * -   Integer and floating-point elements are sorted using a least significant
+ *     digit radix sort over keys whose unsigned integer order matches element
+ *     order (e.g., floating-point keys are computed by flipping bits). Short
+ *     lines are sorted using a stable merge sort.
+ * -   Complex numbers are sorted lexicographically by real and imaginary
+ *     components.
+ * -   `NaN` values are sorted to the end of each line.
+ * -   Independent lines are sorted in parallel. If `nthreads` is less than or
+ *     equal to zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   The output ndarray may be the input ndarray (i.e., elements may be
+ *     sorted in-place); otherwise, the input and output ndarrays must **not**
+ *     share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to sort
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a row-major ndarray:
+ * double buf[] = {3.0, 1.0, 2.0, -1.0, 5.0, 0.0};
+ * int64_t shape[] = {2, 3};
+ * int64_t strides[] = {24, 8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)buf, 2, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Sort each row in-place:
+ * int8_t status = ndarray_sort(x, -1, 1, x);
+ * // buf => {1.0, 2.0, 3.0, -1.0, 0.0, 5.0}
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_sort(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_SORT, 0, 0, 0.0, nthreads, out, NULL
+  );
+}
+
+/**
+ * Computes the indices which would sort ndarray elements along a specified
+ * dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray and
+ *     must have an `int64` data type.
+ * -   The sort is stable (i.e., equal elements retain their relative order).
+ *     Signed zeros compare equal, as do `NaN` values, which are sorted to the
+ *     end of each line.
+ * -   See `ndarray_sort` for a description of the sorting algorithms.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param axis      dimension along which to sort
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * int32_t xbuf[] = {30, 10, 20, 10};
+ * int64_t shape[] = {4};
+ * int64_t xstrides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)xbuf, 1, shape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0, 0, 0};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, shape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the sort indices:
+ * int8_t status = ndarray_argsort(x, 0, 1, y);
+ * // ybuf => {1, 3, 2, 0}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_argsort(
+    const struct ndarray* x, const int64_t axis, int32_t nthreads,
+    struct ndarray* out
+) {
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_ARGSORT, 0, 0, 0.0, nthreads, NULL, out
+  );
+}
+
+/**
+ * Partially sorts ndarray elements along a specified dimension, such that the
+ * element at a specified position is the element which would be at that
+ * position were the elements sorted.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same shape and data type.
+ * -   Along each line, elements preceding the selected position are less than
+ *     or equal to the selected element, and elements following the selected
+ *     position are greater than or equal to the selected element. The order of
+ *     elements within each partition is unspecified.
+ * -   A negative position is resolved relative to the end of the dimension.
+ * -   Elements are selected using an introselect: a quickselect using
+ *     median-of-three pivots, which, after too many unbalanced partitions,
+ *     falls back to radix sorting the remaining range, such that the expected
+ *     (and worst-case) cost is linear in the line length.
+ * -   `NaN` values are ordered after all other values.
+ * -   Complex numbers are not supported.
+ * -   Independent lines are processed in parallel. If `nthreads` is less than
+ *     or equal to zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   The output ndarray may be the input ndarray; otherwise, the input and
+ *     output ndarrays must **not** share overlapping memory.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param kth       selected position
+ * @param axis      dimension along which to partition
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * double buf[] = {5.0, 1.0, 4.0, 2.0, 3.0};
+ * int64_t shape[] = {5};
+ * int64_t strides[] = {8};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)buf, 1, shape, strides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Partition the ndarray in-place about the median:
+ * int8_t status = ndarray_partition(x, 2, 0, 1, x);
+ * // buf[2] => 3.0
+ *
+ * ndarray_free(x);
+ */
+int8_t ndarray_partition(
+    const struct ndarray* x, const int64_t kth, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+) {
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_PARTITION, kth, 0, 0.0, nthreads, out, NULL
+  );
+}
+
+/**
+ * Computes the indices which would partially sort ndarray elements along a
+ * specified dimension, such that the element at a specified position is the
+ * element which would be at that position were the elements sorted.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray and
+ *     must have an `int64` data type.
+ * -   Signed zeros compare equal, as do `NaN` values, which are ordered after
+ *     all other values.
+ * -   See `ndarray_partition` for a description of the selection algorithm.
+ * -   If `nthreads` is less than or equal to zero, the function uses the
+ *     default number of threads (see `ndarray_parallel_num_threads`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param kth       selected position
+ * @param axis      dimension along which to partition
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * int32_t xbuf[] = {30, 10, 50, 20};
+ * int64_t shape[] = {4};
+ * int64_t xstrides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)xbuf, 1, shape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * int64_t ybuf[] = {0, 0, 0, 0};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, shape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the partition indices:
+ * int8_t status = ndarray_argpartition(x, -1, 0, 1, y);
+ * // ybuf[3] => 2
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_argpartition(
+    const struct ndarray* x, const int64_t kth, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+) {
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_ARGPARTITION, kth, 0, 0.0, nthreads, NULL, out
+  );
+}
+
+/**
+ * Selects the `k` smallest (or largest) ndarray elements along a specified
+ * dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarrays must have the same shape as the input ndarray,
+ *     except along the selected dimension, which must have `k` elements.
+ * -   The values output ndarray must have the same data type as the input
+ *     ndarray, and the indices output ndarray must have an `int64` data type.
+ *     Either output ndarray may be `NULL`, but not both.
+ * -   Selected elements are sorted in ascending order (or, if `largest` is
+ *     nonzero, in descending order), with ties resolved in favor of lower
+ *     indices, such that results are deterministic.
+ * -   Signed zeros compare equal, as do `NaN` values, which are considered
+ *     larger than all other values.
+ * -   Small selections maintain a bounded heap while scanning each line, such
+ *     that most elements require a single comparison. Larger selections use
+ *     an introselect (see `ndarray_partition`). In either case, each line
+ *     costs `O(n + k log k)` rather than the cost of a full sort.
+ * -   Complex numbers are not supported.
+ * -   Independent lines are processed in parallel. If `nthreads` is less than
+ *     or equal to zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   The output ndarrays must **not** share overlapping memory with the input
+ *     ndarray.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param k         number of elements to select
+ * @param axis      dimension along which to select
+ * @param largest   boolean indicating whether to select the largest elements
+ * @param nthreads  number of threads
+ * @param values    output ndarray for selected values (or `NULL`)
+ * @param indices   output ndarray for selected indices (or `NULL`)
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * float xbuf[] = {0.1f, 0.9f, 0.4f, 0.7f, 0.2f};
+ * int64_t xshape[] = {5};
+ * int64_t xstrides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_FLOAT32, (uint8_t *)xbuf, 1, xshape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray for indices:
+ * int64_t ybuf[] = {0, 0};
+ * int64_t yshape[] = {2};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_INT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Select the indices of the two largest elements:
+ * int8_t status = ndarray_topk(x, 2, 0, 1, 1, NULL, y);
+ * // ybuf => {1, 3}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_topk(
+    const struct ndarray* x, const int64_t k, const int64_t axis,
+    const int8_t largest, int32_t nthreads, struct ndarray* values,
+    struct ndarray* indices
+) {
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_TOPK, k, largest, 0.0, nthreads, values,
+      indices
+  );
+}
+
+/**
+ * Computes the quantile of ndarray elements along a specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The output ndarray must have the same shape as the input ndarray, except
+ *     along the reduced dimension, which must be a singleton dimension, and
+ *     must have either a `float64` or a `float32` data type.
+ * -   The quantile must be on the interval `[0, 1]`.
+ * -   Quantiles are linearly interpolated between the two order statistics
+ *     bracketing the virtual index `q*(n-1)`, thus mirroring NumPy's default
+ *     method. Order statistics are found using an introselect (see
+ *     `ndarray_partition`) rather than by sorting.
+ * -   If a line contains `NaN` values or is empty, the corresponding quantile
+ *     is `NaN`.
+ * -   Complex numbers are not supported.
+ * -   Independent lines are processed in parallel. If `nthreads` is less than
+ *     or equal to zero, the function uses the default number of threads (see
+ *     `ndarray_parallel_num_threads`).
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param x         input ndarray
+ * @param q         quantile
+ * @param axis      dimension along which to compute quantiles
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ *
+ * @example
+ * #include "ndarray.h"
+ * #include "ndarray/base/sort.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray/index_modes.h"
+ * #include "ndarray/orders.h"
+ * #include <stdint.h>
+ *
+ * // Create a one-dimensional ndarray:
+ * int32_t xbuf[] = {4, 1, 3, 2};
+ * int64_t xshape[] = {4};
+ * int64_t xstrides[] = {4};
+ * int8_t submodes[] = {NDARRAY_INDEX_ERROR};
+ *
+ * struct ndarray *x = ndarray_allocate(
+ *     NDARRAY_INT32, (uint8_t *)xbuf, 1, xshape, xstrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Create an output ndarray:
+ * double ybuf[] = {0.0};
+ * int64_t yshape[] = {1};
+ * int64_t ystrides[] = {8};
+ *
+ * struct ndarray *y = ndarray_allocate(
+ *     NDARRAY_FLOAT64, (uint8_t *)ybuf, 1, yshape, ystrides, 0,
+ *     NDARRAY_ROW_MAJOR, NDARRAY_INDEX_ERROR, 1, submodes
+ * );
+ *
+ * // Compute the median:
+ * int8_t status = ndarray_quantile(x, 0.5, 0, 1, y);
+ * // ybuf => {2.5}
+ *
+ * ndarray_free(x);
+ * ndarray_free(y);
+ */
+int8_t ndarray_quantile(
+    const struct ndarray* x, const double q, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+) {
+  if (!(q >= 0.0 && q <= 1.0)) {
+    return -1;
+  }
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_QUANTILE, 0, 0, q, nthreads, out, NULL
+  );
+}
+
+/**
+ * Computes the percentile of ndarray elements along a specified dimension.
+ *
+ * ## Notes
+ *
+ * -   The percentile must be on the interval `[0, 100]`.
+ * -   See `ndarray_quantile` for further details.
+ *
+ * @param x         input ndarray
+ * @param p         percentile
+ * @param axis      dimension along which to compute percentiles
+ * @param nthreads  number of threads
+ * @param out       output ndarray
+ * @return          status code
+ */
+int8_t ndarray_percentile(
+    const struct ndarray* x, const double p, const int64_t axis,
+    int32_t nthreads, struct ndarray* out
+) {
+  if (!(p >= 0.0 && p <= 100.0)) {
+    return -1;
+  }
+  return ndarray_sort_execute(
+      x, axis, NDARRAY_SORT_OP_QUANTILE, 0, 0, p / 100.0, nthreads, out, NULL
+  );
+}
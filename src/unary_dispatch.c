@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/unary/dispatch.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "ndarray.h"
+#include "ndarray/base/iteration_order.h"
+#include "ndarray/base/min_view_buffer_index.h"
+#include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/base/unary/typedefs.h"
+#include "ndarray/macros.h"
+
+/**
+ * Selects a unary ndarray function according to the dimensionality and memory
+ * layout of provided ndarray arguments.
+ *
+ * ## Notes
+ *
+ * -   The function selects a unary ndarray function as follows:
+ *
+ *     -   If the output ndarray is zero-dimensional, the function selects the
+ *         zero-dimensional function.
+ *     -   If the input and output ndarrays are contiguous, have the same memory
+ *         layout, and have the same iteration order, the function selects the
+ *         one-dimensional function and sets `linear` to `1`, indicating that
+ *         the function should be applied to one-dimensional views of the
+ *         ndarrays (see `ndarray_unary_dispatch_linear`).
+ *     -   If neither ndarray has strides of mixed sign and a function
+ *         specialized for the number of dimensions exists, the function selects
+ *         that function (i.e., simple nested loops).
+ *     -   If a blocked function specialized for the number of dimensions
+ *         exists, the function selects that function.
+ *     -   Otherwise, the function selects the last (i.e., n-dimensional)
+ *         function.
+ *
+ * -   The selection only depends on the output ndarray's number of dimensions,
+ *     the contiguity flags of both ndarrays, and the iteration order of both
+ *     ndarrays. Hence, callers may cache a selection for ndarrays sharing these
+ *     properties.
+ * -   If unable to select a function, the function returns a null pointer.
+ *
+ * @param obj     object comprised of dispatch tables containing unary ndarray
+ *                functions
+ * @param arrays  array whose first element is a pointer to an input ndarray
+ *                and whose last element is a pointer to an output ndarray
+ * @param linear  output address for a boolean indicating whether to apply the
+ *                selected function to one-dimensional views
+ * @return        unary ndarray function
+ *
+ * @example
+ * #include "ndarray/base/unary/dispatch.h"
+ * #include "ndarray/base/unary/dispatch_object.h"
+ * #include "ndarray/base/unary/typedefs.h"
+ * #include "ndarray.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * int8_t linear;
+ * ndarrayUnaryFcn f = ndarray_unary_dispatch_select(&obj, arrays, &linear);
+ */
+ndarrayUnaryFcn ndarray_unary_dispatch_select(
+    const struct ndarrayUnaryDispatchObject* obj, struct ndarray* arrays[],
+    int8_t* linear
+) {
+  struct ndarray* x1;
+  struct ndarray* x2;
+  int64_t ndims;
+  int8_t iox1;
+  int8_t iox2;
+
+  *linear = 0;
+  if (obj == NULL || obj->nfunctions < 1) {
+    return NULL;
+  }
+  x1    = arrays[0];
+  x2    = arrays[1];
+  ndims = x2->ndims;
+
+  // Determine whether we can avoid iteration altogether...
+  if (ndims == 0) {
+    return obj->functions[0];
+  }
+  iox1 = ndarray_iteration_order(x1->ndims, x1->strides);
+  iox2 = ndarray_iteration_order(ndims, x2->strides);
+
+  // Determine whether we can linearly iterate over the ndarrays' underlying
+  // byte arrays...
+  if (obj->nfunctions > 1 && iox1 != 0 && iox1 == iox2 &&
+      ((x1->flags & x2->flags) & (NDARRAY_ROW_MAJOR_CONTIGUOUS_FLAG |
+                                  NDARRAY_COLUMN_MAJOR_CONTIGUOUS_FLAG))) {
+    *linear = 1;
+    return obj->functions[1];
+  }
+  // So long as iteration for each respective ndarray always moves in the same
+  // direction (i.e., no mixed sign strides), we can use simple nested loops...
+  if (ndims < obj->nfunctions - 1 && iox1 != 0 && iox2 != 0) {
+    return obj->functions[ndims];
+  }
+  // Determine whether we can perform blocked iteration...
+  if (ndims >= 2 && ndims - 2 < obj->nblockedfunctions) {
+    return obj->blocked_functions[ndims - 2];
+  }
+  // Fall back to n-dimensional iteration:
+  return obj->functions[obj->nfunctions - 1];
+}
+
+/**
+ * Applies a one-dimensional unary ndarray function to one-dimensional views of
+ * contiguous ndarrays having the same memory layout.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same number of elements, be
+ *     contiguous, have the same memory layout, and have the same iteration
+ *     order (e.g., as determined by `ndarray_unary_dispatch_select`).
+ * -   The views are allocated on the stack and only live for the duration of
+ *     the function call.
+ *
+ * @param f       one-dimensional unary ndarray function
+ * @param arrays  array whose first element is a pointer to an input ndarray
+ *                and whose last element is a pointer to an output ndarray
+ * @param fcn     callback
+ * @return        status code
+ */
+int8_t ndarray_unary_dispatch_linear(
+    ndarrayUnaryFcn f, struct ndarray* arrays[], void* fcn
+) {
+  struct ndarray* views[2];
+  struct ndarray v1;
+  struct ndarray v2;
+  int64_t shape[1];
+  int64_t sv1[1];
+  int64_t sv2[1];
+
+  v1       = *arrays[0];
+  v2       = *arrays[1];
+  shape[0] = v2.length;
+
+  // Iterate from the lowest memory address of each underlying byte array:
+  sv1[0]    = v1.BYTES_PER_ELEMENT;
+  sv2[0]    = v2.BYTES_PER_ELEMENT;
+  v1.offset = ndarray_min_view_buffer_index(
+      v1.ndims, v1.shape, v1.strides, v1.offset
+  );
+  v2.offset = ndarray_min_view_buffer_index(
+      v2.ndims, v2.shape, v2.strides, v2.offset
+  );
+  v1.ndims   = 1;
+  v1.shape   = shape;
+  v1.strides = sv1;
+  v2.ndims   = 1;
+  v2.shape   = shape;
+  v2.strides = sv2;
+
+  views[0] = &v1;
+  views[1] = &v2;
+  return f(views, fcn);
+}
+
+/**
+ * Dispatches to a unary ndarray function according to the dimensionality of
+ * provided ndarray arguments.
+ *
+ * ## Notes
+ *
+ * -   The input and output ndarrays must have the same shape.
+ * -   If successful, the function returns `0`; otherwise, the function returns
+ *     `-1`.
+ *
+ * @param obj     object comprised of dispatch tables containing unary ndarray
+ *                functions
+ * @param arrays  array whose first element is a pointer to an input ndarray
+ *                and whose last element is a pointer to an output ndarray
+ * @param fcn     callback
+ * @return        status code
+ *
+ * @example
+ * #include "ndarray/base/unary/dispatch.h"
+ * #include "ndarray/base/unary/dispatch_object.h"
+ * #include "ndarray.h"
+ * #include <stdint.h>
+ *
+ * // ...
+ *
+ * int8_t status = ndarray_unary_dispatch(&obj, arrays, (void *)scale);
+ */
+int8_t ndarray_unary_dispatch(
+    const struct ndarrayUnaryDispatchObject* obj, struct ndarray* arrays[],
+    void* fcn
+) {
+  ndarrayUnaryFcn f;
+  int8_t linear;
+
+  // Determine whether we can avoid iteration altogether...
+  if (arrays[1]->ndims > 0 && arrays[1]->length == 0) {
+    return 0;
+  }
+  f = ndarray_unary_dispatch_select(obj, arrays, &linear);
+  if (f == NULL) {
+    return -1;
+  }
+  if (linear) {
+    return ndarray_unary_dispatch_linear(f, arrays, fcn);
+  }
+  return f(arrays, fcn);
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2023, the ndarray project authors. Please see
+ * the CONTRIBUTORS file for details. All rights reserved. Use
+ * of this source code is governed by a MIT-style license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ndarray/base/unary/loops.h"
+#include <cstdint>
+#include "ndarray/base/unary/dispatch_object.h"
+#include "ndarray/base/unary/loops.hpp"
+#include "ndarray/complex/float32.h"
+#include "ndarray/complex/float64.h"
+#include "ndarray/dtypes.h"
+#include "ndarray/export.h"
+
+/**
+ * Returns a unary dispatch object for applying a callback to ndarrays having a
+ * specified data type.
+ *
+ * ## Notes
+ *
+ * -   The dispatch object contains loops generated by `nd::unary::dispatch` for
+ *     callbacks having the signature `T f(T x)`, where `T` is the C type
+ *     corresponding to `dtype`. Provide the callback as the `fcn` argument of
+ *     `ndarray_unary_dispatch`.
+ * -   The input and output ndarrays must both have the data type `dtype`.
+ * -   The function returns a null pointer if provided an unsupported data type.
+ *
+ * @param dtype  data type (enumeration constant)
+ * @return       dispatch object
+ *
+ * @example
+ * #include "ndarray/base/unary/dispatch.h"
+ * #include "ndarray/base/unary/loops.h"
+ * #include "ndarray/dtypes.h"
+ * #include "ndarray.h"
+ * #include <stdint.h>
+ *
+ * double square(const double x) {
+ *   return x * x;
+ * }
+ *
+ * // ...
+ *
+ * const struct ndarrayUnaryDispatchObject* obj =
+ *     ndarray_unary_clbk_dispatch_object(NDARRAY_FLOAT64);
+ *
+ * int8_t status = ndarray_unary_dispatch(obj, arrays, (void*)square);
+ */
+NDARRAY_EXPORT const struct ndarrayUnaryDispatchObject*
+ndarray_unary_clbk_dispatch_object(const int16_t dtype) {
+  using nd::unary::clbk;
+  using nd::unary::dispatch;
+  using c64  = ndarray_complex64_t;
+  using c128 = ndarray_complex128_t;
+
+  switch (dtype) {
+    case NDARRAY_FLOAT64:
+      return &dispatch<clbk<double, double>>::object;
+    case NDARRAY_FLOAT32:
+      return &dispatch<clbk<float, float>>::object;
+
+    case NDARRAY_INT8:
+      return &dispatch<clbk<int8_t, int8_t>>::object;
+    case NDARRAY_UINT8:
+    case NDARRAY_UINT8C:
+      return &dispatch<clbk<uint8_t, uint8_t>>::object;
+    case NDARRAY_INT16:
+      return &dispatch<clbk<int16_t, int16_t>>::object;
+    case NDARRAY_UINT16:
+      return &dispatch<clbk<uint16_t, uint16_t>>::object;
+    case NDARRAY_INT32:
+      return &dispatch<clbk<int32_t, int32_t>>::object;
+    case NDARRAY_UINT32:
+      return &dispatch<clbk<uint32_t, uint32_t>>::object;
+    case NDARRAY_INT64:
+      return &dispatch<clbk<int64_t, int64_t>>::object;
+    case NDARRAY_UINT64:
+      return &dispatch<clbk<uint64_t, uint64_t>>::object;
+
+    case NDARRAY_BOOL:
+      return &dispatch<clbk<bool, bool>>::object;
+
+    case NDARRAY_COMPLEX64:
+      return &dispatch<clbk<c64, c64>>::object;
+    case NDARRAY_COMPLEX128:
+      return &dispatch<clbk<c128, c128>>::object;
+
+    default:
+      return nullptr;
+  }
+}
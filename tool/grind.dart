@@ -9,6 +9,7 @@ import 'package:grinder/grinder.dart';
 
 import 'contributors.dart';
 import 'copyright.dart';
+import 'loops.dart';
 import 'utils.dart';
 
 main(args) => grind(args);
@@ -47,6 +48,25 @@ void format() {
   }
 }
 
+@Task('Generate/update the unary ndarray loops.')
+void loops() {
+  final header = File('src/templates/header.txt').readAsStringSync();
+  final source = File('src/templates/source.txt').readAsStringSync();
+  final sigs = signatures(ctypes.keys.map((dtype) => dtype.name).toList());
+  for (final sig in sigs) {
+    log('Generating the $sig loops...');
+    final args = loopArguments(sig);
+    File('src/include/ndarray/base/unary/$sig.h')
+        .writeAsStringSync(renderTemplate(header, args));
+    File('src/unary_$sig.cpp').writeAsStringSync(renderTemplate(source, args));
+  }
+  log('Updating the loop declarations and sources...');
+  replaceSection('src/include/ndarray/base/unary.h', '// BEGIN LOOPS',
+      '// END LOOPS', sigs.map((sig) => '#include "unary/$sig.h"').toList());
+  replaceSection('src/CMakeLists.txt', '# BEGIN LOOPS', '  # END LOOPS',
+      sigs.map((sig) => '  "unary_$sig.cpp"').toList());
+}
+
 @Task('Deploy stuff.')
 @Depends(build)
 void deploy() {
@@ -5,6 +5,49 @@
 
 import 'package:ndarray/ndarray.dart';
 
+/// C type information for a data type supported by the loop templates.
+class CType {
+  /// C type of ndarray elements.
+  final String name;
+
+  /// Number of bytes per element.
+  final int bytesPerElement;
+
+  /// Header file declaring [name], if any.
+  final String? include;
+
+  /// Body of the example callback.
+  final String callbackBody;
+
+  const CType(this.name, this.bytesPerElement,
+      {this.include, this.callbackBody = 'return x * 10;'});
+}
+
+/// C types of the data types for which loops may be generated.
+const Map<DType, CType> ctypes = {
+  DType.bool: CType('bool', 1,
+      include: '<stdbool.h>', callbackBody: 'return !x;'),
+  DType.int8: CType('int8_t', 1),
+  DType.uInt8: CType('uint8_t', 1),
+  DType.uInt8C: CType('uint8_t', 1),
+  DType.int16: CType('int16_t', 2),
+  DType.uInt16: CType('uint16_t', 2),
+  DType.int32: CType('int32_t', 4),
+  DType.uInt32: CType('uint32_t', 4),
+  DType.int64: CType('int64_t', 8),
+  DType.uInt64: CType('uint64_t', 8),
+  DType.float32: CType('float', 4),
+  DType.float64: CType('double', 8),
+  DType.complex64: CType('ndarray_complex64_t', 8,
+      include: '"ndarray/complex/float32.h"', callbackBody: 'return x;'),
+  DType.complex128: CType('ndarray_complex128_t', 16,
+      include: '"ndarray/complex/float64.h"', callbackBody: 'return x;'),
+};
+
+/// Maximum number of dimensions for which the templates define loops (see
+/// `nd::unary::max_rank`).
+const int maxRank = 10;
+
 /// Generates a list of loop signatures from a list of [dtypes] names.
 List<String> signatures(List<String> dtypes) {
   // Generate the list of signatures:
@@ -21,3 +64,108 @@ List<String> signatures(List<String> dtypes) {
   out.sort();
   return out;
 }
+
+/// Resolves the data type having the single-letter abbreviation [char].
+DType _dtype(String char) {
+  return ctypes.keys.firstWhere((dtype) => dtype.char == char,
+      orElse: () => throw ArgumentError.value(
+          char, 'char', 'Unsupported data type abbreviation'));
+}
+
+/// Returns the upper-case C enumeration name of a [dtype] (e.g., `FLOAT64`).
+String _enumName(DType dtype) {
+  return dtype.name.toUpperCase();
+}
+
+/// Returns the shape of the example ndarrays having [ndims] dimensions.
+///
+/// Example ndarrays contain four elements, such that leading dimensions are
+/// singleton dimensions (e.g., `[1, 2, 2]`).
+List<int> _shape(int ndims) {
+  if (ndims == 0) {
+    return [];
+  }
+  if (ndims == 1) {
+    return [4];
+  }
+  return List.filled(ndims - 2, 1) + [2, 2];
+}
+
+/// Returns the row-major strides of an example ndarray having [ndims]
+/// dimensions and [bytesPerElement] bytes per element.
+List<int> _strides(int ndims, int bytesPerElement) {
+  final shape = _shape(ndims);
+  final out = List.filled(ndims, 0);
+  var stride = bytesPerElement;
+  for (var i = ndims - 1; i >= 0; i--) {
+    out[i] = stride;
+    stride *= shape[i];
+  }
+  return out;
+}
+
+/// Returns a zero-filled byte array for an example ndarray.
+List<int> _bytes(int ndims, int bytesPerElement) {
+  final length = _shape(ndims).fold(1, (a, b) => a * b);
+  return List.filled(length * bytesPerElement, 0);
+}
+
+/// Returns a C array initializer (e.g., `{2, 2}`) containing [values].
+///
+/// The templates reference initializers using triple mustaches (e.g.,
+/// `{{{NDARRAY_SHAPE_2D}}}`), which render values as is, such that the braces
+/// must be part of the values.
+String _initializer(List<int> values) {
+  return '{${values.join(', ')}}';
+}
+
+/// Generates the template arguments for rendering the loops having a given
+/// [signature] (e.g., `d_d`).
+///
+/// The returned map fills the placeholders in `src/templates/header.txt` and
+/// `src/templates/source.txt`.
+Map<String, String> loopArguments(String signature) {
+  final chars = signature.split('_');
+  if (chars.length != 2) {
+    throw ArgumentError.value(
+        signature, 'signature', 'Expected an input and an output data type');
+  }
+  final input = _dtype(chars[0]);
+  final output = _dtype(chars[1]);
+  final x = ctypes[input]!;
+  final y = ctypes[output]!;
+
+  // Resolve the headers declaring the element types:
+  final includes = <String>{
+    if (x.include != null) x.include!,
+    if (y.include != null) y.include!,
+  }.map((header) => '\n#include $header').join();
+
+  final args = <String, String>{
+    'SIGNATURE': signature,
+    'INCLUDE_GUARD': signature.toUpperCase(),
+    'INCLUDES': includes,
+    'EXAMPLE_INCLUDES': includes.replaceAll('\n', '\n * '),
+    'INPUT_NDARRAY_1_CTYPE': x.name,
+    'OUTPUT_NDARRAY_CTYPE': y.name,
+    'INPUT_NDARRAY_1_DTYPE_UPPER': _enumName(input),
+    'OUTPUT_NDARRAY_DTYPE_UPPER': _enumName(output),
+    'INPUT_NDARRAY_1_BYTES_PER_ELEMENT': _initializer([x.bytesPerElement]),
+    'OUTPUT_NDARRAY_BYTES_PER_ELEMENT': _initializer([y.bytesPerElement]),
+    'CALLBACK_PARAM_1_DTYPE': x.name,
+    'CALLBACK_RETURN_DTYPE': y.name,
+    'CALLBACK_BODY': x.callbackBody,
+  };
+  for (var ndims = 0; ndims <= maxRank; ndims++) {
+    args['NDARRAY_SHAPE_${ndims}D'] = _initializer(_shape(ndims));
+    args['INPUT_NDARRAY_1_BYTES_${ndims}D'] =
+        _initializer(_bytes(ndims, x.bytesPerElement));
+    args['OUTPUT_NDARRAY_BYTES_${ndims}D'] =
+        _initializer(_bytes(ndims, y.bytesPerElement));
+    args['INPUT_NDARRAY_1_STRIDES_${ndims}D'] =
+        _initializer(_strides(ndims, x.bytesPerElement));
+    args['OUTPUT_NDARRAY_STRIDES_${ndims}D'] =
+        _initializer(_strides(ndims, y.bytesPerElement));
+  }
+  return args;
+}
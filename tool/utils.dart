@@ -24,3 +24,19 @@ String renderTemplate(String templateString, Map<String, String> arguments) {
   return mustache.Template(templateString, htmlEscapeValues: false)
       .renderString(arguments);
 }
+
+/// Replaces the content between the [begin] and [end] markers of the file at
+/// [filePath] with the given [lines].
+void replaceSection(
+    String filePath, String begin, String end, List<String> lines) {
+  final file = File(filePath);
+  final text = file.readAsStringSync();
+  final start = text.indexOf(begin);
+  final stop = text.indexOf(end, start);
+  if (start < 0 || stop < 0) {
+    throw StateError('Missing "$begin" or "$end" in $filePath.');
+  }
+  final content = lines.map((line) => '$line\n').join();
+  file.writeAsStringSync(
+      text.replaceRange(start + begin.length, stop, '\n$content'));
+}